@@ -597,6 +597,7 @@ struct d2d_geometry
 HRESULT d2d_ellipse_geometry_init(struct d2d_geometry *geometry,
         ID2D1Factory *factory, const D2D1_ELLIPSE *ellipse);
 void d2d_path_geometry_init(struct d2d_geometry *geometry, ID2D1Factory *factory);
+void d2d_fill_cache_cleanup(void);
 HRESULT d2d_rectangle_geometry_init(struct d2d_geometry *geometry,
         ID2D1Factory *factory, const D2D1_RECT_F *rect);
 HRESULT d2d_rounded_rectangle_geometry_init(struct d2d_geometry *geometry,
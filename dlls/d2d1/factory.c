@@ -1662,7 +1662,15 @@ static void d2d_settings_init(void)
 
 BOOL WINAPI DllMain(HINSTANCE inst, DWORD reason, void *reserved)
 {
-    if (reason == DLL_PROCESS_ATTACH)
-        d2d_settings_init();
+    switch (reason)
+    {
+        case DLL_PROCESS_ATTACH:
+            d2d_settings_init();
+            break;
+        case DLL_PROCESS_DETACH:
+            if (reserved) break;
+            d2d_fill_cache_cleanup();
+            break;
+    }
     return TRUE;
 }
@@ -2279,12 +2279,342 @@ done:
     return ret;
 }
 
+/* Applications tend to build the same path geometries over and over again,
+ * so keep the results of recent triangulations around. Entries are keyed on
+ * the fill mode and the vertices of the filled figures. */
+#define D2D_FILL_CACHE_BUCKET_COUNT 256
+#define D2D_FILL_CACHE_MAX_SIZE     (4 * 1024 * 1024)
+
+struct d2d_fill_cache_entry
+{
+    struct list entry;
+    struct list lru_entry;
+    UINT32 hash;
+    D2D1_FILL_MODE fill_mode;
+    size_t size;
+
+    size_t figure_count;
+    size_t *figure_vertex_counts;
+    D2D1_POINT_2F *figure_vertices;
+
+    size_t vertex_count;
+    D2D1_POINT_2F *vertices;
+    size_t face_count;
+    struct d2d_face *faces;
+};
+
+static struct list d2d_fill_cache_buckets[D2D_FILL_CACHE_BUCKET_COUNT];
+static struct list d2d_fill_cache_lru = LIST_INIT(d2d_fill_cache_lru);
+static size_t d2d_fill_cache_size;
+
+static CRITICAL_SECTION d2d_fill_cache_cs;
+static CRITICAL_SECTION_DEBUG d2d_fill_cache_cs_debug =
+{
+    0, 0, &d2d_fill_cache_cs,
+    {&d2d_fill_cache_cs_debug.ProcessLocksList, &d2d_fill_cache_cs_debug.ProcessLocksList},
+    0, 0, {(DWORD_PTR)(__FILE__ ": d2d_fill_cache_cs")}
+};
+static CRITICAL_SECTION d2d_fill_cache_cs = {&d2d_fill_cache_cs_debug, -1, 0, 0, 0, 0};
+
+static UINT32 d2d_fill_cache_hash_data(UINT32 hash, const void *data, size_t size)
+{
+    const BYTE *p = data;
+    size_t i;
+
+    for (i = 0; i < size; ++i)
+        hash = (hash ^ p[i]) * 0x01000193;
+    return hash;
+}
+
+static UINT32 d2d_fill_cache_hash(const struct d2d_geometry *geometry)
+{
+    const struct d2d_figure *figure;
+    UINT32 hash = 0x811c9dc5;
+    size_t i;
+
+    hash = d2d_fill_cache_hash_data(hash, &geometry->u.path.fill_mode, sizeof(geometry->u.path.fill_mode));
+    for (i = 0; i < geometry->u.path.figure_count; ++i)
+    {
+        figure = &geometry->u.path.figures[i];
+        if (figure->flags & D2D_FIGURE_FLAG_HOLLOW)
+            continue;
+        hash = d2d_fill_cache_hash_data(hash, &figure->vertex_count, sizeof(figure->vertex_count));
+        hash = d2d_fill_cache_hash_data(hash, figure->vertices, figure->vertex_count * sizeof(*figure->vertices));
+    }
+
+    return hash;
+}
+
+static BOOL d2d_fill_cache_entry_matches(const struct d2d_fill_cache_entry *entry,
+        const struct d2d_geometry *geometry, UINT32 hash)
+{
+    const struct d2d_figure *figure;
+    const D2D1_POINT_2F *v;
+    size_t i, j;
+
+    if (entry->hash != hash || entry->fill_mode != geometry->u.path.fill_mode)
+        return FALSE;
+
+    for (i = 0, j = 0, v = entry->figure_vertices; i < geometry->u.path.figure_count; ++i)
+    {
+        figure = &geometry->u.path.figures[i];
+        if (figure->flags & D2D_FIGURE_FLAG_HOLLOW)
+            continue;
+        if (j == entry->figure_count || entry->figure_vertex_counts[j] != figure->vertex_count
+                || memcmp(v, figure->vertices, figure->vertex_count * sizeof(*v)))
+            return FALSE;
+        v += figure->vertex_count;
+        ++j;
+    }
+
+    return j == entry->figure_count;
+}
+
+static void d2d_fill_cache_remove(struct d2d_fill_cache_entry *entry)
+{
+    list_remove(&entry->entry);
+    list_remove(&entry->lru_entry);
+    d2d_fill_cache_size -= entry->size;
+    free(entry);
+}
+
+/* Copy the fill of a previously triangulated geometry with the same figures. */
+static BOOL d2d_fill_cache_lookup(struct d2d_geometry *geometry, UINT32 hash)
+{
+    struct list *bucket = &d2d_fill_cache_buckets[hash % D2D_FILL_CACHE_BUCKET_COUNT];
+    struct d2d_fill_cache_entry *entry;
+    D2D1_POINT_2F *vertices;
+    struct d2d_face *faces;
+
+    EnterCriticalSection(&d2d_fill_cache_cs);
+
+    if (!bucket->next)
+        list_init(bucket);
+
+    LIST_FOR_EACH_ENTRY(entry, bucket, struct d2d_fill_cache_entry, entry)
+    {
+        if (!d2d_fill_cache_entry_matches(entry, geometry, hash))
+            continue;
+
+        vertices = malloc(entry->vertex_count * sizeof(*vertices));
+        faces = malloc(max(entry->face_count, 1) * sizeof(*faces));
+        if (!vertices || !faces)
+        {
+            free(vertices);
+            free(faces);
+            break;
+        }
+        memcpy(vertices, entry->vertices, entry->vertex_count * sizeof(*vertices));
+        memcpy(faces, entry->faces, entry->face_count * sizeof(*faces));
+
+        geometry->fill.vertices = vertices;
+        geometry->fill.vertex_count = entry->vertex_count;
+        geometry->fill.faces = faces;
+        geometry->fill.faces_size = max(entry->face_count, 1);
+        geometry->fill.face_count = entry->face_count;
+
+        list_remove(&entry->lru_entry);
+        list_add_head(&d2d_fill_cache_lru, &entry->lru_entry);
+        LeaveCriticalSection(&d2d_fill_cache_cs);
+        return TRUE;
+    }
+
+    LeaveCriticalSection(&d2d_fill_cache_cs);
+    return FALSE;
+}
+
+static void d2d_fill_cache_add(const struct d2d_geometry *geometry, UINT32 hash)
+{
+    size_t figure_count, figure_vertex_count, size, i, j;
+    struct d2d_fill_cache_entry *entry;
+    const struct d2d_figure *figure;
+    struct list *bucket, *tail;
+    D2D1_POINT_2F *v;
+
+    for (i = 0, figure_count = 0, figure_vertex_count = 0; i < geometry->u.path.figure_count; ++i)
+    {
+        if (geometry->u.path.figures[i].flags & D2D_FIGURE_FLAG_HOLLOW)
+            continue;
+        figure_vertex_count += geometry->u.path.figures[i].vertex_count;
+        ++figure_count;
+    }
+
+    size = sizeof(*entry) + figure_count * sizeof(*entry->figure_vertex_counts)
+            + (figure_vertex_count + geometry->fill.vertex_count) * sizeof(*v)
+            + geometry->fill.face_count * sizeof(*entry->faces);
+    /* Don't let a single huge geometry push out everything else. */
+    if (size > D2D_FILL_CACHE_MAX_SIZE / 16)
+        return;
+
+    if (!(entry = malloc(size)))
+        return;
+    entry->hash = hash;
+    entry->fill_mode = geometry->u.path.fill_mode;
+    entry->size = size;
+    entry->figure_count = figure_count;
+    entry->figure_vertex_counts = (size_t *)(entry + 1);
+    entry->figure_vertices = (D2D1_POINT_2F *)(entry->figure_vertex_counts + figure_count);
+    entry->vertex_count = geometry->fill.vertex_count;
+    entry->vertices = entry->figure_vertices + figure_vertex_count;
+    entry->face_count = geometry->fill.face_count;
+    entry->faces = (struct d2d_face *)(entry->vertices + entry->vertex_count);
+
+    for (i = 0, j = 0, v = entry->figure_vertices; i < geometry->u.path.figure_count; ++i)
+    {
+        figure = &geometry->u.path.figures[i];
+        if (figure->flags & D2D_FIGURE_FLAG_HOLLOW)
+            continue;
+        entry->figure_vertex_counts[j++] = figure->vertex_count;
+        memcpy(v, figure->vertices, figure->vertex_count * sizeof(*v));
+        v += figure->vertex_count;
+    }
+    memcpy(entry->vertices, geometry->fill.vertices, entry->vertex_count * sizeof(*entry->vertices));
+    memcpy(entry->faces, geometry->fill.faces, entry->face_count * sizeof(*entry->faces));
+
+    bucket = &d2d_fill_cache_buckets[hash % D2D_FILL_CACHE_BUCKET_COUNT];
+
+    EnterCriticalSection(&d2d_fill_cache_cs);
+
+    if (!bucket->next)
+        list_init(bucket);
+    list_add_head(bucket, &entry->entry);
+    list_add_head(&d2d_fill_cache_lru, &entry->lru_entry);
+    d2d_fill_cache_size += size;
+
+    while (d2d_fill_cache_size > D2D_FILL_CACHE_MAX_SIZE && (tail = list_tail(&d2d_fill_cache_lru)))
+        d2d_fill_cache_remove(LIST_ENTRY(tail, struct d2d_fill_cache_entry, lru_entry));
+
+    LeaveCriticalSection(&d2d_fill_cache_cs);
+}
+
+void d2d_fill_cache_cleanup(void)
+{
+    struct list *tail;
+
+    EnterCriticalSection(&d2d_fill_cache_cs);
+    while ((tail = list_tail(&d2d_fill_cache_lru)))
+        d2d_fill_cache_remove(LIST_ENTRY(tail, struct d2d_fill_cache_entry, lru_entry));
+    LeaveCriticalSection(&d2d_fill_cache_cs);
+}
+
+/* A single convex figure can be filled with a simple triangle fan. The figure
+ * is convex if it only ever turns in one direction, never doubles back on
+ * itself, and its edges change horizontal direction at most twice. */
+static HRESULT d2d_path_geometry_triangulate_convex(struct d2d_geometry *geometry, BOOL *done)
+{
+    const struct d2d_figure *figure = NULL;
+    size_t vertex_count, face_count, i;
+    D2D1_POINT_2F prev, next, *vertices;
+    int turn = 0, x_dir = 0, first_x_dir = 0;
+    unsigned int x_dir_changes = 0;
+    struct d2d_face *faces;
+    float cross, area;
+
+    *done = FALSE;
+
+    for (i = 0; i < geometry->u.path.figure_count; ++i)
+    {
+        if (geometry->u.path.figures[i].flags & D2D_FIGURE_FLAG_HOLLOW)
+            continue;
+        if (figure)
+            return S_OK;
+        figure = &geometry->u.path.figures[i];
+    }
+
+    if (!figure || (vertex_count = figure->vertex_count) > 0xffff)
+        return S_OK;
+
+    /* Find the last edge that isn't degenerate. */
+    for (i = vertex_count - 1; i; --i)
+    {
+        d2d_point_subtract(&prev, &figure->vertices[0], &figure->vertices[i]);
+        if (prev.x != 0.0f || prev.y != 0.0f)
+            break;
+    }
+    if (!i)
+        return S_OK;
+
+    for (i = 0; i < vertex_count; ++i)
+    {
+        d2d_point_subtract(&next, &figure->vertices[(i + 1) % vertex_count], &figure->vertices[i]);
+        if (next.x == 0.0f && next.y == 0.0f)
+            continue;
+
+        cross = prev.x * next.y - prev.y * next.x;
+        if (cross > 0.0f)
+        {
+            if (turn < 0)
+                return S_OK;
+            turn = 1;
+        }
+        else if (cross < 0.0f)
+        {
+            if (turn > 0)
+                return S_OK;
+            turn = -1;
+        }
+        else if (d2d_point_dot(&prev, &next) < 0.0f)
+        {
+            return S_OK;
+        }
+
+        if (next.x != 0.0f)
+        {
+            if (!first_x_dir)
+                first_x_dir = next.x > 0.0f ? 1 : -1;
+            else if ((next.x > 0.0f ? 1 : -1) != x_dir)
+                ++x_dir_changes;
+            x_dir = next.x > 0.0f ? 1 : -1;
+        }
+
+        prev = next;
+    }
+    if (x_dir != first_x_dir)
+        ++x_dir_changes;
+    if (x_dir_changes > 2)
+        return S_OK;
+
+    if (!(vertices = malloc(vertex_count * sizeof(*vertices))))
+        return E_OUTOFMEMORY;
+    if (!(faces = malloc(max(vertex_count - 2, 1) * sizeof(*faces))))
+    {
+        free(vertices);
+        return E_OUTOFMEMORY;
+    }
+    memcpy(vertices, figure->vertices, vertex_count * sizeof(*vertices));
+
+    for (i = 2, face_count = 0; i < vertex_count; ++i)
+    {
+        d2d_point_subtract(&prev, &vertices[i - 1], &vertices[0]);
+        d2d_point_subtract(&next, &vertices[i], &vertices[0]);
+        area = prev.x * next.y - prev.y * next.x;
+        if (area == 0.0f)
+            continue;
+        if (area > 0.0f)
+            d2d_face_set(&faces[face_count++], 0, i - 1, i);
+        else
+            d2d_face_set(&faces[face_count++], 0, i, i - 1);
+    }
+
+    geometry->fill.vertices = vertices;
+    geometry->fill.vertex_count = vertex_count;
+    geometry->fill.faces = faces;
+    geometry->fill.faces_size = max(vertex_count - 2, 1);
+    geometry->fill.face_count = face_count;
+    *done = TRUE;
+
+    return S_OK;
+}
+
 static HRESULT d2d_path_geometry_triangulate(struct d2d_geometry *geometry)
 {
     struct d2d_cdt_edge_ref left_edge, right_edge;
     size_t vertex_count, i, j;
     struct d2d_cdt cdt = {0};
     D2D1_POINT_2F *vertices;
+    BOOL done;
+    UINT32 hash;
+    HRESULT hr;
 #ifdef __i386__
     unsigned int control_word_x87, mask = 0;
 #endif
@@ -2302,6 +2632,13 @@ static HRESULT d2d_path_geometry_triangulate(struct d2d_geometry *geometry)
         return S_OK;
     }
 
+    if (FAILED(hr = d2d_path_geometry_triangulate_convex(geometry, &done)) || done)
+        return hr;
+
+    hash = d2d_fill_cache_hash(geometry);
+    if (d2d_fill_cache_lookup(geometry, hash))
+        return S_OK;
+
     if (!(vertices = calloc(vertex_count, sizeof(*vertices))))
         return E_OUTOFMEMORY;
 
@@ -2356,6 +2693,7 @@ static HRESULT d2d_path_geometry_triangulate(struct d2d_geometry *geometry)
         goto fail;
 
     free(cdt.edges);
+    d2d_fill_cache_add(geometry, hash);
     return S_OK;
 
 fail:
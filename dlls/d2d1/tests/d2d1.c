@@ -4073,6 +4073,34 @@ static void test_path_geometry(BOOL d3d11)
     ID2D1TransformedGeometry_Release(transformed_geometry);
     ID2D1PathGeometry_Release(geometry);
 
+    /* A second geometry with the same figures. */
+    hr = ID2D1Factory_CreatePathGeometry(factory, &geometry);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    hr = ID2D1PathGeometry_Open(geometry, &sink);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    fill_geometry_sink(sink, 0);
+    hr = ID2D1GeometrySink_Close(sink);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    ID2D1GeometrySink_Release(sink);
+
+    set_matrix_identity(&matrix);
+    translate_matrix(&matrix, 80.0f, 640.0f);
+    scale_matrix(&matrix, 1.0f, -1.0f);
+    hr = ID2D1Factory_CreateTransformedGeometry(factory, (ID2D1Geometry *)geometry, &matrix, &transformed_geometry);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+
+    ID2D1RenderTarget_BeginDraw(rt);
+    ID2D1RenderTarget_Clear(rt, &color);
+    ID2D1RenderTarget_FillGeometry(rt, (ID2D1Geometry *)geometry, (ID2D1Brush *)brush, NULL);
+    ID2D1RenderTarget_FillGeometry(rt, (ID2D1Geometry *)transformed_geometry, (ID2D1Brush *)brush, NULL);
+    hr = ID2D1RenderTarget_EndDraw(rt, NULL, NULL);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    match = compare_surface(&ctx, "3aace1b22aae111cb577614fed16e4eb1650dba5");
+    ok(match, "Surface does not match.\n");
+
+    ID2D1TransformedGeometry_Release(transformed_geometry);
+    ID2D1PathGeometry_Release(geometry);
+
     hr = ID2D1Factory_CreatePathGeometry(factory, &geometry);
     ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
     hr = ID2D1PathGeometry_Open(geometry, &sink);
@@ -4431,6 +4459,117 @@ static void test_path_geometry(BOOL d3d11)
     release_test_context(&ctx);
 }
 
+static void test_path_geometry_fill(BOOL d3d11)
+{
+    struct d2d1_test_context ctx;
+    ID2D1SolidColorBrush *brush;
+    ID2D1PathGeometry *geometry;
+    struct resource_readback rb;
+    ID2D1GeometrySink *sink;
+    unsigned int i, j, k;
+    ID2D1RenderTarget *rt;
+    D2D1_COLOR_F color;
+    HRESULT hr;
+
+    static const struct
+    {
+        D2D1_FILL_MODE fill_mode;
+        unsigned int point_count;
+        D2D1_POINT_2F points[8];
+        struct
+        {
+            unsigned int x, y;
+            DWORD colour;
+        }
+        probes[4];
+    }
+    tests[] =
+    {
+        /* Convex. */
+        {
+            D2D1_FILL_MODE_ALTERNATE, 6,
+            {{100.0f, 40.0f}, {180.0f, 40.0f}, {220.0f, 120.0f}, {180.0f, 200.0f}, {100.0f, 200.0f}, {60.0f, 120.0f}},
+            {{140, 120, 0xffffffff}, {70, 120, 0xffffffff}, {65, 50, 0xff000000}, {215, 195, 0xff000000}},
+        },
+        /* Concave. */
+        {
+            D2D1_FILL_MODE_ALTERNATE, 8,
+            {{300.0f, 40.0f}, {340.0f, 40.0f}, {340.0f, 160.0f}, {400.0f, 160.0f},
+             {400.0f, 40.0f}, {440.0f, 40.0f}, {440.0f, 200.0f}, {300.0f, 200.0f}},
+            {{320, 100, 0xffffffff}, {420, 100, 0xffffffff}, {370, 180, 0xffffffff}, {370, 100, 0xff000000}},
+        },
+        /* Star. */
+        {
+            D2D1_FILL_MODE_ALTERNATE, 5,
+            {{140.0f, 240.0f}, {199.0f, 421.0f}, {45.0f, 309.0f}, {235.0f, 309.0f}, {81.0f, 421.0f}},
+            {{140, 265, 0xffffffff}, {60, 313, 0xffffffff}, {140, 340, 0xff000000}, {60, 260, 0xff000000}},
+        },
+        {
+            D2D1_FILL_MODE_WINDING, 5,
+            {{140.0f, 240.0f}, {199.0f, 421.0f}, {45.0f, 309.0f}, {235.0f, 309.0f}, {81.0f, 421.0f}},
+            {{140, 265, 0xffffffff}, {60, 313, 0xffffffff}, {140, 340, 0xffffffff}, {60, 260, 0xff000000}},
+        },
+    };
+
+    if (!init_test_context(&ctx, d3d11))
+        return;
+
+    rt = ctx.rt;
+    ID2D1RenderTarget_SetDpi(rt, 96.0f, 96.0f);
+    ID2D1RenderTarget_SetAntialiasMode(rt, D2D1_ANTIALIAS_MODE_ALIASED);
+    set_color(&color, 1.0f, 1.0f, 1.0f, 1.0f);
+    hr = ID2D1RenderTarget_CreateSolidColorBrush(rt, &color, NULL, &brush);
+    ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+    set_color(&color, 0.0f, 0.0f, 0.0f, 1.0f);
+
+    for (i = 0; i < ARRAY_SIZE(tests); ++i)
+    {
+        winetest_push_context("Test %u", i);
+
+        /* The second geometry has the same figure, and may reuse the fill of the first one. */
+        for (j = 0; j < 2; ++j)
+        {
+            hr = ID2D1Factory_CreatePathGeometry(ctx.factory, &geometry);
+            ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+            hr = ID2D1PathGeometry_Open(geometry, &sink);
+            ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+            ID2D1GeometrySink_SetFillMode(sink, tests[i].fill_mode);
+            ID2D1GeometrySink_BeginFigure(sink, tests[i].points[0], D2D1_FIGURE_BEGIN_FILLED);
+            for (k = 1; k < tests[i].point_count; ++k)
+                line_to(sink, tests[i].points[k].x, tests[i].points[k].y);
+            ID2D1GeometrySink_EndFigure(sink, D2D1_FIGURE_END_CLOSED);
+            hr = ID2D1GeometrySink_Close(sink);
+            ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+            ID2D1GeometrySink_Release(sink);
+
+            ID2D1RenderTarget_BeginDraw(rt);
+            ID2D1RenderTarget_Clear(rt, &color);
+            ID2D1RenderTarget_FillGeometry(rt, (ID2D1Geometry *)geometry, (ID2D1Brush *)brush, NULL);
+            hr = ID2D1RenderTarget_EndDraw(rt, NULL, NULL);
+            ok(hr == S_OK, "Got unexpected hr %#lx.\n", hr);
+
+            get_surface_readback(&ctx, &rb);
+            for (k = 0; k < ARRAY_SIZE(tests[i].probes); ++k)
+            {
+                DWORD colour;
+
+                colour = get_readback_colour(&rb, tests[i].probes[k].x, tests[i].probes[k].y);
+                ok(compare_colour(colour, tests[i].probes[k].colour, 1),
+                        "Got unexpected colour 0x%08lx at position {%u, %u}.\n",
+                        colour, tests[i].probes[k].x, tests[i].probes[k].y);
+            }
+            release_resource_readback(&rb);
+
+            ID2D1PathGeometry_Release(geometry);
+        }
+
+        winetest_pop_context();
+    }
+
+    ID2D1SolidColorBrush_Release(brush);
+    release_test_context(&ctx);
+}
+
 static void test_rectangle_geometry(BOOL d3d11)
 {
     ID2D1TransformedGeometry *transformed_geometry;
@@ -15137,6 +15276,7 @@ START_TEST(d2d1)
     queue_test(test_linear_brush);
     queue_test(test_radial_brush);
     queue_test(test_path_geometry);
+    queue_test(test_path_geometry_fill);
     queue_d3d10_test(test_rectangle_geometry);
     queue_d3d10_test(test_rounded_rectangle_geometry);
     queue_test(test_bitmap_formats);
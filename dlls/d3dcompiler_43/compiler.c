@@ -24,6 +24,7 @@
 #include "wine/debug.h"
 
 #include "d3dcompiler_private.h"
+#include "wine/wined3d.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(d3dcompiler);
 
@@ -52,8 +53,9 @@ static HRESULT hresult_from_vkd3d_result(int vkd3d_result)
 
 #define D3DXERR_INVALIDDATA                      0x88760b59
 
-/* Mutex used to guarantee a single invocation of the D3DAssemble function at
- * a time. This is needed as the assembler isn't thread-safe. */
+/* Mutex used to guarantee a single invocation of the assembler at a time.
+ * This is needed as the assembler isn't thread-safe; the vkd3d preprocessor
+ * is, so it runs outside of the lock. */
 static CRITICAL_SECTION wpp_mutex;
 static CRITICAL_SECTION_DEBUG wpp_mutex_debug =
 {
@@ -171,6 +173,235 @@ static void close_include(const struct vkd3d_shader_code *code, void *context)
     ID3DInclude_Close(iface, code->code);
 }
 
+struct compile_include
+{
+    char *filename;
+    bool local;
+    const void *data;
+    unsigned int size;
+};
+
+/* With the shader cache in use, include files are opened while preprocessing
+ * the source to build the cache key, and the compilation replays them in the
+ * same order. The application's buffers are passed on as is, so nested
+ * includes see them as parent data, and they are only closed, innermost first,
+ * once the compilation is done. */
+struct compile_includes
+{
+    ID3DInclude *iface;
+    struct compile_include *includes;
+    size_t count, size;
+    size_t replay_index;
+    bool replay;
+};
+
+static int open_recorded_include(const char *filename, bool local, const char *parent_data, void *context,
+        struct vkd3d_shader_code *code)
+{
+    struct compile_includes *includes = context;
+    struct compile_include *include, *new_includes;
+    size_t new_size;
+
+    if (includes->replay && includes->replay_index < includes->count)
+    {
+        include = &includes->includes[includes->replay_index];
+        if (include->local == local && !strcmp(include->filename, filename))
+        {
+            ++includes->replay_index;
+            code->code = include->data;
+            code->size = include->size;
+            return VKD3D_OK;
+        }
+    }
+
+    if (includes->count == includes->size)
+    {
+        new_size = max(includes->size * 2, 4);
+        if (!(new_includes = realloc(includes->includes, new_size * sizeof(*new_includes))))
+            return VKD3D_ERROR_OUT_OF_MEMORY;
+        includes->includes = new_includes;
+        includes->size = new_size;
+    }
+    include = &includes->includes[includes->count];
+
+    if (open_include(filename, local, parent_data, includes->iface, code))
+        return VKD3D_ERROR;
+    if (!(include->filename = strdup(filename)))
+    {
+        close_include(code, includes->iface);
+        return VKD3D_ERROR_OUT_OF_MEMORY;
+    }
+    include->local = local;
+    include->data = code->code;
+    include->size = code->size;
+    ++includes->count;
+
+    return VKD3D_OK;
+}
+
+static void close_recorded_include(const struct vkd3d_shader_code *code, void *context)
+{
+}
+
+static void compile_includes_cleanup(struct compile_includes *includes)
+{
+    struct vkd3d_shader_code code;
+    size_t i;
+
+    for (i = includes->count; i; --i)
+    {
+        code.code = includes->includes[i - 1].data;
+        code.size = includes->includes[i - 1].size;
+        close_include(&code, includes->iface);
+        free(includes->includes[i - 1].filename);
+    }
+    free(includes->includes);
+}
+
+struct compile_cache_key
+{
+    BYTE *data;
+    size_t size, count;
+    bool valid;
+};
+
+static void compile_cache_key_add(struct compile_cache_key *key, const void *data, size_t size)
+{
+    size_t new_size;
+    BYTE *new_data;
+
+    if (!key->valid || !size)
+        return;
+
+    if (key->count + size > key->size)
+    {
+        new_size = max(max(key->size * 2, key->count + size), 256);
+        if (!(new_data = realloc(key->data, new_size)))
+        {
+            key->valid = false;
+            return;
+        }
+        key->data = new_data;
+        key->size = new_size;
+    }
+    memcpy(key->data + key->count, data, size);
+    key->count += size;
+}
+
+static void compile_cache_key_add_string(struct compile_cache_key *key, const char *str)
+{
+    if (!str)
+        str = "";
+    compile_cache_key_add(key, str, strlen(str) + 1);
+}
+
+/* Compiled shaders are kept in the wined3d shader cache, which also provides
+ * its size limit and location settings. The key covers the preprocessed
+ * source, and with it the macros and the contents of the include files, as
+ * well as everything else that affects the output. Reflection data is part
+ * of the DXBC container, so it doesn't need to be cached separately. */
+static void init_compile_cache_key(struct compile_cache_key *key,
+        const struct vkd3d_shader_compile_info *compile_info,
+        const struct vkd3d_shader_hlsl_source_info *hlsl_info, UINT flags, UINT effect_flags)
+{
+    static const unsigned int compiler_version = D3D_COMPILER_VERSION;
+    struct vkd3d_shader_code preprocessed;
+    char *messages;
+    int ret;
+
+    memset(key, 0, sizeof(*key));
+
+    ret = vkd3d_shader_preprocess(compile_info, &preprocessed, &messages);
+    vkd3d_shader_free_messages(messages);
+    if (ret)
+        return;
+
+    key->valid = true;
+    compile_cache_key_add(key, &compiler_version, sizeof(compiler_version));
+    compile_cache_key_add_string(key, vkd3d_shader_get_version(NULL, NULL));
+    compile_cache_key_add(key, &compile_info->target_type, sizeof(compile_info->target_type));
+    compile_cache_key_add(key, &compile_info->option_count, sizeof(compile_info->option_count));
+    compile_cache_key_add(key, compile_info->options,
+            compile_info->option_count * sizeof(*compile_info->options));
+    compile_cache_key_add(key, &flags, sizeof(flags));
+    compile_cache_key_add(key, &effect_flags, sizeof(effect_flags));
+    compile_cache_key_add_string(key, compile_info->source_name);
+    compile_cache_key_add_string(key, hlsl_info->profile);
+    compile_cache_key_add_string(key, hlsl_info->entry_point);
+    compile_cache_key_add(key, &hlsl_info->secondary_code.size, sizeof(hlsl_info->secondary_code.size));
+    compile_cache_key_add(key, hlsl_info->secondary_code.code, hlsl_info->secondary_code.size);
+    compile_cache_key_add(key, &preprocessed.size, sizeof(preprocessed.size));
+    compile_cache_key_add(key, preprocessed.code, preprocessed.size);
+
+    vkd3d_shader_free_shader_code(&preprocessed);
+}
+
+/* Cache entries hold the size of the shader code, the code itself and the
+ * compiler messages. */
+static bool compile_cache_lookup(const struct compile_cache_key *key,
+        struct vkd3d_shader_code *code, char **messages)
+{
+    SIZE_T size, messages_size;
+    char *messages_data = NULL;
+    uint32_t code_size;
+    void *code_data;
+    BYTE *data;
+
+    if (!key->valid || !wined3d_shader_cache_get("d3dcompiler", key->data, key->count, (void **)&data, &size))
+        return false;
+
+    if (size < sizeof(code_size))
+        goto fail;
+    memcpy(&code_size, data, sizeof(code_size));
+    if (code_size > size - sizeof(code_size))
+        goto fail;
+    messages_size = size - sizeof(code_size) - code_size;
+
+    if (!(code_data = malloc(code_size)))
+        goto fail;
+    if (messages_size && !(messages_data = malloc(messages_size + 1)))
+    {
+        free(code_data);
+        goto fail;
+    }
+    memcpy(code_data, data + sizeof(code_size), code_size);
+    if (messages_data)
+    {
+        memcpy(messages_data, data + sizeof(code_size) + code_size, messages_size);
+        messages_data[messages_size] = 0;
+    }
+    wined3d_shader_cache_free(data);
+
+    code->code = code_data;
+    code->size = code_size;
+    *messages = messages_data;
+    return true;
+
+fail:
+    WARN("Failed to load cache entry.\n");
+    wined3d_shader_cache_free(data);
+    return false;
+}
+
+static void compile_cache_store(const struct compile_cache_key *key,
+        const struct vkd3d_shader_code *code, const char *messages)
+{
+    size_t messages_size = messages ? strlen(messages) : 0;
+    uint32_t code_size = code->size;
+    BYTE *data;
+
+    if (!key->valid || !(data = malloc(sizeof(code_size) + code->size + messages_size)))
+        return;
+
+    memcpy(data, &code_size, sizeof(code_size));
+    memcpy(data + sizeof(code_size), code->code, code->size);
+    if (messages_size)
+        memcpy(data + sizeof(code_size) + code->size, messages, messages_size);
+    wined3d_shader_cache_put("d3dcompiler", key->data, key->count,
+            data, sizeof(code_size) + code->size + messages_size);
+    free(data);
+}
+
 static const char *get_line(const char **ptr)
 {
     const char *p, *q;
@@ -371,8 +602,6 @@ HRESULT WINAPI D3DAssemble(const void *data, SIZE_T datasize, const char *filena
             "shader %p, error_messages %p.\n",
             data, datasize, debugstr_a(filename), defines, include, flags, shader, error_messages);
 
-    EnterCriticalSection(&wpp_mutex);
-
     /* TODO: flags */
     if (flags) FIXME("flags %x\n", flags);
 
@@ -389,11 +618,12 @@ HRESULT WINAPI D3DAssemble(const void *data, SIZE_T datasize, const char *filena
             ID3D10Blob_Release(preproc_shader);
             preproc_terminated[preproc_size] = 0;
 
+            EnterCriticalSection(&wpp_mutex);
             hr = assemble_shader(preproc_terminated, shader, error_messages);
+            LeaveCriticalSection(&wpp_mutex);
             free(preproc_terminated);
         }
     }
-    LeaveCriticalSection(&wpp_mutex);
     return hr;
 }
 
@@ -460,9 +690,12 @@ HRESULT WINAPI D3DCompile2(const void *data, SIZE_T data_size, const char *filen
     struct vkd3d_shader_compile_option options[6];
     struct vkd3d_shader_compile_info compile_info;
     struct vkd3d_shader_compile_option *option;
-    struct vkd3d_shader_code byte_code;
+    struct vkd3d_shader_code byte_code = {0};
+    struct compile_includes includes = {0};
+    struct compile_cache_key key = {0};
     const D3D_SHADER_MACRO *macro;
-    char *messages;
+    char *messages = NULL;
+    bool use_cache, cached = false;
     HRESULT hr;
     int ret;
 
@@ -519,9 +752,19 @@ HRESULT WINAPI D3DCompile2(const void *data, SIZE_T data_size, const char *filen
         for (macro = macros; macro->Name; ++macro)
             ++preprocess_info.macro_count;
     }
-    preprocess_info.pfn_open_include = open_include;
-    preprocess_info.pfn_close_include = close_include;
-    preprocess_info.include_context = include;
+    if ((use_cache = wined3d_shader_cache_enabled()))
+    {
+        preprocess_info.pfn_open_include = open_recorded_include;
+        preprocess_info.pfn_close_include = close_recorded_include;
+        preprocess_info.include_context = &includes;
+        includes.iface = include;
+    }
+    else
+    {
+        preprocess_info.pfn_open_include = open_include;
+        preprocess_info.pfn_close_include = close_include;
+        preprocess_info.include_context = include;
+    }
 
     hlsl_info.type = VKD3D_SHADER_STRUCTURE_TYPE_HLSL_SOURCE_INFO;
     hlsl_info.next = NULL;
@@ -570,7 +813,17 @@ HRESULT WINAPI D3DCompile2(const void *data, SIZE_T data_size, const char *filen
     option->value = true;
 #endif
 
-    ret = vkd3d_shader_compile(&compile_info, &byte_code, &messages);
+    if (use_cache)
+    {
+        init_compile_cache_key(&key, &compile_info, &hlsl_info, flags, effect_flags);
+        cached = compile_cache_lookup(&key, &byte_code, &messages);
+        includes.replay = true;
+    }
+
+    if (cached)
+        ret = VKD3D_OK;
+    else
+        ret = vkd3d_shader_compile(&compile_info, &byte_code, &messages);
 
     if (ret)
         ERR("Failed to compile shader, vkd3d result %d.\n", ret);
@@ -594,44 +847,53 @@ HRESULT WINAPI D3DCompile2(const void *data, SIZE_T data_size, const char *filen
         {
             size_t size = strlen(messages);
             if (FAILED(hr = D3DCreateBlob(size, messages_blob)))
-            {
-                vkd3d_shader_free_messages(messages);
-                vkd3d_shader_free_shader_code(&byte_code);
-                return hr;
-            }
+                goto done;
             memcpy(ID3D10Blob_GetBufferPointer(*messages_blob), messages, size);
         }
-
-        vkd3d_shader_free_messages(messages);
     }
 
     if (ret)
-        return hresult_from_vkd3d_result(ret);
-
-    if (!shader_blob)
     {
-        vkd3d_shader_free_shader_code(&byte_code);
-        return S_OK;
+        hr = hresult_from_vkd3d_result(ret);
+        goto done;
     }
 
     /* Unlike other effect profiles fx_4_x is using DXBC container. */
-    if (!strcmp(profile, "fx_4_0") || !strcmp(profile, "fx_4_1"))
+    if (!cached && (!strcmp(profile, "fx_4_0") || !strcmp(profile, "fx_4_1")))
     {
         struct vkd3d_shader_dxbc_section_desc section = { .tag = TAG_FX10, .data = byte_code };
         struct vkd3d_shader_code dxbc;
 
-        ret = vkd3d_shader_serialize_dxbc(1, &section, &dxbc, NULL);
-        vkd3d_shader_free_shader_code(&byte_code);
-        if (ret)
-            return hresult_from_vkd3d_result(ret);
+        if ((ret = vkd3d_shader_serialize_dxbc(1, &section, &dxbc, NULL)))
+        {
+            hr = hresult_from_vkd3d_result(ret);
+            goto done;
+        }
 
+        vkd3d_shader_free_shader_code(&byte_code);
         byte_code = dxbc;
     }
 
-    if (SUCCEEDED(hr = D3DCreateBlob(byte_code.size, shader_blob)))
+    if (use_cache && !cached)
+        compile_cache_store(&key, &byte_code, messages);
+
+    hr = S_OK;
+    if (shader_blob && SUCCEEDED(hr = D3DCreateBlob(byte_code.size, shader_blob)))
         memcpy(ID3D10Blob_GetBufferPointer(*shader_blob), byte_code.code, byte_code.size);
 
-    vkd3d_shader_free_shader_code(&byte_code);
+done:
+    if (cached)
+    {
+        free((void *)byte_code.code);
+        free(messages);
+    }
+    else
+    {
+        vkd3d_shader_free_shader_code(&byte_code);
+        vkd3d_shader_free_messages(messages);
+    }
+    free(key.data);
+    compile_includes_cleanup(&includes);
 
     return hr;
 }
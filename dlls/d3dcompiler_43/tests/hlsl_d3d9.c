@@ -1815,6 +1815,102 @@ static void test_include(void)
     delete_directory(L"include");
 }
 
+struct test_changing_include
+{
+    ID3DInclude ID3DInclude_iface;
+    const char *data;
+    unsigned int open_count, close_count;
+};
+
+static const char test_changing_include_inner[] = "#define INNER 1\n";
+
+static HRESULT WINAPI test_changing_include_open(ID3DInclude *iface, D3D_INCLUDE_TYPE include_type,
+        const char *filename, const void *parent_data, const void **data, UINT *bytes)
+{
+    struct test_changing_include *include = CONTAINING_RECORD(iface, struct test_changing_include, ID3DInclude_iface);
+
+    if (!strcmp(filename, "inner.h"))
+    {
+        ok(parent_data == include->data, "Got unexpected parent data %p.\n", parent_data);
+        ok(include->close_count == 0, "Got unexpected close count %u.\n", include->close_count);
+        *data = test_changing_include_inner;
+    }
+    else
+    {
+        ok(!strcmp(filename, "value.h"), "Unexpected #include for file %s.\n", filename);
+        ok(!parent_data, "Got unexpected parent data %p.\n", parent_data);
+        *data = include->data;
+    }
+    ++include->open_count;
+    *bytes = strlen(*data);
+    return S_OK;
+}
+
+static HRESULT WINAPI test_changing_include_close(ID3DInclude *iface, const void *data)
+{
+    struct test_changing_include *include = CONTAINING_RECORD(iface, struct test_changing_include, ID3DInclude_iface);
+
+    /* The nested include is closed before its parent. */
+    if (include->close_count++)
+        ok(data == include->data, "Got unexpected data %p.\n", data);
+    else
+        ok(data == test_changing_include_inner, "Got unexpected data %p.\n", data);
+    return S_OK;
+}
+
+static const struct ID3DIncludeVtbl test_changing_include_vtbl =
+{
+    test_changing_include_open,
+    test_changing_include_close
+};
+
+static void test_include_changes(void)
+{
+    struct test_changing_include include = {{&test_changing_include_vtbl}};
+    ID3D10Blob *blobs[3], *errors;
+    unsigned int i;
+    HRESULT hr;
+
+    static const char ps_code[] =
+        "#include \"value.h\"\n"
+        "\n"
+        "float4 main() : COLOR\n"
+        "{\n"
+        "    return VALUE;\n"
+        "}";
+    static const char *const values[] =
+    {
+        "#include \"inner.h\"\n#define VALUE float4(0.25, 0.5, 0.75, 1.0)\n",
+        "#include \"inner.h\"\n#define VALUE float4(0.25, 0.5, 0.75, 1.0)\n",
+        "#include \"inner.h\"\n#define VALUE float4(1.0, 0.75, 0.5, 0.25)\n",
+    };
+
+    /* The output must follow the contents of the included files, even when
+     * the source and the include names are the same. */
+    for (i = 0; i < ARRAY_SIZE(values); ++i)
+    {
+        include.data = values[i];
+        include.open_count = include.close_count = 0;
+        errors = NULL;
+        hr = D3DCompile(ps_code, sizeof(ps_code), NULL, NULL, &include.ID3DInclude_iface,
+                "main", "ps_2_0", 0, 0, &blobs[i], &errors);
+        ok(hr == S_OK, "Test %u: Got unexpected hr %#lx.\n", i, hr);
+        ok(!errors, "Test %u: Got unexpected errors.\n", i);
+        ok(include.open_count == 2, "Test %u: Got unexpected open count %u.\n", i, include.open_count);
+        ok(include.close_count == 2, "Test %u: Got unexpected close count %u.\n", i, include.close_count);
+    }
+
+    ok(ID3D10Blob_GetBufferSize(blobs[0]) == ID3D10Blob_GetBufferSize(blobs[1])
+            && !memcmp(ID3D10Blob_GetBufferPointer(blobs[0]), ID3D10Blob_GetBufferPointer(blobs[1]),
+            ID3D10Blob_GetBufferSize(blobs[0])), "Got different output for identical includes.\n");
+    ok(ID3D10Blob_GetBufferSize(blobs[0]) != ID3D10Blob_GetBufferSize(blobs[2])
+            || memcmp(ID3D10Blob_GetBufferPointer(blobs[0]), ID3D10Blob_GetBufferPointer(blobs[2]),
+            ID3D10Blob_GetBufferSize(blobs[0])), "Got identical output for different includes.\n");
+
+    for (i = 0; i < ARRAY_SIZE(blobs); ++i)
+        ID3D10Blob_Release(blobs[i]);
+}
+
 static void test_no_output_blob(void)
 {
     static const char vs_source[] =
@@ -1864,5 +1960,6 @@ START_TEST(hlsl_d3d9)
     test_constant_table();
     test_fail();
     test_include();
+    test_include_changes();
     test_no_output_blob();
 }
@@ -307,6 +307,10 @@ extern HRESULT create_text_format(const WCHAR *family_name, IDWriteFontCollectio
         DWRITE_FONT_STYLE style, DWRITE_FONT_STRETCH stretch, float size, const WCHAR *locale, REFIID riid,
         void **out);
 extern HRESULT create_textlayout(const struct textlayout_desc*,IDWriteTextLayout**);
+struct shaped_run_cache;
+extern HRESULT create_shaped_run_cache(struct shaped_run_cache **cache);
+extern void release_shaped_run_cache(struct shaped_run_cache *cache);
+extern struct shaped_run_cache *factory_get_shaped_run_cache(IDWriteFactory7 *factory);
 extern HRESULT create_trimmingsign(IDWriteFactory7 *factory, IDWriteTextFormat *format,
         IDWriteInlineObject **sign);
 extern HRESULT create_typography(IDWriteTypography**);
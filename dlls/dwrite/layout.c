@@ -950,7 +950,6 @@ static HRESULT layout_shape_get_glyphs(struct dwrite_textlayout *layout, struct
     unsigned int max_count;
     HRESULT hr;
 
-    run->descr.localeName = get_layout_range_by_pos(layout, run->descr.textPosition)->locale;
     run->clustermap = calloc(run->descr.stringLength, sizeof(*run->clustermap));
     if (!run->clustermap)
         return E_OUTOFMEMORY;
@@ -965,9 +964,6 @@ static HRESULT layout_shape_get_glyphs(struct dwrite_textlayout *layout, struct
     if (!context->text_props || !context->glyph_props)
         return E_OUTOFMEMORY;
 
-    if (FAILED(hr = layout_shape_get_user_features(layout, context)))
-        return hr;
-
     for (;;)
     {
         hr = IDWriteTextAnalyzer2_GetGlyphs(context->analyzer, run->descr.string, run->descr.stringLength, run->run.fontFace,
@@ -1114,26 +1110,393 @@ static HRESULT layout_shape_get_positions(struct dwrite_textlayout *layout, stru
         WARN("%s: failed to get glyph placement info, hr %#lx.\n", debugstr_rundescr(&run->descr), hr);
     }
 
-    if (SUCCEEDED(hr))
-        hr = layout_shape_apply_character_spacing(layout, context);
-
     run->run.glyphAdvances = run->advances;
     run->run.glyphOffsets = run->offsets;
 
     return hr;
 }
 
+/* Shaped runs are cached per factory, so that layouts recreated for the same text
+   don't have to go through the shaping engine again. Cached data is taken before
+   character spacing is applied, spacing is a layout property. */
+#define SHAPED_RUN_CACHE_BUCKET_COUNT 256
+#define SHAPED_RUN_CACHE_MAX_SIZE (2 * 1024 * 1024)
+
+struct shaped_run_key
+{
+    const void *font_key;   /* font file reference key */
+    UINT32 font_key_size;
+    UINT32 face_index;
+    DWRITE_FONT_SIMULATIONS simulations;
+    float em_size;
+    BOOL is_sideways;
+    BOOL is_rtl;
+    DWRITE_SCRIPT_ANALYSIS sa;
+    DWRITE_MEASURING_MODE measuring_mode;
+    float ppdip;
+    DWRITE_MATRIX transform;
+    const WCHAR *text;
+    UINT32 length;
+    const WCHAR *locale;
+    UINT32 locale_length;
+    const UINT32 *features;
+    UINT32 features_length;
+};
+
+struct shaped_run_entry
+{
+    struct list entry;
+    struct list lru_entry;
+    UINT32 hash;
+    size_t size;
+    struct shaped_run_key key;
+
+    UINT32 glyph_count;
+    UINT16 *glyphs;
+    UINT16 *clustermap;
+    float *advances;
+    DWRITE_GLYPH_OFFSET *offsets;
+    DWRITE_SHAPING_GLYPH_PROPERTIES *glyph_props;
+};
+
+struct shaped_run_cache
+{
+    CRITICAL_SECTION cs;
+    struct list buckets[SHAPED_RUN_CACHE_BUCKET_COUNT];
+    struct list lru;
+    size_t size;
+    unsigned int hits;
+    unsigned int misses;
+};
+
+HRESULT create_shaped_run_cache(struct shaped_run_cache **ret)
+{
+    struct shaped_run_cache *cache;
+    unsigned int i;
+
+    *ret = NULL;
+
+    if (!(cache = calloc(1, sizeof(*cache))))
+        return E_OUTOFMEMORY;
+
+    for (i = 0; i < ARRAY_SIZE(cache->buckets); ++i)
+        list_init(&cache->buckets[i]);
+    list_init(&cache->lru);
+    InitializeCriticalSectionEx(&cache->cs, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO);
+    cache->cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": shaped_run_cache.lock");
+
+    *ret = cache;
+    return S_OK;
+}
+
+void release_shaped_run_cache(struct shaped_run_cache *cache)
+{
+    struct shaped_run_entry *entry, *entry2;
+
+    if (!cache) return;
+
+    TRACE("%u hits, %u misses, %Iu bytes in use.\n", cache->hits, cache->misses, cache->size);
+
+    LIST_FOR_EACH_ENTRY_SAFE(entry, entry2, &cache->lru, struct shaped_run_entry, lru_entry)
+        free(entry);
+
+    cache->cs.DebugInfo->Spare[0] = 0;
+    DeleteCriticalSection(&cache->cs);
+    free(cache);
+}
+
+static UINT32 shaped_run_hash_data(UINT32 hash, const void *data, size_t size)
+{
+    const BYTE *p = data;
+    size_t i;
+
+    for (i = 0; i < size; ++i)
+        hash = (hash ^ p[i]) * 0x01000193;
+    return hash;
+}
+
+static UINT32 shaped_run_key_hash(const struct shaped_run_key *key)
+{
+    UINT32 hash = 0x811c9dc5;
+
+    hash = shaped_run_hash_data(hash, key->font_key, key->font_key_size);
+    hash = shaped_run_hash_data(hash, &key->face_index, sizeof(key->face_index));
+    hash = shaped_run_hash_data(hash, &key->em_size, sizeof(key->em_size));
+    hash = shaped_run_hash_data(hash, &key->sa.script, sizeof(key->sa.script));
+    hash = shaped_run_hash_data(hash, key->text, key->length * sizeof(*key->text));
+    hash = shaped_run_hash_data(hash, key->locale, key->locale_length * sizeof(*key->locale));
+    hash = shaped_run_hash_data(hash, key->features, key->features_length * sizeof(*key->features));
+    return hash;
+}
+
+static BOOL shaped_run_key_equal(const struct shaped_run_key *key1, const struct shaped_run_key *key2)
+{
+    return key1->font_key_size == key2->font_key_size
+            && key1->face_index == key2->face_index
+            && key1->simulations == key2->simulations
+            && key1->em_size == key2->em_size
+            && key1->is_sideways == key2->is_sideways
+            && key1->is_rtl == key2->is_rtl
+            && key1->sa.script == key2->sa.script
+            && key1->sa.shapes == key2->sa.shapes
+            && key1->measuring_mode == key2->measuring_mode
+            && key1->ppdip == key2->ppdip
+            && !memcmp(&key1->transform, &key2->transform, sizeof(key1->transform))
+            && key1->length == key2->length
+            && key1->locale_length == key2->locale_length
+            && key1->features_length == key2->features_length
+            && !memcmp(key1->font_key, key2->font_key, key1->font_key_size)
+            && !memcmp(key1->text, key2->text, key1->length * sizeof(*key1->text))
+            && !memcmp(key1->locale, key2->locale, key1->locale_length * sizeof(*key1->locale))
+            && !memcmp(key1->features, key2->features, key1->features_length * sizeof(*key1->features));
+}
+
+/* Font faces are identified by their file reference key rather than by pointer, so that entries
+   survive font face objects being released and created again. Only local font files are cached,
+   their keys identify the file on their own. User features are flattened to a sequence of range
+   length, feature count and tag/parameter pairs. */
+static HRESULT shaped_run_key_init(struct shaped_run_key *key, const struct dwrite_textlayout *layout,
+        const struct shaping_context *context)
+{
+    const struct regular_layout_run *run = context->run;
+    const DWRITE_TYPOGRAPHIC_FEATURES *features;
+    unsigned int i, f, length = 0;
+    IDWriteFontFileLoader *loader;
+    IDWriteFontFile *file;
+    UINT32 count = 1;
+    UINT32 *ptr;
+    HRESULT hr;
+
+    memset(key, 0, sizeof(*key));
+
+    if (FAILED(hr = IDWriteFontFace_GetFiles(run->run.fontFace, &count, &file)))
+        return hr;
+    if (SUCCEEDED(hr = IDWriteFontFile_GetLoader(file, &loader)))
+    {
+        if (loader != get_local_fontfile_loader())
+            hr = E_NOTIMPL;
+        IDWriteFontFileLoader_Release(loader);
+    }
+    /* The face keeps its file alive, the key stays valid as long as the run does. */
+    if (SUCCEEDED(hr))
+        hr = IDWriteFontFile_GetReferenceKey(file, &key->font_key, &key->font_key_size);
+    IDWriteFontFile_Release(file);
+    if (FAILED(hr))
+        return hr;
+    key->face_index = IDWriteFontFace_GetIndex(run->run.fontFace);
+    key->simulations = IDWriteFontFace_GetSimulations(run->run.fontFace);
+
+    key->em_size = run->run.fontEmSize;
+    key->is_sideways = run->run.isSideways;
+    key->is_rtl = run->run.bidiLevel & 1;
+    key->sa = run->sa;
+    if (is_layout_gdi_compatible(layout))
+    {
+        key->measuring_mode = layout->measuringmode;
+        key->ppdip = layout->ppdip;
+        key->transform = layout->transform;
+    }
+    key->text = run->descr.string;
+    key->length = run->descr.stringLength;
+    key->locale = run->descr.localeName;
+    key->locale_length = wcslen(run->descr.localeName);
+
+    for (i = 0; i < context->user_features.range_count; ++i)
+        length += 2 + 2 * context->user_features.features[i]->featureCount;
+    if (!length)
+        return S_OK;
+
+    if (!(ptr = malloc(length * sizeof(*ptr))))
+        return E_OUTOFMEMORY;
+    key->features = ptr;
+    key->features_length = length;
+
+    for (i = 0; i < context->user_features.range_count; ++i)
+    {
+        features = context->user_features.features[i];
+        *ptr++ = context->user_features.range_lengths[i];
+        *ptr++ = features->featureCount;
+        for (f = 0; f < features->featureCount; ++f)
+        {
+            *ptr++ = features->features[f].nameTag;
+            *ptr++ = features->features[f].parameter;
+        }
+    }
+
+    return S_OK;
+}
+
+static BOOL shaped_run_cache_lookup(struct shaped_run_cache *cache, const struct shaped_run_key *key,
+        UINT32 hash, struct shaping_context *context)
+{
+    struct regular_layout_run *run = context->run;
+    struct shaped_run_entry *entry;
+    UINT32 count;
+
+    EnterCriticalSection(&cache->cs);
+
+    LIST_FOR_EACH_ENTRY(entry, &cache->buckets[hash % SHAPED_RUN_CACHE_BUCKET_COUNT], struct shaped_run_entry, entry)
+    {
+        if (entry->hash != hash || !shaped_run_key_equal(&entry->key, key))
+            continue;
+
+        count = max(entry->glyph_count, 1);
+        run->clustermap = malloc(key->length * sizeof(*run->clustermap));
+        run->glyphs = malloc(count * sizeof(*run->glyphs));
+        run->advances = malloc(count * sizeof(*run->advances));
+        run->offsets = malloc(count * sizeof(*run->offsets));
+        context->glyph_props = malloc(count * sizeof(*context->glyph_props));
+        if (!run->clustermap || !run->glyphs || !run->advances || !run->offsets || !context->glyph_props)
+            break;
+
+        memcpy(run->clustermap, entry->clustermap, key->length * sizeof(*run->clustermap));
+        memcpy(run->glyphs, entry->glyphs, entry->glyph_count * sizeof(*run->glyphs));
+        memcpy(run->advances, entry->advances, entry->glyph_count * sizeof(*run->advances));
+        memcpy(run->offsets, entry->offsets, entry->glyph_count * sizeof(*run->offsets));
+        memcpy(context->glyph_props, entry->glyph_props, entry->glyph_count * sizeof(*context->glyph_props));
+        run->glyphcount = entry->glyph_count;
+
+        run->run.glyphIndices = run->glyphs;
+        run->descr.clusterMap = run->clustermap;
+        run->run.glyphAdvances = run->advances;
+        run->run.glyphOffsets = run->offsets;
+
+        list_remove(&entry->lru_entry);
+        list_add_head(&cache->lru, &entry->lru_entry);
+        cache->hits++;
+        LeaveCriticalSection(&cache->cs);
+        return TRUE;
+    }
+
+    cache->misses++;
+    LeaveCriticalSection(&cache->cs);
+
+    free(run->clustermap);
+    free(run->glyphs);
+    free(run->advances);
+    free(run->offsets);
+    free(context->glyph_props);
+    run->clustermap = run->glyphs = NULL;
+    run->advances = NULL;
+    run->offsets = NULL;
+    context->glyph_props = NULL;
+
+    return FALSE;
+}
+
+static void shaped_run_cache_add(struct shaped_run_cache *cache, const struct shaped_run_key *key,
+        UINT32 hash, const struct shaping_context *context)
+{
+    const struct regular_layout_run *run = context->run;
+    struct shaped_run_entry *entry;
+    UINT32 count = run->glyphcount;
+    struct list *tail;
+    size_t size;
+    BYTE *ptr;
+
+    size = sizeof(*entry) + count * (sizeof(*entry->advances) + sizeof(*entry->offsets)
+            + sizeof(*entry->glyphs) + sizeof(*entry->glyph_props))
+            + key->features_length * sizeof(*key->features)
+            + (key->length + key->locale_length) * sizeof(WCHAR) + key->length * sizeof(*entry->clustermap)
+            + key->font_key_size;
+    if (size > SHAPED_RUN_CACHE_MAX_SIZE / 16)
+        return;
+
+    if (!(entry = malloc(size)))
+        return;
+
+    entry->hash = hash;
+    entry->size = size;
+    entry->key = *key;
+    entry->glyph_count = count;
+
+    /* Keep everything naturally aligned, largest elements first. */
+    ptr = (BYTE *)(entry + 1);
+    entry->advances = (float *)ptr;
+    memcpy(entry->advances, run->advances, count * sizeof(*entry->advances));
+    ptr += count * sizeof(*entry->advances);
+    entry->offsets = (DWRITE_GLYPH_OFFSET *)ptr;
+    memcpy(entry->offsets, run->offsets, count * sizeof(*entry->offsets));
+    ptr += count * sizeof(*entry->offsets);
+    entry->key.features = (UINT32 *)ptr;
+    memcpy(ptr, key->features, key->features_length * sizeof(*key->features));
+    ptr += key->features_length * sizeof(*key->features);
+    entry->glyphs = (UINT16 *)ptr;
+    memcpy(entry->glyphs, run->glyphs, count * sizeof(*entry->glyphs));
+    ptr += count * sizeof(*entry->glyphs);
+    entry->glyph_props = (DWRITE_SHAPING_GLYPH_PROPERTIES *)ptr;
+    memcpy(entry->glyph_props, context->glyph_props, count * sizeof(*entry->glyph_props));
+    ptr += count * sizeof(*entry->glyph_props);
+    entry->clustermap = (UINT16 *)ptr;
+    memcpy(entry->clustermap, run->clustermap, key->length * sizeof(*entry->clustermap));
+    ptr += key->length * sizeof(*entry->clustermap);
+    entry->key.text = (WCHAR *)ptr;
+    memcpy(ptr, key->text, key->length * sizeof(WCHAR));
+    ptr += key->length * sizeof(WCHAR);
+    entry->key.locale = (WCHAR *)ptr;
+    memcpy(ptr, key->locale, key->locale_length * sizeof(WCHAR));
+    ptr += key->locale_length * sizeof(WCHAR);
+    entry->key.font_key = ptr;
+    memcpy(ptr, key->font_key, key->font_key_size);
+
+    EnterCriticalSection(&cache->cs);
+
+    list_add_head(&cache->buckets[hash % SHAPED_RUN_CACHE_BUCKET_COUNT], &entry->entry);
+    list_add_head(&cache->lru, &entry->lru_entry);
+    cache->size += size;
+
+    while (cache->size > SHAPED_RUN_CACHE_MAX_SIZE && (tail = list_tail(&cache->lru)))
+    {
+        entry = LIST_ENTRY(tail, struct shaped_run_entry, lru_entry);
+        list_remove(&entry->entry);
+        list_remove(&entry->lru_entry);
+        cache->size -= entry->size;
+        free(entry);
+    }
+
+    LeaveCriticalSection(&cache->cs);
+}
+
 static HRESULT layout_shape_run(struct dwrite_textlayout *layout, struct regular_layout_run *run)
 {
+    struct shaped_run_cache *cache = factory_get_shaped_run_cache(layout->factory);
     struct shaping_context context = { 0 };
+    struct shaped_run_key key;
+    UINT32 hash = 0;
     HRESULT hr;
 
     context.analyzer = get_text_analyzer();
     context.run = run;
 
+    run->descr.localeName = get_layout_range_by_pos(layout, run->descr.textPosition)->locale;
+
+    if (FAILED(hr = layout_shape_get_user_features(layout, &context)))
+        goto done;
+
+    if (cache && FAILED(shaped_run_key_init(&key, layout, &context)))
+        cache = NULL;
+
+    if (cache)
+    {
+        hash = shaped_run_key_hash(&key);
+        if (shaped_run_cache_lookup(cache, &key, hash, &context))
+            goto spacing;
+    }
+
     if (SUCCEEDED(hr = layout_shape_get_glyphs(layout, &context)))
         hr = layout_shape_get_positions(layout, &context);
 
+    if (SUCCEEDED(hr) && cache)
+        shaped_run_cache_add(cache, &key, hash, &context);
+
+spacing:
+    if (SUCCEEDED(hr))
+        hr = layout_shape_apply_character_spacing(layout, &context);
+
+    if (cache)
+        free((void *)key.features);
+
+done:
     layout_shape_clear_context(&context);
 
     /* Special treatment for runs that don't produce visual output, shaping code adds normal glyphs for them,
@@ -608,6 +608,8 @@ struct dwritefactory
     struct list collection_loaders;
     struct list file_loaders;
 
+    struct shaped_run_cache *shaped_runs;
+
     CRITICAL_SECTION cs;
 };
 
@@ -663,6 +665,7 @@ static void release_dwritefactory(struct dwritefactory *factory)
         IDWriteFontCollection1_Release(factory->eudc_collection);
     if (factory->fallback)
         release_system_fontfallback(factory->fallback);
+    release_shaped_run_cache(factory->shaped_runs);
 
     factory->cs.DebugInfo->Spare[0] = 0;
     DeleteCriticalSection(&factory->cs);
@@ -2097,10 +2100,19 @@ static void init_dwritefactory(struct dwritefactory *factory, DWRITE_FACTORY_TYP
     list_init(&factory->file_loaders);
     list_init(&factory->localfontfaces);
 
+    /* Layouts work without it, shaping is just not cached then. */
+    create_shaped_run_cache(&factory->shaped_runs);
+
     InitializeCriticalSectionEx(&factory->cs, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO);
     factory->cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": dwritefactory.lock");
 }
 
+struct shaped_run_cache *factory_get_shaped_run_cache(IDWriteFactory7 *iface)
+{
+    struct dwritefactory *factory = impl_from_IDWriteFactory7(iface);
+    return factory->shaped_runs;
+}
+
 void factory_detach_fontcollection(IDWriteFactory7 *iface, IDWriteFontCollection3 *collection)
 {
     struct dwritefactory *factory = impl_from_IDWriteFactory7(iface);
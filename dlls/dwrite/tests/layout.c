@@ -2497,6 +2497,14 @@ static void test_GetClusterMetrics(void)
         hr = IDWriteTextLayout1_SetCharacterSpacing(layout1, 0.0, 0.0, 0.0, r);
         ok(hr == S_OK, "Unexpected hr %#lx.\n", hr);
 
+        count = 0;
+        hr = IDWriteTextLayout_GetClusterMetrics(layout, metrics2, ARRAY_SIZE(metrics2), &count);
+        ok(hr == S_OK, "Unexpected hr %#lx.\n", hr);
+        ok(count == 4, "got %u\n", count);
+        for (i = 0; i < count; ++i)
+            ok(metrics2[i].width == metrics[i].width, "%u: got width %.2f, was %.2f\n", i, metrics2[i].width,
+                metrics[i].width);
+
         /* negative advance limit */
         r.startPosition = 0;
         r.length = 4;
@@ -21,6 +21,10 @@
 #include <limits.h>
 #include <assert.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "windef.h"
 #include "winbase.h"
 #include "winuser.h"
@@ -452,6 +456,71 @@ static GpStatus get_clip_hrgn(GpGraphics *graphics, HRGN *hrgn)
     return stat;
 }
 
+/* Blend a span of unpremultiplied ARGB pixels over a 32bppRGB or 32bppARGB row.
+ * This gives the same results as going through GdipBitmapGetPixel, color_over and
+ * GdipBitmapSetPixel. */
+static void blend_argb_span(DWORD *dst, const ARGB *src, INT count, PixelFormat dst_format)
+{
+    const BOOL has_alpha = (dst_format == PixelFormat32bppARGB);
+    INT x = 0;
+
+#ifdef __SSE2__
+    {
+        /* Opaque destination pixels end up with an alpha of 255, so the blend reduces to
+         * (bg * (255 - a) + fg * a) / 255 for every channel. */
+        const __m128i zero = _mm_setzero_si128(), one = _mm_set1_epi16(1);
+        const __m128i max = _mm_set1_epi16(0xff), color_mask = _mm_set1_epi32(0x00ffffff);
+        const __m128i alpha_bits = _mm_set1_epi32(has_alpha ? 0xff000000 : 0);
+        INT i;
+
+        for (; x + 4 <= count; x += 4)
+        {
+            __m128i s = _mm_loadu_si128((const __m128i *)(src + x));
+            __m128i d = _mm_loadu_si128((__m128i *)(dst + x));
+            __m128i transparent = _mm_cmpeq_epi32(_mm_srli_epi32(s, 24), zero);
+            __m128i s16, d16, a16, res_lo, res_hi, res;
+
+            if (_mm_movemask_epi8(transparent) == 0xffff) continue;
+            if (has_alpha && _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_or_si128(d, color_mask),
+                                                              _mm_set1_epi32(-1))) != 0xffff)
+            {
+                for (i = x; i < x + 4; i++)
+                    if (src[i] & 0xff000000) dst[i] = color_over(dst[i], src[i]);
+                continue;
+            }
+
+            s16 = _mm_unpacklo_epi8(s, zero);
+            d16 = _mm_unpacklo_epi8(d, zero);
+            a16 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xff), 0xff);
+            res_lo = _mm_add_epi16(_mm_mullo_epi16(s16, a16), _mm_mullo_epi16(d16, _mm_sub_epi16(max, a16)));
+            res_lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(res_lo, one), _mm_srli_epi16(res_lo, 8)), 8);
+
+            s16 = _mm_unpackhi_epi8(s, zero);
+            d16 = _mm_unpackhi_epi8(d, zero);
+            a16 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s16, 0xff), 0xff);
+            res_hi = _mm_add_epi16(_mm_mullo_epi16(s16, a16), _mm_mullo_epi16(d16, _mm_sub_epi16(max, a16)));
+            res_hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(res_hi, one), _mm_srli_epi16(res_hi, 8)), 8);
+
+            res = _mm_or_si128(_mm_and_si128(_mm_packus_epi16(res_lo, res_hi), color_mask), alpha_bits);
+            /* transparent source pixels leave the destination untouched */
+            res = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, res));
+            _mm_storeu_si128((__m128i *)(dst + x), res);
+        }
+    }
+#endif
+
+    for (; x < count; x++)
+    {
+        if (!(src[x] & 0xff000000))
+            continue;
+
+        if (has_alpha)
+            dst[x] = color_over(dst[x], src[x]);
+        else
+            dst[x] = color_over(dst[x] | 0xff000000, src[x]) & 0x00ffffff;
+    }
+}
+
 /* Draw ARGB data to the given graphics object */
 static GpStatus alpha_blend_bmp_pixels(GpGraphics *graphics, INT dst_x, INT dst_y,
     const BYTE *src, INT src_width, INT src_height, INT src_stride, const PixelFormat fmt)
@@ -460,6 +529,42 @@ static GpStatus alpha_blend_bmp_pixels(GpGraphics *graphics, INT dst_x, INT dst_
     INT x, y;
     CompositingMode comp_mode = graphics->compmode;
 
+    if (dst_bitmap->format == PixelFormat32bppARGB || dst_bitmap->format == PixelFormat32bppRGB)
+    {
+        const ARGB alpha_mask = (dst_bitmap->format == PixelFormat32bppARGB) ? 0xffffffff : 0x00ffffff;
+        INT left = max(dst_x, 0), top = max(dst_y, 0);
+        INT right = min(dst_x + src_width, dst_bitmap->width);
+        INT bottom = min(dst_y + src_height, dst_bitmap->height);
+
+        /* work on the bitmap rows directly instead of one pixel at a time */
+        for (y = top; y < bottom; y++)
+        {
+            const ARGB *src_row = (const ARGB *)(src + src_stride * (y - dst_y)) + (left - dst_x);
+            DWORD *dst_row = (DWORD *)(dst_bitmap->bits + dst_bitmap->stride * y) + left;
+
+            if (comp_mode == CompositingModeSourceCopy)
+            {
+                for (x = 0; x < right - left; x++)
+                    dst_row[x] = (src_row[x] & 0xff000000) ? src_row[x] & alpha_mask : 0;
+            }
+            else if (fmt & PixelFormatPAlpha)
+            {
+                for (x = 0; x < right - left; x++)
+                {
+                    if (!(src_row[x] & 0xff000000)) continue;
+                    if (alpha_mask == 0xffffffff)
+                        dst_row[x] = color_over_fgpremult(dst_row[x], src_row[x]);
+                    else
+                        dst_row[x] = color_over_fgpremult(dst_row[x] | 0xff000000, src_row[x]) & alpha_mask;
+                }
+            }
+            else
+                blend_argb_span(dst_row, src_row, right - left, dst_bitmap->format);
+        }
+
+        return Ok;
+    }
+
     for (y=0; y<src_height; y++)
     {
         for (x=0; x<src_width; x++)
@@ -6843,6 +6843,60 @@ static void test_GdipFillRectanglesOnBitmapTextureBrush(void)
     GdipFree(src_img_data);
 }
 
+extern BOOL color_match(ARGB c1, ARGB c2, BYTE max_diff);
+
+static void test_GdipFillRectanglesOnBitmapAlpha(void)
+{
+    static const PixelFormat formats[] = {PixelFormat32bppARGB, PixelFormat32bppRGB};
+    GpGraphics *graphics;
+    GpBitmap *bitmap;
+    GpBrush *brush;
+    GpStatus status;
+    ARGB color;
+    UINT i;
+
+    for (i = 0; i < ARRAY_SIZE(formats); i++)
+    {
+        status = GdipCreateBitmapFromScan0(12, 12, 0, formats[i], NULL, &bitmap);
+        expect(Ok, status);
+        status = GdipGetImageGraphicsContext((GpImage *)bitmap, &graphics);
+        expect(Ok, status);
+
+        status = GdipGraphicsClear(graphics, 0xff0000ff);
+        expect(Ok, status);
+
+        /* partly outside of the bitmap */
+        status = GdipCreateSolidFill(0x80ff0000, (GpSolidFill **)&brush);
+        expect(Ok, status);
+        status = GdipFillRectangleI(graphics, brush, -4, -4, 10, 10);
+        expect(Ok, status);
+        GdipDeleteBrush(brush);
+
+        status = GdipCreateSolidFill(0, (GpSolidFill **)&brush);
+        expect(Ok, status);
+        status = GdipFillRectangleI(graphics, brush, 0, 8, 12, 4);
+        expect(Ok, status);
+        GdipDeleteBrush(brush);
+
+        GdipDeleteGraphics(graphics);
+
+        status = GdipBitmapGetPixel(bitmap, 0, 0, &color);
+        expect(Ok, status);
+        ok(color_match(color, 0xff80007f, 1), "%u: got %08lx\n", i, color);
+        status = GdipBitmapGetPixel(bitmap, 5, 5, &color);
+        expect(Ok, status);
+        ok(color_match(color, 0xff80007f, 1), "%u: got %08lx\n", i, color);
+        status = GdipBitmapGetPixel(bitmap, 6, 6, &color);
+        expect(Ok, status);
+        ok(color == 0xff0000ff, "%u: got %08lx\n", i, color);
+        status = GdipBitmapGetPixel(bitmap, 11, 11, &color);
+        expect(Ok, status);
+        ok(color == 0xff0000ff, "%u: got %08lx\n", i, color);
+
+        GdipDisposeImage((GpImage *)bitmap);
+    }
+}
+
 static void test_GdipDrawImagePointsRectOnMemoryDC(void)
 {
     ARGB color[6] = {0,0,0,0,0,0};
@@ -7574,6 +7628,7 @@ START_TEST(graphics)
     test_GdipFillRectanglesOnMemoryDCSolidBrush();
     test_GdipFillRectanglesOnMemoryDCTextureBrush();
     test_GdipFillRectanglesOnBitmapTextureBrush();
+    test_GdipFillRectanglesOnBitmapAlpha();
     test_GdipDrawImagePointsRectOnMemoryDC();
     test_container_rects();
     test_GdipGraphicsSetAbort();
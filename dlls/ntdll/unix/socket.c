@@ -42,6 +42,9 @@
 #ifdef HAVE_NETINET_TCP_H
 # include <netinet/tcp.h>
 #endif
+#ifdef HAVE_SYS_SENDFILE_H
+# include <sys/sendfile.h>
+#endif
 
 #ifdef HAVE_NETIPX_IPX_H
 # include <netipx/ipx.h>
@@ -133,24 +136,28 @@ struct async_send_ioctl
     struct iovec iov[1];
 };
 
+struct transmit_element
+{
+    HANDLE file;                /* file to send, or NULL for a memory element */
+    const char *buffer;         /* data of a memory element */
+    LARGE_INTEGER offset;       /* current file offset, or FILE_USE_FILE_POINTER_POSITION */
+    unsigned int len;           /* element length; 0 sends a file up to its end */
+    unsigned int cursor;        /* amount of element data already sent */
+};
+
 struct async_transmit_ioctl
 {
     struct async_fileio io;
-    HANDLE file;
-    char *buffer;
+    char *buffer;               /* bounce buffer for files which cannot be sent directly */
     unsigned int buffer_size;   /* allocated size of buffer */
     unsigned int read_len;      /* amount of valid data currently in the buffer */
-    unsigned int head_cursor;   /* amount of header data already sent */
-    unsigned int file_cursor;   /* amount of file data already sent */
     unsigned int buffer_cursor; /* amount of data currently in the buffer already sent */
-    unsigned int tail_cursor;   /* amount of tail data already sent */
-    unsigned int file_len;      /* total file length to send */
+    unsigned int sent_len;      /* total amount of data sent */
     unsigned int flags;
-    const char *head;
-    const char *tail;
-    unsigned int head_len;
-    unsigned int tail_len;
-    LARGE_INTEGER offset;
+    BOOL no_sendfile;           /* sendfile() failed, fall back to read() and send() */
+    unsigned int current;       /* index of the element currently being sent */
+    unsigned int count;
+    struct transmit_element elements[1];
 };
 
 static NTSTATUS sock_errno_to_status( int err )
@@ -1215,75 +1222,170 @@ static ssize_t do_send( int fd, const void *buffer, size_t len, int flags )
     return ret;
 }
 
-static NTSTATUS try_transmit( int sock_fd, int file_fd, struct async_transmit_ioctl *async )
+static NTSTATUS transmit_memory( int sock_fd, struct async_transmit_ioctl *async,
+                                 struct transmit_element *element, int flags )
 {
     ssize_t ret;
 
-    while (async->head_cursor < async->head_len)
+    while (element->cursor < element->len)
     {
-        TRACE( "sending %u bytes of header data\n", async->head_len - async->head_cursor );
-        ret = do_send( sock_fd, async->head + async->head_cursor,
-                       async->head_len - async->head_cursor, 0 );
+        TRACE( "sending %u bytes of memory data\n", element->len - element->cursor );
+        ret = do_send( sock_fd, element->buffer + element->cursor, element->len - element->cursor, flags );
         if (ret < 0) return sock_errno_to_status( errno );
         TRACE( "send returned %zd\n", ret );
-        async->head_cursor += ret;
+        element->cursor += ret;
+        async->sent_len += ret;
     }
+    return STATUS_SUCCESS;
+}
 
-    while (async->buffer_cursor < async->read_len)
+#ifdef HAVE_SYS_SENDFILE_H
+static NTSTATUS transmit_file_sendfile( int sock_fd, int file_fd, struct async_transmit_ioctl *async,
+                                        struct transmit_element *element )
+{
+    ssize_t ret;
+
+    while (!element->len || element->cursor < element->len)
     {
-        TRACE( "sending %u bytes of file data\n", async->read_len - async->buffer_cursor );
-        ret = do_send( sock_fd, async->buffer + async->buffer_cursor,
-                       async->read_len - async->buffer_cursor, 0 );
-        if (ret < 0) return sock_errno_to_status( errno );
-        TRACE( "send returned %zd\n", ret );
-        async->buffer_cursor += ret;
-        async->file_cursor += ret;
+        size_t size = element->len ? element->len - element->cursor : 0x7ffff000;
+        off_t offset = element->offset.QuadPart;
+
+        TRACE( "sending %zu bytes of file data\n", size );
+        do
+        {
+            if (element->offset.QuadPart == FILE_USE_FILE_POINTER_POSITION)
+                ret = sendfile( sock_fd, file_fd, NULL, size );
+            else
+                ret = sendfile( sock_fd, file_fd, &offset, size );
+        } while (ret < 0 && errno == EINTR);
+
+        if (ret < 0)
+        {
+            if (errno == EWOULDBLOCK) return STATUS_DEVICE_NOT_READY;
+            if (errno == EINVAL || errno == ENOSYS || errno == EOPNOTSUPP)
+            {
+                /* the file or socket can't be spliced, nothing was consumed */
+                TRACE( "sendfile not supported, falling back to read\n" );
+                async->no_sendfile = TRUE;
+                return STATUS_SUCCESS;
+            }
+            WARN( "sendfile: %s\n", strerror( errno ) );
+            return sock_errno_to_status( errno );
+        }
+        TRACE( "sendfile returned %zd\n", ret );
+        if (!ret) break; /* end of file */
+
+        element->cursor += ret;
+        async->sent_len += ret;
+        if (element->offset.QuadPart != FILE_USE_FILE_POINTER_POSITION)
+            element->offset.QuadPart += ret;
     }
+    return STATUS_SUCCESS;
+}
+#endif
+
+static NTSTATUS transmit_file_copy( int sock_fd, int file_fd, struct async_transmit_ioctl *async,
+                                    struct transmit_element *element, int flags )
+{
+    ssize_t ret;
+
+    if (!async->buffer && !(async->buffer = malloc( async->buffer_size )))
+        return STATUS_NO_MEMORY;
 
-    if (async->file && async->buffer_cursor == async->read_len)
+    for (;;)
     {
         unsigned int read_size = async->buffer_size;
 
-        if (async->file_len)
-            read_size = min( read_size, async->file_len - async->file_cursor );
+        while (async->buffer_cursor < async->read_len)
+        {
+            TRACE( "sending %u bytes of file data\n", async->read_len - async->buffer_cursor );
+            ret = do_send( sock_fd, async->buffer + async->buffer_cursor,
+                           async->read_len - async->buffer_cursor, flags );
+            if (ret < 0) return sock_errno_to_status( errno );
+            TRACE( "send returned %zd\n", ret );
+            async->buffer_cursor += ret;
+            element->cursor += ret;
+            async->sent_len += ret;
+        }
+        async->read_len = async->buffer_cursor = 0;
+
+        if (element->len)
+            read_size = min( read_size, element->len - element->cursor );
+        if (!read_size) return STATUS_SUCCESS;
 
         TRACE( "reading %u bytes of file data\n", read_size );
         do
         {
-            if (async->offset.QuadPart == FILE_USE_FILE_POINTER_POSITION)
+            if (element->offset.QuadPart == FILE_USE_FILE_POINTER_POSITION)
                 ret = read( file_fd, async->buffer, read_size );
             else
-                ret = pread( file_fd, async->buffer, read_size, async->offset.QuadPart );
+                ret = pread( file_fd, async->buffer, read_size, element->offset.QuadPart );
         } while (ret < 0 && errno == EINTR);
         if (ret < 0) return errno_to_status( errno );
         TRACE( "read returned %zd\n", ret );
+        if (!ret) return STATUS_SUCCESS;
 
         async->read_len = ret;
-        async->buffer_cursor = 0;
-        if (async->offset.QuadPart != FILE_USE_FILE_POINTER_POSITION)
-            async->offset.QuadPart += ret;
-
-        if (ret < read_size || (async->file_len && async->file_cursor == async->file_len))
-            async->file = NULL;
-        return STATUS_DEVICE_NOT_READY; /* still more data to send */
+        if (element->offset.QuadPart != FILE_USE_FILE_POINTER_POSITION)
+            element->offset.QuadPart += ret;
     }
+}
+
+static NTSTATUS transmit_file( int sock_fd, struct async_transmit_ioctl *async,
+                               struct transmit_element *element, int flags )
+{
+    int file_fd, needs_close = FALSE;
+    NTSTATUS status;
+
+    if ((status = server_get_unix_fd( element->file, 0, &file_fd, &needs_close, NULL, NULL )))
+        return status;
+
+#ifdef HAVE_SYS_SENDFILE_H
+    if (!async->no_sendfile)
+        status = transmit_file_sendfile( sock_fd, file_fd, async, element );
+    /* sendfile() may have given up on this file, in which case we copy it ourselves */
+    if (async->no_sendfile)
+#endif
+        status = transmit_file_copy( sock_fd, file_fd, async, element, flags );
+
+    if (needs_close) close( file_fd );
+    return status;
+}
 
-    while (async->tail_cursor < async->tail_len)
+static NTSTATUS try_transmit( int sock_fd, struct async_transmit_ioctl *async )
+{
+    NTSTATUS status;
+
+    while (async->current < async->count)
     {
-        TRACE( "sending %u bytes of tail data\n", async->tail_len - async->tail_cursor );
-        ret = do_send( sock_fd, async->tail + async->tail_cursor,
-                       async->tail_len - async->tail_cursor, 0 );
-        if (ret < 0) return sock_errno_to_status( errno );
-        TRACE( "send returned %zd\n", ret );
-        async->tail_cursor += ret;
+        struct transmit_element *element = &async->elements[async->current];
+        int flags = 0;
+
+#ifdef MSG_MORE
+        /* let the kernel coalesce small headers with the data that follows them */
+        if (async->current + 1 < async->count) flags |= MSG_MORE;
+#endif
+        if (element->file)
+            status = transmit_file( sock_fd, async, element, flags );
+        else
+            status = transmit_memory( sock_fd, async, element, flags );
+        if (status) return status;
+
+        async->current++;
     }
 
     return STATUS_SUCCESS;
 }
 
+static void release_transmit_ioctl( struct async_transmit_ioctl *async )
+{
+    free( async->buffer );
+    release_fileio( &async->io );
+}
+
 static BOOL async_transmit_proc( void *user, ULONG_PTR *info, unsigned int *status )
 {
-    int sock_fd, file_fd = -1, sock_needs_close = FALSE, file_needs_close = FALSE;
+    int sock_fd, sock_needs_close = FALSE;
     struct async_transmit_ioctl *async = user;
 
     TRACE( "%#x\n", *status );
@@ -1293,77 +1395,77 @@ static BOOL async_transmit_proc( void *user, ULONG_PTR *info, unsigned int *stat
         if ((*status = server_get_unix_fd( async->io.handle, 0, &sock_fd, &sock_needs_close, NULL, NULL )))
             return TRUE;
 
-        if (async->file && (*status = server_get_unix_fd( async->file, 0, &file_fd, &file_needs_close, NULL, NULL )))
-        {
-            if (sock_needs_close) close( sock_fd );
-            return TRUE;
-        }
-
-        *status = try_transmit( sock_fd, file_fd, async );
+        *status = try_transmit( sock_fd, async );
         TRACE( "got status %#x\n", *status );
 
         if (sock_needs_close) close( sock_fd );
-        if (file_needs_close) close( file_fd );
 
         if (*status == STATUS_DEVICE_NOT_READY)
             return FALSE;
     }
-    *info = async->head_cursor + async->file_cursor + async->tail_cursor;
-    release_fileio( &async->io );
+    *info = async->sent_len;
+    release_transmit_ioctl( async );
     return TRUE;
 }
 
-static NTSTATUS sock_transmit( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc_user,
-                               IO_STATUS_BLOCK *io, int fd, const struct afd_transmit_params *params )
+static BOOL is_connected( int fd )
+{
+    union unix_sockaddr addr;
+    socklen_t addr_len = sizeof(addr);
+
+    return !getpeername( fd, &addr.addr, &addr_len );
+}
+
+static NTSTATUS check_transmit_file( HANDLE file )
 {
     int file_fd, file_needs_close = FALSE;
-    struct async_transmit_ioctl *async;
     enum server_fd_type file_type;
-    union unix_sockaddr addr;
-    socklen_t addr_len;
-    HANDLE wait_handle;
-    unsigned int status;
-    ULONG options;
+    NTSTATUS status;
 
-    addr_len = sizeof(addr);
-    if (getpeername( fd, &addr.addr, &addr_len ) != 0)
-        return STATUS_INVALID_CONNECTION;
+    if ((status = server_get_unix_fd( file, 0, &file_fd, &file_needs_close, &file_type, NULL )))
+        return status;
+    if (file_needs_close) close( file_fd );
 
-    if (params->file)
+    if (file_type != FD_TYPE_FILE)
     {
-        if ((status = server_get_unix_fd( ULongToHandle( params->file ), 0, &file_fd, &file_needs_close, &file_type, NULL )))
-            return status;
-        if (file_needs_close) close( file_fd );
-
-        if (file_type != FD_TYPE_FILE)
-        {
-            FIXME( "unsupported file type %#x\n", file_type );
-            return STATUS_NOT_IMPLEMENTED;
-        }
+        FIXME( "unsupported file type %#x\n", file_type );
+        return STATUS_NOT_IMPLEMENTED;
     }
+    return STATUS_SUCCESS;
+}
 
-    if (!(async = (struct async_transmit_ioctl *)alloc_fileio( sizeof(*async), async_transmit_proc, handle )))
-        return STATUS_NO_MEMORY;
+static void init_transmit_memory( struct transmit_element *element, const void *buffer, unsigned int len )
+{
+    element->file = NULL;
+    element->buffer = buffer;
+    element->offset.QuadPart = 0;
+    element->len = len;
+    element->cursor = 0;
+}
 
-    async->file = ULongToHandle( params->file );
-    async->buffer_size = params->buffer_size ? params->buffer_size : 65536;
-    if (!(async->buffer = malloc( async->buffer_size )))
-    {
-        release_fileio( &async->io );
-        return STATUS_NO_MEMORY;
-    }
+static void init_transmit_file( struct transmit_element *element, HANDLE file,
+                                LARGE_INTEGER offset, unsigned int len )
+{
+    element->file = file;
+    element->buffer = NULL;
+    element->offset = offset;
+    element->len = len;
+    element->cursor = 0;
+}
+
+static NTSTATUS sock_transmit( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc_user,
+                               IO_STATUS_BLOCK *io, int fd, struct async_transmit_ioctl *async )
+{
+    HANDLE wait_handle;
+    unsigned int status;
+    ULONG options;
+
+    async->buffer = NULL;
     async->read_len = 0;
-    async->head_cursor = 0;
-    async->file_cursor = 0;
     async->buffer_cursor = 0;
-    async->tail_cursor = 0;
-    async->file_len = params->file_len;
-    async->flags = params->flags;
-    async->head = u64_to_user_ptr(params->head_ptr);
-    async->head_len = params->head_len;
-    async->tail = u64_to_user_ptr(params->tail_ptr);
-    async->tail_len = params->tail_len;
-    async->offset = params->offset;
+    async->sent_len = 0;
+    async->no_sendfile = FALSE;
+    async->current = 0;
 
     SERVER_START_REQ( send_socket )
     {
@@ -1380,18 +1482,15 @@ static NTSTATUS sock_transmit( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc,
 
     if (status == STATUS_ALERTED)
     {
-        ULONG_PTR information;
-
-        status = try_transmit( fd, file_fd, async );
+        status = try_transmit( fd, async );
         if (status == STATUS_DEVICE_NOT_READY)
             status = STATUS_PENDING;
 
-        information = async->head_cursor + async->file_cursor + async->tail_cursor;
-        set_async_direct_result( &wait_handle, options, io, status, information, TRUE );
+        set_async_direct_result( &wait_handle, options, io, status, async->sent_len, TRUE );
     }
 
     if (status != STATUS_PENDING)
-        release_fileio( &async->io );
+        release_transmit_ioctl( async );
 
     if (!status && !(options & (FILE_SYNCHRONOUS_IO_ALERT | FILE_SYNCHRONOUS_IO_NONALERT)))
     {
@@ -1405,6 +1504,82 @@ static NTSTATUS sock_transmit( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc,
     return status;
 }
 
+static NTSTATUS sock_ioctl_transmit( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc_user,
+                                     IO_STATUS_BLOCK *io, int fd, const struct afd_transmit_params *params )
+{
+    struct async_transmit_ioctl *async;
+    unsigned int status, count = 0;
+
+    if (!is_connected( fd ))
+        return STATUS_INVALID_CONNECTION;
+
+    if (params->file && (status = check_transmit_file( ULongToHandle( params->file ) )))
+        return status;
+
+    if (!(async = (struct async_transmit_ioctl *)alloc_fileio( offsetof( struct async_transmit_ioctl, elements[3] ),
+                                                               async_transmit_proc, handle )))
+        return STATUS_NO_MEMORY;
+
+    if (params->head_len)
+        init_transmit_memory( &async->elements[count++], u64_to_user_ptr(params->head_ptr), params->head_len );
+    if (params->file)
+        init_transmit_file( &async->elements[count++], ULongToHandle( params->file ),
+                            params->offset, params->file_len );
+    if (params->tail_len)
+        init_transmit_memory( &async->elements[count++], u64_to_user_ptr(params->tail_ptr), params->tail_len );
+    async->count = count;
+    async->buffer_size = params->buffer_size ? params->buffer_size : 65536;
+    async->flags = params->flags;
+
+    return sock_transmit( handle, event, apc, apc_user, io, fd, async );
+}
+
+static NTSTATUS sock_ioctl_transmit_packets( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc_user,
+                                             IO_STATUS_BLOCK *io, int fd,
+                                             const struct afd_transmit_packets_params *params )
+{
+    const struct afd_transmit_packets_element *elements = u64_to_user_ptr(params->elements_ptr);
+    struct async_transmit_ioctl *async;
+    unsigned int i, status, count = 0;
+
+    if (!is_connected( fd ))
+        return STATUS_INVALID_CONNECTION;
+
+    for (i = 0; i < params->count; ++i)
+    {
+        switch (elements[i].flags & (TP_ELEMENT_MEMORY | TP_ELEMENT_FILE))
+        {
+        case TP_ELEMENT_MEMORY:
+            break;
+        case TP_ELEMENT_FILE:
+            if ((status = check_transmit_file( ULongToHandle( elements[i].file ) )))
+                return status;
+            break;
+        default:
+            return STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    if (!(async = (struct async_transmit_ioctl *)alloc_fileio( offsetof( struct async_transmit_ioctl, elements[params->count] ),
+                                                               async_transmit_proc, handle )))
+        return STATUS_NO_MEMORY;
+
+    for (i = 0; i < params->count; ++i)
+    {
+        if (elements[i].flags & TP_ELEMENT_FILE)
+            init_transmit_file( &async->elements[count++], ULongToHandle( elements[i].file ),
+                                elements[i].offset, elements[i].len );
+        else if (elements[i].len)
+            init_transmit_memory( &async->elements[count++], u64_to_user_ptr(elements[i].buffer_ptr),
+                                  elements[i].len );
+    }
+    async->count = count;
+    async->buffer_size = params->send_size ? params->send_size : 65536;
+    async->flags = params->flags;
+
+    return sock_transmit( handle, event, apc, apc_user, io, fd, async );
+}
+
 
 static NTSTATUS do_getsockopt( HANDLE handle, IO_STATUS_BLOCK *io, int level,
                                int option, void *out_buffer, ULONG out_size )
@@ -1676,7 +1851,24 @@ NTSTATUS sock_ioctl( HANDLE handle, HANDLE event, PIO_APC_ROUTINE apc, void *apc
                 status = STATUS_BUFFER_TOO_SMALL;
                 break;
             }
-            status = sock_transmit( handle, event, apc, apc_user, io, fd, params );
+            status = sock_ioctl_transmit( handle, event, apc, apc_user, io, fd, params );
+            if (needs_close) close( fd );
+            return status;
+        }
+
+        case IOCTL_AFD_WINE_TRANSMIT_PACKETS:
+        {
+            const struct afd_transmit_packets_params *params = in_buffer;
+
+            if ((status = server_get_unix_fd( handle, 0, &fd, &needs_close, NULL, NULL )))
+                return status;
+
+            if (in_size < sizeof(*params))
+            {
+                status = STATUS_BUFFER_TOO_SMALL;
+                break;
+            }
+            status = sock_ioctl_transmit_packets( handle, event, apc, apc_user, io, fd, params );
             if (needs_close) close( fd );
             return status;
         }
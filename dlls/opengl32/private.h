@@ -28,8 +28,16 @@
 #include "winternl.h"
 #include "wingdi.h"
 
+#include "unixlib.h"
+
 extern const void *extension_procs[];
 
+extern NTSTATUS gl_unix_call( enum unix_funcs code, void *params );
+extern NTSTATUS batch_unix_call( enum unix_funcs code, void *params, UINT size );
+
+#define UNIX_CALL( func, params ) gl_unix_call( unix_ ## func, params )
+#define UNIX_BATCH_CALL( func, params ) batch_unix_call( unix_ ## func, params, sizeof(*(params)) )
+
 extern int WINAPI wglDescribePixelFormat( HDC hdc, int ipfd, UINT cjpfd, PIXELFORMATDESCRIPTOR *ppfd );
 
 #endif /* __WINE_OPENGL32_PRIVATE_H */
@@ -502,6 +502,125 @@ static void test_debug_message_callback(void)
     glDisable(GL_DEBUG_OUTPUT);
 }
 
+static void WINAPI batch_debug_message_callback(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                                GLsizei length, const GLchar *message, const void *userParam)
+{
+    DWORD *count = (DWORD *)userParam;
+
+    /* GL calls made from the callback may be queued while the queue is being flushed. */
+    glClearDepth(0.5);
+    glDepthFunc(GL_GREATER);
+    (*count)++;
+}
+
+static void test_batch_child(void)
+{
+    PIXELFORMATDESCRIPTOR pfd = {sizeof(pfd), 1, PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER,
+            PFD_TYPE_RGBA, 24};
+    GLfloat color[4], depth;
+    GLint func;
+    HGLRC hglrc = NULL;
+    GLenum error;
+    DWORD count;
+    HWND hwnd;
+    int format;
+    HDC hdc;
+    BOOL ret;
+
+    hwnd = CreateWindowA("static", "Title", WS_OVERLAPPEDWINDOW, 10, 10, 200, 200, NULL, NULL, NULL, NULL);
+    ok(!!hwnd, "Failed to create window, error %lu.\n", GetLastError());
+    hdc = GetDC(hwnd);
+    if (!(format = ChoosePixelFormat(hdc, &pfd)))
+    {
+        win_skip("Unable to find pixel format.\n");
+        goto done;
+    }
+    ret = SetPixelFormat(hdc, format, &pfd);
+    ok(ret, "Failed to set pixel format, error %lu.\n", GetLastError());
+    hglrc = wglCreateContext(hdc);
+    ok(!!hglrc, "Failed to create context, error %lu.\n", GetLastError());
+    ret = wglMakeCurrent(hdc, hglrc);
+    ok(ret, "Failed to make context current, error %lu.\n", GetLastError());
+    init_functions();
+
+    /* State set by queued calls is visible to queries. */
+    glClearColor(0.25f, 0.5f, 0.75f, 1.0f);
+    glEnable(GL_BLEND);
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, color);
+    ok(color[0] == 0.25f && color[1] == 0.5f && color[2] == 0.75f && color[3] == 1.0f,
+            "Got unexpected clear color {%.8e, %.8e, %.8e, %.8e}.\n", color[0], color[1], color[2], color[3]);
+    ok(glIsEnabled(GL_BLEND), "Expected blending to be enabled.\n");
+
+    /* Errors raised by queued calls are reported by glGetError. */
+    glEnable(0xdeadbeef);
+    error = glGetError();
+    ok(error == GL_INVALID_ENUM, "Got unexpected error %#x.\n", error);
+    error = glGetError();
+    ok(error == GL_NO_ERROR, "Got unexpected error %#x.\n", error);
+
+    if (!pglDebugMessageCallbackARB)
+    {
+        skip("glDebugMessageCallbackARB not supported.\n");
+        goto done;
+    }
+
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    pglDebugMessageCallbackARB(batch_debug_message_callback, &count);
+    pglDebugMessageControlARB(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+
+    count = 0;
+    glClearDepth(1.0);
+    glDepthFunc(GL_LESS);
+    glEnable(0xdeadbeef);
+    glGetFloatv(GL_DEPTH_CLEAR_VALUE, &depth);
+    glGetIntegerv(GL_DEPTH_FUNC, &func);
+    if (!count)
+    {
+        skip("No debug message for GL errors.\n");
+    }
+    else
+    {
+        ok(depth == 0.5f, "Got unexpected clear depth %.8e.\n", depth);
+        ok(func == GL_GREATER, "Got unexpected depth func %#x.\n", func);
+    }
+    error = glGetError();
+    ok(error == GL_INVALID_ENUM, "Got unexpected error %#x.\n", error);
+
+    pglDebugMessageCallbackARB(NULL, NULL);
+    glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    glDisable(GL_DEBUG_OUTPUT);
+
+done:
+    wglMakeCurrent(NULL, NULL);
+    if (hglrc) wglDeleteContext(hglrc);
+    ReleaseDC(hwnd, hdc);
+    DestroyWindow(hwnd);
+}
+
+/* Runs the queued GL call tests in a child process, since WINE_OPENGL_BATCH
+ * is only read when opengl32 is loaded. */
+static void test_batch(void)
+{
+    STARTUPINFOA si = {sizeof(si)};
+    PROCESS_INFORMATION pi;
+    char cmdline[MAX_PATH];
+    char **argv;
+    BOOL ret;
+
+    winetest_get_mainargs(&argv);
+    sprintf(cmdline, "\"%s\" opengl batch", argv[0]);
+    SetEnvironmentVariableA("WINE_OPENGL_BATCH", "1");
+    ret = CreateProcessA(NULL, cmdline, NULL, NULL, FALSE, 0, NULL, NULL, &si, &pi);
+    SetEnvironmentVariableA("WINE_OPENGL_BATCH", NULL);
+    ok(ret, "Failed to create process, error %lu.\n", GetLastError());
+    if (!ret) return;
+
+    wait_child_process(pi.hProcess);
+    CloseHandle(pi.hProcess);
+    CloseHandle(pi.hThread);
+}
+
 static void test_setpixelformat(HDC winhdc)
 {
     int res = 0;
@@ -2154,6 +2273,7 @@ static void test_child_window(HWND hwnd, PIXELFORMATDESCRIPTOR *pfd)
 
 START_TEST(opengl)
 {
+    char **argv;
     HWND hwnd;
     PIXELFORMATDESCRIPTOR pfd = {
         sizeof(PIXELFORMATDESCRIPTOR),
@@ -2176,6 +2296,12 @@ START_TEST(opengl)
         0, 0, 0                /* layer masks */
     };
 
+    if (winetest_get_mainargs(&argv) >= 3 && !strcmp(argv[2], "batch"))
+    {
+        test_batch_child();
+        return;
+    }
+
     hwnd = CreateWindowA("static", "Title", WS_OVERLAPPEDWINDOW, 10, 10, 200, 200, NULL, NULL,
             NULL, NULL);
     ok(hwnd != NULL, "err: %ld\n", GetLastError());
@@ -2253,6 +2379,7 @@ START_TEST(opengl)
         test_choosepixelformat_flag_is_ignored_when_unset(PFD_SUPPORT_OPENGL);
         test_wglChoosePixelFormatARB(hdc);
         test_debug_message_callback();
+        test_batch();
         test_setpixelformat(hdc);
         test_destroy(hdc);
         test_sharelists(hdc);
@@ -75,7 +75,7 @@ void WINAPI glAccum( GLenum op, GLfloat value )
     struct glAccum_params args = { .teb = NtCurrentTeb(), .op = op, .value = value };
     NTSTATUS status;
     TRACE( "op %d, value %f\n", op, value );
-    if ((status = UNIX_CALL( glAccum, &args ))) WARN( "glAccum returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAccum, &args ))) WARN( "glAccum returned %#lx\n", status );
 }
 
 void WINAPI glAlphaFunc( GLenum func, GLfloat ref )
@@ -83,7 +83,7 @@ void WINAPI glAlphaFunc( GLenum func, GLfloat ref )
     struct glAlphaFunc_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref };
     NTSTATUS status;
     TRACE( "func %d, ref %f\n", func, ref );
-    if ((status = UNIX_CALL( glAlphaFunc, &args ))) WARN( "glAlphaFunc returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAlphaFunc, &args ))) WARN( "glAlphaFunc returned %#lx\n", status );
 }
 
 GLboolean WINAPI glAreTexturesResident( GLsizei n, const GLuint *textures, GLboolean *residences )
@@ -108,7 +108,7 @@ void WINAPI glBegin( GLenum mode )
     struct glBegin_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glBegin, &args ))) WARN( "glBegin returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBegin, &args ))) WARN( "glBegin returned %#lx\n", status );
 }
 
 void WINAPI glBindTexture( GLenum target, GLuint texture )
@@ -116,7 +116,7 @@ void WINAPI glBindTexture( GLenum target, GLuint texture )
     struct glBindTexture_params args = { .teb = NtCurrentTeb(), .target = target, .texture = texture };
     NTSTATUS status;
     TRACE( "target %d, texture %d\n", target, texture );
-    if ((status = UNIX_CALL( glBindTexture, &args ))) WARN( "glBindTexture returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindTexture, &args ))) WARN( "glBindTexture returned %#lx\n", status );
 }
 
 void WINAPI glBitmap( GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap )
@@ -132,7 +132,7 @@ void WINAPI glBlendFunc( GLenum sfactor, GLenum dfactor )
     struct glBlendFunc_params args = { .teb = NtCurrentTeb(), .sfactor = sfactor, .dfactor = dfactor };
     NTSTATUS status;
     TRACE( "sfactor %d, dfactor %d\n", sfactor, dfactor );
-    if ((status = UNIX_CALL( glBlendFunc, &args ))) WARN( "glBlendFunc returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFunc, &args ))) WARN( "glBlendFunc returned %#lx\n", status );
 }
 
 void WINAPI glCallList( GLuint list )
@@ -140,7 +140,7 @@ void WINAPI glCallList( GLuint list )
     struct glCallList_params args = { .teb = NtCurrentTeb(), .list = list };
     NTSTATUS status;
     TRACE( "list %d\n", list );
-    if ((status = UNIX_CALL( glCallList, &args ))) WARN( "glCallList returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCallList, &args ))) WARN( "glCallList returned %#lx\n", status );
 }
 
 void WINAPI glCallLists( GLsizei n, GLenum type, const void *lists )
@@ -156,7 +156,7 @@ void WINAPI glClear( GLbitfield mask )
     struct glClear_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glClear, &args ))) WARN( "glClear returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClear, &args ))) WARN( "glClear returned %#lx\n", status );
 }
 
 void WINAPI glClearAccum( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
@@ -164,7 +164,7 @@ void WINAPI glClearAccum( GLfloat red, GLfloat green, GLfloat blue, GLfloat alph
     struct glClearAccum_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearAccum, &args ))) WARN( "glClearAccum returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearAccum, &args ))) WARN( "glClearAccum returned %#lx\n", status );
 }
 
 void WINAPI glClearColor( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
@@ -172,7 +172,7 @@ void WINAPI glClearColor( GLfloat red, GLfloat green, GLfloat blue, GLfloat alph
     struct glClearColor_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearColor, &args ))) WARN( "glClearColor returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearColor, &args ))) WARN( "glClearColor returned %#lx\n", status );
 }
 
 void WINAPI glClearDepth( GLdouble depth )
@@ -180,7 +180,7 @@ void WINAPI glClearDepth( GLdouble depth )
     struct glClearDepth_params args = { .teb = NtCurrentTeb(), .depth = depth };
     NTSTATUS status;
     TRACE( "depth %f\n", depth );
-    if ((status = UNIX_CALL( glClearDepth, &args ))) WARN( "glClearDepth returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearDepth, &args ))) WARN( "glClearDepth returned %#lx\n", status );
 }
 
 void WINAPI glClearIndex( GLfloat c )
@@ -188,7 +188,7 @@ void WINAPI glClearIndex( GLfloat c )
     struct glClearIndex_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %f\n", c );
-    if ((status = UNIX_CALL( glClearIndex, &args ))) WARN( "glClearIndex returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearIndex, &args ))) WARN( "glClearIndex returned %#lx\n", status );
 }
 
 void WINAPI glClearStencil( GLint s )
@@ -196,7 +196,7 @@ void WINAPI glClearStencil( GLint s )
     struct glClearStencil_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glClearStencil, &args ))) WARN( "glClearStencil returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearStencil, &args ))) WARN( "glClearStencil returned %#lx\n", status );
 }
 
 void WINAPI glClipPlane( GLenum plane, const GLdouble *equation )
@@ -212,7 +212,7 @@ void WINAPI glColor3b( GLbyte red, GLbyte green, GLbyte blue )
     struct glColor3b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3b, &args ))) WARN( "glColor3b returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3b, &args ))) WARN( "glColor3b returned %#lx\n", status );
 }
 
 void WINAPI glColor3bv( const GLbyte *v )
@@ -228,7 +228,7 @@ void WINAPI glColor3d( GLdouble red, GLdouble green, GLdouble blue )
     struct glColor3d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3d, &args ))) WARN( "glColor3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3d, &args ))) WARN( "glColor3d returned %#lx\n", status );
 }
 
 void WINAPI glColor3dv( const GLdouble *v )
@@ -244,7 +244,7 @@ void WINAPI glColor3f( GLfloat red, GLfloat green, GLfloat blue )
     struct glColor3f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3f, &args ))) WARN( "glColor3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3f, &args ))) WARN( "glColor3f returned %#lx\n", status );
 }
 
 void WINAPI glColor3fv( const GLfloat *v )
@@ -260,7 +260,7 @@ void WINAPI glColor3i( GLint red, GLint green, GLint blue )
     struct glColor3i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3i, &args ))) WARN( "glColor3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3i, &args ))) WARN( "glColor3i returned %#lx\n", status );
 }
 
 void WINAPI glColor3iv( const GLint *v )
@@ -276,7 +276,7 @@ void WINAPI glColor3s( GLshort red, GLshort green, GLshort blue )
     struct glColor3s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3s, &args ))) WARN( "glColor3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3s, &args ))) WARN( "glColor3s returned %#lx\n", status );
 }
 
 void WINAPI glColor3sv( const GLshort *v )
@@ -292,7 +292,7 @@ void WINAPI glColor3ub( GLubyte red, GLubyte green, GLubyte blue )
     struct glColor3ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3ub, &args ))) WARN( "glColor3ub returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3ub, &args ))) WARN( "glColor3ub returned %#lx\n", status );
 }
 
 void WINAPI glColor3ubv( const GLubyte *v )
@@ -308,7 +308,7 @@ void WINAPI glColor3ui( GLuint red, GLuint green, GLuint blue )
     struct glColor3ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3ui, &args ))) WARN( "glColor3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3ui, &args ))) WARN( "glColor3ui returned %#lx\n", status );
 }
 
 void WINAPI glColor3uiv( const GLuint *v )
@@ -324,7 +324,7 @@ void WINAPI glColor3us( GLushort red, GLushort green, GLushort blue )
     struct glColor3us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3us, &args ))) WARN( "glColor3us returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3us, &args ))) WARN( "glColor3us returned %#lx\n", status );
 }
 
 void WINAPI glColor3usv( const GLushort *v )
@@ -340,7 +340,7 @@ void WINAPI glColor4b( GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha )
     struct glColor4b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4b, &args ))) WARN( "glColor4b returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4b, &args ))) WARN( "glColor4b returned %#lx\n", status );
 }
 
 void WINAPI glColor4bv( const GLbyte *v )
@@ -356,7 +356,7 @@ void WINAPI glColor4d( GLdouble red, GLdouble green, GLdouble blue, GLdouble alp
     struct glColor4d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4d, &args ))) WARN( "glColor4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4d, &args ))) WARN( "glColor4d returned %#lx\n", status );
 }
 
 void WINAPI glColor4dv( const GLdouble *v )
@@ -372,7 +372,7 @@ void WINAPI glColor4f( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
     struct glColor4f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4f, &args ))) WARN( "glColor4f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4f, &args ))) WARN( "glColor4f returned %#lx\n", status );
 }
 
 void WINAPI glColor4fv( const GLfloat *v )
@@ -388,7 +388,7 @@ void WINAPI glColor4i( GLint red, GLint green, GLint blue, GLint alpha )
     struct glColor4i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4i, &args ))) WARN( "glColor4i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4i, &args ))) WARN( "glColor4i returned %#lx\n", status );
 }
 
 void WINAPI glColor4iv( const GLint *v )
@@ -404,7 +404,7 @@ void WINAPI glColor4s( GLshort red, GLshort green, GLshort blue, GLshort alpha )
     struct glColor4s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4s, &args ))) WARN( "glColor4s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4s, &args ))) WARN( "glColor4s returned %#lx\n", status );
 }
 
 void WINAPI glColor4sv( const GLshort *v )
@@ -420,7 +420,7 @@ void WINAPI glColor4ub( GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha
     struct glColor4ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4ub, &args ))) WARN( "glColor4ub returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4ub, &args ))) WARN( "glColor4ub returned %#lx\n", status );
 }
 
 void WINAPI glColor4ubv( const GLubyte *v )
@@ -436,7 +436,7 @@ void WINAPI glColor4ui( GLuint red, GLuint green, GLuint blue, GLuint alpha )
     struct glColor4ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4ui, &args ))) WARN( "glColor4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4ui, &args ))) WARN( "glColor4ui returned %#lx\n", status );
 }
 
 void WINAPI glColor4uiv( const GLuint *v )
@@ -452,7 +452,7 @@ void WINAPI glColor4us( GLushort red, GLushort green, GLushort blue, GLushort al
     struct glColor4us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4us, &args ))) WARN( "glColor4us returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4us, &args ))) WARN( "glColor4us returned %#lx\n", status );
 }
 
 void WINAPI glColor4usv( const GLushort *v )
@@ -468,7 +468,7 @@ void WINAPI glColorMask( GLboolean red, GLboolean green, GLboolean blue, GLboole
     struct glColorMask_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColorMask, &args ))) WARN( "glColorMask returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorMask, &args ))) WARN( "glColorMask returned %#lx\n", status );
 }
 
 void WINAPI glColorMaterial( GLenum face, GLenum mode )
@@ -476,7 +476,7 @@ void WINAPI glColorMaterial( GLenum face, GLenum mode )
     struct glColorMaterial_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
     NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glColorMaterial, &args ))) WARN( "glColorMaterial returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorMaterial, &args ))) WARN( "glColorMaterial returned %#lx\n", status );
 }
 
 void WINAPI glColorPointer( GLint size, GLenum type, GLsizei stride, const void *pointer )
@@ -492,7 +492,7 @@ void WINAPI glCopyPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenu
     struct glCopyPixels_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .width = width, .height = height, .type = type };
     NTSTATUS status;
     TRACE( "x %d, y %d, width %d, height %d, type %d\n", x, y, width, height, type );
-    if ((status = UNIX_CALL( glCopyPixels, &args ))) WARN( "glCopyPixels returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyPixels, &args ))) WARN( "glCopyPixels returned %#lx\n", status );
 }
 
 void WINAPI glCopyTexImage1D( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border )
@@ -500,7 +500,7 @@ void WINAPI glCopyTexImage1D( GLenum target, GLint level, GLenum internalformat,
     struct glCopyTexImage1D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .border = border };
     NTSTATUS status;
     TRACE( "target %d, level %d, internalformat %d, x %d, y %d, width %d, border %d\n", target, level, internalformat, x, y, width, border );
-    if ((status = UNIX_CALL( glCopyTexImage1D, &args ))) WARN( "glCopyTexImage1D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexImage1D, &args ))) WARN( "glCopyTexImage1D returned %#lx\n", status );
 }
 
 void WINAPI glCopyTexImage2D( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
@@ -508,7 +508,7 @@ void WINAPI glCopyTexImage2D( GLenum target, GLint level, GLenum internalformat,
     struct glCopyTexImage2D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height, .border = border };
     NTSTATUS status;
     TRACE( "target %d, level %d, internalformat %d, x %d, y %d, width %d, height %d, border %d\n", target, level, internalformat, x, y, width, height, border );
-    if ((status = UNIX_CALL( glCopyTexImage2D, &args ))) WARN( "glCopyTexImage2D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexImage2D, &args ))) WARN( "glCopyTexImage2D returned %#lx\n", status );
 }
 
 void WINAPI glCopyTexSubImage1D( GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
@@ -516,7 +516,7 @@ void WINAPI glCopyTexSubImage1D( GLenum target, GLint level, GLint xoffset, GLin
     struct glCopyTexSubImage1D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, x %d, y %d, width %d\n", target, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyTexSubImage1D, &args ))) WARN( "glCopyTexSubImage1D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexSubImage1D, &args ))) WARN( "glCopyTexSubImage1D returned %#lx\n", status );
 }
 
 void WINAPI glCopyTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -524,7 +524,7 @@ void WINAPI glCopyTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLin
     struct glCopyTexSubImage2D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", target, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTexSubImage2D, &args ))) WARN( "glCopyTexSubImage2D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexSubImage2D, &args ))) WARN( "glCopyTexSubImage2D returned %#lx\n", status );
 }
 
 void WINAPI glCullFace( GLenum mode )
@@ -532,7 +532,7 @@ void WINAPI glCullFace( GLenum mode )
     struct glCullFace_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glCullFace, &args ))) WARN( "glCullFace returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCullFace, &args ))) WARN( "glCullFace returned %#lx\n", status );
 }
 
 void WINAPI glDeleteLists( GLuint list, GLsizei range )
@@ -540,7 +540,7 @@ void WINAPI glDeleteLists( GLuint list, GLsizei range )
     struct glDeleteLists_params args = { .teb = NtCurrentTeb(), .list = list, .range = range };
     NTSTATUS status;
     TRACE( "list %d, range %d\n", list, range );
-    if ((status = UNIX_CALL( glDeleteLists, &args ))) WARN( "glDeleteLists returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteLists, &args ))) WARN( "glDeleteLists returned %#lx\n", status );
 }
 
 void WINAPI glDeleteTextures( GLsizei n, const GLuint *textures )
@@ -556,7 +556,7 @@ void WINAPI glDepthFunc( GLenum func )
     struct glDepthFunc_params args = { .teb = NtCurrentTeb(), .func = func };
     NTSTATUS status;
     TRACE( "func %d\n", func );
-    if ((status = UNIX_CALL( glDepthFunc, &args ))) WARN( "glDepthFunc returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthFunc, &args ))) WARN( "glDepthFunc returned %#lx\n", status );
 }
 
 void WINAPI glDepthMask( GLboolean flag )
@@ -564,7 +564,7 @@ void WINAPI glDepthMask( GLboolean flag )
     struct glDepthMask_params args = { .teb = NtCurrentTeb(), .flag = flag };
     NTSTATUS status;
     TRACE( "flag %d\n", flag );
-    if ((status = UNIX_CALL( glDepthMask, &args ))) WARN( "glDepthMask returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthMask, &args ))) WARN( "glDepthMask returned %#lx\n", status );
 }
 
 void WINAPI glDepthRange( GLdouble n, GLdouble f )
@@ -572,7 +572,7 @@ void WINAPI glDepthRange( GLdouble n, GLdouble f )
     struct glDepthRange_params args = { .teb = NtCurrentTeb(), .n = n, .f = f };
     NTSTATUS status;
     TRACE( "n %f, f %f\n", n, f );
-    if ((status = UNIX_CALL( glDepthRange, &args ))) WARN( "glDepthRange returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthRange, &args ))) WARN( "glDepthRange returned %#lx\n", status );
 }
 
 void WINAPI glDisable( GLenum cap )
@@ -580,7 +580,7 @@ void WINAPI glDisable( GLenum cap )
     struct glDisable_params args = { .teb = NtCurrentTeb(), .cap = cap };
     NTSTATUS status;
     TRACE( "cap %d\n", cap );
-    if ((status = UNIX_CALL( glDisable, &args ))) WARN( "glDisable returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisable, &args ))) WARN( "glDisable returned %#lx\n", status );
 }
 
 void WINAPI glDisableClientState( GLenum array )
@@ -588,7 +588,7 @@ void WINAPI glDisableClientState( GLenum array )
     struct glDisableClientState_params args = { .teb = NtCurrentTeb(), .array = array };
     NTSTATUS status;
     TRACE( "array %d\n", array );
-    if ((status = UNIX_CALL( glDisableClientState, &args ))) WARN( "glDisableClientState returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableClientState, &args ))) WARN( "glDisableClientState returned %#lx\n", status );
 }
 
 void WINAPI glDrawArrays( GLenum mode, GLint first, GLsizei count )
@@ -604,7 +604,7 @@ void WINAPI glDrawBuffer( GLenum buf )
     struct glDrawBuffer_params args = { .teb = NtCurrentTeb(), .buf = buf };
     NTSTATUS status;
     TRACE( "buf %d\n", buf );
-    if ((status = UNIX_CALL( glDrawBuffer, &args ))) WARN( "glDrawBuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDrawBuffer, &args ))) WARN( "glDrawBuffer returned %#lx\n", status );
 }
 
 void WINAPI glDrawElements( GLenum mode, GLsizei count, GLenum type, const void *indices )
@@ -628,7 +628,7 @@ void WINAPI glEdgeFlag( GLboolean flag )
     struct glEdgeFlag_params args = { .teb = NtCurrentTeb(), .flag = flag };
     NTSTATUS status;
     TRACE( "flag %d\n", flag );
-    if ((status = UNIX_CALL( glEdgeFlag, &args ))) WARN( "glEdgeFlag returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEdgeFlag, &args ))) WARN( "glEdgeFlag returned %#lx\n", status );
 }
 
 void WINAPI glEdgeFlagPointer( GLsizei stride, const void *pointer )
@@ -652,7 +652,7 @@ void WINAPI glEnable( GLenum cap )
     struct glEnable_params args = { .teb = NtCurrentTeb(), .cap = cap };
     NTSTATUS status;
     TRACE( "cap %d\n", cap );
-    if ((status = UNIX_CALL( glEnable, &args ))) WARN( "glEnable returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnable, &args ))) WARN( "glEnable returned %#lx\n", status );
 }
 
 void WINAPI glEnableClientState( GLenum array )
@@ -660,7 +660,7 @@ void WINAPI glEnableClientState( GLenum array )
     struct glEnableClientState_params args = { .teb = NtCurrentTeb(), .array = array };
     NTSTATUS status;
     TRACE( "array %d\n", array );
-    if ((status = UNIX_CALL( glEnableClientState, &args ))) WARN( "glEnableClientState returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableClientState, &args ))) WARN( "glEnableClientState returned %#lx\n", status );
 }
 
 void WINAPI glEnd(void)
@@ -668,7 +668,7 @@ void WINAPI glEnd(void)
     struct glEnd_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEnd, &args ))) WARN( "glEnd returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnd, &args ))) WARN( "glEnd returned %#lx\n", status );
 }
 
 void WINAPI glEndList(void)
@@ -676,7 +676,7 @@ void WINAPI glEndList(void)
     struct glEndList_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndList, &args ))) WARN( "glEndList returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndList, &args ))) WARN( "glEndList returned %#lx\n", status );
 }
 
 void WINAPI glEvalCoord1d( GLdouble u )
@@ -684,7 +684,7 @@ void WINAPI glEvalCoord1d( GLdouble u )
     struct glEvalCoord1d_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %f\n", u );
-    if ((status = UNIX_CALL( glEvalCoord1d, &args ))) WARN( "glEvalCoord1d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalCoord1d, &args ))) WARN( "glEvalCoord1d returned %#lx\n", status );
 }
 
 void WINAPI glEvalCoord1dv( const GLdouble *u )
@@ -700,7 +700,7 @@ void WINAPI glEvalCoord1f( GLfloat u )
     struct glEvalCoord1f_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %f\n", u );
-    if ((status = UNIX_CALL( glEvalCoord1f, &args ))) WARN( "glEvalCoord1f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalCoord1f, &args ))) WARN( "glEvalCoord1f returned %#lx\n", status );
 }
 
 void WINAPI glEvalCoord1fv( const GLfloat *u )
@@ -716,7 +716,7 @@ void WINAPI glEvalCoord2d( GLdouble u, GLdouble v )
     struct glEvalCoord2d_params args = { .teb = NtCurrentTeb(), .u = u, .v = v };
     NTSTATUS status;
     TRACE( "u %f, v %f\n", u, v );
-    if ((status = UNIX_CALL( glEvalCoord2d, &args ))) WARN( "glEvalCoord2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalCoord2d, &args ))) WARN( "glEvalCoord2d returned %#lx\n", status );
 }
 
 void WINAPI glEvalCoord2dv( const GLdouble *u )
@@ -732,7 +732,7 @@ void WINAPI glEvalCoord2f( GLfloat u, GLfloat v )
     struct glEvalCoord2f_params args = { .teb = NtCurrentTeb(), .u = u, .v = v };
     NTSTATUS status;
     TRACE( "u %f, v %f\n", u, v );
-    if ((status = UNIX_CALL( glEvalCoord2f, &args ))) WARN( "glEvalCoord2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalCoord2f, &args ))) WARN( "glEvalCoord2f returned %#lx\n", status );
 }
 
 void WINAPI glEvalCoord2fv( const GLfloat *u )
@@ -748,7 +748,7 @@ void WINAPI glEvalMesh1( GLenum mode, GLint i1, GLint i2 )
     struct glEvalMesh1_params args = { .teb = NtCurrentTeb(), .mode = mode, .i1 = i1, .i2 = i2 };
     NTSTATUS status;
     TRACE( "mode %d, i1 %d, i2 %d\n", mode, i1, i2 );
-    if ((status = UNIX_CALL( glEvalMesh1, &args ))) WARN( "glEvalMesh1 returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalMesh1, &args ))) WARN( "glEvalMesh1 returned %#lx\n", status );
 }
 
 void WINAPI glEvalMesh2( GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2 )
@@ -756,7 +756,7 @@ void WINAPI glEvalMesh2( GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2 )
     struct glEvalMesh2_params args = { .teb = NtCurrentTeb(), .mode = mode, .i1 = i1, .i2 = i2, .j1 = j1, .j2 = j2 };
     NTSTATUS status;
     TRACE( "mode %d, i1 %d, i2 %d, j1 %d, j2 %d\n", mode, i1, i2, j1, j2 );
-    if ((status = UNIX_CALL( glEvalMesh2, &args ))) WARN( "glEvalMesh2 returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalMesh2, &args ))) WARN( "glEvalMesh2 returned %#lx\n", status );
 }
 
 void WINAPI glEvalPoint1( GLint i )
@@ -764,7 +764,7 @@ void WINAPI glEvalPoint1( GLint i )
     struct glEvalPoint1_params args = { .teb = NtCurrentTeb(), .i = i };
     NTSTATUS status;
     TRACE( "i %d\n", i );
-    if ((status = UNIX_CALL( glEvalPoint1, &args ))) WARN( "glEvalPoint1 returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalPoint1, &args ))) WARN( "glEvalPoint1 returned %#lx\n", status );
 }
 
 void WINAPI glEvalPoint2( GLint i, GLint j )
@@ -772,7 +772,7 @@ void WINAPI glEvalPoint2( GLint i, GLint j )
     struct glEvalPoint2_params args = { .teb = NtCurrentTeb(), .i = i, .j = j };
     NTSTATUS status;
     TRACE( "i %d, j %d\n", i, j );
-    if ((status = UNIX_CALL( glEvalPoint2, &args ))) WARN( "glEvalPoint2 returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalPoint2, &args ))) WARN( "glEvalPoint2 returned %#lx\n", status );
 }
 
 void WINAPI glFeedbackBuffer( GLsizei size, GLenum type, GLfloat *buffer )
@@ -804,7 +804,7 @@ void WINAPI glFogf( GLenum pname, GLfloat param )
     struct glFogf_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glFogf, &args ))) WARN( "glFogf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogf, &args ))) WARN( "glFogf returned %#lx\n", status );
 }
 
 void WINAPI glFogfv( GLenum pname, const GLfloat *params )
@@ -820,7 +820,7 @@ void WINAPI glFogi( GLenum pname, GLint param )
     struct glFogi_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glFogi, &args ))) WARN( "glFogi returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogi, &args ))) WARN( "glFogi returned %#lx\n", status );
 }
 
 void WINAPI glFogiv( GLenum pname, const GLint *params )
@@ -836,7 +836,7 @@ void WINAPI glFrontFace( GLenum mode )
     struct glFrontFace_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glFrontFace, &args ))) WARN( "glFrontFace returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFrontFace, &args ))) WARN( "glFrontFace returned %#lx\n", status );
 }
 
 void WINAPI glFrustum( GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar )
@@ -844,7 +844,7 @@ void WINAPI glFrustum( GLdouble left, GLdouble right, GLdouble bottom, GLdouble
     struct glFrustum_params args = { .teb = NtCurrentTeb(), .left = left, .right = right, .bottom = bottom, .top = top, .zNear = zNear, .zFar = zFar };
     NTSTATUS status;
     TRACE( "left %f, right %f, bottom %f, top %f, zNear %f, zFar %f\n", left, right, bottom, top, zNear, zFar );
-    if ((status = UNIX_CALL( glFrustum, &args ))) WARN( "glFrustum returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFrustum, &args ))) WARN( "glFrustum returned %#lx\n", status );
 }
 
 GLuint WINAPI glGenLists( GLsizei range )
@@ -1094,7 +1094,7 @@ void WINAPI glHint( GLenum target, GLenum mode )
     struct glHint_params args = { .teb = NtCurrentTeb(), .target = target, .mode = mode };
     NTSTATUS status;
     TRACE( "target %d, mode %d\n", target, mode );
-    if ((status = UNIX_CALL( glHint, &args ))) WARN( "glHint returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glHint, &args ))) WARN( "glHint returned %#lx\n", status );
 }
 
 void WINAPI glIndexMask( GLuint mask )
@@ -1102,7 +1102,7 @@ void WINAPI glIndexMask( GLuint mask )
     struct glIndexMask_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glIndexMask, &args ))) WARN( "glIndexMask returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexMask, &args ))) WARN( "glIndexMask returned %#lx\n", status );
 }
 
 void WINAPI glIndexPointer( GLenum type, GLsizei stride, const void *pointer )
@@ -1118,7 +1118,7 @@ void WINAPI glIndexd( GLdouble c )
     struct glIndexd_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %f\n", c );
-    if ((status = UNIX_CALL( glIndexd, &args ))) WARN( "glIndexd returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexd, &args ))) WARN( "glIndexd returned %#lx\n", status );
 }
 
 void WINAPI glIndexdv( const GLdouble *c )
@@ -1134,7 +1134,7 @@ void WINAPI glIndexf( GLfloat c )
     struct glIndexf_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %f\n", c );
-    if ((status = UNIX_CALL( glIndexf, &args ))) WARN( "glIndexf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexf, &args ))) WARN( "glIndexf returned %#lx\n", status );
 }
 
 void WINAPI glIndexfv( const GLfloat *c )
@@ -1150,7 +1150,7 @@ void WINAPI glIndexi( GLint c )
     struct glIndexi_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %d\n", c );
-    if ((status = UNIX_CALL( glIndexi, &args ))) WARN( "glIndexi returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexi, &args ))) WARN( "glIndexi returned %#lx\n", status );
 }
 
 void WINAPI glIndexiv( const GLint *c )
@@ -1166,7 +1166,7 @@ void WINAPI glIndexs( GLshort c )
     struct glIndexs_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %d\n", c );
-    if ((status = UNIX_CALL( glIndexs, &args ))) WARN( "glIndexs returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexs, &args ))) WARN( "glIndexs returned %#lx\n", status );
 }
 
 void WINAPI glIndexsv( const GLshort *c )
@@ -1182,7 +1182,7 @@ void WINAPI glIndexub( GLubyte c )
     struct glIndexub_params args = { .teb = NtCurrentTeb(), .c = c };
     NTSTATUS status;
     TRACE( "c %d\n", c );
-    if ((status = UNIX_CALL( glIndexub, &args ))) WARN( "glIndexub returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexub, &args ))) WARN( "glIndexub returned %#lx\n", status );
 }
 
 void WINAPI glIndexubv( const GLubyte *c )
@@ -1198,7 +1198,7 @@ void WINAPI glInitNames(void)
     struct glInitNames_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glInitNames, &args ))) WARN( "glInitNames returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glInitNames, &args ))) WARN( "glInitNames returned %#lx\n", status );
 }
 
 void WINAPI glInterleavedArrays( GLenum format, GLsizei stride, const void *pointer )
@@ -1241,7 +1241,7 @@ void WINAPI glLightModelf( GLenum pname, GLfloat param )
     struct glLightModelf_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glLightModelf, &args ))) WARN( "glLightModelf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLightModelf, &args ))) WARN( "glLightModelf returned %#lx\n", status );
 }
 
 void WINAPI glLightModelfv( GLenum pname, const GLfloat *params )
@@ -1257,7 +1257,7 @@ void WINAPI glLightModeli( GLenum pname, GLint param )
     struct glLightModeli_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glLightModeli, &args ))) WARN( "glLightModeli returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLightModeli, &args ))) WARN( "glLightModeli returned %#lx\n", status );
 }
 
 void WINAPI glLightModeliv( GLenum pname, const GLint *params )
@@ -1273,7 +1273,7 @@ void WINAPI glLightf( GLenum light, GLenum pname, GLfloat param )
     struct glLightf_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "light %d, pname %d, param %f\n", light, pname, param );
-    if ((status = UNIX_CALL( glLightf, &args ))) WARN( "glLightf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLightf, &args ))) WARN( "glLightf returned %#lx\n", status );
 }
 
 void WINAPI glLightfv( GLenum light, GLenum pname, const GLfloat *params )
@@ -1289,7 +1289,7 @@ void WINAPI glLighti( GLenum light, GLenum pname, GLint param )
     struct glLighti_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "light %d, pname %d, param %d\n", light, pname, param );
-    if ((status = UNIX_CALL( glLighti, &args ))) WARN( "glLighti returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLighti, &args ))) WARN( "glLighti returned %#lx\n", status );
 }
 
 void WINAPI glLightiv( GLenum light, GLenum pname, const GLint *params )
@@ -1305,7 +1305,7 @@ void WINAPI glLineStipple( GLint factor, GLushort pattern )
     struct glLineStipple_params args = { .teb = NtCurrentTeb(), .factor = factor, .pattern = pattern };
     NTSTATUS status;
     TRACE( "factor %d, pattern %d\n", factor, pattern );
-    if ((status = UNIX_CALL( glLineStipple, &args ))) WARN( "glLineStipple returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLineStipple, &args ))) WARN( "glLineStipple returned %#lx\n", status );
 }
 
 void WINAPI glLineWidth( GLfloat width )
@@ -1313,7 +1313,7 @@ void WINAPI glLineWidth( GLfloat width )
     struct glLineWidth_params args = { .teb = NtCurrentTeb(), .width = width };
     NTSTATUS status;
     TRACE( "width %f\n", width );
-    if ((status = UNIX_CALL( glLineWidth, &args ))) WARN( "glLineWidth returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLineWidth, &args ))) WARN( "glLineWidth returned %#lx\n", status );
 }
 
 void WINAPI glListBase( GLuint base )
@@ -1321,7 +1321,7 @@ void WINAPI glListBase( GLuint base )
     struct glListBase_params args = { .teb = NtCurrentTeb(), .base = base };
     NTSTATUS status;
     TRACE( "base %d\n", base );
-    if ((status = UNIX_CALL( glListBase, &args ))) WARN( "glListBase returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glListBase, &args ))) WARN( "glListBase returned %#lx\n", status );
 }
 
 void WINAPI glLoadIdentity(void)
@@ -1329,7 +1329,7 @@ void WINAPI glLoadIdentity(void)
     struct glLoadIdentity_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glLoadIdentity, &args ))) WARN( "glLoadIdentity returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLoadIdentity, &args ))) WARN( "glLoadIdentity returned %#lx\n", status );
 }
 
 void WINAPI glLoadMatrixd( const GLdouble *m )
@@ -1353,7 +1353,7 @@ void WINAPI glLoadName( GLuint name )
     struct glLoadName_params args = { .teb = NtCurrentTeb(), .name = name };
     NTSTATUS status;
     TRACE( "name %d\n", name );
-    if ((status = UNIX_CALL( glLoadName, &args ))) WARN( "glLoadName returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLoadName, &args ))) WARN( "glLoadName returned %#lx\n", status );
 }
 
 void WINAPI glLogicOp( GLenum opcode )
@@ -1361,7 +1361,7 @@ void WINAPI glLogicOp( GLenum opcode )
     struct glLogicOp_params args = { .teb = NtCurrentTeb(), .opcode = opcode };
     NTSTATUS status;
     TRACE( "opcode %d\n", opcode );
-    if ((status = UNIX_CALL( glLogicOp, &args ))) WARN( "glLogicOp returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLogicOp, &args ))) WARN( "glLogicOp returned %#lx\n", status );
 }
 
 void WINAPI glMap1d( GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points )
@@ -1401,7 +1401,7 @@ void WINAPI glMapGrid1d( GLint un, GLdouble u1, GLdouble u2 )
     struct glMapGrid1d_params args = { .teb = NtCurrentTeb(), .un = un, .u1 = u1, .u2 = u2 };
     NTSTATUS status;
     TRACE( "un %d, u1 %f, u2 %f\n", un, u1, u2 );
-    if ((status = UNIX_CALL( glMapGrid1d, &args ))) WARN( "glMapGrid1d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMapGrid1d, &args ))) WARN( "glMapGrid1d returned %#lx\n", status );
 }
 
 void WINAPI glMapGrid1f( GLint un, GLfloat u1, GLfloat u2 )
@@ -1409,7 +1409,7 @@ void WINAPI glMapGrid1f( GLint un, GLfloat u1, GLfloat u2 )
     struct glMapGrid1f_params args = { .teb = NtCurrentTeb(), .un = un, .u1 = u1, .u2 = u2 };
     NTSTATUS status;
     TRACE( "un %d, u1 %f, u2 %f\n", un, u1, u2 );
-    if ((status = UNIX_CALL( glMapGrid1f, &args ))) WARN( "glMapGrid1f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMapGrid1f, &args ))) WARN( "glMapGrid1f returned %#lx\n", status );
 }
 
 void WINAPI glMapGrid2d( GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2 )
@@ -1417,7 +1417,7 @@ void WINAPI glMapGrid2d( GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble
     struct glMapGrid2d_params args = { .teb = NtCurrentTeb(), .un = un, .u1 = u1, .u2 = u2, .vn = vn, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "un %d, u1 %f, u2 %f, vn %d, v1 %f, v2 %f\n", un, u1, u2, vn, v1, v2 );
-    if ((status = UNIX_CALL( glMapGrid2d, &args ))) WARN( "glMapGrid2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMapGrid2d, &args ))) WARN( "glMapGrid2d returned %#lx\n", status );
 }
 
 void WINAPI glMapGrid2f( GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2 )
@@ -1425,7 +1425,7 @@ void WINAPI glMapGrid2f( GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1,
     struct glMapGrid2f_params args = { .teb = NtCurrentTeb(), .un = un, .u1 = u1, .u2 = u2, .vn = vn, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "un %d, u1 %f, u2 %f, vn %d, v1 %f, v2 %f\n", un, u1, u2, vn, v1, v2 );
-    if ((status = UNIX_CALL( glMapGrid2f, &args ))) WARN( "glMapGrid2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMapGrid2f, &args ))) WARN( "glMapGrid2f returned %#lx\n", status );
 }
 
 void WINAPI glMaterialf( GLenum face, GLenum pname, GLfloat param )
@@ -1433,7 +1433,7 @@ void WINAPI glMaterialf( GLenum face, GLenum pname, GLfloat param )
     struct glMaterialf_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "face %d, pname %d, param %f\n", face, pname, param );
-    if ((status = UNIX_CALL( glMaterialf, &args ))) WARN( "glMaterialf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMaterialf, &args ))) WARN( "glMaterialf returned %#lx\n", status );
 }
 
 void WINAPI glMaterialfv( GLenum face, GLenum pname, const GLfloat *params )
@@ -1449,7 +1449,7 @@ void WINAPI glMateriali( GLenum face, GLenum pname, GLint param )
     struct glMateriali_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "face %d, pname %d, param %d\n", face, pname, param );
-    if ((status = UNIX_CALL( glMateriali, &args ))) WARN( "glMateriali returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMateriali, &args ))) WARN( "glMateriali returned %#lx\n", status );
 }
 
 void WINAPI glMaterialiv( GLenum face, GLenum pname, const GLint *params )
@@ -1465,7 +1465,7 @@ void WINAPI glMatrixMode( GLenum mode )
     struct glMatrixMode_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glMatrixMode, &args ))) WARN( "glMatrixMode returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixMode, &args ))) WARN( "glMatrixMode returned %#lx\n", status );
 }
 
 void WINAPI glMultMatrixd( const GLdouble *m )
@@ -1489,7 +1489,7 @@ void WINAPI glNewList( GLuint list, GLenum mode )
     struct glNewList_params args = { .teb = NtCurrentTeb(), .list = list, .mode = mode };
     NTSTATUS status;
     TRACE( "list %d, mode %d\n", list, mode );
-    if ((status = UNIX_CALL( glNewList, &args ))) WARN( "glNewList returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNewList, &args ))) WARN( "glNewList returned %#lx\n", status );
 }
 
 void WINAPI glNormal3b( GLbyte nx, GLbyte ny, GLbyte nz )
@@ -1497,7 +1497,7 @@ void WINAPI glNormal3b( GLbyte nx, GLbyte ny, GLbyte nz )
     struct glNormal3b_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3b, &args ))) WARN( "glNormal3b returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormal3b, &args ))) WARN( "glNormal3b returned %#lx\n", status );
 }
 
 void WINAPI glNormal3bv( const GLbyte *v )
@@ -1513,7 +1513,7 @@ void WINAPI glNormal3d( GLdouble nx, GLdouble ny, GLdouble nz )
     struct glNormal3d_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %f, ny %f, nz %f\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3d, &args ))) WARN( "glNormal3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormal3d, &args ))) WARN( "glNormal3d returned %#lx\n", status );
 }
 
 void WINAPI glNormal3dv( const GLdouble *v )
@@ -1529,7 +1529,7 @@ void WINAPI glNormal3f( GLfloat nx, GLfloat ny, GLfloat nz )
     struct glNormal3f_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %f, ny %f, nz %f\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3f, &args ))) WARN( "glNormal3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormal3f, &args ))) WARN( "glNormal3f returned %#lx\n", status );
 }
 
 void WINAPI glNormal3fv( const GLfloat *v )
@@ -1545,7 +1545,7 @@ void WINAPI glNormal3i( GLint nx, GLint ny, GLint nz )
     struct glNormal3i_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3i, &args ))) WARN( "glNormal3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormal3i, &args ))) WARN( "glNormal3i returned %#lx\n", status );
 }
 
 void WINAPI glNormal3iv( const GLint *v )
@@ -1561,7 +1561,7 @@ void WINAPI glNormal3s( GLshort nx, GLshort ny, GLshort nz )
     struct glNormal3s_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3s, &args ))) WARN( "glNormal3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormal3s, &args ))) WARN( "glNormal3s returned %#lx\n", status );
 }
 
 void WINAPI glNormal3sv( const GLshort *v )
@@ -1585,7 +1585,7 @@ void WINAPI glOrtho( GLdouble left, GLdouble right, GLdouble bottom, GLdouble to
     struct glOrtho_params args = { .teb = NtCurrentTeb(), .left = left, .right = right, .bottom = bottom, .top = top, .zNear = zNear, .zFar = zFar };
     NTSTATUS status;
     TRACE( "left %f, right %f, bottom %f, top %f, zNear %f, zFar %f\n", left, right, bottom, top, zNear, zFar );
-    if ((status = UNIX_CALL( glOrtho, &args ))) WARN( "glOrtho returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glOrtho, &args ))) WARN( "glOrtho returned %#lx\n", status );
 }
 
 void WINAPI glPassThrough( GLfloat token )
@@ -1593,7 +1593,7 @@ void WINAPI glPassThrough( GLfloat token )
     struct glPassThrough_params args = { .teb = NtCurrentTeb(), .token = token };
     NTSTATUS status;
     TRACE( "token %f\n", token );
-    if ((status = UNIX_CALL( glPassThrough, &args ))) WARN( "glPassThrough returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPassThrough, &args ))) WARN( "glPassThrough returned %#lx\n", status );
 }
 
 void WINAPI glPixelMapfv( GLenum map, GLsizei mapsize, const GLfloat *values )
@@ -1625,7 +1625,7 @@ void WINAPI glPixelStoref( GLenum pname, GLfloat param )
     struct glPixelStoref_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPixelStoref, &args ))) WARN( "glPixelStoref returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelStoref, &args ))) WARN( "glPixelStoref returned %#lx\n", status );
 }
 
 void WINAPI glPixelStorei( GLenum pname, GLint param )
@@ -1633,7 +1633,7 @@ void WINAPI glPixelStorei( GLenum pname, GLint param )
     struct glPixelStorei_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelStorei, &args ))) WARN( "glPixelStorei returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelStorei, &args ))) WARN( "glPixelStorei returned %#lx\n", status );
 }
 
 void WINAPI glPixelTransferf( GLenum pname, GLfloat param )
@@ -1641,7 +1641,7 @@ void WINAPI glPixelTransferf( GLenum pname, GLfloat param )
     struct glPixelTransferf_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTransferf, &args ))) WARN( "glPixelTransferf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelTransferf, &args ))) WARN( "glPixelTransferf returned %#lx\n", status );
 }
 
 void WINAPI glPixelTransferi( GLenum pname, GLint param )
@@ -1649,7 +1649,7 @@ void WINAPI glPixelTransferi( GLenum pname, GLint param )
     struct glPixelTransferi_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTransferi, &args ))) WARN( "glPixelTransferi returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelTransferi, &args ))) WARN( "glPixelTransferi returned %#lx\n", status );
 }
 
 void WINAPI glPixelZoom( GLfloat xfactor, GLfloat yfactor )
@@ -1657,7 +1657,7 @@ void WINAPI glPixelZoom( GLfloat xfactor, GLfloat yfactor )
     struct glPixelZoom_params args = { .teb = NtCurrentTeb(), .xfactor = xfactor, .yfactor = yfactor };
     NTSTATUS status;
     TRACE( "xfactor %f, yfactor %f\n", xfactor, yfactor );
-    if ((status = UNIX_CALL( glPixelZoom, &args ))) WARN( "glPixelZoom returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelZoom, &args ))) WARN( "glPixelZoom returned %#lx\n", status );
 }
 
 void WINAPI glPointSize( GLfloat size )
@@ -1665,7 +1665,7 @@ void WINAPI glPointSize( GLfloat size )
     struct glPointSize_params args = { .teb = NtCurrentTeb(), .size = size };
     NTSTATUS status;
     TRACE( "size %f\n", size );
-    if ((status = UNIX_CALL( glPointSize, &args ))) WARN( "glPointSize returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPointSize, &args ))) WARN( "glPointSize returned %#lx\n", status );
 }
 
 void WINAPI glPolygonMode( GLenum face, GLenum mode )
@@ -1673,7 +1673,7 @@ void WINAPI glPolygonMode( GLenum face, GLenum mode )
     struct glPolygonMode_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
     NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glPolygonMode, &args ))) WARN( "glPolygonMode returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPolygonMode, &args ))) WARN( "glPolygonMode returned %#lx\n", status );
 }
 
 void WINAPI glPolygonOffset( GLfloat factor, GLfloat units )
@@ -1681,7 +1681,7 @@ void WINAPI glPolygonOffset( GLfloat factor, GLfloat units )
     struct glPolygonOffset_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units };
     NTSTATUS status;
     TRACE( "factor %f, units %f\n", factor, units );
-    if ((status = UNIX_CALL( glPolygonOffset, &args ))) WARN( "glPolygonOffset returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPolygonOffset, &args ))) WARN( "glPolygonOffset returned %#lx\n", status );
 }
 
 void WINAPI glPolygonStipple( const GLubyte *mask )
@@ -1697,7 +1697,7 @@ void WINAPI glPopAttrib(void)
     struct glPopAttrib_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopAttrib, &args ))) WARN( "glPopAttrib returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPopAttrib, &args ))) WARN( "glPopAttrib returned %#lx\n", status );
 }
 
 void WINAPI glPopClientAttrib(void)
@@ -1705,7 +1705,7 @@ void WINAPI glPopClientAttrib(void)
     struct glPopClientAttrib_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopClientAttrib, &args ))) WARN( "glPopClientAttrib returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPopClientAttrib, &args ))) WARN( "glPopClientAttrib returned %#lx\n", status );
 }
 
 void WINAPI glPopMatrix(void)
@@ -1713,7 +1713,7 @@ void WINAPI glPopMatrix(void)
     struct glPopMatrix_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopMatrix, &args ))) WARN( "glPopMatrix returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPopMatrix, &args ))) WARN( "glPopMatrix returned %#lx\n", status );
 }
 
 void WINAPI glPopName(void)
@@ -1721,7 +1721,7 @@ void WINAPI glPopName(void)
     struct glPopName_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopName, &args ))) WARN( "glPopName returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPopName, &args ))) WARN( "glPopName returned %#lx\n", status );
 }
 
 void WINAPI glPrioritizeTextures( GLsizei n, const GLuint *textures, const GLfloat *priorities )
@@ -1737,7 +1737,7 @@ void WINAPI glPushAttrib( GLbitfield mask )
     struct glPushAttrib_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glPushAttrib, &args ))) WARN( "glPushAttrib returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPushAttrib, &args ))) WARN( "glPushAttrib returned %#lx\n", status );
 }
 
 void WINAPI glPushClientAttrib( GLbitfield mask )
@@ -1745,7 +1745,7 @@ void WINAPI glPushClientAttrib( GLbitfield mask )
     struct glPushClientAttrib_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glPushClientAttrib, &args ))) WARN( "glPushClientAttrib returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPushClientAttrib, &args ))) WARN( "glPushClientAttrib returned %#lx\n", status );
 }
 
 void WINAPI glPushMatrix(void)
@@ -1753,7 +1753,7 @@ void WINAPI glPushMatrix(void)
     struct glPushMatrix_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPushMatrix, &args ))) WARN( "glPushMatrix returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPushMatrix, &args ))) WARN( "glPushMatrix returned %#lx\n", status );
 }
 
 void WINAPI glPushName( GLuint name )
@@ -1761,7 +1761,7 @@ void WINAPI glPushName( GLuint name )
     struct glPushName_params args = { .teb = NtCurrentTeb(), .name = name };
     NTSTATUS status;
     TRACE( "name %d\n", name );
-    if ((status = UNIX_CALL( glPushName, &args ))) WARN( "glPushName returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPushName, &args ))) WARN( "glPushName returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos2d( GLdouble x, GLdouble y )
@@ -1769,7 +1769,7 @@ void WINAPI glRasterPos2d( GLdouble x, GLdouble y )
     struct glRasterPos2d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2d, &args ))) WARN( "glRasterPos2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos2d, &args ))) WARN( "glRasterPos2d returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos2dv( const GLdouble *v )
@@ -1785,7 +1785,7 @@ void WINAPI glRasterPos2f( GLfloat x, GLfloat y )
     struct glRasterPos2f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2f, &args ))) WARN( "glRasterPos2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos2f, &args ))) WARN( "glRasterPos2f returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos2fv( const GLfloat *v )
@@ -1801,7 +1801,7 @@ void WINAPI glRasterPos2i( GLint x, GLint y )
     struct glRasterPos2i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2i, &args ))) WARN( "glRasterPos2i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos2i, &args ))) WARN( "glRasterPos2i returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos2iv( const GLint *v )
@@ -1817,7 +1817,7 @@ void WINAPI glRasterPos2s( GLshort x, GLshort y )
     struct glRasterPos2s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2s, &args ))) WARN( "glRasterPos2s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos2s, &args ))) WARN( "glRasterPos2s returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos2sv( const GLshort *v )
@@ -1833,7 +1833,7 @@ void WINAPI glRasterPos3d( GLdouble x, GLdouble y, GLdouble z )
     struct glRasterPos3d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3d, &args ))) WARN( "glRasterPos3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos3d, &args ))) WARN( "glRasterPos3d returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos3dv( const GLdouble *v )
@@ -1849,7 +1849,7 @@ void WINAPI glRasterPos3f( GLfloat x, GLfloat y, GLfloat z )
     struct glRasterPos3f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3f, &args ))) WARN( "glRasterPos3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos3f, &args ))) WARN( "glRasterPos3f returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos3fv( const GLfloat *v )
@@ -1865,7 +1865,7 @@ void WINAPI glRasterPos3i( GLint x, GLint y, GLint z )
     struct glRasterPos3i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3i, &args ))) WARN( "glRasterPos3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos3i, &args ))) WARN( "glRasterPos3i returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos3iv( const GLint *v )
@@ -1881,7 +1881,7 @@ void WINAPI glRasterPos3s( GLshort x, GLshort y, GLshort z )
     struct glRasterPos3s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3s, &args ))) WARN( "glRasterPos3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos3s, &args ))) WARN( "glRasterPos3s returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos3sv( const GLshort *v )
@@ -1897,7 +1897,7 @@ void WINAPI glRasterPos4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w )
     struct glRasterPos4d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4d, &args ))) WARN( "glRasterPos4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos4d, &args ))) WARN( "glRasterPos4d returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos4dv( const GLdouble *v )
@@ -1913,7 +1913,7 @@ void WINAPI glRasterPos4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w )
     struct glRasterPos4f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4f, &args ))) WARN( "glRasterPos4f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos4f, &args ))) WARN( "glRasterPos4f returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos4fv( const GLfloat *v )
@@ -1929,7 +1929,7 @@ void WINAPI glRasterPos4i( GLint x, GLint y, GLint z, GLint w )
     struct glRasterPos4i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4i, &args ))) WARN( "glRasterPos4i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos4i, &args ))) WARN( "glRasterPos4i returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos4iv( const GLint *v )
@@ -1945,7 +1945,7 @@ void WINAPI glRasterPos4s( GLshort x, GLshort y, GLshort z, GLshort w )
     struct glRasterPos4s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4s, &args ))) WARN( "glRasterPos4s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos4s, &args ))) WARN( "glRasterPos4s returned %#lx\n", status );
 }
 
 void WINAPI glRasterPos4sv( const GLshort *v )
@@ -1961,7 +1961,7 @@ void WINAPI glReadBuffer( GLenum src )
     struct glReadBuffer_params args = { .teb = NtCurrentTeb(), .src = src };
     NTSTATUS status;
     TRACE( "src %d\n", src );
-    if ((status = UNIX_CALL( glReadBuffer, &args ))) WARN( "glReadBuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReadBuffer, &args ))) WARN( "glReadBuffer returned %#lx\n", status );
 }
 
 void WINAPI glReadPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels )
@@ -1977,7 +1977,7 @@ void WINAPI glRectd( GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2 )
     struct glRectd_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
     NTSTATUS status;
     TRACE( "x1 %f, y1 %f, x2 %f, y2 %f\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRectd, &args ))) WARN( "glRectd returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRectd, &args ))) WARN( "glRectd returned %#lx\n", status );
 }
 
 void WINAPI glRectdv( const GLdouble *v1, const GLdouble *v2 )
@@ -1993,7 +1993,7 @@ void WINAPI glRectf( GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2 )
     struct glRectf_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
     NTSTATUS status;
     TRACE( "x1 %f, y1 %f, x2 %f, y2 %f\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRectf, &args ))) WARN( "glRectf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRectf, &args ))) WARN( "glRectf returned %#lx\n", status );
 }
 
 void WINAPI glRectfv( const GLfloat *v1, const GLfloat *v2 )
@@ -2009,7 +2009,7 @@ void WINAPI glRecti( GLint x1, GLint y1, GLint x2, GLint y2 )
     struct glRecti_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
     NTSTATUS status;
     TRACE( "x1 %d, y1 %d, x2 %d, y2 %d\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRecti, &args ))) WARN( "glRecti returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRecti, &args ))) WARN( "glRecti returned %#lx\n", status );
 }
 
 void WINAPI glRectiv( const GLint *v1, const GLint *v2 )
@@ -2025,7 +2025,7 @@ void WINAPI glRects( GLshort x1, GLshort y1, GLshort x2, GLshort y2 )
     struct glRects_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
     NTSTATUS status;
     TRACE( "x1 %d, y1 %d, x2 %d, y2 %d\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRects, &args ))) WARN( "glRects returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRects, &args ))) WARN( "glRects returned %#lx\n", status );
 }
 
 void WINAPI glRectsv( const GLshort *v1, const GLshort *v2 )
@@ -2050,7 +2050,7 @@ void WINAPI glRotated( GLdouble angle, GLdouble x, GLdouble y, GLdouble z )
     struct glRotated_params args = { .teb = NtCurrentTeb(), .angle = angle, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "angle %f, x %f, y %f, z %f\n", angle, x, y, z );
-    if ((status = UNIX_CALL( glRotated, &args ))) WARN( "glRotated returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRotated, &args ))) WARN( "glRotated returned %#lx\n", status );
 }
 
 void WINAPI glRotatef( GLfloat angle, GLfloat x, GLfloat y, GLfloat z )
@@ -2058,7 +2058,7 @@ void WINAPI glRotatef( GLfloat angle, GLfloat x, GLfloat y, GLfloat z )
     struct glRotatef_params args = { .teb = NtCurrentTeb(), .angle = angle, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "angle %f, x %f, y %f, z %f\n", angle, x, y, z );
-    if ((status = UNIX_CALL( glRotatef, &args ))) WARN( "glRotatef returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRotatef, &args ))) WARN( "glRotatef returned %#lx\n", status );
 }
 
 void WINAPI glScaled( GLdouble x, GLdouble y, GLdouble z )
@@ -2066,7 +2066,7 @@ void WINAPI glScaled( GLdouble x, GLdouble y, GLdouble z )
     struct glScaled_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glScaled, &args ))) WARN( "glScaled returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glScaled, &args ))) WARN( "glScaled returned %#lx\n", status );
 }
 
 void WINAPI glScalef( GLfloat x, GLfloat y, GLfloat z )
@@ -2074,7 +2074,7 @@ void WINAPI glScalef( GLfloat x, GLfloat y, GLfloat z )
     struct glScalef_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glScalef, &args ))) WARN( "glScalef returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glScalef, &args ))) WARN( "glScalef returned %#lx\n", status );
 }
 
 void WINAPI glScissor( GLint x, GLint y, GLsizei width, GLsizei height )
@@ -2082,7 +2082,7 @@ void WINAPI glScissor( GLint x, GLint y, GLsizei width, GLsizei height )
     struct glScissor_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "x %d, y %d, width %d, height %d\n", x, y, width, height );
-    if ((status = UNIX_CALL( glScissor, &args ))) WARN( "glScissor returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glScissor, &args ))) WARN( "glScissor returned %#lx\n", status );
 }
 
 void WINAPI glSelectBuffer( GLsizei size, GLuint *buffer )
@@ -2098,7 +2098,7 @@ void WINAPI glShadeModel( GLenum mode )
     struct glShadeModel_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glShadeModel, &args ))) WARN( "glShadeModel returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glShadeModel, &args ))) WARN( "glShadeModel returned %#lx\n", status );
 }
 
 void WINAPI glStencilFunc( GLenum func, GLint ref, GLuint mask )
@@ -2106,7 +2106,7 @@ void WINAPI glStencilFunc( GLenum func, GLint ref, GLuint mask )
     struct glStencilFunc_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref, .mask = mask };
     NTSTATUS status;
     TRACE( "func %d, ref %d, mask %d\n", func, ref, mask );
-    if ((status = UNIX_CALL( glStencilFunc, &args ))) WARN( "glStencilFunc returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilFunc, &args ))) WARN( "glStencilFunc returned %#lx\n", status );
 }
 
 void WINAPI glStencilMask( GLuint mask )
@@ -2114,7 +2114,7 @@ void WINAPI glStencilMask( GLuint mask )
     struct glStencilMask_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glStencilMask, &args ))) WARN( "glStencilMask returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilMask, &args ))) WARN( "glStencilMask returned %#lx\n", status );
 }
 
 void WINAPI glStencilOp( GLenum fail, GLenum zfail, GLenum zpass )
@@ -2122,7 +2122,7 @@ void WINAPI glStencilOp( GLenum fail, GLenum zfail, GLenum zpass )
     struct glStencilOp_params args = { .teb = NtCurrentTeb(), .fail = fail, .zfail = zfail, .zpass = zpass };
     NTSTATUS status;
     TRACE( "fail %d, zfail %d, zpass %d\n", fail, zfail, zpass );
-    if ((status = UNIX_CALL( glStencilOp, &args ))) WARN( "glStencilOp returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilOp, &args ))) WARN( "glStencilOp returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord1d( GLdouble s )
@@ -2130,7 +2130,7 @@ void WINAPI glTexCoord1d( GLdouble s )
     struct glTexCoord1d_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %f\n", s );
-    if ((status = UNIX_CALL( glTexCoord1d, &args ))) WARN( "glTexCoord1d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord1d, &args ))) WARN( "glTexCoord1d returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord1dv( const GLdouble *v )
@@ -2146,7 +2146,7 @@ void WINAPI glTexCoord1f( GLfloat s )
     struct glTexCoord1f_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %f\n", s );
-    if ((status = UNIX_CALL( glTexCoord1f, &args ))) WARN( "glTexCoord1f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord1f, &args ))) WARN( "glTexCoord1f returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord1fv( const GLfloat *v )
@@ -2162,7 +2162,7 @@ void WINAPI glTexCoord1i( GLint s )
     struct glTexCoord1i_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1i, &args ))) WARN( "glTexCoord1i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord1i, &args ))) WARN( "glTexCoord1i returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord1iv( const GLint *v )
@@ -2178,7 +2178,7 @@ void WINAPI glTexCoord1s( GLshort s )
     struct glTexCoord1s_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1s, &args ))) WARN( "glTexCoord1s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord1s, &args ))) WARN( "glTexCoord1s returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord1sv( const GLshort *v )
@@ -2194,7 +2194,7 @@ void WINAPI glTexCoord2d( GLdouble s, GLdouble t )
     struct glTexCoord2d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %f, t %f\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2d, &args ))) WARN( "glTexCoord2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2d, &args ))) WARN( "glTexCoord2d returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord2dv( const GLdouble *v )
@@ -2210,7 +2210,7 @@ void WINAPI glTexCoord2f( GLfloat s, GLfloat t )
     struct glTexCoord2f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %f, t %f\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2f, &args ))) WARN( "glTexCoord2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2f, &args ))) WARN( "glTexCoord2f returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord2fv( const GLfloat *v )
@@ -2226,7 +2226,7 @@ void WINAPI glTexCoord2i( GLint s, GLint t )
     struct glTexCoord2i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2i, &args ))) WARN( "glTexCoord2i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2i, &args ))) WARN( "glTexCoord2i returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord2iv( const GLint *v )
@@ -2242,7 +2242,7 @@ void WINAPI glTexCoord2s( GLshort s, GLshort t )
     struct glTexCoord2s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2s, &args ))) WARN( "glTexCoord2s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2s, &args ))) WARN( "glTexCoord2s returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord2sv( const GLshort *v )
@@ -2258,7 +2258,7 @@ void WINAPI glTexCoord3d( GLdouble s, GLdouble t, GLdouble r )
     struct glTexCoord3d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3d, &args ))) WARN( "glTexCoord3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord3d, &args ))) WARN( "glTexCoord3d returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord3dv( const GLdouble *v )
@@ -2274,7 +2274,7 @@ void WINAPI glTexCoord3f( GLfloat s, GLfloat t, GLfloat r )
     struct glTexCoord3f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3f, &args ))) WARN( "glTexCoord3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord3f, &args ))) WARN( "glTexCoord3f returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord3fv( const GLfloat *v )
@@ -2290,7 +2290,7 @@ void WINAPI glTexCoord3i( GLint s, GLint t, GLint r )
     struct glTexCoord3i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3i, &args ))) WARN( "glTexCoord3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord3i, &args ))) WARN( "glTexCoord3i returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord3iv( const GLint *v )
@@ -2306,7 +2306,7 @@ void WINAPI glTexCoord3s( GLshort s, GLshort t, GLshort r )
     struct glTexCoord3s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3s, &args ))) WARN( "glTexCoord3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord3s, &args ))) WARN( "glTexCoord3s returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord3sv( const GLshort *v )
@@ -2322,7 +2322,7 @@ void WINAPI glTexCoord4d( GLdouble s, GLdouble t, GLdouble r, GLdouble q )
     struct glTexCoord4d_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f, q %f\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4d, &args ))) WARN( "glTexCoord4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4d, &args ))) WARN( "glTexCoord4d returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord4dv( const GLdouble *v )
@@ -2338,7 +2338,7 @@ void WINAPI glTexCoord4f( GLfloat s, GLfloat t, GLfloat r, GLfloat q )
     struct glTexCoord4f_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f, q %f\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4f, &args ))) WARN( "glTexCoord4f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4f, &args ))) WARN( "glTexCoord4f returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord4fv( const GLfloat *v )
@@ -2354,7 +2354,7 @@ void WINAPI glTexCoord4i( GLint s, GLint t, GLint r, GLint q )
     struct glTexCoord4i_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4i, &args ))) WARN( "glTexCoord4i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4i, &args ))) WARN( "glTexCoord4i returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord4iv( const GLint *v )
@@ -2370,7 +2370,7 @@ void WINAPI glTexCoord4s( GLshort s, GLshort t, GLshort r, GLshort q )
     struct glTexCoord4s_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4s, &args ))) WARN( "glTexCoord4s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4s, &args ))) WARN( "glTexCoord4s returned %#lx\n", status );
 }
 
 void WINAPI glTexCoord4sv( const GLshort *v )
@@ -2394,7 +2394,7 @@ void WINAPI glTexEnvf( GLenum target, GLenum pname, GLfloat param )
     struct glTexEnvf_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %f\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexEnvf, &args ))) WARN( "glTexEnvf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexEnvf, &args ))) WARN( "glTexEnvf returned %#lx\n", status );
 }
 
 void WINAPI glTexEnvfv( GLenum target, GLenum pname, const GLfloat *params )
@@ -2410,7 +2410,7 @@ void WINAPI glTexEnvi( GLenum target, GLenum pname, GLint param )
     struct glTexEnvi_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexEnvi, &args ))) WARN( "glTexEnvi returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexEnvi, &args ))) WARN( "glTexEnvi returned %#lx\n", status );
 }
 
 void WINAPI glTexEnviv( GLenum target, GLenum pname, const GLint *params )
@@ -2426,7 +2426,7 @@ void WINAPI glTexGend( GLenum coord, GLenum pname, GLdouble param )
     struct glTexGend_params args = { .teb = NtCurrentTeb(), .coord = coord, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "coord %d, pname %d, param %f\n", coord, pname, param );
-    if ((status = UNIX_CALL( glTexGend, &args ))) WARN( "glTexGend returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexGend, &args ))) WARN( "glTexGend returned %#lx\n", status );
 }
 
 void WINAPI glTexGendv( GLenum coord, GLenum pname, const GLdouble *params )
@@ -2442,7 +2442,7 @@ void WINAPI glTexGenf( GLenum coord, GLenum pname, GLfloat param )
     struct glTexGenf_params args = { .teb = NtCurrentTeb(), .coord = coord, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "coord %d, pname %d, param %f\n", coord, pname, param );
-    if ((status = UNIX_CALL( glTexGenf, &args ))) WARN( "glTexGenf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexGenf, &args ))) WARN( "glTexGenf returned %#lx\n", status );
 }
 
 void WINAPI glTexGenfv( GLenum coord, GLenum pname, const GLfloat *params )
@@ -2458,7 +2458,7 @@ void WINAPI glTexGeni( GLenum coord, GLenum pname, GLint param )
     struct glTexGeni_params args = { .teb = NtCurrentTeb(), .coord = coord, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "coord %d, pname %d, param %d\n", coord, pname, param );
-    if ((status = UNIX_CALL( glTexGeni, &args ))) WARN( "glTexGeni returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexGeni, &args ))) WARN( "glTexGeni returned %#lx\n", status );
 }
 
 void WINAPI glTexGeniv( GLenum coord, GLenum pname, const GLint *params )
@@ -2490,7 +2490,7 @@ void WINAPI glTexParameterf( GLenum target, GLenum pname, GLfloat param )
     struct glTexParameterf_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %f\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexParameterf, &args ))) WARN( "glTexParameterf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexParameterf, &args ))) WARN( "glTexParameterf returned %#lx\n", status );
 }
 
 void WINAPI glTexParameterfv( GLenum target, GLenum pname, const GLfloat *params )
@@ -2506,7 +2506,7 @@ void WINAPI glTexParameteri( GLenum target, GLenum pname, GLint param )
     struct glTexParameteri_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexParameteri, &args ))) WARN( "glTexParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexParameteri, &args ))) WARN( "glTexParameteri returned %#lx\n", status );
 }
 
 void WINAPI glTexParameteriv( GLenum target, GLenum pname, const GLint *params )
@@ -2538,7 +2538,7 @@ void WINAPI glTranslated( GLdouble x, GLdouble y, GLdouble z )
     struct glTranslated_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glTranslated, &args ))) WARN( "glTranslated returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTranslated, &args ))) WARN( "glTranslated returned %#lx\n", status );
 }
 
 void WINAPI glTranslatef( GLfloat x, GLfloat y, GLfloat z )
@@ -2546,7 +2546,7 @@ void WINAPI glTranslatef( GLfloat x, GLfloat y, GLfloat z )
     struct glTranslatef_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glTranslatef, &args ))) WARN( "glTranslatef returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTranslatef, &args ))) WARN( "glTranslatef returned %#lx\n", status );
 }
 
 void WINAPI glVertex2d( GLdouble x, GLdouble y )
@@ -2554,7 +2554,7 @@ void WINAPI glVertex2d( GLdouble x, GLdouble y )
     struct glVertex2d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glVertex2d, &args ))) WARN( "glVertex2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex2d, &args ))) WARN( "glVertex2d returned %#lx\n", status );
 }
 
 void WINAPI glVertex2dv( const GLdouble *v )
@@ -2570,7 +2570,7 @@ void WINAPI glVertex2f( GLfloat x, GLfloat y )
     struct glVertex2f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glVertex2f, &args ))) WARN( "glVertex2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex2f, &args ))) WARN( "glVertex2f returned %#lx\n", status );
 }
 
 void WINAPI glVertex2fv( const GLfloat *v )
@@ -2586,7 +2586,7 @@ void WINAPI glVertex2i( GLint x, GLint y )
     struct glVertex2i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex2i, &args ))) WARN( "glVertex2i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex2i, &args ))) WARN( "glVertex2i returned %#lx\n", status );
 }
 
 void WINAPI glVertex2iv( const GLint *v )
@@ -2602,7 +2602,7 @@ void WINAPI glVertex2s( GLshort x, GLshort y )
     struct glVertex2s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex2s, &args ))) WARN( "glVertex2s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex2s, &args ))) WARN( "glVertex2s returned %#lx\n", status );
 }
 
 void WINAPI glVertex2sv( const GLshort *v )
@@ -2618,7 +2618,7 @@ void WINAPI glVertex3d( GLdouble x, GLdouble y, GLdouble z )
     struct glVertex3d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3d, &args ))) WARN( "glVertex3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex3d, &args ))) WARN( "glVertex3d returned %#lx\n", status );
 }
 
 void WINAPI glVertex3dv( const GLdouble *v )
@@ -2634,7 +2634,7 @@ void WINAPI glVertex3f( GLfloat x, GLfloat y, GLfloat z )
     struct glVertex3f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3f, &args ))) WARN( "glVertex3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex3f, &args ))) WARN( "glVertex3f returned %#lx\n", status );
 }
 
 void WINAPI glVertex3fv( const GLfloat *v )
@@ -2650,7 +2650,7 @@ void WINAPI glVertex3i( GLint x, GLint y, GLint z )
     struct glVertex3i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3i, &args ))) WARN( "glVertex3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex3i, &args ))) WARN( "glVertex3i returned %#lx\n", status );
 }
 
 void WINAPI glVertex3iv( const GLint *v )
@@ -2666,7 +2666,7 @@ void WINAPI glVertex3s( GLshort x, GLshort y, GLshort z )
     struct glVertex3s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3s, &args ))) WARN( "glVertex3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex3s, &args ))) WARN( "glVertex3s returned %#lx\n", status );
 }
 
 void WINAPI glVertex3sv( const GLshort *v )
@@ -2682,7 +2682,7 @@ void WINAPI glVertex4d( GLdouble x, GLdouble y, GLdouble z, GLdouble w )
     struct glVertex4d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4d, &args ))) WARN( "glVertex4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex4d, &args ))) WARN( "glVertex4d returned %#lx\n", status );
 }
 
 void WINAPI glVertex4dv( const GLdouble *v )
@@ -2698,7 +2698,7 @@ void WINAPI glVertex4f( GLfloat x, GLfloat y, GLfloat z, GLfloat w )
     struct glVertex4f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4f, &args ))) WARN( "glVertex4f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex4f, &args ))) WARN( "glVertex4f returned %#lx\n", status );
 }
 
 void WINAPI glVertex4fv( const GLfloat *v )
@@ -2714,7 +2714,7 @@ void WINAPI glVertex4i( GLint x, GLint y, GLint z, GLint w )
     struct glVertex4i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4i, &args ))) WARN( "glVertex4i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex4i, &args ))) WARN( "glVertex4i returned %#lx\n", status );
 }
 
 void WINAPI glVertex4iv( const GLint *v )
@@ -2730,7 +2730,7 @@ void WINAPI glVertex4s( GLshort x, GLshort y, GLshort z, GLshort w )
     struct glVertex4s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4s, &args ))) WARN( "glVertex4s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex4s, &args ))) WARN( "glVertex4s returned %#lx\n", status );
 }
 
 void WINAPI glVertex4sv( const GLshort *v )
@@ -2754,7 +2754,7 @@ void WINAPI glViewport( GLint x, GLint y, GLsizei width, GLsizei height )
     struct glViewport_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "x %d, y %d, width %d, height %d\n", x, y, width, height );
-    if ((status = UNIX_CALL( glViewport, &args ))) WARN( "glViewport returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glViewport, &args ))) WARN( "glViewport returned %#lx\n", status );
 }
 
 static void WINAPI glAccumxOES( GLenum op, GLfixed value )
@@ -2762,7 +2762,7 @@ static void WINAPI glAccumxOES( GLenum op, GLfixed value )
     struct glAccumxOES_params args = { .teb = NtCurrentTeb(), .op = op, .value = value };
     NTSTATUS status;
     TRACE( "op %d, value %d\n", op, value );
-    if ((status = UNIX_CALL( glAccumxOES, &args ))) WARN( "glAccumxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAccumxOES, &args ))) WARN( "glAccumxOES returned %#lx\n", status );
 }
 
 static GLboolean WINAPI glAcquireKeyedMutexWin32EXT( GLuint memory, GLuint64 key, GLuint timeout )
@@ -2779,7 +2779,7 @@ static void WINAPI glActiveProgramEXT( GLuint program )
     struct glActiveProgramEXT_params args = { .teb = NtCurrentTeb(), .program = program };
     NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glActiveProgramEXT, &args ))) WARN( "glActiveProgramEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glActiveProgramEXT, &args ))) WARN( "glActiveProgramEXT returned %#lx\n", status );
 }
 
 static void WINAPI glActiveShaderProgram( GLuint pipeline, GLuint program )
@@ -2787,7 +2787,7 @@ static void WINAPI glActiveShaderProgram( GLuint pipeline, GLuint program )
     struct glActiveShaderProgram_params args = { .teb = NtCurrentTeb(), .pipeline = pipeline, .program = program };
     NTSTATUS status;
     TRACE( "pipeline %d, program %d\n", pipeline, program );
-    if ((status = UNIX_CALL( glActiveShaderProgram, &args ))) WARN( "glActiveShaderProgram returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glActiveShaderProgram, &args ))) WARN( "glActiveShaderProgram returned %#lx\n", status );
 }
 
 static void WINAPI glActiveStencilFaceEXT( GLenum face )
@@ -2795,7 +2795,7 @@ static void WINAPI glActiveStencilFaceEXT( GLenum face )
     struct glActiveStencilFaceEXT_params args = { .teb = NtCurrentTeb(), .face = face };
     NTSTATUS status;
     TRACE( "face %d\n", face );
-    if ((status = UNIX_CALL( glActiveStencilFaceEXT, &args ))) WARN( "glActiveStencilFaceEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glActiveStencilFaceEXT, &args ))) WARN( "glActiveStencilFaceEXT returned %#lx\n", status );
 }
 
 static void WINAPI glActiveTexture( GLenum texture )
@@ -2803,7 +2803,7 @@ static void WINAPI glActiveTexture( GLenum texture )
     struct glActiveTexture_params args = { .teb = NtCurrentTeb(), .texture = texture };
     NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glActiveTexture, &args ))) WARN( "glActiveTexture returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glActiveTexture, &args ))) WARN( "glActiveTexture returned %#lx\n", status );
 }
 
 static void WINAPI glActiveTextureARB( GLenum texture )
@@ -2811,7 +2811,7 @@ static void WINAPI glActiveTextureARB( GLenum texture )
     struct glActiveTextureARB_params args = { .teb = NtCurrentTeb(), .texture = texture };
     NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glActiveTextureARB, &args ))) WARN( "glActiveTextureARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glActiveTextureARB, &args ))) WARN( "glActiveTextureARB returned %#lx\n", status );
 }
 
 static void WINAPI glActiveVaryingNV( GLuint program, const GLchar *name )
@@ -2827,7 +2827,7 @@ static void WINAPI glAlphaFragmentOp1ATI( GLenum op, GLuint dst, GLuint dstMod,
     struct glAlphaFragmentOp1ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod };
     NTSTATUS status;
     TRACE( "op %d, dst %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod );
-    if ((status = UNIX_CALL( glAlphaFragmentOp1ATI, &args ))) WARN( "glAlphaFragmentOp1ATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAlphaFragmentOp1ATI, &args ))) WARN( "glAlphaFragmentOp1ATI returned %#lx\n", status );
 }
 
 static void WINAPI glAlphaFragmentOp2ATI( GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod )
@@ -2835,7 +2835,7 @@ static void WINAPI glAlphaFragmentOp2ATI( GLenum op, GLuint dst, GLuint dstMod,
     struct glAlphaFragmentOp2ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod, .arg2 = arg2, .arg2Rep = arg2Rep, .arg2Mod = arg2Mod };
     NTSTATUS status;
     TRACE( "op %d, dst %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d, arg2 %d, arg2Rep %d, arg2Mod %d\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod );
-    if ((status = UNIX_CALL( glAlphaFragmentOp2ATI, &args ))) WARN( "glAlphaFragmentOp2ATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAlphaFragmentOp2ATI, &args ))) WARN( "glAlphaFragmentOp2ATI returned %#lx\n", status );
 }
 
 static void WINAPI glAlphaFragmentOp3ATI( GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod )
@@ -2843,7 +2843,7 @@ static void WINAPI glAlphaFragmentOp3ATI( GLenum op, GLuint dst, GLuint dstMod,
     struct glAlphaFragmentOp3ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod, .arg2 = arg2, .arg2Rep = arg2Rep, .arg2Mod = arg2Mod, .arg3 = arg3, .arg3Rep = arg3Rep, .arg3Mod = arg3Mod };
     NTSTATUS status;
     TRACE( "op %d, dst %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d, arg2 %d, arg2Rep %d, arg2Mod %d, arg3 %d, arg3Rep %d, arg3Mod %d\n", op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod );
-    if ((status = UNIX_CALL( glAlphaFragmentOp3ATI, &args ))) WARN( "glAlphaFragmentOp3ATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAlphaFragmentOp3ATI, &args ))) WARN( "glAlphaFragmentOp3ATI returned %#lx\n", status );
 }
 
 static void WINAPI glAlphaFuncxOES( GLenum func, GLfixed ref )
@@ -2851,7 +2851,7 @@ static void WINAPI glAlphaFuncxOES( GLenum func, GLfixed ref )
     struct glAlphaFuncxOES_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref };
     NTSTATUS status;
     TRACE( "func %d, ref %d\n", func, ref );
-    if ((status = UNIX_CALL( glAlphaFuncxOES, &args ))) WARN( "glAlphaFuncxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAlphaFuncxOES, &args ))) WARN( "glAlphaFuncxOES returned %#lx\n", status );
 }
 
 static void WINAPI glAlphaToCoverageDitherControlNV( GLenum mode )
@@ -2859,7 +2859,7 @@ static void WINAPI glAlphaToCoverageDitherControlNV( GLenum mode )
     struct glAlphaToCoverageDitherControlNV_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glAlphaToCoverageDitherControlNV, &args ))) WARN( "glAlphaToCoverageDitherControlNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAlphaToCoverageDitherControlNV, &args ))) WARN( "glAlphaToCoverageDitherControlNV returned %#lx\n", status );
 }
 
 static void WINAPI glApplyFramebufferAttachmentCMAAINTEL(void)
@@ -2867,7 +2867,7 @@ static void WINAPI glApplyFramebufferAttachmentCMAAINTEL(void)
     struct glApplyFramebufferAttachmentCMAAINTEL_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glApplyFramebufferAttachmentCMAAINTEL, &args ))) WARN( "glApplyFramebufferAttachmentCMAAINTEL returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glApplyFramebufferAttachmentCMAAINTEL, &args ))) WARN( "glApplyFramebufferAttachmentCMAAINTEL returned %#lx\n", status );
 }
 
 static void WINAPI glApplyTextureEXT( GLenum mode )
@@ -2875,7 +2875,7 @@ static void WINAPI glApplyTextureEXT( GLenum mode )
     struct glApplyTextureEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glApplyTextureEXT, &args ))) WARN( "glApplyTextureEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glApplyTextureEXT, &args ))) WARN( "glApplyTextureEXT returned %#lx\n", status );
 }
 
 static GLboolean WINAPI glAreProgramsResidentNV( GLsizei n, const GLuint *programs, GLboolean *residences )
@@ -2909,7 +2909,7 @@ static void WINAPI glArrayObjectATI( GLenum array, GLint size, GLenum type, GLsi
     struct glArrayObjectATI_params args = { .teb = NtCurrentTeb(), .array = array, .size = size, .type = type, .stride = stride, .buffer = buffer, .offset = offset };
     NTSTATUS status;
     TRACE( "array %d, size %d, type %d, stride %d, buffer %d, offset %d\n", array, size, type, stride, buffer, offset );
-    if ((status = UNIX_CALL( glArrayObjectATI, &args ))) WARN( "glArrayObjectATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glArrayObjectATI, &args ))) WARN( "glArrayObjectATI returned %#lx\n", status );
 }
 
 static GLuint WINAPI glAsyncCopyBufferSubDataNVX( GLsizei waitSemaphoreCount, const GLuint *waitSemaphoreArray, const GLuint64 *fenceValueArray, GLuint readGpu, GLbitfield writeGpuMask, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size, GLsizei signalSemaphoreCount, const GLuint *signalSemaphoreArray, const GLuint64 *signalValueArray )
@@ -2935,7 +2935,7 @@ static void WINAPI glAsyncMarkerSGIX( GLuint marker )
     struct glAsyncMarkerSGIX_params args = { .teb = NtCurrentTeb(), .marker = marker };
     NTSTATUS status;
     TRACE( "marker %d\n", marker );
-    if ((status = UNIX_CALL( glAsyncMarkerSGIX, &args ))) WARN( "glAsyncMarkerSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAsyncMarkerSGIX, &args ))) WARN( "glAsyncMarkerSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glAttachObjectARB( GLhandleARB containerObj, GLhandleARB obj )
@@ -2943,7 +2943,7 @@ static void WINAPI glAttachObjectARB( GLhandleARB containerObj, GLhandleARB obj
     struct glAttachObjectARB_params args = { .teb = NtCurrentTeb(), .containerObj = containerObj, .obj = obj };
     NTSTATUS status;
     TRACE( "containerObj %d, obj %d\n", containerObj, obj );
-    if ((status = UNIX_CALL( glAttachObjectARB, &args ))) WARN( "glAttachObjectARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAttachObjectARB, &args ))) WARN( "glAttachObjectARB returned %#lx\n", status );
 }
 
 static void WINAPI glAttachShader( GLuint program, GLuint shader )
@@ -2951,7 +2951,7 @@ static void WINAPI glAttachShader( GLuint program, GLuint shader )
     struct glAttachShader_params args = { .teb = NtCurrentTeb(), .program = program, .shader = shader };
     NTSTATUS status;
     TRACE( "program %d, shader %d\n", program, shader );
-    if ((status = UNIX_CALL( glAttachShader, &args ))) WARN( "glAttachShader returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glAttachShader, &args ))) WARN( "glAttachShader returned %#lx\n", status );
 }
 
 static void WINAPI glBeginConditionalRender( GLuint id, GLenum mode )
@@ -2959,7 +2959,7 @@ static void WINAPI glBeginConditionalRender( GLuint id, GLenum mode )
     struct glBeginConditionalRender_params args = { .teb = NtCurrentTeb(), .id = id, .mode = mode };
     NTSTATUS status;
     TRACE( "id %d, mode %d\n", id, mode );
-    if ((status = UNIX_CALL( glBeginConditionalRender, &args ))) WARN( "glBeginConditionalRender returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginConditionalRender, &args ))) WARN( "glBeginConditionalRender returned %#lx\n", status );
 }
 
 static void WINAPI glBeginConditionalRenderNV( GLuint id, GLenum mode )
@@ -2967,7 +2967,7 @@ static void WINAPI glBeginConditionalRenderNV( GLuint id, GLenum mode )
     struct glBeginConditionalRenderNV_params args = { .teb = NtCurrentTeb(), .id = id, .mode = mode };
     NTSTATUS status;
     TRACE( "id %d, mode %d\n", id, mode );
-    if ((status = UNIX_CALL( glBeginConditionalRenderNV, &args ))) WARN( "glBeginConditionalRenderNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginConditionalRenderNV, &args ))) WARN( "glBeginConditionalRenderNV returned %#lx\n", status );
 }
 
 static void WINAPI glBeginConditionalRenderNVX( GLuint id )
@@ -2975,7 +2975,7 @@ static void WINAPI glBeginConditionalRenderNVX( GLuint id )
     struct glBeginConditionalRenderNVX_params args = { .teb = NtCurrentTeb(), .id = id };
     NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glBeginConditionalRenderNVX, &args ))) WARN( "glBeginConditionalRenderNVX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginConditionalRenderNVX, &args ))) WARN( "glBeginConditionalRenderNVX returned %#lx\n", status );
 }
 
 static void WINAPI glBeginFragmentShaderATI(void)
@@ -2983,7 +2983,7 @@ static void WINAPI glBeginFragmentShaderATI(void)
     struct glBeginFragmentShaderATI_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glBeginFragmentShaderATI, &args ))) WARN( "glBeginFragmentShaderATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginFragmentShaderATI, &args ))) WARN( "glBeginFragmentShaderATI returned %#lx\n", status );
 }
 
 static void WINAPI glBeginOcclusionQueryNV( GLuint id )
@@ -2991,7 +2991,7 @@ static void WINAPI glBeginOcclusionQueryNV( GLuint id )
     struct glBeginOcclusionQueryNV_params args = { .teb = NtCurrentTeb(), .id = id };
     NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glBeginOcclusionQueryNV, &args ))) WARN( "glBeginOcclusionQueryNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginOcclusionQueryNV, &args ))) WARN( "glBeginOcclusionQueryNV returned %#lx\n", status );
 }
 
 static void WINAPI glBeginPerfMonitorAMD( GLuint monitor )
@@ -2999,7 +2999,7 @@ static void WINAPI glBeginPerfMonitorAMD( GLuint monitor )
     struct glBeginPerfMonitorAMD_params args = { .teb = NtCurrentTeb(), .monitor = monitor };
     NTSTATUS status;
     TRACE( "monitor %d\n", monitor );
-    if ((status = UNIX_CALL( glBeginPerfMonitorAMD, &args ))) WARN( "glBeginPerfMonitorAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginPerfMonitorAMD, &args ))) WARN( "glBeginPerfMonitorAMD returned %#lx\n", status );
 }
 
 static void WINAPI glBeginPerfQueryINTEL( GLuint queryHandle )
@@ -3007,7 +3007,7 @@ static void WINAPI glBeginPerfQueryINTEL( GLuint queryHandle )
     struct glBeginPerfQueryINTEL_params args = { .teb = NtCurrentTeb(), .queryHandle = queryHandle };
     NTSTATUS status;
     TRACE( "queryHandle %d\n", queryHandle );
-    if ((status = UNIX_CALL( glBeginPerfQueryINTEL, &args ))) WARN( "glBeginPerfQueryINTEL returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginPerfQueryINTEL, &args ))) WARN( "glBeginPerfQueryINTEL returned %#lx\n", status );
 }
 
 static void WINAPI glBeginQuery( GLenum target, GLuint id )
@@ -3015,7 +3015,7 @@ static void WINAPI glBeginQuery( GLenum target, GLuint id )
     struct glBeginQuery_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
     NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBeginQuery, &args ))) WARN( "glBeginQuery returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginQuery, &args ))) WARN( "glBeginQuery returned %#lx\n", status );
 }
 
 static void WINAPI glBeginQueryARB( GLenum target, GLuint id )
@@ -3023,7 +3023,7 @@ static void WINAPI glBeginQueryARB( GLenum target, GLuint id )
     struct glBeginQueryARB_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
     NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBeginQueryARB, &args ))) WARN( "glBeginQueryARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginQueryARB, &args ))) WARN( "glBeginQueryARB returned %#lx\n", status );
 }
 
 static void WINAPI glBeginQueryIndexed( GLenum target, GLuint index, GLuint id )
@@ -3031,7 +3031,7 @@ static void WINAPI glBeginQueryIndexed( GLenum target, GLuint index, GLuint id )
     struct glBeginQueryIndexed_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .id = id };
     NTSTATUS status;
     TRACE( "target %d, index %d, id %d\n", target, index, id );
-    if ((status = UNIX_CALL( glBeginQueryIndexed, &args ))) WARN( "glBeginQueryIndexed returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginQueryIndexed, &args ))) WARN( "glBeginQueryIndexed returned %#lx\n", status );
 }
 
 static void WINAPI glBeginTransformFeedback( GLenum primitiveMode )
@@ -3039,7 +3039,7 @@ static void WINAPI glBeginTransformFeedback( GLenum primitiveMode )
     struct glBeginTransformFeedback_params args = { .teb = NtCurrentTeb(), .primitiveMode = primitiveMode };
     NTSTATUS status;
     TRACE( "primitiveMode %d\n", primitiveMode );
-    if ((status = UNIX_CALL( glBeginTransformFeedback, &args ))) WARN( "glBeginTransformFeedback returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginTransformFeedback, &args ))) WARN( "glBeginTransformFeedback returned %#lx\n", status );
 }
 
 static void WINAPI glBeginTransformFeedbackEXT( GLenum primitiveMode )
@@ -3047,7 +3047,7 @@ static void WINAPI glBeginTransformFeedbackEXT( GLenum primitiveMode )
     struct glBeginTransformFeedbackEXT_params args = { .teb = NtCurrentTeb(), .primitiveMode = primitiveMode };
     NTSTATUS status;
     TRACE( "primitiveMode %d\n", primitiveMode );
-    if ((status = UNIX_CALL( glBeginTransformFeedbackEXT, &args ))) WARN( "glBeginTransformFeedbackEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginTransformFeedbackEXT, &args ))) WARN( "glBeginTransformFeedbackEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBeginTransformFeedbackNV( GLenum primitiveMode )
@@ -3055,7 +3055,7 @@ static void WINAPI glBeginTransformFeedbackNV( GLenum primitiveMode )
     struct glBeginTransformFeedbackNV_params args = { .teb = NtCurrentTeb(), .primitiveMode = primitiveMode };
     NTSTATUS status;
     TRACE( "primitiveMode %d\n", primitiveMode );
-    if ((status = UNIX_CALL( glBeginTransformFeedbackNV, &args ))) WARN( "glBeginTransformFeedbackNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginTransformFeedbackNV, &args ))) WARN( "glBeginTransformFeedbackNV returned %#lx\n", status );
 }
 
 static void WINAPI glBeginVertexShaderEXT(void)
@@ -3063,7 +3063,7 @@ static void WINAPI glBeginVertexShaderEXT(void)
     struct glBeginVertexShaderEXT_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glBeginVertexShaderEXT, &args ))) WARN( "glBeginVertexShaderEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginVertexShaderEXT, &args ))) WARN( "glBeginVertexShaderEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBeginVideoCaptureNV( GLuint video_capture_slot )
@@ -3071,7 +3071,7 @@ static void WINAPI glBeginVideoCaptureNV( GLuint video_capture_slot )
     struct glBeginVideoCaptureNV_params args = { .teb = NtCurrentTeb(), .video_capture_slot = video_capture_slot };
     NTSTATUS status;
     TRACE( "video_capture_slot %d\n", video_capture_slot );
-    if ((status = UNIX_CALL( glBeginVideoCaptureNV, &args ))) WARN( "glBeginVideoCaptureNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBeginVideoCaptureNV, &args ))) WARN( "glBeginVideoCaptureNV returned %#lx\n", status );
 }
 
 static void WINAPI glBindAttribLocation( GLuint program, GLuint index, const GLchar *name )
@@ -3095,7 +3095,7 @@ static void WINAPI glBindBuffer( GLenum target, GLuint buffer )
     struct glBindBuffer_params args = { .teb = NtCurrentTeb(), .target = target, .buffer = buffer };
     NTSTATUS status;
     TRACE( "target %d, buffer %d\n", target, buffer );
-    if ((status = UNIX_CALL( glBindBuffer, &args ))) WARN( "glBindBuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindBuffer, &args ))) WARN( "glBindBuffer returned %#lx\n", status );
 }
 
 static void WINAPI glBindBufferARB( GLenum target, GLuint buffer )
@@ -3103,7 +3103,7 @@ static void WINAPI glBindBufferARB( GLenum target, GLuint buffer )
     struct glBindBufferARB_params args = { .teb = NtCurrentTeb(), .target = target, .buffer = buffer };
     NTSTATUS status;
     TRACE( "target %d, buffer %d\n", target, buffer );
-    if ((status = UNIX_CALL( glBindBufferARB, &args ))) WARN( "glBindBufferARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindBufferARB, &args ))) WARN( "glBindBufferARB returned %#lx\n", status );
 }
 
 static void WINAPI glBindBufferBase( GLenum target, GLuint index, GLuint buffer )
@@ -3111,7 +3111,7 @@ static void WINAPI glBindBufferBase( GLenum target, GLuint index, GLuint buffer
     struct glBindBufferBase_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .buffer = buffer };
     NTSTATUS status;
     TRACE( "target %d, index %d, buffer %d\n", target, index, buffer );
-    if ((status = UNIX_CALL( glBindBufferBase, &args ))) WARN( "glBindBufferBase returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindBufferBase, &args ))) WARN( "glBindBufferBase returned %#lx\n", status );
 }
 
 static void WINAPI glBindBufferBaseEXT( GLenum target, GLuint index, GLuint buffer )
@@ -3119,7 +3119,7 @@ static void WINAPI glBindBufferBaseEXT( GLenum target, GLuint index, GLuint buff
     struct glBindBufferBaseEXT_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .buffer = buffer };
     NTSTATUS status;
     TRACE( "target %d, index %d, buffer %d\n", target, index, buffer );
-    if ((status = UNIX_CALL( glBindBufferBaseEXT, &args ))) WARN( "glBindBufferBaseEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindBufferBaseEXT, &args ))) WARN( "glBindBufferBaseEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBindBufferBaseNV( GLenum target, GLuint index, GLuint buffer )
@@ -3127,7 +3127,7 @@ static void WINAPI glBindBufferBaseNV( GLenum target, GLuint index, GLuint buffe
     struct glBindBufferBaseNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .buffer = buffer };
     NTSTATUS status;
     TRACE( "target %d, index %d, buffer %d\n", target, index, buffer );
-    if ((status = UNIX_CALL( glBindBufferBaseNV, &args ))) WARN( "glBindBufferBaseNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindBufferBaseNV, &args ))) WARN( "glBindBufferBaseNV returned %#lx\n", status );
 }
 
 static void WINAPI glBindBufferOffsetEXT( GLenum target, GLuint index, GLuint buffer, GLintptr offset )
@@ -3215,7 +3215,7 @@ static void WINAPI glBindFragmentShaderATI( GLuint id )
     struct glBindFragmentShaderATI_params args = { .teb = NtCurrentTeb(), .id = id };
     NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glBindFragmentShaderATI, &args ))) WARN( "glBindFragmentShaderATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindFragmentShaderATI, &args ))) WARN( "glBindFragmentShaderATI returned %#lx\n", status );
 }
 
 static void WINAPI glBindFramebuffer( GLenum target, GLuint framebuffer )
@@ -3223,7 +3223,7 @@ static void WINAPI glBindFramebuffer( GLenum target, GLuint framebuffer )
     struct glBindFramebuffer_params args = { .teb = NtCurrentTeb(), .target = target, .framebuffer = framebuffer };
     NTSTATUS status;
     TRACE( "target %d, framebuffer %d\n", target, framebuffer );
-    if ((status = UNIX_CALL( glBindFramebuffer, &args ))) WARN( "glBindFramebuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindFramebuffer, &args ))) WARN( "glBindFramebuffer returned %#lx\n", status );
 }
 
 static void WINAPI glBindFramebufferEXT( GLenum target, GLuint framebuffer )
@@ -3231,7 +3231,7 @@ static void WINAPI glBindFramebufferEXT( GLenum target, GLuint framebuffer )
     struct glBindFramebufferEXT_params args = { .teb = NtCurrentTeb(), .target = target, .framebuffer = framebuffer };
     NTSTATUS status;
     TRACE( "target %d, framebuffer %d\n", target, framebuffer );
-    if ((status = UNIX_CALL( glBindFramebufferEXT, &args ))) WARN( "glBindFramebufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindFramebufferEXT, &args ))) WARN( "glBindFramebufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBindImageTexture( GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format )
@@ -3239,7 +3239,7 @@ static void WINAPI glBindImageTexture( GLuint unit, GLuint texture, GLint level,
     struct glBindImageTexture_params args = { .teb = NtCurrentTeb(), .unit = unit, .texture = texture, .level = level, .layered = layered, .layer = layer, .access = access, .format = format };
     NTSTATUS status;
     TRACE( "unit %d, texture %d, level %d, layered %d, layer %d, access %d, format %d\n", unit, texture, level, layered, layer, access, format );
-    if ((status = UNIX_CALL( glBindImageTexture, &args ))) WARN( "glBindImageTexture returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindImageTexture, &args ))) WARN( "glBindImageTexture returned %#lx\n", status );
 }
 
 static void WINAPI glBindImageTextureEXT( GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format )
@@ -3247,7 +3247,7 @@ static void WINAPI glBindImageTextureEXT( GLuint index, GLuint texture, GLint le
     struct glBindImageTextureEXT_params args = { .teb = NtCurrentTeb(), .index = index, .texture = texture, .level = level, .layered = layered, .layer = layer, .access = access, .format = format };
     NTSTATUS status;
     TRACE( "index %d, texture %d, level %d, layered %d, layer %d, access %d, format %d\n", index, texture, level, layered, layer, access, format );
-    if ((status = UNIX_CALL( glBindImageTextureEXT, &args ))) WARN( "glBindImageTextureEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindImageTextureEXT, &args ))) WARN( "glBindImageTextureEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBindImageTextures( GLuint first, GLsizei count, const GLuint *textures )
@@ -3281,7 +3281,7 @@ static void WINAPI glBindMultiTextureEXT( GLenum texunit, GLenum target, GLuint
     struct glBindMultiTextureEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .texture = texture };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, texture %d\n", texunit, target, texture );
-    if ((status = UNIX_CALL( glBindMultiTextureEXT, &args ))) WARN( "glBindMultiTextureEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindMultiTextureEXT, &args ))) WARN( "glBindMultiTextureEXT returned %#lx\n", status );
 }
 
 static GLuint WINAPI glBindParameterEXT( GLenum value )
@@ -3298,7 +3298,7 @@ static void WINAPI glBindProgramARB( GLenum target, GLuint program )
     struct glBindProgramARB_params args = { .teb = NtCurrentTeb(), .target = target, .program = program };
     NTSTATUS status;
     TRACE( "target %d, program %d\n", target, program );
-    if ((status = UNIX_CALL( glBindProgramARB, &args ))) WARN( "glBindProgramARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindProgramARB, &args ))) WARN( "glBindProgramARB returned %#lx\n", status );
 }
 
 static void WINAPI glBindProgramNV( GLenum target, GLuint id )
@@ -3306,7 +3306,7 @@ static void WINAPI glBindProgramNV( GLenum target, GLuint id )
     struct glBindProgramNV_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
     NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBindProgramNV, &args ))) WARN( "glBindProgramNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindProgramNV, &args ))) WARN( "glBindProgramNV returned %#lx\n", status );
 }
 
 static void WINAPI glBindProgramPipeline( GLuint pipeline )
@@ -3314,7 +3314,7 @@ static void WINAPI glBindProgramPipeline( GLuint pipeline )
     struct glBindProgramPipeline_params args = { .teb = NtCurrentTeb(), .pipeline = pipeline };
     NTSTATUS status;
     TRACE( "pipeline %d\n", pipeline );
-    if ((status = UNIX_CALL( glBindProgramPipeline, &args ))) WARN( "glBindProgramPipeline returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindProgramPipeline, &args ))) WARN( "glBindProgramPipeline returned %#lx\n", status );
 }
 
 static void WINAPI glBindRenderbuffer( GLenum target, GLuint renderbuffer )
@@ -3322,7 +3322,7 @@ static void WINAPI glBindRenderbuffer( GLenum target, GLuint renderbuffer )
     struct glBindRenderbuffer_params args = { .teb = NtCurrentTeb(), .target = target, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "target %d, renderbuffer %d\n", target, renderbuffer );
-    if ((status = UNIX_CALL( glBindRenderbuffer, &args ))) WARN( "glBindRenderbuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindRenderbuffer, &args ))) WARN( "glBindRenderbuffer returned %#lx\n", status );
 }
 
 static void WINAPI glBindRenderbufferEXT( GLenum target, GLuint renderbuffer )
@@ -3330,7 +3330,7 @@ static void WINAPI glBindRenderbufferEXT( GLenum target, GLuint renderbuffer )
     struct glBindRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .target = target, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "target %d, renderbuffer %d\n", target, renderbuffer );
-    if ((status = UNIX_CALL( glBindRenderbufferEXT, &args ))) WARN( "glBindRenderbufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindRenderbufferEXT, &args ))) WARN( "glBindRenderbufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBindSampler( GLuint unit, GLuint sampler )
@@ -3338,7 +3338,7 @@ static void WINAPI glBindSampler( GLuint unit, GLuint sampler )
     struct glBindSampler_params args = { .teb = NtCurrentTeb(), .unit = unit, .sampler = sampler };
     NTSTATUS status;
     TRACE( "unit %d, sampler %d\n", unit, sampler );
-    if ((status = UNIX_CALL( glBindSampler, &args ))) WARN( "glBindSampler returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindSampler, &args ))) WARN( "glBindSampler returned %#lx\n", status );
 }
 
 static void WINAPI glBindSamplers( GLuint first, GLsizei count, const GLuint *samplers )
@@ -3354,7 +3354,7 @@ static void WINAPI glBindShadingRateImageNV( GLuint texture )
     struct glBindShadingRateImageNV_params args = { .teb = NtCurrentTeb(), .texture = texture };
     NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glBindShadingRateImageNV, &args ))) WARN( "glBindShadingRateImageNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindShadingRateImageNV, &args ))) WARN( "glBindShadingRateImageNV returned %#lx\n", status );
 }
 
 static GLuint WINAPI glBindTexGenParameterEXT( GLenum unit, GLenum coord, GLenum value )
@@ -3371,7 +3371,7 @@ static void WINAPI glBindTextureEXT( GLenum target, GLuint texture )
     struct glBindTextureEXT_params args = { .teb = NtCurrentTeb(), .target = target, .texture = texture };
     NTSTATUS status;
     TRACE( "target %d, texture %d\n", target, texture );
-    if ((status = UNIX_CALL( glBindTextureEXT, &args ))) WARN( "glBindTextureEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindTextureEXT, &args ))) WARN( "glBindTextureEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBindTextureUnit( GLuint unit, GLuint texture )
@@ -3379,7 +3379,7 @@ static void WINAPI glBindTextureUnit( GLuint unit, GLuint texture )
     struct glBindTextureUnit_params args = { .teb = NtCurrentTeb(), .unit = unit, .texture = texture };
     NTSTATUS status;
     TRACE( "unit %d, texture %d\n", unit, texture );
-    if ((status = UNIX_CALL( glBindTextureUnit, &args ))) WARN( "glBindTextureUnit returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindTextureUnit, &args ))) WARN( "glBindTextureUnit returned %#lx\n", status );
 }
 
 static GLuint WINAPI glBindTextureUnitParameterEXT( GLenum unit, GLenum value )
@@ -3404,7 +3404,7 @@ static void WINAPI glBindTransformFeedback( GLenum target, GLuint id )
     struct glBindTransformFeedback_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
     NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBindTransformFeedback, &args ))) WARN( "glBindTransformFeedback returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindTransformFeedback, &args ))) WARN( "glBindTransformFeedback returned %#lx\n", status );
 }
 
 static void WINAPI glBindTransformFeedbackNV( GLenum target, GLuint id )
@@ -3412,7 +3412,7 @@ static void WINAPI glBindTransformFeedbackNV( GLenum target, GLuint id )
     struct glBindTransformFeedbackNV_params args = { .teb = NtCurrentTeb(), .target = target, .id = id };
     NTSTATUS status;
     TRACE( "target %d, id %d\n", target, id );
-    if ((status = UNIX_CALL( glBindTransformFeedbackNV, &args ))) WARN( "glBindTransformFeedbackNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindTransformFeedbackNV, &args ))) WARN( "glBindTransformFeedbackNV returned %#lx\n", status );
 }
 
 static void WINAPI glBindVertexArray( GLuint array )
@@ -3420,7 +3420,7 @@ static void WINAPI glBindVertexArray( GLuint array )
     struct glBindVertexArray_params args = { .teb = NtCurrentTeb(), .array = array };
     NTSTATUS status;
     TRACE( "array %d\n", array );
-    if ((status = UNIX_CALL( glBindVertexArray, &args ))) WARN( "glBindVertexArray returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindVertexArray, &args ))) WARN( "glBindVertexArray returned %#lx\n", status );
 }
 
 static void WINAPI glBindVertexArrayAPPLE( GLuint array )
@@ -3428,7 +3428,7 @@ static void WINAPI glBindVertexArrayAPPLE( GLuint array )
     struct glBindVertexArrayAPPLE_params args = { .teb = NtCurrentTeb(), .array = array };
     NTSTATUS status;
     TRACE( "array %d\n", array );
-    if ((status = UNIX_CALL( glBindVertexArrayAPPLE, &args ))) WARN( "glBindVertexArrayAPPLE returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindVertexArrayAPPLE, &args ))) WARN( "glBindVertexArrayAPPLE returned %#lx\n", status );
 }
 
 static void WINAPI glBindVertexBuffer( GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride )
@@ -3452,7 +3452,7 @@ static void WINAPI glBindVertexShaderEXT( GLuint id )
     struct glBindVertexShaderEXT_params args = { .teb = NtCurrentTeb(), .id = id };
     NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glBindVertexShaderEXT, &args ))) WARN( "glBindVertexShaderEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindVertexShaderEXT, &args ))) WARN( "glBindVertexShaderEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBindVideoCaptureStreamBufferNV( GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset )
@@ -3468,7 +3468,7 @@ static void WINAPI glBindVideoCaptureStreamTextureNV( GLuint video_capture_slot,
     struct glBindVideoCaptureStreamTextureNV_params args = { .teb = NtCurrentTeb(), .video_capture_slot = video_capture_slot, .stream = stream, .frame_region = frame_region, .target = target, .texture = texture };
     NTSTATUS status;
     TRACE( "video_capture_slot %d, stream %d, frame_region %d, target %d, texture %d\n", video_capture_slot, stream, frame_region, target, texture );
-    if ((status = UNIX_CALL( glBindVideoCaptureStreamTextureNV, &args ))) WARN( "glBindVideoCaptureStreamTextureNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBindVideoCaptureStreamTextureNV, &args ))) WARN( "glBindVideoCaptureStreamTextureNV returned %#lx\n", status );
 }
 
 static void WINAPI glBinormal3bEXT( GLbyte bx, GLbyte by, GLbyte bz )
@@ -3476,7 +3476,7 @@ static void WINAPI glBinormal3bEXT( GLbyte bx, GLbyte by, GLbyte bz )
     struct glBinormal3bEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
     NTSTATUS status;
     TRACE( "bx %d, by %d, bz %d\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3bEXT, &args ))) WARN( "glBinormal3bEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBinormal3bEXT, &args ))) WARN( "glBinormal3bEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBinormal3bvEXT( const GLbyte *v )
@@ -3492,7 +3492,7 @@ static void WINAPI glBinormal3dEXT( GLdouble bx, GLdouble by, GLdouble bz )
     struct glBinormal3dEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
     NTSTATUS status;
     TRACE( "bx %f, by %f, bz %f\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3dEXT, &args ))) WARN( "glBinormal3dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBinormal3dEXT, &args ))) WARN( "glBinormal3dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBinormal3dvEXT( const GLdouble *v )
@@ -3508,7 +3508,7 @@ static void WINAPI glBinormal3fEXT( GLfloat bx, GLfloat by, GLfloat bz )
     struct glBinormal3fEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
     NTSTATUS status;
     TRACE( "bx %f, by %f, bz %f\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3fEXT, &args ))) WARN( "glBinormal3fEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBinormal3fEXT, &args ))) WARN( "glBinormal3fEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBinormal3fvEXT( const GLfloat *v )
@@ -3524,7 +3524,7 @@ static void WINAPI glBinormal3iEXT( GLint bx, GLint by, GLint bz )
     struct glBinormal3iEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
     NTSTATUS status;
     TRACE( "bx %d, by %d, bz %d\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3iEXT, &args ))) WARN( "glBinormal3iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBinormal3iEXT, &args ))) WARN( "glBinormal3iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBinormal3ivEXT( const GLint *v )
@@ -3540,7 +3540,7 @@ static void WINAPI glBinormal3sEXT( GLshort bx, GLshort by, GLshort bz )
     struct glBinormal3sEXT_params args = { .teb = NtCurrentTeb(), .bx = bx, .by = by, .bz = bz };
     NTSTATUS status;
     TRACE( "bx %d, by %d, bz %d\n", bx, by, bz );
-    if ((status = UNIX_CALL( glBinormal3sEXT, &args ))) WARN( "glBinormal3sEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBinormal3sEXT, &args ))) WARN( "glBinormal3sEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBinormal3svEXT( const GLshort *v )
@@ -3572,7 +3572,7 @@ static void WINAPI glBlendBarrierKHR(void)
     struct glBlendBarrierKHR_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glBlendBarrierKHR, &args ))) WARN( "glBlendBarrierKHR returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendBarrierKHR, &args ))) WARN( "glBlendBarrierKHR returned %#lx\n", status );
 }
 
 static void WINAPI glBlendBarrierNV(void)
@@ -3580,7 +3580,7 @@ static void WINAPI glBlendBarrierNV(void)
     struct glBlendBarrierNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glBlendBarrierNV, &args ))) WARN( "glBlendBarrierNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendBarrierNV, &args ))) WARN( "glBlendBarrierNV returned %#lx\n", status );
 }
 
 static void WINAPI glBlendColor( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
@@ -3588,7 +3588,7 @@ static void WINAPI glBlendColor( GLfloat red, GLfloat green, GLfloat blue, GLflo
     struct glBlendColor_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glBlendColor, &args ))) WARN( "glBlendColor returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendColor, &args ))) WARN( "glBlendColor returned %#lx\n", status );
 }
 
 static void WINAPI glBlendColorEXT( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha )
@@ -3596,7 +3596,7 @@ static void WINAPI glBlendColorEXT( GLfloat red, GLfloat green, GLfloat blue, GL
     struct glBlendColorEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f, alpha %f\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glBlendColorEXT, &args ))) WARN( "glBlendColorEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendColorEXT, &args ))) WARN( "glBlendColorEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBlendColorxOES( GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha )
@@ -3604,7 +3604,7 @@ static void WINAPI glBlendColorxOES( GLfixed red, GLfixed green, GLfixed blue, G
     struct glBlendColorxOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glBlendColorxOES, &args ))) WARN( "glBlendColorxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendColorxOES, &args ))) WARN( "glBlendColorxOES returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquation( GLenum mode )
@@ -3612,7 +3612,7 @@ static void WINAPI glBlendEquation( GLenum mode )
     struct glBlendEquation_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glBlendEquation, &args ))) WARN( "glBlendEquation returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquation, &args ))) WARN( "glBlendEquation returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationEXT( GLenum mode )
@@ -3620,7 +3620,7 @@ static void WINAPI glBlendEquationEXT( GLenum mode )
     struct glBlendEquationEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glBlendEquationEXT, &args ))) WARN( "glBlendEquationEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationEXT, &args ))) WARN( "glBlendEquationEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationIndexedAMD( GLuint buf, GLenum mode )
@@ -3628,7 +3628,7 @@ static void WINAPI glBlendEquationIndexedAMD( GLuint buf, GLenum mode )
     struct glBlendEquationIndexedAMD_params args = { .teb = NtCurrentTeb(), .buf = buf, .mode = mode };
     NTSTATUS status;
     TRACE( "buf %d, mode %d\n", buf, mode );
-    if ((status = UNIX_CALL( glBlendEquationIndexedAMD, &args ))) WARN( "glBlendEquationIndexedAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationIndexedAMD, &args ))) WARN( "glBlendEquationIndexedAMD returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha )
@@ -3636,7 +3636,7 @@ static void WINAPI glBlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha )
     struct glBlendEquationSeparate_params args = { .teb = NtCurrentTeb(), .modeRGB = modeRGB, .modeAlpha = modeAlpha };
     NTSTATUS status;
     TRACE( "modeRGB %d, modeAlpha %d\n", modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparate, &args ))) WARN( "glBlendEquationSeparate returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationSeparate, &args ))) WARN( "glBlendEquationSeparate returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationSeparateEXT( GLenum modeRGB, GLenum modeAlpha )
@@ -3644,7 +3644,7 @@ static void WINAPI glBlendEquationSeparateEXT( GLenum modeRGB, GLenum modeAlpha
     struct glBlendEquationSeparateEXT_params args = { .teb = NtCurrentTeb(), .modeRGB = modeRGB, .modeAlpha = modeAlpha };
     NTSTATUS status;
     TRACE( "modeRGB %d, modeAlpha %d\n", modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparateEXT, &args ))) WARN( "glBlendEquationSeparateEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationSeparateEXT, &args ))) WARN( "glBlendEquationSeparateEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationSeparateIndexedAMD( GLuint buf, GLenum modeRGB, GLenum modeAlpha )
@@ -3652,7 +3652,7 @@ static void WINAPI glBlendEquationSeparateIndexedAMD( GLuint buf, GLenum modeRGB
     struct glBlendEquationSeparateIndexedAMD_params args = { .teb = NtCurrentTeb(), .buf = buf, .modeRGB = modeRGB, .modeAlpha = modeAlpha };
     NTSTATUS status;
     TRACE( "buf %d, modeRGB %d, modeAlpha %d\n", buf, modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparateIndexedAMD, &args ))) WARN( "glBlendEquationSeparateIndexedAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationSeparateIndexedAMD, &args ))) WARN( "glBlendEquationSeparateIndexedAMD returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationSeparatei( GLuint buf, GLenum modeRGB, GLenum modeAlpha )
@@ -3660,7 +3660,7 @@ static void WINAPI glBlendEquationSeparatei( GLuint buf, GLenum modeRGB, GLenum
     struct glBlendEquationSeparatei_params args = { .teb = NtCurrentTeb(), .buf = buf, .modeRGB = modeRGB, .modeAlpha = modeAlpha };
     NTSTATUS status;
     TRACE( "buf %d, modeRGB %d, modeAlpha %d\n", buf, modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparatei, &args ))) WARN( "glBlendEquationSeparatei returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationSeparatei, &args ))) WARN( "glBlendEquationSeparatei returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationSeparateiARB( GLuint buf, GLenum modeRGB, GLenum modeAlpha )
@@ -3668,7 +3668,7 @@ static void WINAPI glBlendEquationSeparateiARB( GLuint buf, GLenum modeRGB, GLen
     struct glBlendEquationSeparateiARB_params args = { .teb = NtCurrentTeb(), .buf = buf, .modeRGB = modeRGB, .modeAlpha = modeAlpha };
     NTSTATUS status;
     TRACE( "buf %d, modeRGB %d, modeAlpha %d\n", buf, modeRGB, modeAlpha );
-    if ((status = UNIX_CALL( glBlendEquationSeparateiARB, &args ))) WARN( "glBlendEquationSeparateiARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationSeparateiARB, &args ))) WARN( "glBlendEquationSeparateiARB returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationi( GLuint buf, GLenum mode )
@@ -3676,7 +3676,7 @@ static void WINAPI glBlendEquationi( GLuint buf, GLenum mode )
     struct glBlendEquationi_params args = { .teb = NtCurrentTeb(), .buf = buf, .mode = mode };
     NTSTATUS status;
     TRACE( "buf %d, mode %d\n", buf, mode );
-    if ((status = UNIX_CALL( glBlendEquationi, &args ))) WARN( "glBlendEquationi returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationi, &args ))) WARN( "glBlendEquationi returned %#lx\n", status );
 }
 
 static void WINAPI glBlendEquationiARB( GLuint buf, GLenum mode )
@@ -3684,7 +3684,7 @@ static void WINAPI glBlendEquationiARB( GLuint buf, GLenum mode )
     struct glBlendEquationiARB_params args = { .teb = NtCurrentTeb(), .buf = buf, .mode = mode };
     NTSTATUS status;
     TRACE( "buf %d, mode %d\n", buf, mode );
-    if ((status = UNIX_CALL( glBlendEquationiARB, &args ))) WARN( "glBlendEquationiARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendEquationiARB, &args ))) WARN( "glBlendEquationiARB returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFuncIndexedAMD( GLuint buf, GLenum src, GLenum dst )
@@ -3692,7 +3692,7 @@ static void WINAPI glBlendFuncIndexedAMD( GLuint buf, GLenum src, GLenum dst )
     struct glBlendFuncIndexedAMD_params args = { .teb = NtCurrentTeb(), .buf = buf, .src = src, .dst = dst };
     NTSTATUS status;
     TRACE( "buf %d, src %d, dst %d\n", buf, src, dst );
-    if ((status = UNIX_CALL( glBlendFuncIndexedAMD, &args ))) WARN( "glBlendFuncIndexedAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFuncIndexedAMD, &args ))) WARN( "glBlendFuncIndexedAMD returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFuncSeparate( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha )
@@ -3700,7 +3700,7 @@ static void WINAPI glBlendFuncSeparate( GLenum sfactorRGB, GLenum dfactorRGB, GL
     struct glBlendFuncSeparate_params args = { .teb = NtCurrentTeb(), .sfactorRGB = sfactorRGB, .dfactorRGB = dfactorRGB, .sfactorAlpha = sfactorAlpha, .dfactorAlpha = dfactorAlpha };
     NTSTATUS status;
     TRACE( "sfactorRGB %d, dfactorRGB %d, sfactorAlpha %d, dfactorAlpha %d\n", sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparate, &args ))) WARN( "glBlendFuncSeparate returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFuncSeparate, &args ))) WARN( "glBlendFuncSeparate returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFuncSeparateEXT( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha )
@@ -3708,7 +3708,7 @@ static void WINAPI glBlendFuncSeparateEXT( GLenum sfactorRGB, GLenum dfactorRGB,
     struct glBlendFuncSeparateEXT_params args = { .teb = NtCurrentTeb(), .sfactorRGB = sfactorRGB, .dfactorRGB = dfactorRGB, .sfactorAlpha = sfactorAlpha, .dfactorAlpha = dfactorAlpha };
     NTSTATUS status;
     TRACE( "sfactorRGB %d, dfactorRGB %d, sfactorAlpha %d, dfactorAlpha %d\n", sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparateEXT, &args ))) WARN( "glBlendFuncSeparateEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFuncSeparateEXT, &args ))) WARN( "glBlendFuncSeparateEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFuncSeparateINGR( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha )
@@ -3716,7 +3716,7 @@ static void WINAPI glBlendFuncSeparateINGR( GLenum sfactorRGB, GLenum dfactorRGB
     struct glBlendFuncSeparateINGR_params args = { .teb = NtCurrentTeb(), .sfactorRGB = sfactorRGB, .dfactorRGB = dfactorRGB, .sfactorAlpha = sfactorAlpha, .dfactorAlpha = dfactorAlpha };
     NTSTATUS status;
     TRACE( "sfactorRGB %d, dfactorRGB %d, sfactorAlpha %d, dfactorAlpha %d\n", sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparateINGR, &args ))) WARN( "glBlendFuncSeparateINGR returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFuncSeparateINGR, &args ))) WARN( "glBlendFuncSeparateINGR returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFuncSeparateIndexedAMD( GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
@@ -3724,7 +3724,7 @@ static void WINAPI glBlendFuncSeparateIndexedAMD( GLuint buf, GLenum srcRGB, GLe
     struct glBlendFuncSeparateIndexedAMD_params args = { .teb = NtCurrentTeb(), .buf = buf, .srcRGB = srcRGB, .dstRGB = dstRGB, .srcAlpha = srcAlpha, .dstAlpha = dstAlpha };
     NTSTATUS status;
     TRACE( "buf %d, srcRGB %d, dstRGB %d, srcAlpha %d, dstAlpha %d\n", buf, srcRGB, dstRGB, srcAlpha, dstAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparateIndexedAMD, &args ))) WARN( "glBlendFuncSeparateIndexedAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFuncSeparateIndexedAMD, &args ))) WARN( "glBlendFuncSeparateIndexedAMD returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFuncSeparatei( GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
@@ -3732,7 +3732,7 @@ static void WINAPI glBlendFuncSeparatei( GLuint buf, GLenum srcRGB, GLenum dstRG
     struct glBlendFuncSeparatei_params args = { .teb = NtCurrentTeb(), .buf = buf, .srcRGB = srcRGB, .dstRGB = dstRGB, .srcAlpha = srcAlpha, .dstAlpha = dstAlpha };
     NTSTATUS status;
     TRACE( "buf %d, srcRGB %d, dstRGB %d, srcAlpha %d, dstAlpha %d\n", buf, srcRGB, dstRGB, srcAlpha, dstAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparatei, &args ))) WARN( "glBlendFuncSeparatei returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFuncSeparatei, &args ))) WARN( "glBlendFuncSeparatei returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFuncSeparateiARB( GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
@@ -3740,7 +3740,7 @@ static void WINAPI glBlendFuncSeparateiARB( GLuint buf, GLenum srcRGB, GLenum ds
     struct glBlendFuncSeparateiARB_params args = { .teb = NtCurrentTeb(), .buf = buf, .srcRGB = srcRGB, .dstRGB = dstRGB, .srcAlpha = srcAlpha, .dstAlpha = dstAlpha };
     NTSTATUS status;
     TRACE( "buf %d, srcRGB %d, dstRGB %d, srcAlpha %d, dstAlpha %d\n", buf, srcRGB, dstRGB, srcAlpha, dstAlpha );
-    if ((status = UNIX_CALL( glBlendFuncSeparateiARB, &args ))) WARN( "glBlendFuncSeparateiARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFuncSeparateiARB, &args ))) WARN( "glBlendFuncSeparateiARB returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFunci( GLuint buf, GLenum src, GLenum dst )
@@ -3748,7 +3748,7 @@ static void WINAPI glBlendFunci( GLuint buf, GLenum src, GLenum dst )
     struct glBlendFunci_params args = { .teb = NtCurrentTeb(), .buf = buf, .src = src, .dst = dst };
     NTSTATUS status;
     TRACE( "buf %d, src %d, dst %d\n", buf, src, dst );
-    if ((status = UNIX_CALL( glBlendFunci, &args ))) WARN( "glBlendFunci returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFunci, &args ))) WARN( "glBlendFunci returned %#lx\n", status );
 }
 
 static void WINAPI glBlendFunciARB( GLuint buf, GLenum src, GLenum dst )
@@ -3756,7 +3756,7 @@ static void WINAPI glBlendFunciARB( GLuint buf, GLenum src, GLenum dst )
     struct glBlendFunciARB_params args = { .teb = NtCurrentTeb(), .buf = buf, .src = src, .dst = dst };
     NTSTATUS status;
     TRACE( "buf %d, src %d, dst %d\n", buf, src, dst );
-    if ((status = UNIX_CALL( glBlendFunciARB, &args ))) WARN( "glBlendFunciARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendFunciARB, &args ))) WARN( "glBlendFunciARB returned %#lx\n", status );
 }
 
 static void WINAPI glBlendParameteriNV( GLenum pname, GLint value )
@@ -3764,7 +3764,7 @@ static void WINAPI glBlendParameteriNV( GLenum pname, GLint value )
     struct glBlendParameteriNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .value = value };
     NTSTATUS status;
     TRACE( "pname %d, value %d\n", pname, value );
-    if ((status = UNIX_CALL( glBlendParameteriNV, &args ))) WARN( "glBlendParameteriNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlendParameteriNV, &args ))) WARN( "glBlendParameteriNV returned %#lx\n", status );
 }
 
 static void WINAPI glBlitFramebuffer( GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
@@ -3772,7 +3772,7 @@ static void WINAPI glBlitFramebuffer( GLint srcX0, GLint srcY0, GLint srcX1, GLi
     struct glBlitFramebuffer_params args = { .teb = NtCurrentTeb(), .srcX0 = srcX0, .srcY0 = srcY0, .srcX1 = srcX1, .srcY1 = srcY1, .dstX0 = dstX0, .dstY0 = dstY0, .dstX1 = dstX1, .dstY1 = dstY1, .mask = mask, .filter = filter };
     NTSTATUS status;
     TRACE( "srcX0 %d, srcY0 %d, srcX1 %d, srcY1 %d, dstX0 %d, dstY0 %d, dstX1 %d, dstY1 %d, mask %d, filter %d\n", srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
-    if ((status = UNIX_CALL( glBlitFramebuffer, &args ))) WARN( "glBlitFramebuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlitFramebuffer, &args ))) WARN( "glBlitFramebuffer returned %#lx\n", status );
 }
 
 static void WINAPI glBlitFramebufferEXT( GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
@@ -3780,7 +3780,7 @@ static void WINAPI glBlitFramebufferEXT( GLint srcX0, GLint srcY0, GLint srcX1,
     struct glBlitFramebufferEXT_params args = { .teb = NtCurrentTeb(), .srcX0 = srcX0, .srcY0 = srcY0, .srcX1 = srcX1, .srcY1 = srcY1, .dstX0 = dstX0, .dstY0 = dstY0, .dstX1 = dstX1, .dstY1 = dstY1, .mask = mask, .filter = filter };
     NTSTATUS status;
     TRACE( "srcX0 %d, srcY0 %d, srcX1 %d, srcY1 %d, dstX0 %d, dstY0 %d, dstX1 %d, dstY1 %d, mask %d, filter %d\n", srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
-    if ((status = UNIX_CALL( glBlitFramebufferEXT, &args ))) WARN( "glBlitFramebufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlitFramebufferEXT, &args ))) WARN( "glBlitFramebufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glBlitNamedFramebuffer( GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
@@ -3788,7 +3788,7 @@ static void WINAPI glBlitNamedFramebuffer( GLuint readFramebuffer, GLuint drawFr
     struct glBlitNamedFramebuffer_params args = { .teb = NtCurrentTeb(), .readFramebuffer = readFramebuffer, .drawFramebuffer = drawFramebuffer, .srcX0 = srcX0, .srcY0 = srcY0, .srcX1 = srcX1, .srcY1 = srcY1, .dstX0 = dstX0, .dstY0 = dstY0, .dstX1 = dstX1, .dstY1 = dstY1, .mask = mask, .filter = filter };
     NTSTATUS status;
     TRACE( "readFramebuffer %d, drawFramebuffer %d, srcX0 %d, srcY0 %d, srcX1 %d, srcY1 %d, dstX0 %d, dstY0 %d, dstX1 %d, dstY1 %d, mask %d, filter %d\n", readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
-    if ((status = UNIX_CALL( glBlitNamedFramebuffer, &args ))) WARN( "glBlitNamedFramebuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBlitNamedFramebuffer, &args ))) WARN( "glBlitNamedFramebuffer returned %#lx\n", status );
 }
 
 static void WINAPI glBufferAddressRangeNV( GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length )
@@ -3804,7 +3804,7 @@ static void WINAPI glBufferAttachMemoryNV( GLenum target, GLuint memory, GLuint6
     struct glBufferAttachMemoryNV_params args = { .teb = NtCurrentTeb(), .target = target, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "target %d, memory %d, offset %s\n", target, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glBufferAttachMemoryNV, &args ))) WARN( "glBufferAttachMemoryNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBufferAttachMemoryNV, &args ))) WARN( "glBufferAttachMemoryNV returned %#lx\n", status );
 }
 
 static void WINAPI glBufferData( GLenum target, GLsizeiptr size, const void *data, GLenum usage )
@@ -3836,7 +3836,7 @@ static void WINAPI glBufferParameteriAPPLE( GLenum target, GLenum pname, GLint p
     struct glBufferParameteriAPPLE_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glBufferParameteriAPPLE, &args ))) WARN( "glBufferParameteriAPPLE returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glBufferParameteriAPPLE, &args ))) WARN( "glBufferParameteriAPPLE returned %#lx\n", status );
 }
 
 static GLuint WINAPI glBufferRegionEnabled(void)
@@ -3893,7 +3893,7 @@ static void WINAPI glCallCommandListNV( GLuint list )
     struct glCallCommandListNV_params args = { .teb = NtCurrentTeb(), .list = list };
     NTSTATUS status;
     TRACE( "list %d\n", list );
-    if ((status = UNIX_CALL( glCallCommandListNV, &args ))) WARN( "glCallCommandListNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCallCommandListNV, &args ))) WARN( "glCallCommandListNV returned %#lx\n", status );
 }
 
 static GLenum WINAPI glCheckFramebufferStatus( GLenum target )
@@ -3937,7 +3937,7 @@ static void WINAPI glClampColor( GLenum target, GLenum clamp )
     struct glClampColor_params args = { .teb = NtCurrentTeb(), .target = target, .clamp = clamp };
     NTSTATUS status;
     TRACE( "target %d, clamp %d\n", target, clamp );
-    if ((status = UNIX_CALL( glClampColor, &args ))) WARN( "glClampColor returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClampColor, &args ))) WARN( "glClampColor returned %#lx\n", status );
 }
 
 static void WINAPI glClampColorARB( GLenum target, GLenum clamp )
@@ -3945,7 +3945,7 @@ static void WINAPI glClampColorARB( GLenum target, GLenum clamp )
     struct glClampColorARB_params args = { .teb = NtCurrentTeb(), .target = target, .clamp = clamp };
     NTSTATUS status;
     TRACE( "target %d, clamp %d\n", target, clamp );
-    if ((status = UNIX_CALL( glClampColorARB, &args ))) WARN( "glClampColorARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClampColorARB, &args ))) WARN( "glClampColorARB returned %#lx\n", status );
 }
 
 static void WINAPI glClearAccumxOES( GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha )
@@ -3953,7 +3953,7 @@ static void WINAPI glClearAccumxOES( GLfixed red, GLfixed green, GLfixed blue, G
     struct glClearAccumxOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearAccumxOES, &args ))) WARN( "glClearAccumxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearAccumxOES, &args ))) WARN( "glClearAccumxOES returned %#lx\n", status );
 }
 
 static void WINAPI glClearBufferData( GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data )
@@ -3977,7 +3977,7 @@ static void WINAPI glClearBufferfi( GLenum buffer, GLint drawbuffer, GLfloat dep
     struct glClearBufferfi_params args = { .teb = NtCurrentTeb(), .buffer = buffer, .drawbuffer = drawbuffer, .depth = depth, .stencil = stencil };
     NTSTATUS status;
     TRACE( "buffer %d, drawbuffer %d, depth %f, stencil %d\n", buffer, drawbuffer, depth, stencil );
-    if ((status = UNIX_CALL( glClearBufferfi, &args ))) WARN( "glClearBufferfi returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearBufferfi, &args ))) WARN( "glClearBufferfi returned %#lx\n", status );
 }
 
 static void WINAPI glClearBufferfv( GLenum buffer, GLint drawbuffer, const GLfloat *value )
@@ -4009,7 +4009,7 @@ static void WINAPI glClearColorIiEXT( GLint red, GLint green, GLint blue, GLint
     struct glClearColorIiEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearColorIiEXT, &args ))) WARN( "glClearColorIiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearColorIiEXT, &args ))) WARN( "glClearColorIiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glClearColorIuiEXT( GLuint red, GLuint green, GLuint blue, GLuint alpha )
@@ -4017,7 +4017,7 @@ static void WINAPI glClearColorIuiEXT( GLuint red, GLuint green, GLuint blue, GL
     struct glClearColorIuiEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearColorIuiEXT, &args ))) WARN( "glClearColorIuiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearColorIuiEXT, &args ))) WARN( "glClearColorIuiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glClearColorxOES( GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha )
@@ -4025,7 +4025,7 @@ static void WINAPI glClearColorxOES( GLfixed red, GLfixed green, GLfixed blue, G
     struct glClearColorxOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glClearColorxOES, &args ))) WARN( "glClearColorxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearColorxOES, &args ))) WARN( "glClearColorxOES returned %#lx\n", status );
 }
 
 static void WINAPI glClearDepthdNV( GLdouble depth )
@@ -4033,7 +4033,7 @@ static void WINAPI glClearDepthdNV( GLdouble depth )
     struct glClearDepthdNV_params args = { .teb = NtCurrentTeb(), .depth = depth };
     NTSTATUS status;
     TRACE( "depth %f\n", depth );
-    if ((status = UNIX_CALL( glClearDepthdNV, &args ))) WARN( "glClearDepthdNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearDepthdNV, &args ))) WARN( "glClearDepthdNV returned %#lx\n", status );
 }
 
 static void WINAPI glClearDepthf( GLfloat d )
@@ -4041,7 +4041,7 @@ static void WINAPI glClearDepthf( GLfloat d )
     struct glClearDepthf_params args = { .teb = NtCurrentTeb(), .d = d };
     NTSTATUS status;
     TRACE( "d %f\n", d );
-    if ((status = UNIX_CALL( glClearDepthf, &args ))) WARN( "glClearDepthf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearDepthf, &args ))) WARN( "glClearDepthf returned %#lx\n", status );
 }
 
 static void WINAPI glClearDepthfOES( GLclampf depth )
@@ -4049,7 +4049,7 @@ static void WINAPI glClearDepthfOES( GLclampf depth )
     struct glClearDepthfOES_params args = { .teb = NtCurrentTeb(), .depth = depth };
     NTSTATUS status;
     TRACE( "depth %f\n", depth );
-    if ((status = UNIX_CALL( glClearDepthfOES, &args ))) WARN( "glClearDepthfOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearDepthfOES, &args ))) WARN( "glClearDepthfOES returned %#lx\n", status );
 }
 
 static void WINAPI glClearDepthxOES( GLfixed depth )
@@ -4057,7 +4057,7 @@ static void WINAPI glClearDepthxOES( GLfixed depth )
     struct glClearDepthxOES_params args = { .teb = NtCurrentTeb(), .depth = depth };
     NTSTATUS status;
     TRACE( "depth %d\n", depth );
-    if ((status = UNIX_CALL( glClearDepthxOES, &args ))) WARN( "glClearDepthxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearDepthxOES, &args ))) WARN( "glClearDepthxOES returned %#lx\n", status );
 }
 
 static void WINAPI glClearNamedBufferData( GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data )
@@ -4097,7 +4097,7 @@ static void WINAPI glClearNamedFramebufferfi( GLuint framebuffer, GLenum buffer,
     struct glClearNamedFramebufferfi_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .buffer = buffer, .drawbuffer = drawbuffer, .depth = depth, .stencil = stencil };
     NTSTATUS status;
     TRACE( "framebuffer %d, buffer %d, drawbuffer %d, depth %f, stencil %d\n", framebuffer, buffer, drawbuffer, depth, stencil );
-    if ((status = UNIX_CALL( glClearNamedFramebufferfi, &args ))) WARN( "glClearNamedFramebufferfi returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClearNamedFramebufferfi, &args ))) WARN( "glClearNamedFramebufferfi returned %#lx\n", status );
 }
 
 static void WINAPI glClearNamedFramebufferfv( GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value )
@@ -4145,7 +4145,7 @@ static void WINAPI glClientActiveTexture( GLenum texture )
     struct glClientActiveTexture_params args = { .teb = NtCurrentTeb(), .texture = texture };
     NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glClientActiveTexture, &args ))) WARN( "glClientActiveTexture returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClientActiveTexture, &args ))) WARN( "glClientActiveTexture returned %#lx\n", status );
 }
 
 static void WINAPI glClientActiveTextureARB( GLenum texture )
@@ -4153,7 +4153,7 @@ static void WINAPI glClientActiveTextureARB( GLenum texture )
     struct glClientActiveTextureARB_params args = { .teb = NtCurrentTeb(), .texture = texture };
     NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glClientActiveTextureARB, &args ))) WARN( "glClientActiveTextureARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClientActiveTextureARB, &args ))) WARN( "glClientActiveTextureARB returned %#lx\n", status );
 }
 
 static void WINAPI glClientActiveVertexStreamATI( GLenum stream )
@@ -4161,7 +4161,7 @@ static void WINAPI glClientActiveVertexStreamATI( GLenum stream )
     struct glClientActiveVertexStreamATI_params args = { .teb = NtCurrentTeb(), .stream = stream };
     NTSTATUS status;
     TRACE( "stream %d\n", stream );
-    if ((status = UNIX_CALL( glClientActiveVertexStreamATI, &args ))) WARN( "glClientActiveVertexStreamATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClientActiveVertexStreamATI, &args ))) WARN( "glClientActiveVertexStreamATI returned %#lx\n", status );
 }
 
 static void WINAPI glClientAttribDefaultEXT( GLbitfield mask )
@@ -4169,7 +4169,7 @@ static void WINAPI glClientAttribDefaultEXT( GLbitfield mask )
     struct glClientAttribDefaultEXT_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glClientAttribDefaultEXT, &args ))) WARN( "glClientAttribDefaultEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClientAttribDefaultEXT, &args ))) WARN( "glClientAttribDefaultEXT returned %#lx\n", status );
 }
 
 static void WINAPI glClientWaitSemaphoreui64NVX( GLsizei fenceObjectCount, const GLuint *semaphoreArray, const GLuint64 *fenceValueArray )
@@ -4194,7 +4194,7 @@ static void WINAPI glClipControl( GLenum origin, GLenum depth )
     struct glClipControl_params args = { .teb = NtCurrentTeb(), .origin = origin, .depth = depth };
     NTSTATUS status;
     TRACE( "origin %d, depth %d\n", origin, depth );
-    if ((status = UNIX_CALL( glClipControl, &args ))) WARN( "glClipControl returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glClipControl, &args ))) WARN( "glClipControl returned %#lx\n", status );
 }
 
 static void WINAPI glClipPlanefOES( GLenum plane, const GLfloat *equation )
@@ -4218,7 +4218,7 @@ static void WINAPI glColor3fVertex3fSUN( GLfloat r, GLfloat g, GLfloat b, GLfloa
     struct glColor3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .r = r, .g = g, .b = b, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "r %f, g %f, b %f, x %f, y %f, z %f\n", r, g, b, x, y, z );
-    if ((status = UNIX_CALL( glColor3fVertex3fSUN, &args ))) WARN( "glColor3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3fVertex3fSUN, &args ))) WARN( "glColor3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glColor3fVertex3fvSUN( const GLfloat *c, const GLfloat *v )
@@ -4234,7 +4234,7 @@ static void WINAPI glColor3hNV( GLhalfNV red, GLhalfNV green, GLhalfNV blue )
     struct glColor3hNV_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3hNV, &args ))) WARN( "glColor3hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3hNV, &args ))) WARN( "glColor3hNV returned %#lx\n", status );
 }
 
 static void WINAPI glColor3hvNV( const GLhalfNV *v )
@@ -4250,7 +4250,7 @@ static void WINAPI glColor3xOES( GLfixed red, GLfixed green, GLfixed blue )
     struct glColor3xOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glColor3xOES, &args ))) WARN( "glColor3xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor3xOES, &args ))) WARN( "glColor3xOES returned %#lx\n", status );
 }
 
 static void WINAPI glColor3xvOES( const GLfixed *components )
@@ -4266,7 +4266,7 @@ static void WINAPI glColor4fNormal3fVertex3fSUN( GLfloat r, GLfloat g, GLfloat b
     struct glColor4fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", r, g, b, a, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glColor4fNormal3fVertex3fSUN, &args ))) WARN( "glColor4fNormal3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4fNormal3fVertex3fSUN, &args ))) WARN( "glColor4fNormal3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glColor4fNormal3fVertex3fvSUN( const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -4282,7 +4282,7 @@ static void WINAPI glColor4hNV( GLhalfNV red, GLhalfNV green, GLhalfNV blue, GLh
     struct glColor4hNV_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4hNV, &args ))) WARN( "glColor4hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4hNV, &args ))) WARN( "glColor4hNV returned %#lx\n", status );
 }
 
 static void WINAPI glColor4hvNV( const GLhalfNV *v )
@@ -4298,7 +4298,7 @@ static void WINAPI glColor4ubVertex2fSUN( GLubyte r, GLubyte g, GLubyte b, GLuby
     struct glColor4ubVertex2fSUN_params args = { .teb = NtCurrentTeb(), .r = r, .g = g, .b = b, .a = a, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "r %d, g %d, b %d, a %d, x %f, y %f\n", r, g, b, a, x, y );
-    if ((status = UNIX_CALL( glColor4ubVertex2fSUN, &args ))) WARN( "glColor4ubVertex2fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4ubVertex2fSUN, &args ))) WARN( "glColor4ubVertex2fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glColor4ubVertex2fvSUN( const GLubyte *c, const GLfloat *v )
@@ -4314,7 +4314,7 @@ static void WINAPI glColor4ubVertex3fSUN( GLubyte r, GLubyte g, GLubyte b, GLuby
     struct glColor4ubVertex3fSUN_params args = { .teb = NtCurrentTeb(), .r = r, .g = g, .b = b, .a = a, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "r %d, g %d, b %d, a %d, x %f, y %f, z %f\n", r, g, b, a, x, y, z );
-    if ((status = UNIX_CALL( glColor4ubVertex3fSUN, &args ))) WARN( "glColor4ubVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4ubVertex3fSUN, &args ))) WARN( "glColor4ubVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glColor4ubVertex3fvSUN( const GLubyte *c, const GLfloat *v )
@@ -4330,7 +4330,7 @@ static void WINAPI glColor4xOES( GLfixed red, GLfixed green, GLfixed blue, GLfix
     struct glColor4xOES_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glColor4xOES, &args ))) WARN( "glColor4xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColor4xOES, &args ))) WARN( "glColor4xOES returned %#lx\n", status );
 }
 
 static void WINAPI glColor4xvOES( const GLfixed *components )
@@ -4346,7 +4346,7 @@ static void WINAPI glColorFormatNV( GLint size, GLenum type, GLsizei stride )
     struct glColorFormatNV_params args = { .teb = NtCurrentTeb(), .size = size, .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "size %d, type %d, stride %d\n", size, type, stride );
-    if ((status = UNIX_CALL( glColorFormatNV, &args ))) WARN( "glColorFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorFormatNV, &args ))) WARN( "glColorFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glColorFragmentOp1ATI( GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod )
@@ -4354,7 +4354,7 @@ static void WINAPI glColorFragmentOp1ATI( GLenum op, GLuint dst, GLuint dstMask,
     struct glColorFragmentOp1ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMask = dstMask, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod };
     NTSTATUS status;
     TRACE( "op %d, dst %d, dstMask %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod );
-    if ((status = UNIX_CALL( glColorFragmentOp1ATI, &args ))) WARN( "glColorFragmentOp1ATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorFragmentOp1ATI, &args ))) WARN( "glColorFragmentOp1ATI returned %#lx\n", status );
 }
 
 static void WINAPI glColorFragmentOp2ATI( GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod )
@@ -4362,7 +4362,7 @@ static void WINAPI glColorFragmentOp2ATI( GLenum op, GLuint dst, GLuint dstMask,
     struct glColorFragmentOp2ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMask = dstMask, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod, .arg2 = arg2, .arg2Rep = arg2Rep, .arg2Mod = arg2Mod };
     NTSTATUS status;
     TRACE( "op %d, dst %d, dstMask %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d, arg2 %d, arg2Rep %d, arg2Mod %d\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod );
-    if ((status = UNIX_CALL( glColorFragmentOp2ATI, &args ))) WARN( "glColorFragmentOp2ATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorFragmentOp2ATI, &args ))) WARN( "glColorFragmentOp2ATI returned %#lx\n", status );
 }
 
 static void WINAPI glColorFragmentOp3ATI( GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod )
@@ -4370,7 +4370,7 @@ static void WINAPI glColorFragmentOp3ATI( GLenum op, GLuint dst, GLuint dstMask,
     struct glColorFragmentOp3ATI_params args = { .teb = NtCurrentTeb(), .op = op, .dst = dst, .dstMask = dstMask, .dstMod = dstMod, .arg1 = arg1, .arg1Rep = arg1Rep, .arg1Mod = arg1Mod, .arg2 = arg2, .arg2Rep = arg2Rep, .arg2Mod = arg2Mod, .arg3 = arg3, .arg3Rep = arg3Rep, .arg3Mod = arg3Mod };
     NTSTATUS status;
     TRACE( "op %d, dst %d, dstMask %d, dstMod %d, arg1 %d, arg1Rep %d, arg1Mod %d, arg2 %d, arg2Rep %d, arg2Mod %d, arg3 %d, arg3Rep %d, arg3Mod %d\n", op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod );
-    if ((status = UNIX_CALL( glColorFragmentOp3ATI, &args ))) WARN( "glColorFragmentOp3ATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorFragmentOp3ATI, &args ))) WARN( "glColorFragmentOp3ATI returned %#lx\n", status );
 }
 
 static void WINAPI glColorMaskIndexedEXT( GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a )
@@ -4378,7 +4378,7 @@ static void WINAPI glColorMaskIndexedEXT( GLuint index, GLboolean r, GLboolean g
     struct glColorMaskIndexedEXT_params args = { .teb = NtCurrentTeb(), .index = index, .r = r, .g = g, .b = b, .a = a };
     NTSTATUS status;
     TRACE( "index %d, r %d, g %d, b %d, a %d\n", index, r, g, b, a );
-    if ((status = UNIX_CALL( glColorMaskIndexedEXT, &args ))) WARN( "glColorMaskIndexedEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorMaskIndexedEXT, &args ))) WARN( "glColorMaskIndexedEXT returned %#lx\n", status );
 }
 
 static void WINAPI glColorMaski( GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a )
@@ -4386,7 +4386,7 @@ static void WINAPI glColorMaski( GLuint index, GLboolean r, GLboolean g, GLboole
     struct glColorMaski_params args = { .teb = NtCurrentTeb(), .index = index, .r = r, .g = g, .b = b, .a = a };
     NTSTATUS status;
     TRACE( "index %d, r %d, g %d, b %d, a %d\n", index, r, g, b, a );
-    if ((status = UNIX_CALL( glColorMaski, &args ))) WARN( "glColorMaski returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorMaski, &args ))) WARN( "glColorMaski returned %#lx\n", status );
 }
 
 static void WINAPI glColorP3ui( GLenum type, GLuint color )
@@ -4394,7 +4394,7 @@ static void WINAPI glColorP3ui( GLenum type, GLuint color )
     struct glColorP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .color = color };
     NTSTATUS status;
     TRACE( "type %d, color %d\n", type, color );
-    if ((status = UNIX_CALL( glColorP3ui, &args ))) WARN( "glColorP3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorP3ui, &args ))) WARN( "glColorP3ui returned %#lx\n", status );
 }
 
 static void WINAPI glColorP3uiv( GLenum type, const GLuint *color )
@@ -4410,7 +4410,7 @@ static void WINAPI glColorP4ui( GLenum type, GLuint color )
     struct glColorP4ui_params args = { .teb = NtCurrentTeb(), .type = type, .color = color };
     NTSTATUS status;
     TRACE( "type %d, color %d\n", type, color );
-    if ((status = UNIX_CALL( glColorP4ui, &args ))) WARN( "glColorP4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glColorP4ui, &args ))) WARN( "glColorP4ui returned %#lx\n", status );
 }
 
 static void WINAPI glColorP4uiv( GLenum type, const GLuint *color )
@@ -4522,7 +4522,7 @@ static void WINAPI glCombinerInputNV( GLenum stage, GLenum portion, GLenum varia
     struct glCombinerInputNV_params args = { .teb = NtCurrentTeb(), .stage = stage, .portion = portion, .variable = variable, .input = input, .mapping = mapping, .componentUsage = componentUsage };
     NTSTATUS status;
     TRACE( "stage %d, portion %d, variable %d, input %d, mapping %d, componentUsage %d\n", stage, portion, variable, input, mapping, componentUsage );
-    if ((status = UNIX_CALL( glCombinerInputNV, &args ))) WARN( "glCombinerInputNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCombinerInputNV, &args ))) WARN( "glCombinerInputNV returned %#lx\n", status );
 }
 
 static void WINAPI glCombinerOutputNV( GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum )
@@ -4530,7 +4530,7 @@ static void WINAPI glCombinerOutputNV( GLenum stage, GLenum portion, GLenum abOu
     struct glCombinerOutputNV_params args = { .teb = NtCurrentTeb(), .stage = stage, .portion = portion, .abOutput = abOutput, .cdOutput = cdOutput, .sumOutput = sumOutput, .scale = scale, .bias = bias, .abDotProduct = abDotProduct, .cdDotProduct = cdDotProduct, .muxSum = muxSum };
     NTSTATUS status;
     TRACE( "stage %d, portion %d, abOutput %d, cdOutput %d, sumOutput %d, scale %d, bias %d, abDotProduct %d, cdDotProduct %d, muxSum %d\n", stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum );
-    if ((status = UNIX_CALL( glCombinerOutputNV, &args ))) WARN( "glCombinerOutputNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCombinerOutputNV, &args ))) WARN( "glCombinerOutputNV returned %#lx\n", status );
 }
 
 static void WINAPI glCombinerParameterfNV( GLenum pname, GLfloat param )
@@ -4538,7 +4538,7 @@ static void WINAPI glCombinerParameterfNV( GLenum pname, GLfloat param )
     struct glCombinerParameterfNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glCombinerParameterfNV, &args ))) WARN( "glCombinerParameterfNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCombinerParameterfNV, &args ))) WARN( "glCombinerParameterfNV returned %#lx\n", status );
 }
 
 static void WINAPI glCombinerParameterfvNV( GLenum pname, const GLfloat *params )
@@ -4554,7 +4554,7 @@ static void WINAPI glCombinerParameteriNV( GLenum pname, GLint param )
     struct glCombinerParameteriNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glCombinerParameteriNV, &args ))) WARN( "glCombinerParameteriNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCombinerParameteriNV, &args ))) WARN( "glCombinerParameteriNV returned %#lx\n", status );
 }
 
 static void WINAPI glCombinerParameterivNV( GLenum pname, const GLint *params )
@@ -4578,7 +4578,7 @@ static void WINAPI glCommandListSegmentsNV( GLuint list, GLuint segments )
     struct glCommandListSegmentsNV_params args = { .teb = NtCurrentTeb(), .list = list, .segments = segments };
     NTSTATUS status;
     TRACE( "list %d, segments %d\n", list, segments );
-    if ((status = UNIX_CALL( glCommandListSegmentsNV, &args ))) WARN( "glCommandListSegmentsNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCommandListSegmentsNV, &args ))) WARN( "glCommandListSegmentsNV returned %#lx\n", status );
 }
 
 static void WINAPI glCompileCommandListNV( GLuint list )
@@ -4586,7 +4586,7 @@ static void WINAPI glCompileCommandListNV( GLuint list )
     struct glCompileCommandListNV_params args = { .teb = NtCurrentTeb(), .list = list };
     NTSTATUS status;
     TRACE( "list %d\n", list );
-    if ((status = UNIX_CALL( glCompileCommandListNV, &args ))) WARN( "glCompileCommandListNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCompileCommandListNV, &args ))) WARN( "glCompileCommandListNV returned %#lx\n", status );
 }
 
 static void WINAPI glCompileShader( GLuint shader )
@@ -4594,7 +4594,7 @@ static void WINAPI glCompileShader( GLuint shader )
     struct glCompileShader_params args = { .teb = NtCurrentTeb(), .shader = shader };
     NTSTATUS status;
     TRACE( "shader %d\n", shader );
-    if ((status = UNIX_CALL( glCompileShader, &args ))) WARN( "glCompileShader returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCompileShader, &args ))) WARN( "glCompileShader returned %#lx\n", status );
 }
 
 static void WINAPI glCompileShaderARB( GLhandleARB shaderObj )
@@ -4602,7 +4602,7 @@ static void WINAPI glCompileShaderARB( GLhandleARB shaderObj )
     struct glCompileShaderARB_params args = { .teb = NtCurrentTeb(), .shaderObj = shaderObj };
     NTSTATUS status;
     TRACE( "shaderObj %d\n", shaderObj );
-    if ((status = UNIX_CALL( glCompileShaderARB, &args ))) WARN( "glCompileShaderARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCompileShaderARB, &args ))) WARN( "glCompileShaderARB returned %#lx\n", status );
 }
 
 static void WINAPI glCompileShaderIncludeARB( GLuint shader, GLsizei count, const GLchar *const*path, const GLint *length )
@@ -4834,7 +4834,7 @@ static void WINAPI glConservativeRasterParameterfNV( GLenum pname, GLfloat value
     struct glConservativeRasterParameterfNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .value = value };
     NTSTATUS status;
     TRACE( "pname %d, value %f\n", pname, value );
-    if ((status = UNIX_CALL( glConservativeRasterParameterfNV, &args ))) WARN( "glConservativeRasterParameterfNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glConservativeRasterParameterfNV, &args ))) WARN( "glConservativeRasterParameterfNV returned %#lx\n", status );
 }
 
 static void WINAPI glConservativeRasterParameteriNV( GLenum pname, GLint param )
@@ -4842,7 +4842,7 @@ static void WINAPI glConservativeRasterParameteriNV( GLenum pname, GLint param )
     struct glConservativeRasterParameteriNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glConservativeRasterParameteriNV, &args ))) WARN( "glConservativeRasterParameteriNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glConservativeRasterParameteriNV, &args ))) WARN( "glConservativeRasterParameteriNV returned %#lx\n", status );
 }
 
 static void WINAPI glConvolutionFilter1D( GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image )
@@ -4882,7 +4882,7 @@ static void WINAPI glConvolutionParameterf( GLenum target, GLenum pname, GLfloat
     struct glConvolutionParameterf_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .params = params };
     NTSTATUS status;
     TRACE( "target %d, pname %d, params %f\n", target, pname, params );
-    if ((status = UNIX_CALL( glConvolutionParameterf, &args ))) WARN( "glConvolutionParameterf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glConvolutionParameterf, &args ))) WARN( "glConvolutionParameterf returned %#lx\n", status );
 }
 
 static void WINAPI glConvolutionParameterfEXT( GLenum target, GLenum pname, GLfloat params )
@@ -4890,7 +4890,7 @@ static void WINAPI glConvolutionParameterfEXT( GLenum target, GLenum pname, GLfl
     struct glConvolutionParameterfEXT_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .params = params };
     NTSTATUS status;
     TRACE( "target %d, pname %d, params %f\n", target, pname, params );
-    if ((status = UNIX_CALL( glConvolutionParameterfEXT, &args ))) WARN( "glConvolutionParameterfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glConvolutionParameterfEXT, &args ))) WARN( "glConvolutionParameterfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glConvolutionParameterfv( GLenum target, GLenum pname, const GLfloat *params )
@@ -4914,7 +4914,7 @@ static void WINAPI glConvolutionParameteri( GLenum target, GLenum pname, GLint p
     struct glConvolutionParameteri_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .params = params };
     NTSTATUS status;
     TRACE( "target %d, pname %d, params %d\n", target, pname, params );
-    if ((status = UNIX_CALL( glConvolutionParameteri, &args ))) WARN( "glConvolutionParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glConvolutionParameteri, &args ))) WARN( "glConvolutionParameteri returned %#lx\n", status );
 }
 
 static void WINAPI glConvolutionParameteriEXT( GLenum target, GLenum pname, GLint params )
@@ -4922,7 +4922,7 @@ static void WINAPI glConvolutionParameteriEXT( GLenum target, GLenum pname, GLin
     struct glConvolutionParameteriEXT_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .params = params };
     NTSTATUS status;
     TRACE( "target %d, pname %d, params %d\n", target, pname, params );
-    if ((status = UNIX_CALL( glConvolutionParameteriEXT, &args ))) WARN( "glConvolutionParameteriEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glConvolutionParameteriEXT, &args ))) WARN( "glConvolutionParameteriEXT returned %#lx\n", status );
 }
 
 static void WINAPI glConvolutionParameteriv( GLenum target, GLenum pname, const GLint *params )
@@ -4946,7 +4946,7 @@ static void WINAPI glConvolutionParameterxOES( GLenum target, GLenum pname, GLfi
     struct glConvolutionParameterxOES_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glConvolutionParameterxOES, &args ))) WARN( "glConvolutionParameterxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glConvolutionParameterxOES, &args ))) WARN( "glConvolutionParameterxOES returned %#lx\n", status );
 }
 
 static void WINAPI glConvolutionParameterxvOES( GLenum target, GLenum pname, const GLfixed *params )
@@ -4970,7 +4970,7 @@ static void WINAPI glCopyColorSubTable( GLenum target, GLsizei start, GLint x, G
     struct glCopyColorSubTable_params args = { .teb = NtCurrentTeb(), .target = target, .start = start, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "target %d, start %d, x %d, y %d, width %d\n", target, start, x, y, width );
-    if ((status = UNIX_CALL( glCopyColorSubTable, &args ))) WARN( "glCopyColorSubTable returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyColorSubTable, &args ))) WARN( "glCopyColorSubTable returned %#lx\n", status );
 }
 
 static void WINAPI glCopyColorSubTableEXT( GLenum target, GLsizei start, GLint x, GLint y, GLsizei width )
@@ -4978,7 +4978,7 @@ static void WINAPI glCopyColorSubTableEXT( GLenum target, GLsizei start, GLint x
     struct glCopyColorSubTableEXT_params args = { .teb = NtCurrentTeb(), .target = target, .start = start, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "target %d, start %d, x %d, y %d, width %d\n", target, start, x, y, width );
-    if ((status = UNIX_CALL( glCopyColorSubTableEXT, &args ))) WARN( "glCopyColorSubTableEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyColorSubTableEXT, &args ))) WARN( "glCopyColorSubTableEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyColorTable( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width )
@@ -4986,7 +4986,7 @@ static void WINAPI glCopyColorTable( GLenum target, GLenum internalformat, GLint
     struct glCopyColorTable_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d\n", target, internalformat, x, y, width );
-    if ((status = UNIX_CALL( glCopyColorTable, &args ))) WARN( "glCopyColorTable returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyColorTable, &args ))) WARN( "glCopyColorTable returned %#lx\n", status );
 }
 
 static void WINAPI glCopyColorTableSGI( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width )
@@ -4994,7 +4994,7 @@ static void WINAPI glCopyColorTableSGI( GLenum target, GLenum internalformat, GL
     struct glCopyColorTableSGI_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d\n", target, internalformat, x, y, width );
-    if ((status = UNIX_CALL( glCopyColorTableSGI, &args ))) WARN( "glCopyColorTableSGI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyColorTableSGI, &args ))) WARN( "glCopyColorTableSGI returned %#lx\n", status );
 }
 
 static void WINAPI glCopyConvolutionFilter1D( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width )
@@ -5002,7 +5002,7 @@ static void WINAPI glCopyConvolutionFilter1D( GLenum target, GLenum internalform
     struct glCopyConvolutionFilter1D_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d\n", target, internalformat, x, y, width );
-    if ((status = UNIX_CALL( glCopyConvolutionFilter1D, &args ))) WARN( "glCopyConvolutionFilter1D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyConvolutionFilter1D, &args ))) WARN( "glCopyConvolutionFilter1D returned %#lx\n", status );
 }
 
 static void WINAPI glCopyConvolutionFilter1DEXT( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width )
@@ -5010,7 +5010,7 @@ static void WINAPI glCopyConvolutionFilter1DEXT( GLenum target, GLenum internalf
     struct glCopyConvolutionFilter1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d\n", target, internalformat, x, y, width );
-    if ((status = UNIX_CALL( glCopyConvolutionFilter1DEXT, &args ))) WARN( "glCopyConvolutionFilter1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyConvolutionFilter1DEXT, &args ))) WARN( "glCopyConvolutionFilter1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyConvolutionFilter2D( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5018,7 +5018,7 @@ static void WINAPI glCopyConvolutionFilter2D( GLenum target, GLenum internalform
     struct glCopyConvolutionFilter2D_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d, height %d\n", target, internalformat, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyConvolutionFilter2D, &args ))) WARN( "glCopyConvolutionFilter2D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyConvolutionFilter2D, &args ))) WARN( "glCopyConvolutionFilter2D returned %#lx\n", status );
 }
 
 static void WINAPI glCopyConvolutionFilter2DEXT( GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5026,7 +5026,7 @@ static void WINAPI glCopyConvolutionFilter2DEXT( GLenum target, GLenum internalf
     struct glCopyConvolutionFilter2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, x %d, y %d, width %d, height %d\n", target, internalformat, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyConvolutionFilter2DEXT, &args ))) WARN( "glCopyConvolutionFilter2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyConvolutionFilter2DEXT, &args ))) WARN( "glCopyConvolutionFilter2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyImageSubData( GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth )
@@ -5034,7 +5034,7 @@ static void WINAPI glCopyImageSubData( GLuint srcName, GLenum srcTarget, GLint s
     struct glCopyImageSubData_params args = { .teb = NtCurrentTeb(), .srcName = srcName, .srcTarget = srcTarget, .srcLevel = srcLevel, .srcX = srcX, .srcY = srcY, .srcZ = srcZ, .dstName = dstName, .dstTarget = dstTarget, .dstLevel = dstLevel, .dstX = dstX, .dstY = dstY, .dstZ = dstZ, .srcWidth = srcWidth, .srcHeight = srcHeight, .srcDepth = srcDepth };
     NTSTATUS status;
     TRACE( "srcName %d, srcTarget %d, srcLevel %d, srcX %d, srcY %d, srcZ %d, dstName %d, dstTarget %d, dstLevel %d, dstX %d, dstY %d, dstZ %d, srcWidth %d, srcHeight %d, srcDepth %d\n", srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth );
-    if ((status = UNIX_CALL( glCopyImageSubData, &args ))) WARN( "glCopyImageSubData returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyImageSubData, &args ))) WARN( "glCopyImageSubData returned %#lx\n", status );
 }
 
 static void WINAPI glCopyImageSubDataNV( GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth )
@@ -5042,7 +5042,7 @@ static void WINAPI glCopyImageSubDataNV( GLuint srcName, GLenum srcTarget, GLint
     struct glCopyImageSubDataNV_params args = { .teb = NtCurrentTeb(), .srcName = srcName, .srcTarget = srcTarget, .srcLevel = srcLevel, .srcX = srcX, .srcY = srcY, .srcZ = srcZ, .dstName = dstName, .dstTarget = dstTarget, .dstLevel = dstLevel, .dstX = dstX, .dstY = dstY, .dstZ = dstZ, .width = width, .height = height, .depth = depth };
     NTSTATUS status;
     TRACE( "srcName %d, srcTarget %d, srcLevel %d, srcX %d, srcY %d, srcZ %d, dstName %d, dstTarget %d, dstLevel %d, dstX %d, dstY %d, dstZ %d, width %d, height %d, depth %d\n", srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth );
-    if ((status = UNIX_CALL( glCopyImageSubDataNV, &args ))) WARN( "glCopyImageSubDataNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyImageSubDataNV, &args ))) WARN( "glCopyImageSubDataNV returned %#lx\n", status );
 }
 
 static void WINAPI glCopyMultiTexImage1DEXT( GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border )
@@ -5050,7 +5050,7 @@ static void WINAPI glCopyMultiTexImage1DEXT( GLenum texunit, GLenum target, GLin
     struct glCopyMultiTexImage1DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .border = border };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, internalformat %d, x %d, y %d, width %d, border %d\n", texunit, target, level, internalformat, x, y, width, border );
-    if ((status = UNIX_CALL( glCopyMultiTexImage1DEXT, &args ))) WARN( "glCopyMultiTexImage1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyMultiTexImage1DEXT, &args ))) WARN( "glCopyMultiTexImage1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyMultiTexImage2DEXT( GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
@@ -5058,7 +5058,7 @@ static void WINAPI glCopyMultiTexImage2DEXT( GLenum texunit, GLenum target, GLin
     struct glCopyMultiTexImage2DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height, .border = border };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, internalformat %d, x %d, y %d, width %d, height %d, border %d\n", texunit, target, level, internalformat, x, y, width, height, border );
-    if ((status = UNIX_CALL( glCopyMultiTexImage2DEXT, &args ))) WARN( "glCopyMultiTexImage2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyMultiTexImage2DEXT, &args ))) WARN( "glCopyMultiTexImage2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyMultiTexSubImage1DEXT( GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
@@ -5066,7 +5066,7 @@ static void WINAPI glCopyMultiTexSubImage1DEXT( GLenum texunit, GLenum target, G
     struct glCopyMultiTexSubImage1DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, xoffset %d, x %d, y %d, width %d\n", texunit, target, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyMultiTexSubImage1DEXT, &args ))) WARN( "glCopyMultiTexSubImage1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyMultiTexSubImage1DEXT, &args ))) WARN( "glCopyMultiTexSubImage1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyMultiTexSubImage2DEXT( GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5074,7 +5074,7 @@ static void WINAPI glCopyMultiTexSubImage2DEXT( GLenum texunit, GLenum target, G
     struct glCopyMultiTexSubImage2DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", texunit, target, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyMultiTexSubImage2DEXT, &args ))) WARN( "glCopyMultiTexSubImage2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyMultiTexSubImage2DEXT, &args ))) WARN( "glCopyMultiTexSubImage2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyMultiTexSubImage3DEXT( GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5082,7 +5082,7 @@ static void WINAPI glCopyMultiTexSubImage3DEXT( GLenum texunit, GLenum target, G
     struct glCopyMultiTexSubImage3DEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyMultiTexSubImage3DEXT, &args ))) WARN( "glCopyMultiTexSubImage3DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyMultiTexSubImage3DEXT, &args ))) WARN( "glCopyMultiTexSubImage3DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyNamedBufferSubData( GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size )
@@ -5098,7 +5098,7 @@ static void WINAPI glCopyPathNV( GLuint resultPath, GLuint srcPath )
     struct glCopyPathNV_params args = { .teb = NtCurrentTeb(), .resultPath = resultPath, .srcPath = srcPath };
     NTSTATUS status;
     TRACE( "resultPath %d, srcPath %d\n", resultPath, srcPath );
-    if ((status = UNIX_CALL( glCopyPathNV, &args ))) WARN( "glCopyPathNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyPathNV, &args ))) WARN( "glCopyPathNV returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTexImage1DEXT( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border )
@@ -5106,7 +5106,7 @@ static void WINAPI glCopyTexImage1DEXT( GLenum target, GLint level, GLenum inter
     struct glCopyTexImage1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .border = border };
     NTSTATUS status;
     TRACE( "target %d, level %d, internalformat %d, x %d, y %d, width %d, border %d\n", target, level, internalformat, x, y, width, border );
-    if ((status = UNIX_CALL( glCopyTexImage1DEXT, &args ))) WARN( "glCopyTexImage1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexImage1DEXT, &args ))) WARN( "glCopyTexImage1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTexImage2DEXT( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
@@ -5114,7 +5114,7 @@ static void WINAPI glCopyTexImage2DEXT( GLenum target, GLint level, GLenum inter
     struct glCopyTexImage2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height, .border = border };
     NTSTATUS status;
     TRACE( "target %d, level %d, internalformat %d, x %d, y %d, width %d, height %d, border %d\n", target, level, internalformat, x, y, width, height, border );
-    if ((status = UNIX_CALL( glCopyTexImage2DEXT, &args ))) WARN( "glCopyTexImage2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexImage2DEXT, &args ))) WARN( "glCopyTexImage2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTexSubImage1DEXT( GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
@@ -5122,7 +5122,7 @@ static void WINAPI glCopyTexSubImage1DEXT( GLenum target, GLint level, GLint xof
     struct glCopyTexSubImage1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, x %d, y %d, width %d\n", target, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyTexSubImage1DEXT, &args ))) WARN( "glCopyTexSubImage1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexSubImage1DEXT, &args ))) WARN( "glCopyTexSubImage1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTexSubImage2DEXT( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5130,7 +5130,7 @@ static void WINAPI glCopyTexSubImage2DEXT( GLenum target, GLint level, GLint xof
     struct glCopyTexSubImage2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", target, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTexSubImage2DEXT, &args ))) WARN( "glCopyTexSubImage2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexSubImage2DEXT, &args ))) WARN( "glCopyTexSubImage2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTexSubImage3D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5138,7 +5138,7 @@ static void WINAPI glCopyTexSubImage3D( GLenum target, GLint level, GLint xoffse
     struct glCopyTexSubImage3D_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", target, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTexSubImage3D, &args ))) WARN( "glCopyTexSubImage3D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexSubImage3D, &args ))) WARN( "glCopyTexSubImage3D returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTexSubImage3DEXT( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5146,7 +5146,7 @@ static void WINAPI glCopyTexSubImage3DEXT( GLenum target, GLint level, GLint xof
     struct glCopyTexSubImage3DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", target, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTexSubImage3DEXT, &args ))) WARN( "glCopyTexSubImage3DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTexSubImage3DEXT, &args ))) WARN( "glCopyTexSubImage3DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTextureImage1DEXT( GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border )
@@ -5154,7 +5154,7 @@ static void WINAPI glCopyTextureImage1DEXT( GLuint texture, GLenum target, GLint
     struct glCopyTextureImage1DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .border = border };
     NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, internalformat %d, x %d, y %d, width %d, border %d\n", texture, target, level, internalformat, x, y, width, border );
-    if ((status = UNIX_CALL( glCopyTextureImage1DEXT, &args ))) WARN( "glCopyTextureImage1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTextureImage1DEXT, &args ))) WARN( "glCopyTextureImage1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTextureImage2DEXT( GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
@@ -5162,7 +5162,7 @@ static void WINAPI glCopyTextureImage2DEXT( GLuint texture, GLenum target, GLint
     struct glCopyTextureImage2DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .internalformat = internalformat, .x = x, .y = y, .width = width, .height = height, .border = border };
     NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, internalformat %d, x %d, y %d, width %d, height %d, border %d\n", texture, target, level, internalformat, x, y, width, height, border );
-    if ((status = UNIX_CALL( glCopyTextureImage2DEXT, &args ))) WARN( "glCopyTextureImage2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTextureImage2DEXT, &args ))) WARN( "glCopyTextureImage2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTextureSubImage1D( GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
@@ -5170,7 +5170,7 @@ static void WINAPI glCopyTextureSubImage1D( GLuint texture, GLint level, GLint x
     struct glCopyTextureSubImage1D_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, x %d, y %d, width %d\n", texture, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyTextureSubImage1D, &args ))) WARN( "glCopyTextureSubImage1D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTextureSubImage1D, &args ))) WARN( "glCopyTextureSubImage1D returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTextureSubImage1DEXT( GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width )
@@ -5178,7 +5178,7 @@ static void WINAPI glCopyTextureSubImage1DEXT( GLuint texture, GLenum target, GL
     struct glCopyTextureSubImage1DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .xoffset = xoffset, .x = x, .y = y, .width = width };
     NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, xoffset %d, x %d, y %d, width %d\n", texture, target, level, xoffset, x, y, width );
-    if ((status = UNIX_CALL( glCopyTextureSubImage1DEXT, &args ))) WARN( "glCopyTextureSubImage1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTextureSubImage1DEXT, &args ))) WARN( "glCopyTextureSubImage1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTextureSubImage2D( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5186,7 +5186,7 @@ static void WINAPI glCopyTextureSubImage2D( GLuint texture, GLint level, GLint x
     struct glCopyTextureSubImage2D_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", texture, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTextureSubImage2D, &args ))) WARN( "glCopyTextureSubImage2D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTextureSubImage2D, &args ))) WARN( "glCopyTextureSubImage2D returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTextureSubImage2DEXT( GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5194,7 +5194,7 @@ static void WINAPI glCopyTextureSubImage2DEXT( GLuint texture, GLenum target, GL
     struct glCopyTextureSubImage2DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, xoffset %d, yoffset %d, x %d, y %d, width %d, height %d\n", texture, target, level, xoffset, yoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTextureSubImage2DEXT, &args ))) WARN( "glCopyTextureSubImage2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTextureSubImage2DEXT, &args ))) WARN( "glCopyTextureSubImage2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTextureSubImage3D( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5202,7 +5202,7 @@ static void WINAPI glCopyTextureSubImage3D( GLuint texture, GLint level, GLint x
     struct glCopyTextureSubImage3D_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", texture, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTextureSubImage3D, &args ))) WARN( "glCopyTextureSubImage3D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTextureSubImage3D, &args ))) WARN( "glCopyTextureSubImage3D returned %#lx\n", status );
 }
 
 static void WINAPI glCopyTextureSubImage3DEXT( GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -5210,7 +5210,7 @@ static void WINAPI glCopyTextureSubImage3DEXT( GLuint texture, GLenum target, GL
     struct glCopyTextureSubImage3DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "texture %d, target %d, level %d, xoffset %d, yoffset %d, zoffset %d, x %d, y %d, width %d, height %d\n", texture, target, level, xoffset, yoffset, zoffset, x, y, width, height );
-    if ((status = UNIX_CALL( glCopyTextureSubImage3DEXT, &args ))) WARN( "glCopyTextureSubImage3DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCopyTextureSubImage3DEXT, &args ))) WARN( "glCopyTextureSubImage3DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glCoverFillPathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues )
@@ -5226,7 +5226,7 @@ static void WINAPI glCoverFillPathNV( GLuint path, GLenum coverMode )
     struct glCoverFillPathNV_params args = { .teb = NtCurrentTeb(), .path = path, .coverMode = coverMode };
     NTSTATUS status;
     TRACE( "path %d, coverMode %d\n", path, coverMode );
-    if ((status = UNIX_CALL( glCoverFillPathNV, &args ))) WARN( "glCoverFillPathNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCoverFillPathNV, &args ))) WARN( "glCoverFillPathNV returned %#lx\n", status );
 }
 
 static void WINAPI glCoverStrokePathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues )
@@ -5242,7 +5242,7 @@ static void WINAPI glCoverStrokePathNV( GLuint path, GLenum coverMode )
     struct glCoverStrokePathNV_params args = { .teb = NtCurrentTeb(), .path = path, .coverMode = coverMode };
     NTSTATUS status;
     TRACE( "path %d, coverMode %d\n", path, coverMode );
-    if ((status = UNIX_CALL( glCoverStrokePathNV, &args ))) WARN( "glCoverStrokePathNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCoverStrokePathNV, &args ))) WARN( "glCoverStrokePathNV returned %#lx\n", status );
 }
 
 static void WINAPI glCoverageModulationNV( GLenum components )
@@ -5250,7 +5250,7 @@ static void WINAPI glCoverageModulationNV( GLenum components )
     struct glCoverageModulationNV_params args = { .teb = NtCurrentTeb(), .components = components };
     NTSTATUS status;
     TRACE( "components %d\n", components );
-    if ((status = UNIX_CALL( glCoverageModulationNV, &args ))) WARN( "glCoverageModulationNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCoverageModulationNV, &args ))) WARN( "glCoverageModulationNV returned %#lx\n", status );
 }
 
 static void WINAPI glCoverageModulationTableNV( GLsizei n, const GLfloat *v )
@@ -5458,7 +5458,7 @@ static void WINAPI glCurrentPaletteMatrixARB( GLint index )
     struct glCurrentPaletteMatrixARB_params args = { .teb = NtCurrentTeb(), .index = index };
     NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glCurrentPaletteMatrixARB, &args ))) WARN( "glCurrentPaletteMatrixARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glCurrentPaletteMatrixARB, &args ))) WARN( "glCurrentPaletteMatrixARB returned %#lx\n", status );
 }
 
 static void WINAPI glDebugMessageCallback( GLDEBUGPROC callback, const void *userParam )
@@ -5538,7 +5538,7 @@ static void WINAPI glDeformSGIX( GLbitfield mask )
     struct glDeformSGIX_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glDeformSGIX, &args ))) WARN( "glDeformSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeformSGIX, &args ))) WARN( "glDeformSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glDeformationMap3dSGIX( GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, GLdouble w1, GLdouble w2, GLint wstride, GLint worder, const GLdouble *points )
@@ -5562,7 +5562,7 @@ static void WINAPI glDeleteAsyncMarkersSGIX( GLuint marker, GLsizei range )
     struct glDeleteAsyncMarkersSGIX_params args = { .teb = NtCurrentTeb(), .marker = marker, .range = range };
     NTSTATUS status;
     TRACE( "marker %d, range %d\n", marker, range );
-    if ((status = UNIX_CALL( glDeleteAsyncMarkersSGIX, &args ))) WARN( "glDeleteAsyncMarkersSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteAsyncMarkersSGIX, &args ))) WARN( "glDeleteAsyncMarkersSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glDeleteBufferRegion( GLenum region )
@@ -5570,7 +5570,7 @@ static void WINAPI glDeleteBufferRegion( GLenum region )
     struct glDeleteBufferRegion_params args = { .teb = NtCurrentTeb(), .region = region };
     NTSTATUS status;
     TRACE( "region %d\n", region );
-    if ((status = UNIX_CALL( glDeleteBufferRegion, &args ))) WARN( "glDeleteBufferRegion returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteBufferRegion, &args ))) WARN( "glDeleteBufferRegion returned %#lx\n", status );
 }
 
 static void WINAPI glDeleteBuffers( GLsizei n, const GLuint *buffers )
@@ -5618,7 +5618,7 @@ static void WINAPI glDeleteFragmentShaderATI( GLuint id )
     struct glDeleteFragmentShaderATI_params args = { .teb = NtCurrentTeb(), .id = id };
     NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glDeleteFragmentShaderATI, &args ))) WARN( "glDeleteFragmentShaderATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteFragmentShaderATI, &args ))) WARN( "glDeleteFragmentShaderATI returned %#lx\n", status );
 }
 
 static void WINAPI glDeleteFramebuffers( GLsizei n, const GLuint *framebuffers )
@@ -5666,7 +5666,7 @@ static void WINAPI glDeleteObjectARB( GLhandleARB obj )
     struct glDeleteObjectARB_params args = { .teb = NtCurrentTeb(), .obj = obj };
     NTSTATUS status;
     TRACE( "obj %d\n", obj );
-    if ((status = UNIX_CALL( glDeleteObjectARB, &args ))) WARN( "glDeleteObjectARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteObjectARB, &args ))) WARN( "glDeleteObjectARB returned %#lx\n", status );
 }
 
 static void WINAPI glDeleteObjectBufferATI( GLuint buffer )
@@ -5674,7 +5674,7 @@ static void WINAPI glDeleteObjectBufferATI( GLuint buffer )
     struct glDeleteObjectBufferATI_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
     NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glDeleteObjectBufferATI, &args ))) WARN( "glDeleteObjectBufferATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteObjectBufferATI, &args ))) WARN( "glDeleteObjectBufferATI returned %#lx\n", status );
 }
 
 static void WINAPI glDeleteOcclusionQueriesNV( GLsizei n, const GLuint *ids )
@@ -5690,7 +5690,7 @@ static void WINAPI glDeletePathsNV( GLuint path, GLsizei range )
     struct glDeletePathsNV_params args = { .teb = NtCurrentTeb(), .path = path, .range = range };
     NTSTATUS status;
     TRACE( "path %d, range %d\n", path, range );
-    if ((status = UNIX_CALL( glDeletePathsNV, &args ))) WARN( "glDeletePathsNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeletePathsNV, &args ))) WARN( "glDeletePathsNV returned %#lx\n", status );
 }
 
 static void WINAPI glDeletePerfMonitorsAMD( GLsizei n, GLuint *monitors )
@@ -5706,7 +5706,7 @@ static void WINAPI glDeletePerfQueryINTEL( GLuint queryHandle )
     struct glDeletePerfQueryINTEL_params args = { .teb = NtCurrentTeb(), .queryHandle = queryHandle };
     NTSTATUS status;
     TRACE( "queryHandle %d\n", queryHandle );
-    if ((status = UNIX_CALL( glDeletePerfQueryINTEL, &args ))) WARN( "glDeletePerfQueryINTEL returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeletePerfQueryINTEL, &args ))) WARN( "glDeletePerfQueryINTEL returned %#lx\n", status );
 }
 
 static void WINAPI glDeleteProgram( GLuint program )
@@ -5714,7 +5714,7 @@ static void WINAPI glDeleteProgram( GLuint program )
     struct glDeleteProgram_params args = { .teb = NtCurrentTeb(), .program = program };
     NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glDeleteProgram, &args ))) WARN( "glDeleteProgram returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteProgram, &args ))) WARN( "glDeleteProgram returned %#lx\n", status );
 }
 
 static void WINAPI glDeleteProgramPipelines( GLsizei n, const GLuint *pipelines )
@@ -5802,7 +5802,7 @@ static void WINAPI glDeleteShader( GLuint shader )
     struct glDeleteShader_params args = { .teb = NtCurrentTeb(), .shader = shader };
     NTSTATUS status;
     TRACE( "shader %d\n", shader );
-    if ((status = UNIX_CALL( glDeleteShader, &args ))) WARN( "glDeleteShader returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteShader, &args ))) WARN( "glDeleteShader returned %#lx\n", status );
 }
 
 static void WINAPI glDeleteStatesNV( GLsizei n, const GLuint *states )
@@ -5866,7 +5866,7 @@ static void WINAPI glDeleteVertexShaderEXT( GLuint id )
     struct glDeleteVertexShaderEXT_params args = { .teb = NtCurrentTeb(), .id = id };
     NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glDeleteVertexShaderEXT, &args ))) WARN( "glDeleteVertexShaderEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDeleteVertexShaderEXT, &args ))) WARN( "glDeleteVertexShaderEXT returned %#lx\n", status );
 }
 
 static void WINAPI glDepthBoundsEXT( GLclampd zmin, GLclampd zmax )
@@ -5874,7 +5874,7 @@ static void WINAPI glDepthBoundsEXT( GLclampd zmin, GLclampd zmax )
     struct glDepthBoundsEXT_params args = { .teb = NtCurrentTeb(), .zmin = zmin, .zmax = zmax };
     NTSTATUS status;
     TRACE( "zmin %f, zmax %f\n", zmin, zmax );
-    if ((status = UNIX_CALL( glDepthBoundsEXT, &args ))) WARN( "glDepthBoundsEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthBoundsEXT, &args ))) WARN( "glDepthBoundsEXT returned %#lx\n", status );
 }
 
 static void WINAPI glDepthBoundsdNV( GLdouble zmin, GLdouble zmax )
@@ -5882,7 +5882,7 @@ static void WINAPI glDepthBoundsdNV( GLdouble zmin, GLdouble zmax )
     struct glDepthBoundsdNV_params args = { .teb = NtCurrentTeb(), .zmin = zmin, .zmax = zmax };
     NTSTATUS status;
     TRACE( "zmin %f, zmax %f\n", zmin, zmax );
-    if ((status = UNIX_CALL( glDepthBoundsdNV, &args ))) WARN( "glDepthBoundsdNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthBoundsdNV, &args ))) WARN( "glDepthBoundsdNV returned %#lx\n", status );
 }
 
 static void WINAPI glDepthRangeArraydvNV( GLuint first, GLsizei count, const GLdouble *v )
@@ -5906,7 +5906,7 @@ static void WINAPI glDepthRangeIndexed( GLuint index, GLdouble n, GLdouble f )
     struct glDepthRangeIndexed_params args = { .teb = NtCurrentTeb(), .index = index, .n = n, .f = f };
     NTSTATUS status;
     TRACE( "index %d, n %f, f %f\n", index, n, f );
-    if ((status = UNIX_CALL( glDepthRangeIndexed, &args ))) WARN( "glDepthRangeIndexed returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthRangeIndexed, &args ))) WARN( "glDepthRangeIndexed returned %#lx\n", status );
 }
 
 static void WINAPI glDepthRangeIndexeddNV( GLuint index, GLdouble n, GLdouble f )
@@ -5914,7 +5914,7 @@ static void WINAPI glDepthRangeIndexeddNV( GLuint index, GLdouble n, GLdouble f
     struct glDepthRangeIndexeddNV_params args = { .teb = NtCurrentTeb(), .index = index, .n = n, .f = f };
     NTSTATUS status;
     TRACE( "index %d, n %f, f %f\n", index, n, f );
-    if ((status = UNIX_CALL( glDepthRangeIndexeddNV, &args ))) WARN( "glDepthRangeIndexeddNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthRangeIndexeddNV, &args ))) WARN( "glDepthRangeIndexeddNV returned %#lx\n", status );
 }
 
 static void WINAPI glDepthRangedNV( GLdouble zNear, GLdouble zFar )
@@ -5922,7 +5922,7 @@ static void WINAPI glDepthRangedNV( GLdouble zNear, GLdouble zFar )
     struct glDepthRangedNV_params args = { .teb = NtCurrentTeb(), .zNear = zNear, .zFar = zFar };
     NTSTATUS status;
     TRACE( "zNear %f, zFar %f\n", zNear, zFar );
-    if ((status = UNIX_CALL( glDepthRangedNV, &args ))) WARN( "glDepthRangedNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthRangedNV, &args ))) WARN( "glDepthRangedNV returned %#lx\n", status );
 }
 
 static void WINAPI glDepthRangef( GLfloat n, GLfloat f )
@@ -5930,7 +5930,7 @@ static void WINAPI glDepthRangef( GLfloat n, GLfloat f )
     struct glDepthRangef_params args = { .teb = NtCurrentTeb(), .n = n, .f = f };
     NTSTATUS status;
     TRACE( "n %f, f %f\n", n, f );
-    if ((status = UNIX_CALL( glDepthRangef, &args ))) WARN( "glDepthRangef returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthRangef, &args ))) WARN( "glDepthRangef returned %#lx\n", status );
 }
 
 static void WINAPI glDepthRangefOES( GLclampf n, GLclampf f )
@@ -5938,7 +5938,7 @@ static void WINAPI glDepthRangefOES( GLclampf n, GLclampf f )
     struct glDepthRangefOES_params args = { .teb = NtCurrentTeb(), .n = n, .f = f };
     NTSTATUS status;
     TRACE( "n %f, f %f\n", n, f );
-    if ((status = UNIX_CALL( glDepthRangefOES, &args ))) WARN( "glDepthRangefOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthRangefOES, &args ))) WARN( "glDepthRangefOES returned %#lx\n", status );
 }
 
 static void WINAPI glDepthRangexOES( GLfixed n, GLfixed f )
@@ -5946,7 +5946,7 @@ static void WINAPI glDepthRangexOES( GLfixed n, GLfixed f )
     struct glDepthRangexOES_params args = { .teb = NtCurrentTeb(), .n = n, .f = f };
     NTSTATUS status;
     TRACE( "n %d, f %d\n", n, f );
-    if ((status = UNIX_CALL( glDepthRangexOES, &args ))) WARN( "glDepthRangexOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDepthRangexOES, &args ))) WARN( "glDepthRangexOES returned %#lx\n", status );
 }
 
 static void WINAPI glDetachObjectARB( GLhandleARB containerObj, GLhandleARB attachedObj )
@@ -5954,7 +5954,7 @@ static void WINAPI glDetachObjectARB( GLhandleARB containerObj, GLhandleARB atta
     struct glDetachObjectARB_params args = { .teb = NtCurrentTeb(), .containerObj = containerObj, .attachedObj = attachedObj };
     NTSTATUS status;
     TRACE( "containerObj %d, attachedObj %d\n", containerObj, attachedObj );
-    if ((status = UNIX_CALL( glDetachObjectARB, &args ))) WARN( "glDetachObjectARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDetachObjectARB, &args ))) WARN( "glDetachObjectARB returned %#lx\n", status );
 }
 
 static void WINAPI glDetachShader( GLuint program, GLuint shader )
@@ -5962,7 +5962,7 @@ static void WINAPI glDetachShader( GLuint program, GLuint shader )
     struct glDetachShader_params args = { .teb = NtCurrentTeb(), .program = program, .shader = shader };
     NTSTATUS status;
     TRACE( "program %d, shader %d\n", program, shader );
-    if ((status = UNIX_CALL( glDetachShader, &args ))) WARN( "glDetachShader returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDetachShader, &args ))) WARN( "glDetachShader returned %#lx\n", status );
 }
 
 static void WINAPI glDetailTexFuncSGIS( GLenum target, GLsizei n, const GLfloat *points )
@@ -5978,7 +5978,7 @@ static void WINAPI glDisableClientStateIndexedEXT( GLenum array, GLuint index )
     struct glDisableClientStateIndexedEXT_params args = { .teb = NtCurrentTeb(), .array = array, .index = index };
     NTSTATUS status;
     TRACE( "array %d, index %d\n", array, index );
-    if ((status = UNIX_CALL( glDisableClientStateIndexedEXT, &args ))) WARN( "glDisableClientStateIndexedEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableClientStateIndexedEXT, &args ))) WARN( "glDisableClientStateIndexedEXT returned %#lx\n", status );
 }
 
 static void WINAPI glDisableClientStateiEXT( GLenum array, GLuint index )
@@ -5986,7 +5986,7 @@ static void WINAPI glDisableClientStateiEXT( GLenum array, GLuint index )
     struct glDisableClientStateiEXT_params args = { .teb = NtCurrentTeb(), .array = array, .index = index };
     NTSTATUS status;
     TRACE( "array %d, index %d\n", array, index );
-    if ((status = UNIX_CALL( glDisableClientStateiEXT, &args ))) WARN( "glDisableClientStateiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableClientStateiEXT, &args ))) WARN( "glDisableClientStateiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glDisableIndexedEXT( GLenum target, GLuint index )
@@ -5994,7 +5994,7 @@ static void WINAPI glDisableIndexedEXT( GLenum target, GLuint index )
     struct glDisableIndexedEXT_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
     NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glDisableIndexedEXT, &args ))) WARN( "glDisableIndexedEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableIndexedEXT, &args ))) WARN( "glDisableIndexedEXT returned %#lx\n", status );
 }
 
 static void WINAPI glDisableVariantClientStateEXT( GLuint id )
@@ -6002,7 +6002,7 @@ static void WINAPI glDisableVariantClientStateEXT( GLuint id )
     struct glDisableVariantClientStateEXT_params args = { .teb = NtCurrentTeb(), .id = id };
     NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glDisableVariantClientStateEXT, &args ))) WARN( "glDisableVariantClientStateEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableVariantClientStateEXT, &args ))) WARN( "glDisableVariantClientStateEXT returned %#lx\n", status );
 }
 
 static void WINAPI glDisableVertexArrayAttrib( GLuint vaobj, GLuint index )
@@ -6010,7 +6010,7 @@ static void WINAPI glDisableVertexArrayAttrib( GLuint vaobj, GLuint index )
     struct glDisableVertexArrayAttrib_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index };
     NTSTATUS status;
     TRACE( "vaobj %d, index %d\n", vaobj, index );
-    if ((status = UNIX_CALL( glDisableVertexArrayAttrib, &args ))) WARN( "glDisableVertexArrayAttrib returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableVertexArrayAttrib, &args ))) WARN( "glDisableVertexArrayAttrib returned %#lx\n", status );
 }
 
 static void WINAPI glDisableVertexArrayAttribEXT( GLuint vaobj, GLuint index )
@@ -6018,7 +6018,7 @@ static void WINAPI glDisableVertexArrayAttribEXT( GLuint vaobj, GLuint index )
     struct glDisableVertexArrayAttribEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index };
     NTSTATUS status;
     TRACE( "vaobj %d, index %d\n", vaobj, index );
-    if ((status = UNIX_CALL( glDisableVertexArrayAttribEXT, &args ))) WARN( "glDisableVertexArrayAttribEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableVertexArrayAttribEXT, &args ))) WARN( "glDisableVertexArrayAttribEXT returned %#lx\n", status );
 }
 
 static void WINAPI glDisableVertexArrayEXT( GLuint vaobj, GLenum array )
@@ -6026,7 +6026,7 @@ static void WINAPI glDisableVertexArrayEXT( GLuint vaobj, GLenum array )
     struct glDisableVertexArrayEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .array = array };
     NTSTATUS status;
     TRACE( "vaobj %d, array %d\n", vaobj, array );
-    if ((status = UNIX_CALL( glDisableVertexArrayEXT, &args ))) WARN( "glDisableVertexArrayEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableVertexArrayEXT, &args ))) WARN( "glDisableVertexArrayEXT returned %#lx\n", status );
 }
 
 static void WINAPI glDisableVertexAttribAPPLE( GLuint index, GLenum pname )
@@ -6034,7 +6034,7 @@ static void WINAPI glDisableVertexAttribAPPLE( GLuint index, GLenum pname )
     struct glDisableVertexAttribAPPLE_params args = { .teb = NtCurrentTeb(), .index = index, .pname = pname };
     NTSTATUS status;
     TRACE( "index %d, pname %d\n", index, pname );
-    if ((status = UNIX_CALL( glDisableVertexAttribAPPLE, &args ))) WARN( "glDisableVertexAttribAPPLE returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableVertexAttribAPPLE, &args ))) WARN( "glDisableVertexAttribAPPLE returned %#lx\n", status );
 }
 
 static void WINAPI glDisableVertexAttribArray( GLuint index )
@@ -6042,7 +6042,7 @@ static void WINAPI glDisableVertexAttribArray( GLuint index )
     struct glDisableVertexAttribArray_params args = { .teb = NtCurrentTeb(), .index = index };
     NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glDisableVertexAttribArray, &args ))) WARN( "glDisableVertexAttribArray returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableVertexAttribArray, &args ))) WARN( "glDisableVertexAttribArray returned %#lx\n", status );
 }
 
 static void WINAPI glDisableVertexAttribArrayARB( GLuint index )
@@ -6050,7 +6050,7 @@ static void WINAPI glDisableVertexAttribArrayARB( GLuint index )
     struct glDisableVertexAttribArrayARB_params args = { .teb = NtCurrentTeb(), .index = index };
     NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glDisableVertexAttribArrayARB, &args ))) WARN( "glDisableVertexAttribArrayARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisableVertexAttribArrayARB, &args ))) WARN( "glDisableVertexAttribArrayARB returned %#lx\n", status );
 }
 
 static void WINAPI glDisablei( GLenum target, GLuint index )
@@ -6058,7 +6058,7 @@ static void WINAPI glDisablei( GLenum target, GLuint index )
     struct glDisablei_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
     NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glDisablei, &args ))) WARN( "glDisablei returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDisablei, &args ))) WARN( "glDisablei returned %#lx\n", status );
 }
 
 static void WINAPI glDispatchCompute( GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z )
@@ -6066,7 +6066,7 @@ static void WINAPI glDispatchCompute( GLuint num_groups_x, GLuint num_groups_y,
     struct glDispatchCompute_params args = { .teb = NtCurrentTeb(), .num_groups_x = num_groups_x, .num_groups_y = num_groups_y, .num_groups_z = num_groups_z };
     NTSTATUS status;
     TRACE( "num_groups_x %d, num_groups_y %d, num_groups_z %d\n", num_groups_x, num_groups_y, num_groups_z );
-    if ((status = UNIX_CALL( glDispatchCompute, &args ))) WARN( "glDispatchCompute returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDispatchCompute, &args ))) WARN( "glDispatchCompute returned %#lx\n", status );
 }
 
 static void WINAPI glDispatchComputeGroupSizeARB( GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z )
@@ -6074,7 +6074,7 @@ static void WINAPI glDispatchComputeGroupSizeARB( GLuint num_groups_x, GLuint nu
     struct glDispatchComputeGroupSizeARB_params args = { .teb = NtCurrentTeb(), .num_groups_x = num_groups_x, .num_groups_y = num_groups_y, .num_groups_z = num_groups_z, .group_size_x = group_size_x, .group_size_y = group_size_y, .group_size_z = group_size_z };
     NTSTATUS status;
     TRACE( "num_groups_x %d, num_groups_y %d, num_groups_z %d, group_size_x %d, group_size_y %d, group_size_z %d\n", num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z );
-    if ((status = UNIX_CALL( glDispatchComputeGroupSizeARB, &args ))) WARN( "glDispatchComputeGroupSizeARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glDispatchComputeGroupSizeARB, &args ))) WARN( "glDispatchComputeGroupSizeARB returned %#lx\n", status );
 }
 
 static void WINAPI glDispatchComputeIndirect( GLintptr indirect )
@@ -6418,7 +6418,7 @@ static void WINAPI glEdgeFlagFormatNV( GLsizei stride )
     struct glEdgeFlagFormatNV_params args = { .teb = NtCurrentTeb(), .stride = stride };
     NTSTATUS status;
     TRACE( "stride %d\n", stride );
-    if ((status = UNIX_CALL( glEdgeFlagFormatNV, &args ))) WARN( "glEdgeFlagFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEdgeFlagFormatNV, &args ))) WARN( "glEdgeFlagFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glEdgeFlagPointerEXT( GLsizei stride, GLsizei count, const GLboolean *pointer )
@@ -6458,7 +6458,7 @@ static void WINAPI glEnableClientStateIndexedEXT( GLenum array, GLuint index )
     struct glEnableClientStateIndexedEXT_params args = { .teb = NtCurrentTeb(), .array = array, .index = index };
     NTSTATUS status;
     TRACE( "array %d, index %d\n", array, index );
-    if ((status = UNIX_CALL( glEnableClientStateIndexedEXT, &args ))) WARN( "glEnableClientStateIndexedEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableClientStateIndexedEXT, &args ))) WARN( "glEnableClientStateIndexedEXT returned %#lx\n", status );
 }
 
 static void WINAPI glEnableClientStateiEXT( GLenum array, GLuint index )
@@ -6466,7 +6466,7 @@ static void WINAPI glEnableClientStateiEXT( GLenum array, GLuint index )
     struct glEnableClientStateiEXT_params args = { .teb = NtCurrentTeb(), .array = array, .index = index };
     NTSTATUS status;
     TRACE( "array %d, index %d\n", array, index );
-    if ((status = UNIX_CALL( glEnableClientStateiEXT, &args ))) WARN( "glEnableClientStateiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableClientStateiEXT, &args ))) WARN( "glEnableClientStateiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glEnableIndexedEXT( GLenum target, GLuint index )
@@ -6474,7 +6474,7 @@ static void WINAPI glEnableIndexedEXT( GLenum target, GLuint index )
     struct glEnableIndexedEXT_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
     NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glEnableIndexedEXT, &args ))) WARN( "glEnableIndexedEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableIndexedEXT, &args ))) WARN( "glEnableIndexedEXT returned %#lx\n", status );
 }
 
 static void WINAPI glEnableVariantClientStateEXT( GLuint id )
@@ -6482,7 +6482,7 @@ static void WINAPI glEnableVariantClientStateEXT( GLuint id )
     struct glEnableVariantClientStateEXT_params args = { .teb = NtCurrentTeb(), .id = id };
     NTSTATUS status;
     TRACE( "id %d\n", id );
-    if ((status = UNIX_CALL( glEnableVariantClientStateEXT, &args ))) WARN( "glEnableVariantClientStateEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableVariantClientStateEXT, &args ))) WARN( "glEnableVariantClientStateEXT returned %#lx\n", status );
 }
 
 static void WINAPI glEnableVertexArrayAttrib( GLuint vaobj, GLuint index )
@@ -6490,7 +6490,7 @@ static void WINAPI glEnableVertexArrayAttrib( GLuint vaobj, GLuint index )
     struct glEnableVertexArrayAttrib_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index };
     NTSTATUS status;
     TRACE( "vaobj %d, index %d\n", vaobj, index );
-    if ((status = UNIX_CALL( glEnableVertexArrayAttrib, &args ))) WARN( "glEnableVertexArrayAttrib returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableVertexArrayAttrib, &args ))) WARN( "glEnableVertexArrayAttrib returned %#lx\n", status );
 }
 
 static void WINAPI glEnableVertexArrayAttribEXT( GLuint vaobj, GLuint index )
@@ -6498,7 +6498,7 @@ static void WINAPI glEnableVertexArrayAttribEXT( GLuint vaobj, GLuint index )
     struct glEnableVertexArrayAttribEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index };
     NTSTATUS status;
     TRACE( "vaobj %d, index %d\n", vaobj, index );
-    if ((status = UNIX_CALL( glEnableVertexArrayAttribEXT, &args ))) WARN( "glEnableVertexArrayAttribEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableVertexArrayAttribEXT, &args ))) WARN( "glEnableVertexArrayAttribEXT returned %#lx\n", status );
 }
 
 static void WINAPI glEnableVertexArrayEXT( GLuint vaobj, GLenum array )
@@ -6506,7 +6506,7 @@ static void WINAPI glEnableVertexArrayEXT( GLuint vaobj, GLenum array )
     struct glEnableVertexArrayEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .array = array };
     NTSTATUS status;
     TRACE( "vaobj %d, array %d\n", vaobj, array );
-    if ((status = UNIX_CALL( glEnableVertexArrayEXT, &args ))) WARN( "glEnableVertexArrayEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableVertexArrayEXT, &args ))) WARN( "glEnableVertexArrayEXT returned %#lx\n", status );
 }
 
 static void WINAPI glEnableVertexAttribAPPLE( GLuint index, GLenum pname )
@@ -6514,7 +6514,7 @@ static void WINAPI glEnableVertexAttribAPPLE( GLuint index, GLenum pname )
     struct glEnableVertexAttribAPPLE_params args = { .teb = NtCurrentTeb(), .index = index, .pname = pname };
     NTSTATUS status;
     TRACE( "index %d, pname %d\n", index, pname );
-    if ((status = UNIX_CALL( glEnableVertexAttribAPPLE, &args ))) WARN( "glEnableVertexAttribAPPLE returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableVertexAttribAPPLE, &args ))) WARN( "glEnableVertexAttribAPPLE returned %#lx\n", status );
 }
 
 static void WINAPI glEnableVertexAttribArray( GLuint index )
@@ -6522,7 +6522,7 @@ static void WINAPI glEnableVertexAttribArray( GLuint index )
     struct glEnableVertexAttribArray_params args = { .teb = NtCurrentTeb(), .index = index };
     NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glEnableVertexAttribArray, &args ))) WARN( "glEnableVertexAttribArray returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableVertexAttribArray, &args ))) WARN( "glEnableVertexAttribArray returned %#lx\n", status );
 }
 
 static void WINAPI glEnableVertexAttribArrayARB( GLuint index )
@@ -6530,7 +6530,7 @@ static void WINAPI glEnableVertexAttribArrayARB( GLuint index )
     struct glEnableVertexAttribArrayARB_params args = { .teb = NtCurrentTeb(), .index = index };
     NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glEnableVertexAttribArrayARB, &args ))) WARN( "glEnableVertexAttribArrayARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnableVertexAttribArrayARB, &args ))) WARN( "glEnableVertexAttribArrayARB returned %#lx\n", status );
 }
 
 static void WINAPI glEnablei( GLenum target, GLuint index )
@@ -6538,7 +6538,7 @@ static void WINAPI glEnablei( GLenum target, GLuint index )
     struct glEnablei_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
     NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glEnablei, &args ))) WARN( "glEnablei returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEnablei, &args ))) WARN( "glEnablei returned %#lx\n", status );
 }
 
 static void WINAPI glEndConditionalRender(void)
@@ -6546,7 +6546,7 @@ static void WINAPI glEndConditionalRender(void)
     struct glEndConditionalRender_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndConditionalRender, &args ))) WARN( "glEndConditionalRender returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndConditionalRender, &args ))) WARN( "glEndConditionalRender returned %#lx\n", status );
 }
 
 static void WINAPI glEndConditionalRenderNV(void)
@@ -6554,7 +6554,7 @@ static void WINAPI glEndConditionalRenderNV(void)
     struct glEndConditionalRenderNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndConditionalRenderNV, &args ))) WARN( "glEndConditionalRenderNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndConditionalRenderNV, &args ))) WARN( "glEndConditionalRenderNV returned %#lx\n", status );
 }
 
 static void WINAPI glEndConditionalRenderNVX(void)
@@ -6562,7 +6562,7 @@ static void WINAPI glEndConditionalRenderNVX(void)
     struct glEndConditionalRenderNVX_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndConditionalRenderNVX, &args ))) WARN( "glEndConditionalRenderNVX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndConditionalRenderNVX, &args ))) WARN( "glEndConditionalRenderNVX returned %#lx\n", status );
 }
 
 static void WINAPI glEndFragmentShaderATI(void)
@@ -6570,7 +6570,7 @@ static void WINAPI glEndFragmentShaderATI(void)
     struct glEndFragmentShaderATI_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndFragmentShaderATI, &args ))) WARN( "glEndFragmentShaderATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndFragmentShaderATI, &args ))) WARN( "glEndFragmentShaderATI returned %#lx\n", status );
 }
 
 static void WINAPI glEndOcclusionQueryNV(void)
@@ -6578,7 +6578,7 @@ static void WINAPI glEndOcclusionQueryNV(void)
     struct glEndOcclusionQueryNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndOcclusionQueryNV, &args ))) WARN( "glEndOcclusionQueryNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndOcclusionQueryNV, &args ))) WARN( "glEndOcclusionQueryNV returned %#lx\n", status );
 }
 
 static void WINAPI glEndPerfMonitorAMD( GLuint monitor )
@@ -6586,7 +6586,7 @@ static void WINAPI glEndPerfMonitorAMD( GLuint monitor )
     struct glEndPerfMonitorAMD_params args = { .teb = NtCurrentTeb(), .monitor = monitor };
     NTSTATUS status;
     TRACE( "monitor %d\n", monitor );
-    if ((status = UNIX_CALL( glEndPerfMonitorAMD, &args ))) WARN( "glEndPerfMonitorAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndPerfMonitorAMD, &args ))) WARN( "glEndPerfMonitorAMD returned %#lx\n", status );
 }
 
 static void WINAPI glEndPerfQueryINTEL( GLuint queryHandle )
@@ -6594,7 +6594,7 @@ static void WINAPI glEndPerfQueryINTEL( GLuint queryHandle )
     struct glEndPerfQueryINTEL_params args = { .teb = NtCurrentTeb(), .queryHandle = queryHandle };
     NTSTATUS status;
     TRACE( "queryHandle %d\n", queryHandle );
-    if ((status = UNIX_CALL( glEndPerfQueryINTEL, &args ))) WARN( "glEndPerfQueryINTEL returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndPerfQueryINTEL, &args ))) WARN( "glEndPerfQueryINTEL returned %#lx\n", status );
 }
 
 static void WINAPI glEndQuery( GLenum target )
@@ -6602,7 +6602,7 @@ static void WINAPI glEndQuery( GLenum target )
     struct glEndQuery_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glEndQuery, &args ))) WARN( "glEndQuery returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndQuery, &args ))) WARN( "glEndQuery returned %#lx\n", status );
 }
 
 static void WINAPI glEndQueryARB( GLenum target )
@@ -6610,7 +6610,7 @@ static void WINAPI glEndQueryARB( GLenum target )
     struct glEndQueryARB_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glEndQueryARB, &args ))) WARN( "glEndQueryARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndQueryARB, &args ))) WARN( "glEndQueryARB returned %#lx\n", status );
 }
 
 static void WINAPI glEndQueryIndexed( GLenum target, GLuint index )
@@ -6618,7 +6618,7 @@ static void WINAPI glEndQueryIndexed( GLenum target, GLuint index )
     struct glEndQueryIndexed_params args = { .teb = NtCurrentTeb(), .target = target, .index = index };
     NTSTATUS status;
     TRACE( "target %d, index %d\n", target, index );
-    if ((status = UNIX_CALL( glEndQueryIndexed, &args ))) WARN( "glEndQueryIndexed returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndQueryIndexed, &args ))) WARN( "glEndQueryIndexed returned %#lx\n", status );
 }
 
 static void WINAPI glEndTransformFeedback(void)
@@ -6626,7 +6626,7 @@ static void WINAPI glEndTransformFeedback(void)
     struct glEndTransformFeedback_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndTransformFeedback, &args ))) WARN( "glEndTransformFeedback returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndTransformFeedback, &args ))) WARN( "glEndTransformFeedback returned %#lx\n", status );
 }
 
 static void WINAPI glEndTransformFeedbackEXT(void)
@@ -6634,7 +6634,7 @@ static void WINAPI glEndTransformFeedbackEXT(void)
     struct glEndTransformFeedbackEXT_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndTransformFeedbackEXT, &args ))) WARN( "glEndTransformFeedbackEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndTransformFeedbackEXT, &args ))) WARN( "glEndTransformFeedbackEXT returned %#lx\n", status );
 }
 
 static void WINAPI glEndTransformFeedbackNV(void)
@@ -6642,7 +6642,7 @@ static void WINAPI glEndTransformFeedbackNV(void)
     struct glEndTransformFeedbackNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndTransformFeedbackNV, &args ))) WARN( "glEndTransformFeedbackNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndTransformFeedbackNV, &args ))) WARN( "glEndTransformFeedbackNV returned %#lx\n", status );
 }
 
 static void WINAPI glEndVertexShaderEXT(void)
@@ -6650,7 +6650,7 @@ static void WINAPI glEndVertexShaderEXT(void)
     struct glEndVertexShaderEXT_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEndVertexShaderEXT, &args ))) WARN( "glEndVertexShaderEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndVertexShaderEXT, &args ))) WARN( "glEndVertexShaderEXT returned %#lx\n", status );
 }
 
 static void WINAPI glEndVideoCaptureNV( GLuint video_capture_slot )
@@ -6658,7 +6658,7 @@ static void WINAPI glEndVideoCaptureNV( GLuint video_capture_slot )
     struct glEndVideoCaptureNV_params args = { .teb = NtCurrentTeb(), .video_capture_slot = video_capture_slot };
     NTSTATUS status;
     TRACE( "video_capture_slot %d\n", video_capture_slot );
-    if ((status = UNIX_CALL( glEndVideoCaptureNV, &args ))) WARN( "glEndVideoCaptureNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEndVideoCaptureNV, &args ))) WARN( "glEndVideoCaptureNV returned %#lx\n", status );
 }
 
 static void WINAPI glEvalCoord1xOES( GLfixed u )
@@ -6666,7 +6666,7 @@ static void WINAPI glEvalCoord1xOES( GLfixed u )
     struct glEvalCoord1xOES_params args = { .teb = NtCurrentTeb(), .u = u };
     NTSTATUS status;
     TRACE( "u %d\n", u );
-    if ((status = UNIX_CALL( glEvalCoord1xOES, &args ))) WARN( "glEvalCoord1xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalCoord1xOES, &args ))) WARN( "glEvalCoord1xOES returned %#lx\n", status );
 }
 
 static void WINAPI glEvalCoord1xvOES( const GLfixed *coords )
@@ -6682,7 +6682,7 @@ static void WINAPI glEvalCoord2xOES( GLfixed u, GLfixed v )
     struct glEvalCoord2xOES_params args = { .teb = NtCurrentTeb(), .u = u, .v = v };
     NTSTATUS status;
     TRACE( "u %d, v %d\n", u, v );
-    if ((status = UNIX_CALL( glEvalCoord2xOES, &args ))) WARN( "glEvalCoord2xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalCoord2xOES, &args ))) WARN( "glEvalCoord2xOES returned %#lx\n", status );
 }
 
 static void WINAPI glEvalCoord2xvOES( const GLfixed *coords )
@@ -6698,7 +6698,7 @@ static void WINAPI glEvalMapsNV( GLenum target, GLenum mode )
     struct glEvalMapsNV_params args = { .teb = NtCurrentTeb(), .target = target, .mode = mode };
     NTSTATUS status;
     TRACE( "target %d, mode %d\n", target, mode );
-    if ((status = UNIX_CALL( glEvalMapsNV, &args ))) WARN( "glEvalMapsNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvalMapsNV, &args ))) WARN( "glEvalMapsNV returned %#lx\n", status );
 }
 
 static void WINAPI glEvaluateDepthValuesARB(void)
@@ -6706,7 +6706,7 @@ static void WINAPI glEvaluateDepthValuesARB(void)
     struct glEvaluateDepthValuesARB_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glEvaluateDepthValuesARB, &args ))) WARN( "glEvaluateDepthValuesARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glEvaluateDepthValuesARB, &args ))) WARN( "glEvaluateDepthValuesARB returned %#lx\n", status );
 }
 
 static void WINAPI glExecuteProgramNV( GLenum target, GLuint id, const GLfloat *params )
@@ -6722,7 +6722,7 @@ static void WINAPI glExtractComponentEXT( GLuint res, GLuint src, GLuint num )
     struct glExtractComponentEXT_params args = { .teb = NtCurrentTeb(), .res = res, .src = src, .num = num };
     NTSTATUS status;
     TRACE( "res %d, src %d, num %d\n", res, src, num );
-    if ((status = UNIX_CALL( glExtractComponentEXT, &args ))) WARN( "glExtractComponentEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glExtractComponentEXT, &args ))) WARN( "glExtractComponentEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFeedbackBufferxOES( GLsizei n, GLenum type, const GLfixed *buffer )
@@ -6747,7 +6747,7 @@ static void WINAPI glFinalCombinerInputNV( GLenum variable, GLenum input, GLenum
     struct glFinalCombinerInputNV_params args = { .teb = NtCurrentTeb(), .variable = variable, .input = input, .mapping = mapping, .componentUsage = componentUsage };
     NTSTATUS status;
     TRACE( "variable %d, input %d, mapping %d, componentUsage %d\n", variable, input, mapping, componentUsage );
-    if ((status = UNIX_CALL( glFinalCombinerInputNV, &args ))) WARN( "glFinalCombinerInputNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFinalCombinerInputNV, &args ))) WARN( "glFinalCombinerInputNV returned %#lx\n", status );
 }
 
 static GLint WINAPI glFinishAsyncSGIX( GLuint *markerp )
@@ -6764,7 +6764,7 @@ static void WINAPI glFinishFenceAPPLE( GLuint fence )
     struct glFinishFenceAPPLE_params args = { .teb = NtCurrentTeb(), .fence = fence };
     NTSTATUS status;
     TRACE( "fence %d\n", fence );
-    if ((status = UNIX_CALL( glFinishFenceAPPLE, &args ))) WARN( "glFinishFenceAPPLE returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFinishFenceAPPLE, &args ))) WARN( "glFinishFenceAPPLE returned %#lx\n", status );
 }
 
 static void WINAPI glFinishFenceNV( GLuint fence )
@@ -6772,7 +6772,7 @@ static void WINAPI glFinishFenceNV( GLuint fence )
     struct glFinishFenceNV_params args = { .teb = NtCurrentTeb(), .fence = fence };
     NTSTATUS status;
     TRACE( "fence %d\n", fence );
-    if ((status = UNIX_CALL( glFinishFenceNV, &args ))) WARN( "glFinishFenceNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFinishFenceNV, &args ))) WARN( "glFinishFenceNV returned %#lx\n", status );
 }
 
 static void WINAPI glFinishObjectAPPLE( GLenum object, GLint name )
@@ -6780,7 +6780,7 @@ static void WINAPI glFinishObjectAPPLE( GLenum object, GLint name )
     struct glFinishObjectAPPLE_params args = { .teb = NtCurrentTeb(), .object = object, .name = name };
     NTSTATUS status;
     TRACE( "object %d, name %d\n", object, name );
-    if ((status = UNIX_CALL( glFinishObjectAPPLE, &args ))) WARN( "glFinishObjectAPPLE returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFinishObjectAPPLE, &args ))) WARN( "glFinishObjectAPPLE returned %#lx\n", status );
 }
 
 static void WINAPI glFinishTextureSUNX(void)
@@ -6788,7 +6788,7 @@ static void WINAPI glFinishTextureSUNX(void)
     struct glFinishTextureSUNX_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFinishTextureSUNX, &args ))) WARN( "glFinishTextureSUNX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFinishTextureSUNX, &args ))) WARN( "glFinishTextureSUNX returned %#lx\n", status );
 }
 
 static void WINAPI glFlushMappedBufferRange( GLenum target, GLintptr offset, GLsizeiptr length )
@@ -6828,7 +6828,7 @@ static void WINAPI glFlushPixelDataRangeNV( GLenum target )
     struct glFlushPixelDataRangeNV_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glFlushPixelDataRangeNV, &args ))) WARN( "glFlushPixelDataRangeNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFlushPixelDataRangeNV, &args ))) WARN( "glFlushPixelDataRangeNV returned %#lx\n", status );
 }
 
 static void WINAPI glFlushRasterSGIX(void)
@@ -6836,7 +6836,7 @@ static void WINAPI glFlushRasterSGIX(void)
     struct glFlushRasterSGIX_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFlushRasterSGIX, &args ))) WARN( "glFlushRasterSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFlushRasterSGIX, &args ))) WARN( "glFlushRasterSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFlushStaticDataIBM( GLenum target )
@@ -6844,7 +6844,7 @@ static void WINAPI glFlushStaticDataIBM( GLenum target )
     struct glFlushStaticDataIBM_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glFlushStaticDataIBM, &args ))) WARN( "glFlushStaticDataIBM returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFlushStaticDataIBM, &args ))) WARN( "glFlushStaticDataIBM returned %#lx\n", status );
 }
 
 static void WINAPI glFlushVertexArrayRangeAPPLE( GLsizei length, void *pointer )
@@ -6860,7 +6860,7 @@ static void WINAPI glFlushVertexArrayRangeNV(void)
     struct glFlushVertexArrayRangeNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFlushVertexArrayRangeNV, &args ))) WARN( "glFlushVertexArrayRangeNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFlushVertexArrayRangeNV, &args ))) WARN( "glFlushVertexArrayRangeNV returned %#lx\n", status );
 }
 
 static void WINAPI glFogCoordFormatNV( GLenum type, GLsizei stride )
@@ -6868,7 +6868,7 @@ static void WINAPI glFogCoordFormatNV( GLenum type, GLsizei stride )
     struct glFogCoordFormatNV_params args = { .teb = NtCurrentTeb(), .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "type %d, stride %d\n", type, stride );
-    if ((status = UNIX_CALL( glFogCoordFormatNV, &args ))) WARN( "glFogCoordFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogCoordFormatNV, &args ))) WARN( "glFogCoordFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glFogCoordPointer( GLenum type, GLsizei stride, const void *pointer )
@@ -6900,7 +6900,7 @@ static void WINAPI glFogCoordd( GLdouble coord )
     struct glFogCoordd_params args = { .teb = NtCurrentTeb(), .coord = coord };
     NTSTATUS status;
     TRACE( "coord %f\n", coord );
-    if ((status = UNIX_CALL( glFogCoordd, &args ))) WARN( "glFogCoordd returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogCoordd, &args ))) WARN( "glFogCoordd returned %#lx\n", status );
 }
 
 static void WINAPI glFogCoorddEXT( GLdouble coord )
@@ -6908,7 +6908,7 @@ static void WINAPI glFogCoorddEXT( GLdouble coord )
     struct glFogCoorddEXT_params args = { .teb = NtCurrentTeb(), .coord = coord };
     NTSTATUS status;
     TRACE( "coord %f\n", coord );
-    if ((status = UNIX_CALL( glFogCoorddEXT, &args ))) WARN( "glFogCoorddEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogCoorddEXT, &args ))) WARN( "glFogCoorddEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFogCoorddv( const GLdouble *coord )
@@ -6932,7 +6932,7 @@ static void WINAPI glFogCoordf( GLfloat coord )
     struct glFogCoordf_params args = { .teb = NtCurrentTeb(), .coord = coord };
     NTSTATUS status;
     TRACE( "coord %f\n", coord );
-    if ((status = UNIX_CALL( glFogCoordf, &args ))) WARN( "glFogCoordf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogCoordf, &args ))) WARN( "glFogCoordf returned %#lx\n", status );
 }
 
 static void WINAPI glFogCoordfEXT( GLfloat coord )
@@ -6940,7 +6940,7 @@ static void WINAPI glFogCoordfEXT( GLfloat coord )
     struct glFogCoordfEXT_params args = { .teb = NtCurrentTeb(), .coord = coord };
     NTSTATUS status;
     TRACE( "coord %f\n", coord );
-    if ((status = UNIX_CALL( glFogCoordfEXT, &args ))) WARN( "glFogCoordfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogCoordfEXT, &args ))) WARN( "glFogCoordfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFogCoordfv( const GLfloat *coord )
@@ -6964,7 +6964,7 @@ static void WINAPI glFogCoordhNV( GLhalfNV fog )
     struct glFogCoordhNV_params args = { .teb = NtCurrentTeb(), .fog = fog };
     NTSTATUS status;
     TRACE( "fog %d\n", fog );
-    if ((status = UNIX_CALL( glFogCoordhNV, &args ))) WARN( "glFogCoordhNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogCoordhNV, &args ))) WARN( "glFogCoordhNV returned %#lx\n", status );
 }
 
 static void WINAPI glFogCoordhvNV( const GLhalfNV *fog )
@@ -6988,7 +6988,7 @@ static void WINAPI glFogxOES( GLenum pname, GLfixed param )
     struct glFogxOES_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glFogxOES, &args ))) WARN( "glFogxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFogxOES, &args ))) WARN( "glFogxOES returned %#lx\n", status );
 }
 
 static void WINAPI glFogxvOES( GLenum pname, const GLfixed *param )
@@ -7004,7 +7004,7 @@ static void WINAPI glFragmentColorMaterialSGIX( GLenum face, GLenum mode )
     struct glFragmentColorMaterialSGIX_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
     NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glFragmentColorMaterialSGIX, &args ))) WARN( "glFragmentColorMaterialSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFragmentColorMaterialSGIX, &args ))) WARN( "glFragmentColorMaterialSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFragmentCoverageColorNV( GLuint color )
@@ -7012,7 +7012,7 @@ static void WINAPI glFragmentCoverageColorNV( GLuint color )
     struct glFragmentCoverageColorNV_params args = { .teb = NtCurrentTeb(), .color = color };
     NTSTATUS status;
     TRACE( "color %d\n", color );
-    if ((status = UNIX_CALL( glFragmentCoverageColorNV, &args ))) WARN( "glFragmentCoverageColorNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFragmentCoverageColorNV, &args ))) WARN( "glFragmentCoverageColorNV returned %#lx\n", status );
 }
 
 static void WINAPI glFragmentLightModelfSGIX( GLenum pname, GLfloat param )
@@ -7020,7 +7020,7 @@ static void WINAPI glFragmentLightModelfSGIX( GLenum pname, GLfloat param )
     struct glFragmentLightModelfSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glFragmentLightModelfSGIX, &args ))) WARN( "glFragmentLightModelfSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFragmentLightModelfSGIX, &args ))) WARN( "glFragmentLightModelfSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFragmentLightModelfvSGIX( GLenum pname, const GLfloat *params )
@@ -7036,7 +7036,7 @@ static void WINAPI glFragmentLightModeliSGIX( GLenum pname, GLint param )
     struct glFragmentLightModeliSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glFragmentLightModeliSGIX, &args ))) WARN( "glFragmentLightModeliSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFragmentLightModeliSGIX, &args ))) WARN( "glFragmentLightModeliSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFragmentLightModelivSGIX( GLenum pname, const GLint *params )
@@ -7052,7 +7052,7 @@ static void WINAPI glFragmentLightfSGIX( GLenum light, GLenum pname, GLfloat par
     struct glFragmentLightfSGIX_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "light %d, pname %d, param %f\n", light, pname, param );
-    if ((status = UNIX_CALL( glFragmentLightfSGIX, &args ))) WARN( "glFragmentLightfSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFragmentLightfSGIX, &args ))) WARN( "glFragmentLightfSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFragmentLightfvSGIX( GLenum light, GLenum pname, const GLfloat *params )
@@ -7068,7 +7068,7 @@ static void WINAPI glFragmentLightiSGIX( GLenum light, GLenum pname, GLint param
     struct glFragmentLightiSGIX_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "light %d, pname %d, param %d\n", light, pname, param );
-    if ((status = UNIX_CALL( glFragmentLightiSGIX, &args ))) WARN( "glFragmentLightiSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFragmentLightiSGIX, &args ))) WARN( "glFragmentLightiSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFragmentLightivSGIX( GLenum light, GLenum pname, const GLint *params )
@@ -7084,7 +7084,7 @@ static void WINAPI glFragmentMaterialfSGIX( GLenum face, GLenum pname, GLfloat p
     struct glFragmentMaterialfSGIX_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "face %d, pname %d, param %f\n", face, pname, param );
-    if ((status = UNIX_CALL( glFragmentMaterialfSGIX, &args ))) WARN( "glFragmentMaterialfSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFragmentMaterialfSGIX, &args ))) WARN( "glFragmentMaterialfSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFragmentMaterialfvSGIX( GLenum face, GLenum pname, const GLfloat *params )
@@ -7100,7 +7100,7 @@ static void WINAPI glFragmentMaterialiSGIX( GLenum face, GLenum pname, GLint par
     struct glFragmentMaterialiSGIX_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "face %d, pname %d, param %d\n", face, pname, param );
-    if ((status = UNIX_CALL( glFragmentMaterialiSGIX, &args ))) WARN( "glFragmentMaterialiSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFragmentMaterialiSGIX, &args ))) WARN( "glFragmentMaterialiSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFragmentMaterialivSGIX( GLenum face, GLenum pname, const GLint *params )
@@ -7116,7 +7116,7 @@ static void WINAPI glFrameTerminatorGREMEDY(void)
     struct glFrameTerminatorGREMEDY_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFrameTerminatorGREMEDY, &args ))) WARN( "glFrameTerminatorGREMEDY returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFrameTerminatorGREMEDY, &args ))) WARN( "glFrameTerminatorGREMEDY returned %#lx\n", status );
 }
 
 static void WINAPI glFrameZoomSGIX( GLint factor )
@@ -7124,7 +7124,7 @@ static void WINAPI glFrameZoomSGIX( GLint factor )
     struct glFrameZoomSGIX_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glFrameZoomSGIX, &args ))) WARN( "glFrameZoomSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFrameZoomSGIX, &args ))) WARN( "glFrameZoomSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferDrawBufferEXT( GLuint framebuffer, GLenum mode )
@@ -7132,7 +7132,7 @@ static void WINAPI glFramebufferDrawBufferEXT( GLuint framebuffer, GLenum mode )
     struct glFramebufferDrawBufferEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .mode = mode };
     NTSTATUS status;
     TRACE( "framebuffer %d, mode %d\n", framebuffer, mode );
-    if ((status = UNIX_CALL( glFramebufferDrawBufferEXT, &args ))) WARN( "glFramebufferDrawBufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferDrawBufferEXT, &args ))) WARN( "glFramebufferDrawBufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferDrawBuffersEXT( GLuint framebuffer, GLsizei n, const GLenum *bufs )
@@ -7148,7 +7148,7 @@ static void WINAPI glFramebufferFetchBarrierEXT(void)
     struct glFramebufferFetchBarrierEXT_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glFramebufferFetchBarrierEXT, &args ))) WARN( "glFramebufferFetchBarrierEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferFetchBarrierEXT, &args ))) WARN( "glFramebufferFetchBarrierEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferParameteri( GLenum target, GLenum pname, GLint param )
@@ -7156,7 +7156,7 @@ static void WINAPI glFramebufferParameteri( GLenum target, GLenum pname, GLint p
     struct glFramebufferParameteri_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glFramebufferParameteri, &args ))) WARN( "glFramebufferParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferParameteri, &args ))) WARN( "glFramebufferParameteri returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferParameteriMESA( GLenum target, GLenum pname, GLint param )
@@ -7164,7 +7164,7 @@ static void WINAPI glFramebufferParameteriMESA( GLenum target, GLenum pname, GLi
     struct glFramebufferParameteriMESA_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glFramebufferParameteriMESA, &args ))) WARN( "glFramebufferParameteriMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferParameteriMESA, &args ))) WARN( "glFramebufferParameteriMESA returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferReadBufferEXT( GLuint framebuffer, GLenum mode )
@@ -7172,7 +7172,7 @@ static void WINAPI glFramebufferReadBufferEXT( GLuint framebuffer, GLenum mode )
     struct glFramebufferReadBufferEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .mode = mode };
     NTSTATUS status;
     TRACE( "framebuffer %d, mode %d\n", framebuffer, mode );
-    if ((status = UNIX_CALL( glFramebufferReadBufferEXT, &args ))) WARN( "glFramebufferReadBufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferReadBufferEXT, &args ))) WARN( "glFramebufferReadBufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferRenderbuffer( GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
@@ -7180,7 +7180,7 @@ static void WINAPI glFramebufferRenderbuffer( GLenum target, GLenum attachment,
     struct glFramebufferRenderbuffer_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .renderbuffertarget = renderbuffertarget, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, renderbuffertarget %d, renderbuffer %d\n", target, attachment, renderbuffertarget, renderbuffer );
-    if ((status = UNIX_CALL( glFramebufferRenderbuffer, &args ))) WARN( "glFramebufferRenderbuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferRenderbuffer, &args ))) WARN( "glFramebufferRenderbuffer returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferRenderbufferEXT( GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
@@ -7188,7 +7188,7 @@ static void WINAPI glFramebufferRenderbufferEXT( GLenum target, GLenum attachmen
     struct glFramebufferRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .renderbuffertarget = renderbuffertarget, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, renderbuffertarget %d, renderbuffer %d\n", target, attachment, renderbuffertarget, renderbuffer );
-    if ((status = UNIX_CALL( glFramebufferRenderbufferEXT, &args ))) WARN( "glFramebufferRenderbufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferRenderbufferEXT, &args ))) WARN( "glFramebufferRenderbufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferSampleLocationsfvARB( GLenum target, GLuint start, GLsizei count, const GLfloat *v )
@@ -7220,7 +7220,7 @@ static void WINAPI glFramebufferTexture( GLenum target, GLenum attachment, GLuin
     struct glFramebufferTexture_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d\n", target, attachment, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture, &args ))) WARN( "glFramebufferTexture returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTexture, &args ))) WARN( "glFramebufferTexture returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTexture1D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
@@ -7228,7 +7228,7 @@ static void WINAPI glFramebufferTexture1D( GLenum target, GLenum attachment, GLe
     struct glFramebufferTexture1D_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d\n", target, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture1D, &args ))) WARN( "glFramebufferTexture1D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTexture1D, &args ))) WARN( "glFramebufferTexture1D returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTexture1DEXT( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
@@ -7236,7 +7236,7 @@ static void WINAPI glFramebufferTexture1DEXT( GLenum target, GLenum attachment,
     struct glFramebufferTexture1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d\n", target, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture1DEXT, &args ))) WARN( "glFramebufferTexture1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTexture1DEXT, &args ))) WARN( "glFramebufferTexture1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTexture2D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
@@ -7244,7 +7244,7 @@ static void WINAPI glFramebufferTexture2D( GLenum target, GLenum attachment, GLe
     struct glFramebufferTexture2D_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d\n", target, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture2D, &args ))) WARN( "glFramebufferTexture2D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTexture2D, &args ))) WARN( "glFramebufferTexture2D returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTexture2DEXT( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
@@ -7252,7 +7252,7 @@ static void WINAPI glFramebufferTexture2DEXT( GLenum target, GLenum attachment,
     struct glFramebufferTexture2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d\n", target, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTexture2DEXT, &args ))) WARN( "glFramebufferTexture2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTexture2DEXT, &args ))) WARN( "glFramebufferTexture2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTexture3D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset )
@@ -7260,7 +7260,7 @@ static void WINAPI glFramebufferTexture3D( GLenum target, GLenum attachment, GLe
     struct glFramebufferTexture3D_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level, .zoffset = zoffset };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d, zoffset %d\n", target, attachment, textarget, texture, level, zoffset );
-    if ((status = UNIX_CALL( glFramebufferTexture3D, &args ))) WARN( "glFramebufferTexture3D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTexture3D, &args ))) WARN( "glFramebufferTexture3D returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTexture3DEXT( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset )
@@ -7268,7 +7268,7 @@ static void WINAPI glFramebufferTexture3DEXT( GLenum target, GLenum attachment,
     struct glFramebufferTexture3DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level, .zoffset = zoffset };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, textarget %d, texture %d, level %d, zoffset %d\n", target, attachment, textarget, texture, level, zoffset );
-    if ((status = UNIX_CALL( glFramebufferTexture3DEXT, &args ))) WARN( "glFramebufferTexture3DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTexture3DEXT, &args ))) WARN( "glFramebufferTexture3DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTextureARB( GLenum target, GLenum attachment, GLuint texture, GLint level )
@@ -7276,7 +7276,7 @@ static void WINAPI glFramebufferTextureARB( GLenum target, GLenum attachment, GL
     struct glFramebufferTextureARB_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d\n", target, attachment, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTextureARB, &args ))) WARN( "glFramebufferTextureARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTextureARB, &args ))) WARN( "glFramebufferTextureARB returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTextureEXT( GLenum target, GLenum attachment, GLuint texture, GLint level )
@@ -7284,7 +7284,7 @@ static void WINAPI glFramebufferTextureEXT( GLenum target, GLenum attachment, GL
     struct glFramebufferTextureEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d\n", target, attachment, texture, level );
-    if ((status = UNIX_CALL( glFramebufferTextureEXT, &args ))) WARN( "glFramebufferTextureEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTextureEXT, &args ))) WARN( "glFramebufferTextureEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTextureFaceARB( GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face )
@@ -7292,7 +7292,7 @@ static void WINAPI glFramebufferTextureFaceARB( GLenum target, GLenum attachment
     struct glFramebufferTextureFaceARB_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .face = face };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, face %d\n", target, attachment, texture, level, face );
-    if ((status = UNIX_CALL( glFramebufferTextureFaceARB, &args ))) WARN( "glFramebufferTextureFaceARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTextureFaceARB, &args ))) WARN( "glFramebufferTextureFaceARB returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTextureFaceEXT( GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face )
@@ -7300,7 +7300,7 @@ static void WINAPI glFramebufferTextureFaceEXT( GLenum target, GLenum attachment
     struct glFramebufferTextureFaceEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .face = face };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, face %d\n", target, attachment, texture, level, face );
-    if ((status = UNIX_CALL( glFramebufferTextureFaceEXT, &args ))) WARN( "glFramebufferTextureFaceEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTextureFaceEXT, &args ))) WARN( "glFramebufferTextureFaceEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTextureLayer( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer )
@@ -7308,7 +7308,7 @@ static void WINAPI glFramebufferTextureLayer( GLenum target, GLenum attachment,
     struct glFramebufferTextureLayer_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, layer %d\n", target, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glFramebufferTextureLayer, &args ))) WARN( "glFramebufferTextureLayer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTextureLayer, &args ))) WARN( "glFramebufferTextureLayer returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTextureLayerARB( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer )
@@ -7316,7 +7316,7 @@ static void WINAPI glFramebufferTextureLayerARB( GLenum target, GLenum attachmen
     struct glFramebufferTextureLayerARB_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, layer %d\n", target, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glFramebufferTextureLayerARB, &args ))) WARN( "glFramebufferTextureLayerARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTextureLayerARB, &args ))) WARN( "glFramebufferTextureLayerARB returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTextureLayerEXT( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer )
@@ -7324,7 +7324,7 @@ static void WINAPI glFramebufferTextureLayerEXT( GLenum target, GLenum attachmen
     struct glFramebufferTextureLayerEXT_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, layer %d\n", target, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glFramebufferTextureLayerEXT, &args ))) WARN( "glFramebufferTextureLayerEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTextureLayerEXT, &args ))) WARN( "glFramebufferTextureLayerEXT returned %#lx\n", status );
 }
 
 static void WINAPI glFramebufferTextureMultiviewOVR( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews )
@@ -7332,7 +7332,7 @@ static void WINAPI glFramebufferTextureMultiviewOVR( GLenum target, GLenum attac
     struct glFramebufferTextureMultiviewOVR_params args = { .teb = NtCurrentTeb(), .target = target, .attachment = attachment, .texture = texture, .level = level, .baseViewIndex = baseViewIndex, .numViews = numViews };
     NTSTATUS status;
     TRACE( "target %d, attachment %d, texture %d, level %d, baseViewIndex %d, numViews %d\n", target, attachment, texture, level, baseViewIndex, numViews );
-    if ((status = UNIX_CALL( glFramebufferTextureMultiviewOVR, &args ))) WARN( "glFramebufferTextureMultiviewOVR returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFramebufferTextureMultiviewOVR, &args ))) WARN( "glFramebufferTextureMultiviewOVR returned %#lx\n", status );
 }
 
 static void WINAPI glFreeObjectBufferATI( GLuint buffer )
@@ -7340,7 +7340,7 @@ static void WINAPI glFreeObjectBufferATI( GLuint buffer )
     struct glFreeObjectBufferATI_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
     NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glFreeObjectBufferATI, &args ))) WARN( "glFreeObjectBufferATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFreeObjectBufferATI, &args ))) WARN( "glFreeObjectBufferATI returned %#lx\n", status );
 }
 
 static void WINAPI glFrustumfOES( GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f )
@@ -7348,7 +7348,7 @@ static void WINAPI glFrustumfOES( GLfloat l, GLfloat r, GLfloat b, GLfloat t, GL
     struct glFrustumfOES_params args = { .teb = NtCurrentTeb(), .l = l, .r = r, .b = b, .t = t, .n = n, .f = f };
     NTSTATUS status;
     TRACE( "l %f, r %f, b %f, t %f, n %f, f %f\n", l, r, b, t, n, f );
-    if ((status = UNIX_CALL( glFrustumfOES, &args ))) WARN( "glFrustumfOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFrustumfOES, &args ))) WARN( "glFrustumfOES returned %#lx\n", status );
 }
 
 static void WINAPI glFrustumxOES( GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f )
@@ -7356,7 +7356,7 @@ static void WINAPI glFrustumxOES( GLfixed l, GLfixed r, GLfixed b, GLfixed t, GL
     struct glFrustumxOES_params args = { .teb = NtCurrentTeb(), .l = l, .r = r, .b = b, .t = t, .n = n, .f = f };
     NTSTATUS status;
     TRACE( "l %d, r %d, b %d, t %d, n %d, f %d\n", l, r, b, t, n, f );
-    if ((status = UNIX_CALL( glFrustumxOES, &args ))) WARN( "glFrustumxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glFrustumxOES, &args ))) WARN( "glFrustumxOES returned %#lx\n", status );
 }
 
 static GLuint WINAPI glGenAsyncMarkersSGIX( GLsizei range )
@@ -7601,7 +7601,7 @@ static void WINAPI glGenerateMipmap( GLenum target )
     struct glGenerateMipmap_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glGenerateMipmap, &args ))) WARN( "glGenerateMipmap returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGenerateMipmap, &args ))) WARN( "glGenerateMipmap returned %#lx\n", status );
 }
 
 static void WINAPI glGenerateMipmapEXT( GLenum target )
@@ -7609,7 +7609,7 @@ static void WINAPI glGenerateMipmapEXT( GLenum target )
     struct glGenerateMipmapEXT_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glGenerateMipmapEXT, &args ))) WARN( "glGenerateMipmapEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGenerateMipmapEXT, &args ))) WARN( "glGenerateMipmapEXT returned %#lx\n", status );
 }
 
 static void WINAPI glGenerateMultiTexMipmapEXT( GLenum texunit, GLenum target )
@@ -7617,7 +7617,7 @@ static void WINAPI glGenerateMultiTexMipmapEXT( GLenum texunit, GLenum target )
     struct glGenerateMultiTexMipmapEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target };
     NTSTATUS status;
     TRACE( "texunit %d, target %d\n", texunit, target );
-    if ((status = UNIX_CALL( glGenerateMultiTexMipmapEXT, &args ))) WARN( "glGenerateMultiTexMipmapEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGenerateMultiTexMipmapEXT, &args ))) WARN( "glGenerateMultiTexMipmapEXT returned %#lx\n", status );
 }
 
 static void WINAPI glGenerateTextureMipmap( GLuint texture )
@@ -7625,7 +7625,7 @@ static void WINAPI glGenerateTextureMipmap( GLuint texture )
     struct glGenerateTextureMipmap_params args = { .teb = NtCurrentTeb(), .texture = texture };
     NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glGenerateTextureMipmap, &args ))) WARN( "glGenerateTextureMipmap returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGenerateTextureMipmap, &args ))) WARN( "glGenerateTextureMipmap returned %#lx\n", status );
 }
 
 static void WINAPI glGenerateTextureMipmapEXT( GLuint texture, GLenum target )
@@ -7633,7 +7633,7 @@ static void WINAPI glGenerateTextureMipmapEXT( GLuint texture, GLenum target )
     struct glGenerateTextureMipmapEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target };
     NTSTATUS status;
     TRACE( "texture %d, target %d\n", texture, target );
-    if ((status = UNIX_CALL( glGenerateTextureMipmapEXT, &args ))) WARN( "glGenerateTextureMipmapEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGenerateTextureMipmapEXT, &args ))) WARN( "glGenerateTextureMipmapEXT returned %#lx\n", status );
 }
 
 static void WINAPI glGetActiveAtomicCounterBufferiv( GLuint program, GLuint bufferIndex, GLenum pname, GLint *params )
@@ -8688,7 +8688,7 @@ static void WINAPI glGetMaterialxOES( GLenum face, GLenum pname, GLfixed param )
     struct glGetMaterialxOES_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "face %d, pname %d, param %d\n", face, pname, param );
-    if ((status = UNIX_CALL( glGetMaterialxOES, &args ))) WARN( "glGetMaterialxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGetMaterialxOES, &args ))) WARN( "glGetMaterialxOES returned %#lx\n", status );
 }
 
 static void WINAPI glGetMemoryObjectDetachedResourcesuivNV( GLuint memory, GLenum pname, GLint first, GLsizei count, GLuint *params )
@@ -11074,7 +11074,7 @@ static void WINAPI glGlobalAlphaFactorbSUN( GLbyte factor )
     struct glGlobalAlphaFactorbSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorbSUN, &args ))) WARN( "glGlobalAlphaFactorbSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGlobalAlphaFactorbSUN, &args ))) WARN( "glGlobalAlphaFactorbSUN returned %#lx\n", status );
 }
 
 static void WINAPI glGlobalAlphaFactordSUN( GLdouble factor )
@@ -11082,7 +11082,7 @@ static void WINAPI glGlobalAlphaFactordSUN( GLdouble factor )
     struct glGlobalAlphaFactordSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %f\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactordSUN, &args ))) WARN( "glGlobalAlphaFactordSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGlobalAlphaFactordSUN, &args ))) WARN( "glGlobalAlphaFactordSUN returned %#lx\n", status );
 }
 
 static void WINAPI glGlobalAlphaFactorfSUN( GLfloat factor )
@@ -11090,7 +11090,7 @@ static void WINAPI glGlobalAlphaFactorfSUN( GLfloat factor )
     struct glGlobalAlphaFactorfSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %f\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorfSUN, &args ))) WARN( "glGlobalAlphaFactorfSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGlobalAlphaFactorfSUN, &args ))) WARN( "glGlobalAlphaFactorfSUN returned %#lx\n", status );
 }
 
 static void WINAPI glGlobalAlphaFactoriSUN( GLint factor )
@@ -11098,7 +11098,7 @@ static void WINAPI glGlobalAlphaFactoriSUN( GLint factor )
     struct glGlobalAlphaFactoriSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactoriSUN, &args ))) WARN( "glGlobalAlphaFactoriSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGlobalAlphaFactoriSUN, &args ))) WARN( "glGlobalAlphaFactoriSUN returned %#lx\n", status );
 }
 
 static void WINAPI glGlobalAlphaFactorsSUN( GLshort factor )
@@ -11106,7 +11106,7 @@ static void WINAPI glGlobalAlphaFactorsSUN( GLshort factor )
     struct glGlobalAlphaFactorsSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorsSUN, &args ))) WARN( "glGlobalAlphaFactorsSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGlobalAlphaFactorsSUN, &args ))) WARN( "glGlobalAlphaFactorsSUN returned %#lx\n", status );
 }
 
 static void WINAPI glGlobalAlphaFactorubSUN( GLubyte factor )
@@ -11114,7 +11114,7 @@ static void WINAPI glGlobalAlphaFactorubSUN( GLubyte factor )
     struct glGlobalAlphaFactorubSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorubSUN, &args ))) WARN( "glGlobalAlphaFactorubSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGlobalAlphaFactorubSUN, &args ))) WARN( "glGlobalAlphaFactorubSUN returned %#lx\n", status );
 }
 
 static void WINAPI glGlobalAlphaFactoruiSUN( GLuint factor )
@@ -11122,7 +11122,7 @@ static void WINAPI glGlobalAlphaFactoruiSUN( GLuint factor )
     struct glGlobalAlphaFactoruiSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactoruiSUN, &args ))) WARN( "glGlobalAlphaFactoruiSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGlobalAlphaFactoruiSUN, &args ))) WARN( "glGlobalAlphaFactoruiSUN returned %#lx\n", status );
 }
 
 static void WINAPI glGlobalAlphaFactorusSUN( GLushort factor )
@@ -11130,7 +11130,7 @@ static void WINAPI glGlobalAlphaFactorusSUN( GLushort factor )
     struct glGlobalAlphaFactorusSUN_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %d\n", factor );
-    if ((status = UNIX_CALL( glGlobalAlphaFactorusSUN, &args ))) WARN( "glGlobalAlphaFactorusSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glGlobalAlphaFactorusSUN, &args ))) WARN( "glGlobalAlphaFactorusSUN returned %#lx\n", status );
 }
 
 static void WINAPI glHintPGI( GLenum target, GLint mode )
@@ -11138,7 +11138,7 @@ static void WINAPI glHintPGI( GLenum target, GLint mode )
     struct glHintPGI_params args = { .teb = NtCurrentTeb(), .target = target, .mode = mode };
     NTSTATUS status;
     TRACE( "target %d, mode %d\n", target, mode );
-    if ((status = UNIX_CALL( glHintPGI, &args ))) WARN( "glHintPGI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glHintPGI, &args ))) WARN( "glHintPGI returned %#lx\n", status );
 }
 
 static void WINAPI glHistogram( GLenum target, GLsizei width, GLenum internalformat, GLboolean sink )
@@ -11146,7 +11146,7 @@ static void WINAPI glHistogram( GLenum target, GLsizei width, GLenum internalfor
     struct glHistogram_params args = { .teb = NtCurrentTeb(), .target = target, .width = width, .internalformat = internalformat, .sink = sink };
     NTSTATUS status;
     TRACE( "target %d, width %d, internalformat %d, sink %d\n", target, width, internalformat, sink );
-    if ((status = UNIX_CALL( glHistogram, &args ))) WARN( "glHistogram returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glHistogram, &args ))) WARN( "glHistogram returned %#lx\n", status );
 }
 
 static void WINAPI glHistogramEXT( GLenum target, GLsizei width, GLenum internalformat, GLboolean sink )
@@ -11154,7 +11154,7 @@ static void WINAPI glHistogramEXT( GLenum target, GLsizei width, GLenum internal
     struct glHistogramEXT_params args = { .teb = NtCurrentTeb(), .target = target, .width = width, .internalformat = internalformat, .sink = sink };
     NTSTATUS status;
     TRACE( "target %d, width %d, internalformat %d, sink %d\n", target, width, internalformat, sink );
-    if ((status = UNIX_CALL( glHistogramEXT, &args ))) WARN( "glHistogramEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glHistogramEXT, &args ))) WARN( "glHistogramEXT returned %#lx\n", status );
 }
 
 static void WINAPI glIglooInterfaceSGIX( GLenum pname, const void *params )
@@ -11170,7 +11170,7 @@ static void WINAPI glImageTransformParameterfHP( GLenum target, GLenum pname, GL
     struct glImageTransformParameterfHP_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %f\n", target, pname, param );
-    if ((status = UNIX_CALL( glImageTransformParameterfHP, &args ))) WARN( "glImageTransformParameterfHP returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glImageTransformParameterfHP, &args ))) WARN( "glImageTransformParameterfHP returned %#lx\n", status );
 }
 
 static void WINAPI glImageTransformParameterfvHP( GLenum target, GLenum pname, const GLfloat *params )
@@ -11186,7 +11186,7 @@ static void WINAPI glImageTransformParameteriHP( GLenum target, GLenum pname, GL
     struct glImageTransformParameteriHP_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glImageTransformParameteriHP, &args ))) WARN( "glImageTransformParameteriHP returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glImageTransformParameteriHP, &args ))) WARN( "glImageTransformParameteriHP returned %#lx\n", status );
 }
 
 static void WINAPI glImageTransformParameterivHP( GLenum target, GLenum pname, const GLint *params )
@@ -11202,7 +11202,7 @@ static void WINAPI glImportMemoryFdEXT( GLuint memory, GLuint64 size, GLenum han
     struct glImportMemoryFdEXT_params args = { .teb = NtCurrentTeb(), .memory = memory, .size = size, .handleType = handleType, .fd = fd };
     NTSTATUS status;
     TRACE( "memory %d, size %s, handleType %d, fd %d\n", memory, wine_dbgstr_longlong(size), handleType, fd );
-    if ((status = UNIX_CALL( glImportMemoryFdEXT, &args ))) WARN( "glImportMemoryFdEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glImportMemoryFdEXT, &args ))) WARN( "glImportMemoryFdEXT returned %#lx\n", status );
 }
 
 static void WINAPI glImportMemoryWin32HandleEXT( GLuint memory, GLuint64 size, GLenum handleType, void *handle )
@@ -11226,7 +11226,7 @@ static void WINAPI glImportSemaphoreFdEXT( GLuint semaphore, GLenum handleType,
     struct glImportSemaphoreFdEXT_params args = { .teb = NtCurrentTeb(), .semaphore = semaphore, .handleType = handleType, .fd = fd };
     NTSTATUS status;
     TRACE( "semaphore %d, handleType %d, fd %d\n", semaphore, handleType, fd );
-    if ((status = UNIX_CALL( glImportSemaphoreFdEXT, &args ))) WARN( "glImportSemaphoreFdEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glImportSemaphoreFdEXT, &args ))) WARN( "glImportSemaphoreFdEXT returned %#lx\n", status );
 }
 
 static void WINAPI glImportSemaphoreWin32HandleEXT( GLuint semaphore, GLenum handleType, void *handle )
@@ -11259,7 +11259,7 @@ static void WINAPI glIndexFormatNV( GLenum type, GLsizei stride )
     struct glIndexFormatNV_params args = { .teb = NtCurrentTeb(), .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "type %d, stride %d\n", type, stride );
-    if ((status = UNIX_CALL( glIndexFormatNV, &args ))) WARN( "glIndexFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexFormatNV, &args ))) WARN( "glIndexFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glIndexFuncEXT( GLenum func, GLclampf ref )
@@ -11267,7 +11267,7 @@ static void WINAPI glIndexFuncEXT( GLenum func, GLclampf ref )
     struct glIndexFuncEXT_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref };
     NTSTATUS status;
     TRACE( "func %d, ref %f\n", func, ref );
-    if ((status = UNIX_CALL( glIndexFuncEXT, &args ))) WARN( "glIndexFuncEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexFuncEXT, &args ))) WARN( "glIndexFuncEXT returned %#lx\n", status );
 }
 
 static void WINAPI glIndexMaterialEXT( GLenum face, GLenum mode )
@@ -11275,7 +11275,7 @@ static void WINAPI glIndexMaterialEXT( GLenum face, GLenum mode )
     struct glIndexMaterialEXT_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
     NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glIndexMaterialEXT, &args ))) WARN( "glIndexMaterialEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexMaterialEXT, &args ))) WARN( "glIndexMaterialEXT returned %#lx\n", status );
 }
 
 static void WINAPI glIndexPointerEXT( GLenum type, GLsizei stride, GLsizei count, const void *pointer )
@@ -11299,7 +11299,7 @@ static void WINAPI glIndexxOES( GLfixed component )
     struct glIndexxOES_params args = { .teb = NtCurrentTeb(), .component = component };
     NTSTATUS status;
     TRACE( "component %d\n", component );
-    if ((status = UNIX_CALL( glIndexxOES, &args ))) WARN( "glIndexxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glIndexxOES, &args ))) WARN( "glIndexxOES returned %#lx\n", status );
 }
 
 static void WINAPI glIndexxvOES( const GLfixed *component )
@@ -11315,7 +11315,7 @@ static void WINAPI glInsertComponentEXT( GLuint res, GLuint src, GLuint num )
     struct glInsertComponentEXT_params args = { .teb = NtCurrentTeb(), .res = res, .src = src, .num = num };
     NTSTATUS status;
     TRACE( "res %d, src %d, num %d\n", res, src, num );
-    if ((status = UNIX_CALL( glInsertComponentEXT, &args ))) WARN( "glInsertComponentEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glInsertComponentEXT, &args ))) WARN( "glInsertComponentEXT returned %#lx\n", status );
 }
 
 static void WINAPI glInsertEventMarkerEXT( GLsizei length, const GLchar *marker )
@@ -11339,7 +11339,7 @@ static void WINAPI glInterpolatePathsNV( GLuint resultPath, GLuint pathA, GLuint
     struct glInterpolatePathsNV_params args = { .teb = NtCurrentTeb(), .resultPath = resultPath, .pathA = pathA, .pathB = pathB, .weight = weight };
     NTSTATUS status;
     TRACE( "resultPath %d, pathA %d, pathB %d, weight %f\n", resultPath, pathA, pathB, weight );
-    if ((status = UNIX_CALL( glInterpolatePathsNV, &args ))) WARN( "glInterpolatePathsNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glInterpolatePathsNV, &args ))) WARN( "glInterpolatePathsNV returned %#lx\n", status );
 }
 
 static void WINAPI glInvalidateBufferData( GLuint buffer )
@@ -11347,7 +11347,7 @@ static void WINAPI glInvalidateBufferData( GLuint buffer )
     struct glInvalidateBufferData_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
     NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glInvalidateBufferData, &args ))) WARN( "glInvalidateBufferData returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glInvalidateBufferData, &args ))) WARN( "glInvalidateBufferData returned %#lx\n", status );
 }
 
 static void WINAPI glInvalidateBufferSubData( GLuint buffer, GLintptr offset, GLsizeiptr length )
@@ -11395,7 +11395,7 @@ static void WINAPI glInvalidateTexImage( GLuint texture, GLint level )
     struct glInvalidateTexImage_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "texture %d, level %d\n", texture, level );
-    if ((status = UNIX_CALL( glInvalidateTexImage, &args ))) WARN( "glInvalidateTexImage returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glInvalidateTexImage, &args ))) WARN( "glInvalidateTexImage returned %#lx\n", status );
 }
 
 static void WINAPI glInvalidateTexSubImage( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth )
@@ -11403,7 +11403,7 @@ static void WINAPI glInvalidateTexSubImage( GLuint texture, GLint level, GLint x
     struct glInvalidateTexSubImage_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .width = width, .height = height, .depth = depth };
     NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, yoffset %d, zoffset %d, width %d, height %d, depth %d\n", texture, level, xoffset, yoffset, zoffset, width, height, depth );
-    if ((status = UNIX_CALL( glInvalidateTexSubImage, &args ))) WARN( "glInvalidateTexSubImage returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glInvalidateTexSubImage, &args ))) WARN( "glInvalidateTexSubImage returned %#lx\n", status );
 }
 
 static GLboolean WINAPI glIsAsyncMarkerSGIX( GLuint marker )
@@ -11807,7 +11807,7 @@ static void WINAPI glLGPUCopyImageSubDataNVX( GLuint sourceGpu, GLbitfield desti
     struct glLGPUCopyImageSubDataNVX_params args = { .teb = NtCurrentTeb(), .sourceGpu = sourceGpu, .destinationGpuMask = destinationGpuMask, .srcName = srcName, .srcTarget = srcTarget, .srcLevel = srcLevel, .srcX = srcX, .srxY = srxY, .srcZ = srcZ, .dstName = dstName, .dstTarget = dstTarget, .dstLevel = dstLevel, .dstX = dstX, .dstY = dstY, .dstZ = dstZ, .width = width, .height = height, .depth = depth };
     NTSTATUS status;
     TRACE( "sourceGpu %d, destinationGpuMask %d, srcName %d, srcTarget %d, srcLevel %d, srcX %d, srxY %d, srcZ %d, dstName %d, dstTarget %d, dstLevel %d, dstX %d, dstY %d, dstZ %d, width %d, height %d, depth %d\n", sourceGpu, destinationGpuMask, srcName, srcTarget, srcLevel, srcX, srxY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth );
-    if ((status = UNIX_CALL( glLGPUCopyImageSubDataNVX, &args ))) WARN( "glLGPUCopyImageSubDataNVX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLGPUCopyImageSubDataNVX, &args ))) WARN( "glLGPUCopyImageSubDataNVX returned %#lx\n", status );
 }
 
 static void WINAPI glLGPUInterlockNVX(void)
@@ -11815,7 +11815,7 @@ static void WINAPI glLGPUInterlockNVX(void)
     struct glLGPUInterlockNVX_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glLGPUInterlockNVX, &args ))) WARN( "glLGPUInterlockNVX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLGPUInterlockNVX, &args ))) WARN( "glLGPUInterlockNVX returned %#lx\n", status );
 }
 
 static void WINAPI glLGPUNamedBufferSubDataNVX( GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data )
@@ -11839,7 +11839,7 @@ static void WINAPI glLightEnviSGIX( GLenum pname, GLint param )
     struct glLightEnviSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glLightEnviSGIX, &args ))) WARN( "glLightEnviSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLightEnviSGIX, &args ))) WARN( "glLightEnviSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glLightModelxOES( GLenum pname, GLfixed param )
@@ -11847,7 +11847,7 @@ static void WINAPI glLightModelxOES( GLenum pname, GLfixed param )
     struct glLightModelxOES_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glLightModelxOES, &args ))) WARN( "glLightModelxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLightModelxOES, &args ))) WARN( "glLightModelxOES returned %#lx\n", status );
 }
 
 static void WINAPI glLightModelxvOES( GLenum pname, const GLfixed *param )
@@ -11863,7 +11863,7 @@ static void WINAPI glLightxOES( GLenum light, GLenum pname, GLfixed param )
     struct glLightxOES_params args = { .teb = NtCurrentTeb(), .light = light, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "light %d, pname %d, param %d\n", light, pname, param );
-    if ((status = UNIX_CALL( glLightxOES, &args ))) WARN( "glLightxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLightxOES, &args ))) WARN( "glLightxOES returned %#lx\n", status );
 }
 
 static void WINAPI glLightxvOES( GLenum light, GLenum pname, const GLfixed *params )
@@ -11879,7 +11879,7 @@ static void WINAPI glLineWidthxOES( GLfixed width )
     struct glLineWidthxOES_params args = { .teb = NtCurrentTeb(), .width = width };
     NTSTATUS status;
     TRACE( "width %d\n", width );
-    if ((status = UNIX_CALL( glLineWidthxOES, &args ))) WARN( "glLineWidthxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLineWidthxOES, &args ))) WARN( "glLineWidthxOES returned %#lx\n", status );
 }
 
 static void WINAPI glLinkProgram( GLuint program )
@@ -11887,7 +11887,7 @@ static void WINAPI glLinkProgram( GLuint program )
     struct glLinkProgram_params args = { .teb = NtCurrentTeb(), .program = program };
     NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glLinkProgram, &args ))) WARN( "glLinkProgram returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLinkProgram, &args ))) WARN( "glLinkProgram returned %#lx\n", status );
 }
 
 static void WINAPI glLinkProgramARB( GLhandleARB programObj )
@@ -11895,7 +11895,7 @@ static void WINAPI glLinkProgramARB( GLhandleARB programObj )
     struct glLinkProgramARB_params args = { .teb = NtCurrentTeb(), .programObj = programObj };
     NTSTATUS status;
     TRACE( "programObj %d\n", programObj );
-    if ((status = UNIX_CALL( glLinkProgramARB, &args ))) WARN( "glLinkProgramARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLinkProgramARB, &args ))) WARN( "glLinkProgramARB returned %#lx\n", status );
 }
 
 static void WINAPI glListDrawCommandsStatesClientNV( GLuint list, GLuint segment, const void **indirects, const GLsizei *sizes, const GLuint *states, const GLuint *fbos, GLuint count )
@@ -11911,7 +11911,7 @@ static void WINAPI glListParameterfSGIX( GLuint list, GLenum pname, GLfloat para
     struct glListParameterfSGIX_params args = { .teb = NtCurrentTeb(), .list = list, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "list %d, pname %d, param %f\n", list, pname, param );
-    if ((status = UNIX_CALL( glListParameterfSGIX, &args ))) WARN( "glListParameterfSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glListParameterfSGIX, &args ))) WARN( "glListParameterfSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glListParameterfvSGIX( GLuint list, GLenum pname, const GLfloat *params )
@@ -11927,7 +11927,7 @@ static void WINAPI glListParameteriSGIX( GLuint list, GLenum pname, GLint param
     struct glListParameteriSGIX_params args = { .teb = NtCurrentTeb(), .list = list, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "list %d, pname %d, param %d\n", list, pname, param );
-    if ((status = UNIX_CALL( glListParameteriSGIX, &args ))) WARN( "glListParameteriSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glListParameteriSGIX, &args ))) WARN( "glListParameteriSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glListParameterivSGIX( GLuint list, GLenum pname, const GLint *params )
@@ -11943,7 +11943,7 @@ static void WINAPI glLoadIdentityDeformationMapSGIX( GLbitfield mask )
     struct glLoadIdentityDeformationMapSGIX_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glLoadIdentityDeformationMapSGIX, &args ))) WARN( "glLoadIdentityDeformationMapSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLoadIdentityDeformationMapSGIX, &args ))) WARN( "glLoadIdentityDeformationMapSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glLoadMatrixxOES( const GLfixed *m )
@@ -12007,7 +12007,7 @@ static void WINAPI glLockArraysEXT( GLint first, GLsizei count )
     struct glLockArraysEXT_params args = { .teb = NtCurrentTeb(), .first = first, .count = count };
     NTSTATUS status;
     TRACE( "first %d, count %d\n", first, count );
-    if ((status = UNIX_CALL( glLockArraysEXT, &args ))) WARN( "glLockArraysEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glLockArraysEXT, &args ))) WARN( "glLockArraysEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMTexCoord2fSGIS( GLenum target, GLfloat s, GLfloat t )
@@ -12015,7 +12015,7 @@ static void WINAPI glMTexCoord2fSGIS( GLenum target, GLfloat s, GLfloat t )
     struct glMTexCoord2fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMTexCoord2fSGIS, &args ))) WARN( "glMTexCoord2fSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMTexCoord2fSGIS, &args ))) WARN( "glMTexCoord2fSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMTexCoord2fvSGIS( GLenum target, GLfloat * v )
@@ -12031,7 +12031,7 @@ static void WINAPI glMakeBufferNonResidentNV( GLenum target )
     struct glMakeBufferNonResidentNV_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glMakeBufferNonResidentNV, &args ))) WARN( "glMakeBufferNonResidentNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeBufferNonResidentNV, &args ))) WARN( "glMakeBufferNonResidentNV returned %#lx\n", status );
 }
 
 static void WINAPI glMakeBufferResidentNV( GLenum target, GLenum access )
@@ -12039,7 +12039,7 @@ static void WINAPI glMakeBufferResidentNV( GLenum target, GLenum access )
     struct glMakeBufferResidentNV_params args = { .teb = NtCurrentTeb(), .target = target, .access = access };
     NTSTATUS status;
     TRACE( "target %d, access %d\n", target, access );
-    if ((status = UNIX_CALL( glMakeBufferResidentNV, &args ))) WARN( "glMakeBufferResidentNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeBufferResidentNV, &args ))) WARN( "glMakeBufferResidentNV returned %#lx\n", status );
 }
 
 static void WINAPI glMakeImageHandleNonResidentARB( GLuint64 handle )
@@ -12047,7 +12047,7 @@ static void WINAPI glMakeImageHandleNonResidentARB( GLuint64 handle )
     struct glMakeImageHandleNonResidentARB_params args = { .teb = NtCurrentTeb(), .handle = handle };
     NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeImageHandleNonResidentARB, &args ))) WARN( "glMakeImageHandleNonResidentARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeImageHandleNonResidentARB, &args ))) WARN( "glMakeImageHandleNonResidentARB returned %#lx\n", status );
 }
 
 static void WINAPI glMakeImageHandleNonResidentNV( GLuint64 handle )
@@ -12055,7 +12055,7 @@ static void WINAPI glMakeImageHandleNonResidentNV( GLuint64 handle )
     struct glMakeImageHandleNonResidentNV_params args = { .teb = NtCurrentTeb(), .handle = handle };
     NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeImageHandleNonResidentNV, &args ))) WARN( "glMakeImageHandleNonResidentNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeImageHandleNonResidentNV, &args ))) WARN( "glMakeImageHandleNonResidentNV returned %#lx\n", status );
 }
 
 static void WINAPI glMakeImageHandleResidentARB( GLuint64 handle, GLenum access )
@@ -12063,7 +12063,7 @@ static void WINAPI glMakeImageHandleResidentARB( GLuint64 handle, GLenum access
     struct glMakeImageHandleResidentARB_params args = { .teb = NtCurrentTeb(), .handle = handle, .access = access };
     NTSTATUS status;
     TRACE( "handle %s, access %d\n", wine_dbgstr_longlong(handle), access );
-    if ((status = UNIX_CALL( glMakeImageHandleResidentARB, &args ))) WARN( "glMakeImageHandleResidentARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeImageHandleResidentARB, &args ))) WARN( "glMakeImageHandleResidentARB returned %#lx\n", status );
 }
 
 static void WINAPI glMakeImageHandleResidentNV( GLuint64 handle, GLenum access )
@@ -12071,7 +12071,7 @@ static void WINAPI glMakeImageHandleResidentNV( GLuint64 handle, GLenum access )
     struct glMakeImageHandleResidentNV_params args = { .teb = NtCurrentTeb(), .handle = handle, .access = access };
     NTSTATUS status;
     TRACE( "handle %s, access %d\n", wine_dbgstr_longlong(handle), access );
-    if ((status = UNIX_CALL( glMakeImageHandleResidentNV, &args ))) WARN( "glMakeImageHandleResidentNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeImageHandleResidentNV, &args ))) WARN( "glMakeImageHandleResidentNV returned %#lx\n", status );
 }
 
 static void WINAPI glMakeNamedBufferNonResidentNV( GLuint buffer )
@@ -12079,7 +12079,7 @@ static void WINAPI glMakeNamedBufferNonResidentNV( GLuint buffer )
     struct glMakeNamedBufferNonResidentNV_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
     NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glMakeNamedBufferNonResidentNV, &args ))) WARN( "glMakeNamedBufferNonResidentNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeNamedBufferNonResidentNV, &args ))) WARN( "glMakeNamedBufferNonResidentNV returned %#lx\n", status );
 }
 
 static void WINAPI glMakeNamedBufferResidentNV( GLuint buffer, GLenum access )
@@ -12087,7 +12087,7 @@ static void WINAPI glMakeNamedBufferResidentNV( GLuint buffer, GLenum access )
     struct glMakeNamedBufferResidentNV_params args = { .teb = NtCurrentTeb(), .buffer = buffer, .access = access };
     NTSTATUS status;
     TRACE( "buffer %d, access %d\n", buffer, access );
-    if ((status = UNIX_CALL( glMakeNamedBufferResidentNV, &args ))) WARN( "glMakeNamedBufferResidentNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeNamedBufferResidentNV, &args ))) WARN( "glMakeNamedBufferResidentNV returned %#lx\n", status );
 }
 
 static void WINAPI glMakeTextureHandleNonResidentARB( GLuint64 handle )
@@ -12095,7 +12095,7 @@ static void WINAPI glMakeTextureHandleNonResidentARB( GLuint64 handle )
     struct glMakeTextureHandleNonResidentARB_params args = { .teb = NtCurrentTeb(), .handle = handle };
     NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeTextureHandleNonResidentARB, &args ))) WARN( "glMakeTextureHandleNonResidentARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeTextureHandleNonResidentARB, &args ))) WARN( "glMakeTextureHandleNonResidentARB returned %#lx\n", status );
 }
 
 static void WINAPI glMakeTextureHandleNonResidentNV( GLuint64 handle )
@@ -12103,7 +12103,7 @@ static void WINAPI glMakeTextureHandleNonResidentNV( GLuint64 handle )
     struct glMakeTextureHandleNonResidentNV_params args = { .teb = NtCurrentTeb(), .handle = handle };
     NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeTextureHandleNonResidentNV, &args ))) WARN( "glMakeTextureHandleNonResidentNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeTextureHandleNonResidentNV, &args ))) WARN( "glMakeTextureHandleNonResidentNV returned %#lx\n", status );
 }
 
 static void WINAPI glMakeTextureHandleResidentARB( GLuint64 handle )
@@ -12111,7 +12111,7 @@ static void WINAPI glMakeTextureHandleResidentARB( GLuint64 handle )
     struct glMakeTextureHandleResidentARB_params args = { .teb = NtCurrentTeb(), .handle = handle };
     NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeTextureHandleResidentARB, &args ))) WARN( "glMakeTextureHandleResidentARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeTextureHandleResidentARB, &args ))) WARN( "glMakeTextureHandleResidentARB returned %#lx\n", status );
 }
 
 static void WINAPI glMakeTextureHandleResidentNV( GLuint64 handle )
@@ -12119,7 +12119,7 @@ static void WINAPI glMakeTextureHandleResidentNV( GLuint64 handle )
     struct glMakeTextureHandleResidentNV_params args = { .teb = NtCurrentTeb(), .handle = handle };
     NTSTATUS status;
     TRACE( "handle %s\n", wine_dbgstr_longlong(handle) );
-    if ((status = UNIX_CALL( glMakeTextureHandleResidentNV, &args ))) WARN( "glMakeTextureHandleResidentNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMakeTextureHandleResidentNV, &args ))) WARN( "glMakeTextureHandleResidentNV returned %#lx\n", status );
 }
 
 static void WINAPI glMap1xOES( GLenum target, GLfixed u1, GLfixed u2, GLint stride, GLint order, GLfixed points )
@@ -12127,7 +12127,7 @@ static void WINAPI glMap1xOES( GLenum target, GLfixed u1, GLfixed u2, GLint stri
     struct glMap1xOES_params args = { .teb = NtCurrentTeb(), .target = target, .u1 = u1, .u2 = u2, .stride = stride, .order = order, .points = points };
     NTSTATUS status;
     TRACE( "target %d, u1 %d, u2 %d, stride %d, order %d, points %d\n", target, u1, u2, stride, order, points );
-    if ((status = UNIX_CALL( glMap1xOES, &args ))) WARN( "glMap1xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMap1xOES, &args ))) WARN( "glMap1xOES returned %#lx\n", status );
 }
 
 static void WINAPI glMap2xOES( GLenum target, GLfixed u1, GLfixed u2, GLint ustride, GLint uorder, GLfixed v1, GLfixed v2, GLint vstride, GLint vorder, GLfixed points )
@@ -12135,7 +12135,7 @@ static void WINAPI glMap2xOES( GLenum target, GLfixed u1, GLfixed u2, GLint ustr
     struct glMap2xOES_params args = { .teb = NtCurrentTeb(), .target = target, .u1 = u1, .u2 = u2, .ustride = ustride, .uorder = uorder, .v1 = v1, .v2 = v2, .vstride = vstride, .vorder = vorder, .points = points };
     NTSTATUS status;
     TRACE( "target %d, u1 %d, u2 %d, ustride %d, uorder %d, v1 %d, v2 %d, vstride %d, vorder %d, points %d\n", target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points );
-    if ((status = UNIX_CALL( glMap2xOES, &args ))) WARN( "glMap2xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMap2xOES, &args ))) WARN( "glMap2xOES returned %#lx\n", status );
 }
 
 static void WINAPI glMapControlPointsNV( GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void *points )
@@ -12151,7 +12151,7 @@ static void WINAPI glMapGrid1xOES( GLint n, GLfixed u1, GLfixed u2 )
     struct glMapGrid1xOES_params args = { .teb = NtCurrentTeb(), .n = n, .u1 = u1, .u2 = u2 };
     NTSTATUS status;
     TRACE( "n %d, u1 %d, u2 %d\n", n, u1, u2 );
-    if ((status = UNIX_CALL( glMapGrid1xOES, &args ))) WARN( "glMapGrid1xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMapGrid1xOES, &args ))) WARN( "glMapGrid1xOES returned %#lx\n", status );
 }
 
 static void WINAPI glMapGrid2xOES( GLint n, GLfixed u1, GLfixed u2, GLfixed v1, GLfixed v2 )
@@ -12159,7 +12159,7 @@ static void WINAPI glMapGrid2xOES( GLint n, GLfixed u1, GLfixed u2, GLfixed v1,
     struct glMapGrid2xOES_params args = { .teb = NtCurrentTeb(), .n = n, .u1 = u1, .u2 = u2, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "n %d, u1 %d, u2 %d, v1 %d, v2 %d\n", n, u1, u2, v1, v2 );
-    if ((status = UNIX_CALL( glMapGrid2xOES, &args ))) WARN( "glMapGrid2xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMapGrid2xOES, &args ))) WARN( "glMapGrid2xOES returned %#lx\n", status );
 }
 
 static void * WINAPI glMapObjectBufferATI( GLuint buffer )
@@ -12233,7 +12233,7 @@ static void WINAPI glMaterialxOES( GLenum face, GLenum pname, GLfixed param )
     struct glMaterialxOES_params args = { .teb = NtCurrentTeb(), .face = face, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "face %d, pname %d, param %d\n", face, pname, param );
-    if ((status = UNIX_CALL( glMaterialxOES, &args ))) WARN( "glMaterialxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMaterialxOES, &args ))) WARN( "glMaterialxOES returned %#lx\n", status );
 }
 
 static void WINAPI glMaterialxvOES( GLenum face, GLenum pname, const GLfixed *param )
@@ -12249,7 +12249,7 @@ static void WINAPI glMatrixFrustumEXT( GLenum mode, GLdouble left, GLdouble righ
     struct glMatrixFrustumEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .left = left, .right = right, .bottom = bottom, .top = top, .zNear = zNear, .zFar = zFar };
     NTSTATUS status;
     TRACE( "mode %d, left %f, right %f, bottom %f, top %f, zNear %f, zFar %f\n", mode, left, right, bottom, top, zNear, zFar );
-    if ((status = UNIX_CALL( glMatrixFrustumEXT, &args ))) WARN( "glMatrixFrustumEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixFrustumEXT, &args ))) WARN( "glMatrixFrustumEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixIndexPointerARB( GLint size, GLenum type, GLsizei stride, const void *pointer )
@@ -12305,7 +12305,7 @@ static void WINAPI glMatrixLoadIdentityEXT( GLenum mode )
     struct glMatrixLoadIdentityEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glMatrixLoadIdentityEXT, &args ))) WARN( "glMatrixLoadIdentityEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixLoadIdentityEXT, &args ))) WARN( "glMatrixLoadIdentityEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixLoadTranspose3x3fNV( GLenum matrixMode, const GLfloat *m )
@@ -12409,7 +12409,7 @@ static void WINAPI glMatrixOrthoEXT( GLenum mode, GLdouble left, GLdouble right,
     struct glMatrixOrthoEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .left = left, .right = right, .bottom = bottom, .top = top, .zNear = zNear, .zFar = zFar };
     NTSTATUS status;
     TRACE( "mode %d, left %f, right %f, bottom %f, top %f, zNear %f, zFar %f\n", mode, left, right, bottom, top, zNear, zFar );
-    if ((status = UNIX_CALL( glMatrixOrthoEXT, &args ))) WARN( "glMatrixOrthoEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixOrthoEXT, &args ))) WARN( "glMatrixOrthoEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixPopEXT( GLenum mode )
@@ -12417,7 +12417,7 @@ static void WINAPI glMatrixPopEXT( GLenum mode )
     struct glMatrixPopEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glMatrixPopEXT, &args ))) WARN( "glMatrixPopEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixPopEXT, &args ))) WARN( "glMatrixPopEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixPushEXT( GLenum mode )
@@ -12425,7 +12425,7 @@ static void WINAPI glMatrixPushEXT( GLenum mode )
     struct glMatrixPushEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glMatrixPushEXT, &args ))) WARN( "glMatrixPushEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixPushEXT, &args ))) WARN( "glMatrixPushEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixRotatedEXT( GLenum mode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z )
@@ -12433,7 +12433,7 @@ static void WINAPI glMatrixRotatedEXT( GLenum mode, GLdouble angle, GLdouble x,
     struct glMatrixRotatedEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .angle = angle, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "mode %d, angle %f, x %f, y %f, z %f\n", mode, angle, x, y, z );
-    if ((status = UNIX_CALL( glMatrixRotatedEXT, &args ))) WARN( "glMatrixRotatedEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixRotatedEXT, &args ))) WARN( "glMatrixRotatedEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixRotatefEXT( GLenum mode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z )
@@ -12441,7 +12441,7 @@ static void WINAPI glMatrixRotatefEXT( GLenum mode, GLfloat angle, GLfloat x, GL
     struct glMatrixRotatefEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .angle = angle, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "mode %d, angle %f, x %f, y %f, z %f\n", mode, angle, x, y, z );
-    if ((status = UNIX_CALL( glMatrixRotatefEXT, &args ))) WARN( "glMatrixRotatefEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixRotatefEXT, &args ))) WARN( "glMatrixRotatefEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixScaledEXT( GLenum mode, GLdouble x, GLdouble y, GLdouble z )
@@ -12449,7 +12449,7 @@ static void WINAPI glMatrixScaledEXT( GLenum mode, GLdouble x, GLdouble y, GLdou
     struct glMatrixScaledEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "mode %d, x %f, y %f, z %f\n", mode, x, y, z );
-    if ((status = UNIX_CALL( glMatrixScaledEXT, &args ))) WARN( "glMatrixScaledEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixScaledEXT, &args ))) WARN( "glMatrixScaledEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixScalefEXT( GLenum mode, GLfloat x, GLfloat y, GLfloat z )
@@ -12457,7 +12457,7 @@ static void WINAPI glMatrixScalefEXT( GLenum mode, GLfloat x, GLfloat y, GLfloat
     struct glMatrixScalefEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "mode %d, x %f, y %f, z %f\n", mode, x, y, z );
-    if ((status = UNIX_CALL( glMatrixScalefEXT, &args ))) WARN( "glMatrixScalefEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixScalefEXT, &args ))) WARN( "glMatrixScalefEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixTranslatedEXT( GLenum mode, GLdouble x, GLdouble y, GLdouble z )
@@ -12465,7 +12465,7 @@ static void WINAPI glMatrixTranslatedEXT( GLenum mode, GLdouble x, GLdouble y, G
     struct glMatrixTranslatedEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "mode %d, x %f, y %f, z %f\n", mode, x, y, z );
-    if ((status = UNIX_CALL( glMatrixTranslatedEXT, &args ))) WARN( "glMatrixTranslatedEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixTranslatedEXT, &args ))) WARN( "glMatrixTranslatedEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMatrixTranslatefEXT( GLenum mode, GLfloat x, GLfloat y, GLfloat z )
@@ -12473,7 +12473,7 @@ static void WINAPI glMatrixTranslatefEXT( GLenum mode, GLfloat x, GLfloat y, GLf
     struct glMatrixTranslatefEXT_params args = { .teb = NtCurrentTeb(), .mode = mode, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "mode %d, x %f, y %f, z %f\n", mode, x, y, z );
-    if ((status = UNIX_CALL( glMatrixTranslatefEXT, &args ))) WARN( "glMatrixTranslatefEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMatrixTranslatefEXT, &args ))) WARN( "glMatrixTranslatefEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMaxShaderCompilerThreadsARB( GLuint count )
@@ -12481,7 +12481,7 @@ static void WINAPI glMaxShaderCompilerThreadsARB( GLuint count )
     struct glMaxShaderCompilerThreadsARB_params args = { .teb = NtCurrentTeb(), .count = count };
     NTSTATUS status;
     TRACE( "count %d\n", count );
-    if ((status = UNIX_CALL( glMaxShaderCompilerThreadsARB, &args ))) WARN( "glMaxShaderCompilerThreadsARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMaxShaderCompilerThreadsARB, &args ))) WARN( "glMaxShaderCompilerThreadsARB returned %#lx\n", status );
 }
 
 static void WINAPI glMaxShaderCompilerThreadsKHR( GLuint count )
@@ -12489,7 +12489,7 @@ static void WINAPI glMaxShaderCompilerThreadsKHR( GLuint count )
     struct glMaxShaderCompilerThreadsKHR_params args = { .teb = NtCurrentTeb(), .count = count };
     NTSTATUS status;
     TRACE( "count %d\n", count );
-    if ((status = UNIX_CALL( glMaxShaderCompilerThreadsKHR, &args ))) WARN( "glMaxShaderCompilerThreadsKHR returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMaxShaderCompilerThreadsKHR, &args ))) WARN( "glMaxShaderCompilerThreadsKHR returned %#lx\n", status );
 }
 
 static void WINAPI glMemoryBarrier( GLbitfield barriers )
@@ -12497,7 +12497,7 @@ static void WINAPI glMemoryBarrier( GLbitfield barriers )
     struct glMemoryBarrier_params args = { .teb = NtCurrentTeb(), .barriers = barriers };
     NTSTATUS status;
     TRACE( "barriers %d\n", barriers );
-    if ((status = UNIX_CALL( glMemoryBarrier, &args ))) WARN( "glMemoryBarrier returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMemoryBarrier, &args ))) WARN( "glMemoryBarrier returned %#lx\n", status );
 }
 
 static void WINAPI glMemoryBarrierByRegion( GLbitfield barriers )
@@ -12505,7 +12505,7 @@ static void WINAPI glMemoryBarrierByRegion( GLbitfield barriers )
     struct glMemoryBarrierByRegion_params args = { .teb = NtCurrentTeb(), .barriers = barriers };
     NTSTATUS status;
     TRACE( "barriers %d\n", barriers );
-    if ((status = UNIX_CALL( glMemoryBarrierByRegion, &args ))) WARN( "glMemoryBarrierByRegion returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMemoryBarrierByRegion, &args ))) WARN( "glMemoryBarrierByRegion returned %#lx\n", status );
 }
 
 static void WINAPI glMemoryBarrierEXT( GLbitfield barriers )
@@ -12513,7 +12513,7 @@ static void WINAPI glMemoryBarrierEXT( GLbitfield barriers )
     struct glMemoryBarrierEXT_params args = { .teb = NtCurrentTeb(), .barriers = barriers };
     NTSTATUS status;
     TRACE( "barriers %d\n", barriers );
-    if ((status = UNIX_CALL( glMemoryBarrierEXT, &args ))) WARN( "glMemoryBarrierEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMemoryBarrierEXT, &args ))) WARN( "glMemoryBarrierEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMemoryObjectParameterivEXT( GLuint memoryObject, GLenum pname, const GLint *params )
@@ -12529,7 +12529,7 @@ static void WINAPI glMinSampleShading( GLfloat value )
     struct glMinSampleShading_params args = { .teb = NtCurrentTeb(), .value = value };
     NTSTATUS status;
     TRACE( "value %f\n", value );
-    if ((status = UNIX_CALL( glMinSampleShading, &args ))) WARN( "glMinSampleShading returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMinSampleShading, &args ))) WARN( "glMinSampleShading returned %#lx\n", status );
 }
 
 static void WINAPI glMinSampleShadingARB( GLfloat value )
@@ -12537,7 +12537,7 @@ static void WINAPI glMinSampleShadingARB( GLfloat value )
     struct glMinSampleShadingARB_params args = { .teb = NtCurrentTeb(), .value = value };
     NTSTATUS status;
     TRACE( "value %f\n", value );
-    if ((status = UNIX_CALL( glMinSampleShadingARB, &args ))) WARN( "glMinSampleShadingARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMinSampleShadingARB, &args ))) WARN( "glMinSampleShadingARB returned %#lx\n", status );
 }
 
 static void WINAPI glMinmax( GLenum target, GLenum internalformat, GLboolean sink )
@@ -12545,7 +12545,7 @@ static void WINAPI glMinmax( GLenum target, GLenum internalformat, GLboolean sin
     struct glMinmax_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .sink = sink };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, sink %d\n", target, internalformat, sink );
-    if ((status = UNIX_CALL( glMinmax, &args ))) WARN( "glMinmax returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMinmax, &args ))) WARN( "glMinmax returned %#lx\n", status );
 }
 
 static void WINAPI glMinmaxEXT( GLenum target, GLenum internalformat, GLboolean sink )
@@ -12553,7 +12553,7 @@ static void WINAPI glMinmaxEXT( GLenum target, GLenum internalformat, GLboolean
     struct glMinmaxEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .sink = sink };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, sink %d\n", target, internalformat, sink );
-    if ((status = UNIX_CALL( glMinmaxEXT, &args ))) WARN( "glMinmaxEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMinmaxEXT, &args ))) WARN( "glMinmaxEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultMatrixxOES( const GLfixed *m )
@@ -12793,7 +12793,7 @@ static void WINAPI glMultiTexBufferEXT( GLenum texunit, GLenum target, GLenum in
     struct glMultiTexBufferEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .internalformat = internalformat, .buffer = buffer };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, internalformat %d, buffer %d\n", texunit, target, internalformat, buffer );
-    if ((status = UNIX_CALL( glMultiTexBufferEXT, &args ))) WARN( "glMultiTexBufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexBufferEXT, &args ))) WARN( "glMultiTexBufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1bOES( GLenum texture, GLbyte s )
@@ -12801,7 +12801,7 @@ static void WINAPI glMultiTexCoord1bOES( GLenum texture, GLbyte s )
     struct glMultiTexCoord1bOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s };
     NTSTATUS status;
     TRACE( "texture %d, s %d\n", texture, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1bOES, &args ))) WARN( "glMultiTexCoord1bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1bOES, &args ))) WARN( "glMultiTexCoord1bOES returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1bvOES( GLenum texture, const GLbyte *coords )
@@ -12817,7 +12817,7 @@ static void WINAPI glMultiTexCoord1d( GLenum target, GLdouble s )
     struct glMultiTexCoord1d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1d, &args ))) WARN( "glMultiTexCoord1d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1d, &args ))) WARN( "glMultiTexCoord1d returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1dARB( GLenum target, GLdouble s )
@@ -12825,7 +12825,7 @@ static void WINAPI glMultiTexCoord1dARB( GLenum target, GLdouble s )
     struct glMultiTexCoord1dARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1dARB, &args ))) WARN( "glMultiTexCoord1dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1dARB, &args ))) WARN( "glMultiTexCoord1dARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1dSGIS( GLenum target, GLdouble s )
@@ -12833,7 +12833,7 @@ static void WINAPI glMultiTexCoord1dSGIS( GLenum target, GLdouble s )
     struct glMultiTexCoord1dSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1dSGIS, &args ))) WARN( "glMultiTexCoord1dSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1dSGIS, &args ))) WARN( "glMultiTexCoord1dSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1dv( GLenum target, const GLdouble *v )
@@ -12865,7 +12865,7 @@ static void WINAPI glMultiTexCoord1f( GLenum target, GLfloat s )
     struct glMultiTexCoord1f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1f, &args ))) WARN( "glMultiTexCoord1f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1f, &args ))) WARN( "glMultiTexCoord1f returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1fARB( GLenum target, GLfloat s )
@@ -12873,7 +12873,7 @@ static void WINAPI glMultiTexCoord1fARB( GLenum target, GLfloat s )
     struct glMultiTexCoord1fARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1fARB, &args ))) WARN( "glMultiTexCoord1fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1fARB, &args ))) WARN( "glMultiTexCoord1fARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1fSGIS( GLenum target, GLfloat s )
@@ -12881,7 +12881,7 @@ static void WINAPI glMultiTexCoord1fSGIS( GLenum target, GLfloat s )
     struct glMultiTexCoord1fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %f\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1fSGIS, &args ))) WARN( "glMultiTexCoord1fSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1fSGIS, &args ))) WARN( "glMultiTexCoord1fSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1fv( GLenum target, const GLfloat *v )
@@ -12913,7 +12913,7 @@ static void WINAPI glMultiTexCoord1hNV( GLenum target, GLhalfNV s )
     struct glMultiTexCoord1hNV_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1hNV, &args ))) WARN( "glMultiTexCoord1hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1hNV, &args ))) WARN( "glMultiTexCoord1hNV returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1hvNV( GLenum target, const GLhalfNV *v )
@@ -12929,7 +12929,7 @@ static void WINAPI glMultiTexCoord1i( GLenum target, GLint s )
     struct glMultiTexCoord1i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1i, &args ))) WARN( "glMultiTexCoord1i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1i, &args ))) WARN( "glMultiTexCoord1i returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1iARB( GLenum target, GLint s )
@@ -12937,7 +12937,7 @@ static void WINAPI glMultiTexCoord1iARB( GLenum target, GLint s )
     struct glMultiTexCoord1iARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1iARB, &args ))) WARN( "glMultiTexCoord1iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1iARB, &args ))) WARN( "glMultiTexCoord1iARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1iSGIS( GLenum target, GLint s )
@@ -12945,7 +12945,7 @@ static void WINAPI glMultiTexCoord1iSGIS( GLenum target, GLint s )
     struct glMultiTexCoord1iSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1iSGIS, &args ))) WARN( "glMultiTexCoord1iSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1iSGIS, &args ))) WARN( "glMultiTexCoord1iSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1iv( GLenum target, const GLint *v )
@@ -12977,7 +12977,7 @@ static void WINAPI glMultiTexCoord1s( GLenum target, GLshort s )
     struct glMultiTexCoord1s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1s, &args ))) WARN( "glMultiTexCoord1s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1s, &args ))) WARN( "glMultiTexCoord1s returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1sARB( GLenum target, GLshort s )
@@ -12985,7 +12985,7 @@ static void WINAPI glMultiTexCoord1sARB( GLenum target, GLshort s )
     struct glMultiTexCoord1sARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1sARB, &args ))) WARN( "glMultiTexCoord1sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1sARB, &args ))) WARN( "glMultiTexCoord1sARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1sSGIS( GLenum target, GLshort s )
@@ -12993,7 +12993,7 @@ static void WINAPI glMultiTexCoord1sSGIS( GLenum target, GLshort s )
     struct glMultiTexCoord1sSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s };
     NTSTATUS status;
     TRACE( "target %d, s %d\n", target, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1sSGIS, &args ))) WARN( "glMultiTexCoord1sSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1sSGIS, &args ))) WARN( "glMultiTexCoord1sSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1sv( GLenum target, const GLshort *v )
@@ -13025,7 +13025,7 @@ static void WINAPI glMultiTexCoord1xOES( GLenum texture, GLfixed s )
     struct glMultiTexCoord1xOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s };
     NTSTATUS status;
     TRACE( "texture %d, s %d\n", texture, s );
-    if ((status = UNIX_CALL( glMultiTexCoord1xOES, &args ))) WARN( "glMultiTexCoord1xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord1xOES, &args ))) WARN( "glMultiTexCoord1xOES returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord1xvOES( GLenum texture, const GLfixed *coords )
@@ -13041,7 +13041,7 @@ static void WINAPI glMultiTexCoord2bOES( GLenum texture, GLbyte s, GLbyte t )
     struct glMultiTexCoord2bOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "texture %d, s %d, t %d\n", texture, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2bOES, &args ))) WARN( "glMultiTexCoord2bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2bOES, &args ))) WARN( "glMultiTexCoord2bOES returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2bvOES( GLenum texture, const GLbyte *coords )
@@ -13057,7 +13057,7 @@ static void WINAPI glMultiTexCoord2d( GLenum target, GLdouble s, GLdouble t )
     struct glMultiTexCoord2d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2d, &args ))) WARN( "glMultiTexCoord2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2d, &args ))) WARN( "glMultiTexCoord2d returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2dARB( GLenum target, GLdouble s, GLdouble t )
@@ -13065,7 +13065,7 @@ static void WINAPI glMultiTexCoord2dARB( GLenum target, GLdouble s, GLdouble t )
     struct glMultiTexCoord2dARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2dARB, &args ))) WARN( "glMultiTexCoord2dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2dARB, &args ))) WARN( "glMultiTexCoord2dARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2dSGIS( GLenum target, GLdouble s, GLdouble t )
@@ -13073,7 +13073,7 @@ static void WINAPI glMultiTexCoord2dSGIS( GLenum target, GLdouble s, GLdouble t
     struct glMultiTexCoord2dSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2dSGIS, &args ))) WARN( "glMultiTexCoord2dSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2dSGIS, &args ))) WARN( "glMultiTexCoord2dSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2dv( GLenum target, const GLdouble *v )
@@ -13105,7 +13105,7 @@ static void WINAPI glMultiTexCoord2f( GLenum target, GLfloat s, GLfloat t )
     struct glMultiTexCoord2f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2f, &args ))) WARN( "glMultiTexCoord2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2f, &args ))) WARN( "glMultiTexCoord2f returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2fARB( GLenum target, GLfloat s, GLfloat t )
@@ -13113,7 +13113,7 @@ static void WINAPI glMultiTexCoord2fARB( GLenum target, GLfloat s, GLfloat t )
     struct glMultiTexCoord2fARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2fARB, &args ))) WARN( "glMultiTexCoord2fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2fARB, &args ))) WARN( "glMultiTexCoord2fARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2fSGIS( GLenum target, GLfloat s, GLfloat t )
@@ -13121,7 +13121,7 @@ static void WINAPI glMultiTexCoord2fSGIS( GLenum target, GLfloat s, GLfloat t )
     struct glMultiTexCoord2fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2fSGIS, &args ))) WARN( "glMultiTexCoord2fSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2fSGIS, &args ))) WARN( "glMultiTexCoord2fSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2fv( GLenum target, const GLfloat *v )
@@ -13153,7 +13153,7 @@ static void WINAPI glMultiTexCoord2hNV( GLenum target, GLhalfNV s, GLhalfNV t )
     struct glMultiTexCoord2hNV_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2hNV, &args ))) WARN( "glMultiTexCoord2hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2hNV, &args ))) WARN( "glMultiTexCoord2hNV returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2hvNV( GLenum target, const GLhalfNV *v )
@@ -13169,7 +13169,7 @@ static void WINAPI glMultiTexCoord2i( GLenum target, GLint s, GLint t )
     struct glMultiTexCoord2i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2i, &args ))) WARN( "glMultiTexCoord2i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2i, &args ))) WARN( "glMultiTexCoord2i returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2iARB( GLenum target, GLint s, GLint t )
@@ -13177,7 +13177,7 @@ static void WINAPI glMultiTexCoord2iARB( GLenum target, GLint s, GLint t )
     struct glMultiTexCoord2iARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2iARB, &args ))) WARN( "glMultiTexCoord2iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2iARB, &args ))) WARN( "glMultiTexCoord2iARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2iSGIS( GLenum target, GLint s, GLint t )
@@ -13185,7 +13185,7 @@ static void WINAPI glMultiTexCoord2iSGIS( GLenum target, GLint s, GLint t )
     struct glMultiTexCoord2iSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2iSGIS, &args ))) WARN( "glMultiTexCoord2iSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2iSGIS, &args ))) WARN( "glMultiTexCoord2iSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2iv( GLenum target, const GLint *v )
@@ -13217,7 +13217,7 @@ static void WINAPI glMultiTexCoord2s( GLenum target, GLshort s, GLshort t )
     struct glMultiTexCoord2s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2s, &args ))) WARN( "glMultiTexCoord2s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2s, &args ))) WARN( "glMultiTexCoord2s returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2sARB( GLenum target, GLshort s, GLshort t )
@@ -13225,7 +13225,7 @@ static void WINAPI glMultiTexCoord2sARB( GLenum target, GLshort s, GLshort t )
     struct glMultiTexCoord2sARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2sARB, &args ))) WARN( "glMultiTexCoord2sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2sARB, &args ))) WARN( "glMultiTexCoord2sARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2sSGIS( GLenum target, GLshort s, GLshort t )
@@ -13233,7 +13233,7 @@ static void WINAPI glMultiTexCoord2sSGIS( GLenum target, GLshort s, GLshort t )
     struct glMultiTexCoord2sSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d\n", target, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2sSGIS, &args ))) WARN( "glMultiTexCoord2sSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2sSGIS, &args ))) WARN( "glMultiTexCoord2sSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2sv( GLenum target, const GLshort *v )
@@ -13265,7 +13265,7 @@ static void WINAPI glMultiTexCoord2xOES( GLenum texture, GLfixed s, GLfixed t )
     struct glMultiTexCoord2xOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t };
     NTSTATUS status;
     TRACE( "texture %d, s %d, t %d\n", texture, s, t );
-    if ((status = UNIX_CALL( glMultiTexCoord2xOES, &args ))) WARN( "glMultiTexCoord2xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord2xOES, &args ))) WARN( "glMultiTexCoord2xOES returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord2xvOES( GLenum texture, const GLfixed *coords )
@@ -13281,7 +13281,7 @@ static void WINAPI glMultiTexCoord3bOES( GLenum texture, GLbyte s, GLbyte t, GLb
     struct glMultiTexCoord3bOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "texture %d, s %d, t %d, r %d\n", texture, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3bOES, &args ))) WARN( "glMultiTexCoord3bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3bOES, &args ))) WARN( "glMultiTexCoord3bOES returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3bvOES( GLenum texture, const GLbyte *coords )
@@ -13297,7 +13297,7 @@ static void WINAPI glMultiTexCoord3d( GLenum target, GLdouble s, GLdouble t, GLd
     struct glMultiTexCoord3d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3d, &args ))) WARN( "glMultiTexCoord3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3d, &args ))) WARN( "glMultiTexCoord3d returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3dARB( GLenum target, GLdouble s, GLdouble t, GLdouble r )
@@ -13305,7 +13305,7 @@ static void WINAPI glMultiTexCoord3dARB( GLenum target, GLdouble s, GLdouble t,
     struct glMultiTexCoord3dARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3dARB, &args ))) WARN( "glMultiTexCoord3dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3dARB, &args ))) WARN( "glMultiTexCoord3dARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3dSGIS( GLenum target, GLdouble s, GLdouble t, GLdouble r )
@@ -13313,7 +13313,7 @@ static void WINAPI glMultiTexCoord3dSGIS( GLenum target, GLdouble s, GLdouble t,
     struct glMultiTexCoord3dSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3dSGIS, &args ))) WARN( "glMultiTexCoord3dSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3dSGIS, &args ))) WARN( "glMultiTexCoord3dSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3dv( GLenum target, const GLdouble *v )
@@ -13345,7 +13345,7 @@ static void WINAPI glMultiTexCoord3f( GLenum target, GLfloat s, GLfloat t, GLflo
     struct glMultiTexCoord3f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3f, &args ))) WARN( "glMultiTexCoord3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3f, &args ))) WARN( "glMultiTexCoord3f returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3fARB( GLenum target, GLfloat s, GLfloat t, GLfloat r )
@@ -13353,7 +13353,7 @@ static void WINAPI glMultiTexCoord3fARB( GLenum target, GLfloat s, GLfloat t, GL
     struct glMultiTexCoord3fARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3fARB, &args ))) WARN( "glMultiTexCoord3fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3fARB, &args ))) WARN( "glMultiTexCoord3fARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3fSGIS( GLenum target, GLfloat s, GLfloat t, GLfloat r )
@@ -13361,7 +13361,7 @@ static void WINAPI glMultiTexCoord3fSGIS( GLenum target, GLfloat s, GLfloat t, G
     struct glMultiTexCoord3fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3fSGIS, &args ))) WARN( "glMultiTexCoord3fSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3fSGIS, &args ))) WARN( "glMultiTexCoord3fSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3fv( GLenum target, const GLfloat *v )
@@ -13393,7 +13393,7 @@ static void WINAPI glMultiTexCoord3hNV( GLenum target, GLhalfNV s, GLhalfNV t, G
     struct glMultiTexCoord3hNV_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3hNV, &args ))) WARN( "glMultiTexCoord3hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3hNV, &args ))) WARN( "glMultiTexCoord3hNV returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3hvNV( GLenum target, const GLhalfNV *v )
@@ -13409,7 +13409,7 @@ static void WINAPI glMultiTexCoord3i( GLenum target, GLint s, GLint t, GLint r )
     struct glMultiTexCoord3i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3i, &args ))) WARN( "glMultiTexCoord3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3i, &args ))) WARN( "glMultiTexCoord3i returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3iARB( GLenum target, GLint s, GLint t, GLint r )
@@ -13417,7 +13417,7 @@ static void WINAPI glMultiTexCoord3iARB( GLenum target, GLint s, GLint t, GLint
     struct glMultiTexCoord3iARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3iARB, &args ))) WARN( "glMultiTexCoord3iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3iARB, &args ))) WARN( "glMultiTexCoord3iARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3iSGIS( GLenum target, GLint s, GLint t, GLint r )
@@ -13425,7 +13425,7 @@ static void WINAPI glMultiTexCoord3iSGIS( GLenum target, GLint s, GLint t, GLint
     struct glMultiTexCoord3iSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3iSGIS, &args ))) WARN( "glMultiTexCoord3iSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3iSGIS, &args ))) WARN( "glMultiTexCoord3iSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3iv( GLenum target, const GLint *v )
@@ -13457,7 +13457,7 @@ static void WINAPI glMultiTexCoord3s( GLenum target, GLshort s, GLshort t, GLsho
     struct glMultiTexCoord3s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3s, &args ))) WARN( "glMultiTexCoord3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3s, &args ))) WARN( "glMultiTexCoord3s returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3sARB( GLenum target, GLshort s, GLshort t, GLshort r )
@@ -13465,7 +13465,7 @@ static void WINAPI glMultiTexCoord3sARB( GLenum target, GLshort s, GLshort t, GL
     struct glMultiTexCoord3sARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3sARB, &args ))) WARN( "glMultiTexCoord3sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3sARB, &args ))) WARN( "glMultiTexCoord3sARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3sSGIS( GLenum target, GLshort s, GLshort t, GLshort r )
@@ -13473,7 +13473,7 @@ static void WINAPI glMultiTexCoord3sSGIS( GLenum target, GLshort s, GLshort t, G
     struct glMultiTexCoord3sSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d\n", target, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3sSGIS, &args ))) WARN( "glMultiTexCoord3sSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3sSGIS, &args ))) WARN( "glMultiTexCoord3sSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3sv( GLenum target, const GLshort *v )
@@ -13505,7 +13505,7 @@ static void WINAPI glMultiTexCoord3xOES( GLenum texture, GLfixed s, GLfixed t, G
     struct glMultiTexCoord3xOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "texture %d, s %d, t %d, r %d\n", texture, s, t, r );
-    if ((status = UNIX_CALL( glMultiTexCoord3xOES, &args ))) WARN( "glMultiTexCoord3xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord3xOES, &args ))) WARN( "glMultiTexCoord3xOES returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord3xvOES( GLenum texture, const GLfixed *coords )
@@ -13521,7 +13521,7 @@ static void WINAPI glMultiTexCoord4bOES( GLenum texture, GLbyte s, GLbyte t, GLb
     struct glMultiTexCoord4bOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "texture %d, s %d, t %d, r %d, q %d\n", texture, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4bOES, &args ))) WARN( "glMultiTexCoord4bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4bOES, &args ))) WARN( "glMultiTexCoord4bOES returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4bvOES( GLenum texture, const GLbyte *coords )
@@ -13537,7 +13537,7 @@ static void WINAPI glMultiTexCoord4d( GLenum target, GLdouble s, GLdouble t, GLd
     struct glMultiTexCoord4d_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4d, &args ))) WARN( "glMultiTexCoord4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4d, &args ))) WARN( "glMultiTexCoord4d returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4dARB( GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q )
@@ -13545,7 +13545,7 @@ static void WINAPI glMultiTexCoord4dARB( GLenum target, GLdouble s, GLdouble t,
     struct glMultiTexCoord4dARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4dARB, &args ))) WARN( "glMultiTexCoord4dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4dARB, &args ))) WARN( "glMultiTexCoord4dARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4dSGIS( GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q )
@@ -13553,7 +13553,7 @@ static void WINAPI glMultiTexCoord4dSGIS( GLenum target, GLdouble s, GLdouble t,
     struct glMultiTexCoord4dSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4dSGIS, &args ))) WARN( "glMultiTexCoord4dSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4dSGIS, &args ))) WARN( "glMultiTexCoord4dSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4dv( GLenum target, const GLdouble *v )
@@ -13585,7 +13585,7 @@ static void WINAPI glMultiTexCoord4f( GLenum target, GLfloat s, GLfloat t, GLflo
     struct glMultiTexCoord4f_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4f, &args ))) WARN( "glMultiTexCoord4f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4f, &args ))) WARN( "glMultiTexCoord4f returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4fARB( GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q )
@@ -13593,7 +13593,7 @@ static void WINAPI glMultiTexCoord4fARB( GLenum target, GLfloat s, GLfloat t, GL
     struct glMultiTexCoord4fARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4fARB, &args ))) WARN( "glMultiTexCoord4fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4fARB, &args ))) WARN( "glMultiTexCoord4fARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4fSGIS( GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q )
@@ -13601,7 +13601,7 @@ static void WINAPI glMultiTexCoord4fSGIS( GLenum target, GLfloat s, GLfloat t, G
     struct glMultiTexCoord4fSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %f, t %f, r %f, q %f\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4fSGIS, &args ))) WARN( "glMultiTexCoord4fSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4fSGIS, &args ))) WARN( "glMultiTexCoord4fSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4fv( GLenum target, const GLfloat *v )
@@ -13633,7 +13633,7 @@ static void WINAPI glMultiTexCoord4hNV( GLenum target, GLhalfNV s, GLhalfNV t, G
     struct glMultiTexCoord4hNV_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4hNV, &args ))) WARN( "glMultiTexCoord4hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4hNV, &args ))) WARN( "glMultiTexCoord4hNV returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4hvNV( GLenum target, const GLhalfNV *v )
@@ -13649,7 +13649,7 @@ static void WINAPI glMultiTexCoord4i( GLenum target, GLint s, GLint t, GLint r,
     struct glMultiTexCoord4i_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4i, &args ))) WARN( "glMultiTexCoord4i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4i, &args ))) WARN( "glMultiTexCoord4i returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4iARB( GLenum target, GLint s, GLint t, GLint r, GLint q )
@@ -13657,7 +13657,7 @@ static void WINAPI glMultiTexCoord4iARB( GLenum target, GLint s, GLint t, GLint
     struct glMultiTexCoord4iARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4iARB, &args ))) WARN( "glMultiTexCoord4iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4iARB, &args ))) WARN( "glMultiTexCoord4iARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4iSGIS( GLenum target, GLint s, GLint t, GLint r, GLint q )
@@ -13665,7 +13665,7 @@ static void WINAPI glMultiTexCoord4iSGIS( GLenum target, GLint s, GLint t, GLint
     struct glMultiTexCoord4iSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4iSGIS, &args ))) WARN( "glMultiTexCoord4iSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4iSGIS, &args ))) WARN( "glMultiTexCoord4iSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4iv( GLenum target, const GLint *v )
@@ -13697,7 +13697,7 @@ static void WINAPI glMultiTexCoord4s( GLenum target, GLshort s, GLshort t, GLsho
     struct glMultiTexCoord4s_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4s, &args ))) WARN( "glMultiTexCoord4s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4s, &args ))) WARN( "glMultiTexCoord4s returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4sARB( GLenum target, GLshort s, GLshort t, GLshort r, GLshort q )
@@ -13705,7 +13705,7 @@ static void WINAPI glMultiTexCoord4sARB( GLenum target, GLshort s, GLshort t, GL
     struct glMultiTexCoord4sARB_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4sARB, &args ))) WARN( "glMultiTexCoord4sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4sARB, &args ))) WARN( "glMultiTexCoord4sARB returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4sSGIS( GLenum target, GLshort s, GLshort t, GLshort r, GLshort q )
@@ -13713,7 +13713,7 @@ static void WINAPI glMultiTexCoord4sSGIS( GLenum target, GLshort s, GLshort t, G
     struct glMultiTexCoord4sSGIS_params args = { .teb = NtCurrentTeb(), .target = target, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "target %d, s %d, t %d, r %d, q %d\n", target, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4sSGIS, &args ))) WARN( "glMultiTexCoord4sSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4sSGIS, &args ))) WARN( "glMultiTexCoord4sSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4sv( GLenum target, const GLshort *v )
@@ -13745,7 +13745,7 @@ static void WINAPI glMultiTexCoord4xOES( GLenum texture, GLfixed s, GLfixed t, G
     struct glMultiTexCoord4xOES_params args = { .teb = NtCurrentTeb(), .texture = texture, .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "texture %d, s %d, t %d, r %d, q %d\n", texture, s, t, r, q );
-    if ((status = UNIX_CALL( glMultiTexCoord4xOES, &args ))) WARN( "glMultiTexCoord4xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoord4xOES, &args ))) WARN( "glMultiTexCoord4xOES returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoord4xvOES( GLenum texture, const GLfixed *coords )
@@ -13761,7 +13761,7 @@ static void WINAPI glMultiTexCoordP1ui( GLenum texture, GLenum type, GLuint coor
     struct glMultiTexCoordP1ui_params args = { .teb = NtCurrentTeb(), .texture = texture, .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "texture %d, type %d, coords %d\n", texture, type, coords );
-    if ((status = UNIX_CALL( glMultiTexCoordP1ui, &args ))) WARN( "glMultiTexCoordP1ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoordP1ui, &args ))) WARN( "glMultiTexCoordP1ui returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoordP1uiv( GLenum texture, GLenum type, const GLuint *coords )
@@ -13777,7 +13777,7 @@ static void WINAPI glMultiTexCoordP2ui( GLenum texture, GLenum type, GLuint coor
     struct glMultiTexCoordP2ui_params args = { .teb = NtCurrentTeb(), .texture = texture, .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "texture %d, type %d, coords %d\n", texture, type, coords );
-    if ((status = UNIX_CALL( glMultiTexCoordP2ui, &args ))) WARN( "glMultiTexCoordP2ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoordP2ui, &args ))) WARN( "glMultiTexCoordP2ui returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoordP2uiv( GLenum texture, GLenum type, const GLuint *coords )
@@ -13793,7 +13793,7 @@ static void WINAPI glMultiTexCoordP3ui( GLenum texture, GLenum type, GLuint coor
     struct glMultiTexCoordP3ui_params args = { .teb = NtCurrentTeb(), .texture = texture, .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "texture %d, type %d, coords %d\n", texture, type, coords );
-    if ((status = UNIX_CALL( glMultiTexCoordP3ui, &args ))) WARN( "glMultiTexCoordP3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoordP3ui, &args ))) WARN( "glMultiTexCoordP3ui returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoordP3uiv( GLenum texture, GLenum type, const GLuint *coords )
@@ -13809,7 +13809,7 @@ static void WINAPI glMultiTexCoordP4ui( GLenum texture, GLenum type, GLuint coor
     struct glMultiTexCoordP4ui_params args = { .teb = NtCurrentTeb(), .texture = texture, .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "texture %d, type %d, coords %d\n", texture, type, coords );
-    if ((status = UNIX_CALL( glMultiTexCoordP4ui, &args ))) WARN( "glMultiTexCoordP4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexCoordP4ui, &args ))) WARN( "glMultiTexCoordP4ui returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexCoordP4uiv( GLenum texture, GLenum type, const GLuint *coords )
@@ -13841,7 +13841,7 @@ static void WINAPI glMultiTexEnvfEXT( GLenum texunit, GLenum target, GLenum pnam
     struct glMultiTexEnvfEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, pname %d, param %f\n", texunit, target, pname, param );
-    if ((status = UNIX_CALL( glMultiTexEnvfEXT, &args ))) WARN( "glMultiTexEnvfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexEnvfEXT, &args ))) WARN( "glMultiTexEnvfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexEnvfvEXT( GLenum texunit, GLenum target, GLenum pname, const GLfloat *params )
@@ -13857,7 +13857,7 @@ static void WINAPI glMultiTexEnviEXT( GLenum texunit, GLenum target, GLenum pnam
     struct glMultiTexEnviEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, pname %d, param %d\n", texunit, target, pname, param );
-    if ((status = UNIX_CALL( glMultiTexEnviEXT, &args ))) WARN( "glMultiTexEnviEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexEnviEXT, &args ))) WARN( "glMultiTexEnviEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexEnvivEXT( GLenum texunit, GLenum target, GLenum pname, const GLint *params )
@@ -13873,7 +13873,7 @@ static void WINAPI glMultiTexGendEXT( GLenum texunit, GLenum coord, GLenum pname
     struct glMultiTexGendEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .coord = coord, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texunit %d, coord %d, pname %d, param %f\n", texunit, coord, pname, param );
-    if ((status = UNIX_CALL( glMultiTexGendEXT, &args ))) WARN( "glMultiTexGendEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexGendEXT, &args ))) WARN( "glMultiTexGendEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexGendvEXT( GLenum texunit, GLenum coord, GLenum pname, const GLdouble *params )
@@ -13889,7 +13889,7 @@ static void WINAPI glMultiTexGenfEXT( GLenum texunit, GLenum coord, GLenum pname
     struct glMultiTexGenfEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .coord = coord, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texunit %d, coord %d, pname %d, param %f\n", texunit, coord, pname, param );
-    if ((status = UNIX_CALL( glMultiTexGenfEXT, &args ))) WARN( "glMultiTexGenfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexGenfEXT, &args ))) WARN( "glMultiTexGenfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexGenfvEXT( GLenum texunit, GLenum coord, GLenum pname, const GLfloat *params )
@@ -13905,7 +13905,7 @@ static void WINAPI glMultiTexGeniEXT( GLenum texunit, GLenum coord, GLenum pname
     struct glMultiTexGeniEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .coord = coord, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texunit %d, coord %d, pname %d, param %d\n", texunit, coord, pname, param );
-    if ((status = UNIX_CALL( glMultiTexGeniEXT, &args ))) WARN( "glMultiTexGeniEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexGeniEXT, &args ))) WARN( "glMultiTexGeniEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexGenivEXT( GLenum texunit, GLenum coord, GLenum pname, const GLint *params )
@@ -13961,7 +13961,7 @@ static void WINAPI glMultiTexParameterfEXT( GLenum texunit, GLenum target, GLenu
     struct glMultiTexParameterfEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, pname %d, param %f\n", texunit, target, pname, param );
-    if ((status = UNIX_CALL( glMultiTexParameterfEXT, &args ))) WARN( "glMultiTexParameterfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexParameterfEXT, &args ))) WARN( "glMultiTexParameterfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexParameterfvEXT( GLenum texunit, GLenum target, GLenum pname, const GLfloat *params )
@@ -13977,7 +13977,7 @@ static void WINAPI glMultiTexParameteriEXT( GLenum texunit, GLenum target, GLenu
     struct glMultiTexParameteriEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, pname %d, param %d\n", texunit, target, pname, param );
-    if ((status = UNIX_CALL( glMultiTexParameteriEXT, &args ))) WARN( "glMultiTexParameteriEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexParameteriEXT, &args ))) WARN( "glMultiTexParameteriEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexParameterivEXT( GLenum texunit, GLenum target, GLenum pname, const GLint *params )
@@ -13993,7 +13993,7 @@ static void WINAPI glMultiTexRenderbufferEXT( GLenum texunit, GLenum target, GLu
     struct glMultiTexRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .texunit = texunit, .target = target, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "texunit %d, target %d, renderbuffer %d\n", texunit, target, renderbuffer );
-    if ((status = UNIX_CALL( glMultiTexRenderbufferEXT, &args ))) WARN( "glMultiTexRenderbufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMultiTexRenderbufferEXT, &args ))) WARN( "glMultiTexRenderbufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glMultiTexSubImage1DEXT( GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels )
@@ -14025,7 +14025,7 @@ static void WINAPI glMulticastBarrierNV(void)
     struct glMulticastBarrierNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glMulticastBarrierNV, &args ))) WARN( "glMulticastBarrierNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMulticastBarrierNV, &args ))) WARN( "glMulticastBarrierNV returned %#lx\n", status );
 }
 
 static void WINAPI glMulticastBlitFramebufferNV( GLuint srcGpu, GLuint dstGpu, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
@@ -14033,7 +14033,7 @@ static void WINAPI glMulticastBlitFramebufferNV( GLuint srcGpu, GLuint dstGpu, G
     struct glMulticastBlitFramebufferNV_params args = { .teb = NtCurrentTeb(), .srcGpu = srcGpu, .dstGpu = dstGpu, .srcX0 = srcX0, .srcY0 = srcY0, .srcX1 = srcX1, .srcY1 = srcY1, .dstX0 = dstX0, .dstY0 = dstY0, .dstX1 = dstX1, .dstY1 = dstY1, .mask = mask, .filter = filter };
     NTSTATUS status;
     TRACE( "srcGpu %d, dstGpu %d, srcX0 %d, srcY0 %d, srcX1 %d, srcY1 %d, dstX0 %d, dstY0 %d, dstX1 %d, dstY1 %d, mask %d, filter %d\n", srcGpu, dstGpu, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
-    if ((status = UNIX_CALL( glMulticastBlitFramebufferNV, &args ))) WARN( "glMulticastBlitFramebufferNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMulticastBlitFramebufferNV, &args ))) WARN( "glMulticastBlitFramebufferNV returned %#lx\n", status );
 }
 
 static void WINAPI glMulticastBufferSubDataNV( GLbitfield gpuMask, GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data )
@@ -14057,7 +14057,7 @@ static void WINAPI glMulticastCopyImageSubDataNV( GLuint srcGpu, GLbitfield dstG
     struct glMulticastCopyImageSubDataNV_params args = { .teb = NtCurrentTeb(), .srcGpu = srcGpu, .dstGpuMask = dstGpuMask, .srcName = srcName, .srcTarget = srcTarget, .srcLevel = srcLevel, .srcX = srcX, .srcY = srcY, .srcZ = srcZ, .dstName = dstName, .dstTarget = dstTarget, .dstLevel = dstLevel, .dstX = dstX, .dstY = dstY, .dstZ = dstZ, .srcWidth = srcWidth, .srcHeight = srcHeight, .srcDepth = srcDepth };
     NTSTATUS status;
     TRACE( "srcGpu %d, dstGpuMask %d, srcName %d, srcTarget %d, srcLevel %d, srcX %d, srcY %d, srcZ %d, dstName %d, dstTarget %d, dstLevel %d, dstX %d, dstY %d, dstZ %d, srcWidth %d, srcHeight %d, srcDepth %d\n", srcGpu, dstGpuMask, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth );
-    if ((status = UNIX_CALL( glMulticastCopyImageSubDataNV, &args ))) WARN( "glMulticastCopyImageSubDataNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMulticastCopyImageSubDataNV, &args ))) WARN( "glMulticastCopyImageSubDataNV returned %#lx\n", status );
 }
 
 static void WINAPI glMulticastFramebufferSampleLocationsfvNV( GLuint gpu, GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v )
@@ -14121,7 +14121,7 @@ static void WINAPI glMulticastViewportPositionWScaleNVX( GLuint gpu, GLuint inde
     struct glMulticastViewportPositionWScaleNVX_params args = { .teb = NtCurrentTeb(), .gpu = gpu, .index = index, .xcoeff = xcoeff, .ycoeff = ycoeff };
     NTSTATUS status;
     TRACE( "gpu %d, index %d, xcoeff %f, ycoeff %f\n", gpu, index, xcoeff, ycoeff );
-    if ((status = UNIX_CALL( glMulticastViewportPositionWScaleNVX, &args ))) WARN( "glMulticastViewportPositionWScaleNVX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMulticastViewportPositionWScaleNVX, &args ))) WARN( "glMulticastViewportPositionWScaleNVX returned %#lx\n", status );
 }
 
 static void WINAPI glMulticastWaitSyncNV( GLuint signalGpu, GLbitfield waitGpuMask )
@@ -14129,7 +14129,7 @@ static void WINAPI glMulticastWaitSyncNV( GLuint signalGpu, GLbitfield waitGpuMa
     struct glMulticastWaitSyncNV_params args = { .teb = NtCurrentTeb(), .signalGpu = signalGpu, .waitGpuMask = waitGpuMask };
     NTSTATUS status;
     TRACE( "signalGpu %d, waitGpuMask %d\n", signalGpu, waitGpuMask );
-    if ((status = UNIX_CALL( glMulticastWaitSyncNV, &args ))) WARN( "glMulticastWaitSyncNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glMulticastWaitSyncNV, &args ))) WARN( "glMulticastWaitSyncNV returned %#lx\n", status );
 }
 
 static void WINAPI glNamedBufferAttachMemoryNV( GLuint buffer, GLuint memory, GLuint64 offset )
@@ -14137,7 +14137,7 @@ static void WINAPI glNamedBufferAttachMemoryNV( GLuint buffer, GLuint memory, GL
     struct glNamedBufferAttachMemoryNV_params args = { .teb = NtCurrentTeb(), .buffer = buffer, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "buffer %d, memory %d, offset %s\n", buffer, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glNamedBufferAttachMemoryNV, &args ))) WARN( "glNamedBufferAttachMemoryNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedBufferAttachMemoryNV, &args ))) WARN( "glNamedBufferAttachMemoryNV returned %#lx\n", status );
 }
 
 static void WINAPI glNamedBufferData( GLuint buffer, GLsizeiptr size, const void *data, GLenum usage )
@@ -14233,7 +14233,7 @@ static void WINAPI glNamedFramebufferDrawBuffer( GLuint framebuffer, GLenum buf
     struct glNamedFramebufferDrawBuffer_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .buf = buf };
     NTSTATUS status;
     TRACE( "framebuffer %d, buf %d\n", framebuffer, buf );
-    if ((status = UNIX_CALL( glNamedFramebufferDrawBuffer, &args ))) WARN( "glNamedFramebufferDrawBuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferDrawBuffer, &args ))) WARN( "glNamedFramebufferDrawBuffer returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferDrawBuffers( GLuint framebuffer, GLsizei n, const GLenum *bufs )
@@ -14249,7 +14249,7 @@ static void WINAPI glNamedFramebufferParameteri( GLuint framebuffer, GLenum pnam
     struct glNamedFramebufferParameteri_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "framebuffer %d, pname %d, param %d\n", framebuffer, pname, param );
-    if ((status = UNIX_CALL( glNamedFramebufferParameteri, &args ))) WARN( "glNamedFramebufferParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferParameteri, &args ))) WARN( "glNamedFramebufferParameteri returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferParameteriEXT( GLuint framebuffer, GLenum pname, GLint param )
@@ -14257,7 +14257,7 @@ static void WINAPI glNamedFramebufferParameteriEXT( GLuint framebuffer, GLenum p
     struct glNamedFramebufferParameteriEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "framebuffer %d, pname %d, param %d\n", framebuffer, pname, param );
-    if ((status = UNIX_CALL( glNamedFramebufferParameteriEXT, &args ))) WARN( "glNamedFramebufferParameteriEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferParameteriEXT, &args ))) WARN( "glNamedFramebufferParameteriEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferReadBuffer( GLuint framebuffer, GLenum src )
@@ -14265,7 +14265,7 @@ static void WINAPI glNamedFramebufferReadBuffer( GLuint framebuffer, GLenum src
     struct glNamedFramebufferReadBuffer_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .src = src };
     NTSTATUS status;
     TRACE( "framebuffer %d, src %d\n", framebuffer, src );
-    if ((status = UNIX_CALL( glNamedFramebufferReadBuffer, &args ))) WARN( "glNamedFramebufferReadBuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferReadBuffer, &args ))) WARN( "glNamedFramebufferReadBuffer returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferRenderbuffer( GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
@@ -14273,7 +14273,7 @@ static void WINAPI glNamedFramebufferRenderbuffer( GLuint framebuffer, GLenum at
     struct glNamedFramebufferRenderbuffer_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .renderbuffertarget = renderbuffertarget, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, renderbuffertarget %d, renderbuffer %d\n", framebuffer, attachment, renderbuffertarget, renderbuffer );
-    if ((status = UNIX_CALL( glNamedFramebufferRenderbuffer, &args ))) WARN( "glNamedFramebufferRenderbuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferRenderbuffer, &args ))) WARN( "glNamedFramebufferRenderbuffer returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferRenderbufferEXT( GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
@@ -14281,7 +14281,7 @@ static void WINAPI glNamedFramebufferRenderbufferEXT( GLuint framebuffer, GLenum
     struct glNamedFramebufferRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .renderbuffertarget = renderbuffertarget, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, renderbuffertarget %d, renderbuffer %d\n", framebuffer, attachment, renderbuffertarget, renderbuffer );
-    if ((status = UNIX_CALL( glNamedFramebufferRenderbufferEXT, &args ))) WARN( "glNamedFramebufferRenderbufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferRenderbufferEXT, &args ))) WARN( "glNamedFramebufferRenderbufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferSampleLocationsfvARB( GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v )
@@ -14313,7 +14313,7 @@ static void WINAPI glNamedFramebufferTexture( GLuint framebuffer, GLenum attachm
     struct glNamedFramebufferTexture_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d\n", framebuffer, attachment, texture, level );
-    if ((status = UNIX_CALL( glNamedFramebufferTexture, &args ))) WARN( "glNamedFramebufferTexture returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferTexture, &args ))) WARN( "glNamedFramebufferTexture returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferTexture1DEXT( GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
@@ -14321,7 +14321,7 @@ static void WINAPI glNamedFramebufferTexture1DEXT( GLuint framebuffer, GLenum at
     struct glNamedFramebufferTexture1DEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, textarget %d, texture %d, level %d\n", framebuffer, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glNamedFramebufferTexture1DEXT, &args ))) WARN( "glNamedFramebufferTexture1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferTexture1DEXT, &args ))) WARN( "glNamedFramebufferTexture1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferTexture2DEXT( GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
@@ -14329,7 +14329,7 @@ static void WINAPI glNamedFramebufferTexture2DEXT( GLuint framebuffer, GLenum at
     struct glNamedFramebufferTexture2DEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, textarget %d, texture %d, level %d\n", framebuffer, attachment, textarget, texture, level );
-    if ((status = UNIX_CALL( glNamedFramebufferTexture2DEXT, &args ))) WARN( "glNamedFramebufferTexture2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferTexture2DEXT, &args ))) WARN( "glNamedFramebufferTexture2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferTexture3DEXT( GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset )
@@ -14337,7 +14337,7 @@ static void WINAPI glNamedFramebufferTexture3DEXT( GLuint framebuffer, GLenum at
     struct glNamedFramebufferTexture3DEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .textarget = textarget, .texture = texture, .level = level, .zoffset = zoffset };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, textarget %d, texture %d, level %d, zoffset %d\n", framebuffer, attachment, textarget, texture, level, zoffset );
-    if ((status = UNIX_CALL( glNamedFramebufferTexture3DEXT, &args ))) WARN( "glNamedFramebufferTexture3DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferTexture3DEXT, &args ))) WARN( "glNamedFramebufferTexture3DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferTextureEXT( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level )
@@ -14345,7 +14345,7 @@ static void WINAPI glNamedFramebufferTextureEXT( GLuint framebuffer, GLenum atta
     struct glNamedFramebufferTextureEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d\n", framebuffer, attachment, texture, level );
-    if ((status = UNIX_CALL( glNamedFramebufferTextureEXT, &args ))) WARN( "glNamedFramebufferTextureEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferTextureEXT, &args ))) WARN( "glNamedFramebufferTextureEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferTextureFaceEXT( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face )
@@ -14353,7 +14353,7 @@ static void WINAPI glNamedFramebufferTextureFaceEXT( GLuint framebuffer, GLenum
     struct glNamedFramebufferTextureFaceEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level, .face = face };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d, face %d\n", framebuffer, attachment, texture, level, face );
-    if ((status = UNIX_CALL( glNamedFramebufferTextureFaceEXT, &args ))) WARN( "glNamedFramebufferTextureFaceEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferTextureFaceEXT, &args ))) WARN( "glNamedFramebufferTextureFaceEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferTextureLayer( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer )
@@ -14361,7 +14361,7 @@ static void WINAPI glNamedFramebufferTextureLayer( GLuint framebuffer, GLenum at
     struct glNamedFramebufferTextureLayer_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d, layer %d\n", framebuffer, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glNamedFramebufferTextureLayer, &args ))) WARN( "glNamedFramebufferTextureLayer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferTextureLayer, &args ))) WARN( "glNamedFramebufferTextureLayer returned %#lx\n", status );
 }
 
 static void WINAPI glNamedFramebufferTextureLayerEXT( GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer )
@@ -14369,7 +14369,7 @@ static void WINAPI glNamedFramebufferTextureLayerEXT( GLuint framebuffer, GLenum
     struct glNamedFramebufferTextureLayerEXT_params args = { .teb = NtCurrentTeb(), .framebuffer = framebuffer, .attachment = attachment, .texture = texture, .level = level, .layer = layer };
     NTSTATUS status;
     TRACE( "framebuffer %d, attachment %d, texture %d, level %d, layer %d\n", framebuffer, attachment, texture, level, layer );
-    if ((status = UNIX_CALL( glNamedFramebufferTextureLayerEXT, &args ))) WARN( "glNamedFramebufferTextureLayerEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedFramebufferTextureLayerEXT, &args ))) WARN( "glNamedFramebufferTextureLayerEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedProgramLocalParameter4dEXT( GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
@@ -14377,7 +14377,7 @@ static void WINAPI glNamedProgramLocalParameter4dEXT( GLuint program, GLenum tar
     struct glNamedProgramLocalParameter4dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, target %d, index %d, x %f, y %f, z %f, w %f\n", program, target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glNamedProgramLocalParameter4dEXT, &args ))) WARN( "glNamedProgramLocalParameter4dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedProgramLocalParameter4dEXT, &args ))) WARN( "glNamedProgramLocalParameter4dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedProgramLocalParameter4dvEXT( GLuint program, GLenum target, GLuint index, const GLdouble *params )
@@ -14393,7 +14393,7 @@ static void WINAPI glNamedProgramLocalParameter4fEXT( GLuint program, GLenum tar
     struct glNamedProgramLocalParameter4fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, target %d, index %d, x %f, y %f, z %f, w %f\n", program, target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glNamedProgramLocalParameter4fEXT, &args ))) WARN( "glNamedProgramLocalParameter4fEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedProgramLocalParameter4fEXT, &args ))) WARN( "glNamedProgramLocalParameter4fEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedProgramLocalParameter4fvEXT( GLuint program, GLenum target, GLuint index, const GLfloat *params )
@@ -14409,7 +14409,7 @@ static void WINAPI glNamedProgramLocalParameterI4iEXT( GLuint program, GLenum ta
     struct glNamedProgramLocalParameterI4iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, target %d, index %d, x %d, y %d, z %d, w %d\n", program, target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glNamedProgramLocalParameterI4iEXT, &args ))) WARN( "glNamedProgramLocalParameterI4iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedProgramLocalParameterI4iEXT, &args ))) WARN( "glNamedProgramLocalParameterI4iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedProgramLocalParameterI4ivEXT( GLuint program, GLenum target, GLuint index, const GLint *params )
@@ -14425,7 +14425,7 @@ static void WINAPI glNamedProgramLocalParameterI4uiEXT( GLuint program, GLenum t
     struct glNamedProgramLocalParameterI4uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, target %d, index %d, x %d, y %d, z %d, w %d\n", program, target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glNamedProgramLocalParameterI4uiEXT, &args ))) WARN( "glNamedProgramLocalParameterI4uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedProgramLocalParameterI4uiEXT, &args ))) WARN( "glNamedProgramLocalParameterI4uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedProgramLocalParameterI4uivEXT( GLuint program, GLenum target, GLuint index, const GLuint *params )
@@ -14473,7 +14473,7 @@ static void WINAPI glNamedRenderbufferStorage( GLuint renderbuffer, GLenum inter
     struct glNamedRenderbufferStorage_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "renderbuffer %d, internalformat %d, width %d, height %d\n", renderbuffer, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorage, &args ))) WARN( "glNamedRenderbufferStorage returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedRenderbufferStorage, &args ))) WARN( "glNamedRenderbufferStorage returned %#lx\n", status );
 }
 
 static void WINAPI glNamedRenderbufferStorageEXT( GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height )
@@ -14481,7 +14481,7 @@ static void WINAPI glNamedRenderbufferStorageEXT( GLuint renderbuffer, GLenum in
     struct glNamedRenderbufferStorageEXT_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "renderbuffer %d, internalformat %d, width %d, height %d\n", renderbuffer, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageEXT, &args ))) WARN( "glNamedRenderbufferStorageEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedRenderbufferStorageEXT, &args ))) WARN( "glNamedRenderbufferStorageEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedRenderbufferStorageMultisample( GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
@@ -14489,7 +14489,7 @@ static void WINAPI glNamedRenderbufferStorageMultisample( GLuint renderbuffer, G
     struct glNamedRenderbufferStorageMultisample_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .samples = samples, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "renderbuffer %d, samples %d, internalformat %d, width %d, height %d\n", renderbuffer, samples, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageMultisample, &args ))) WARN( "glNamedRenderbufferStorageMultisample returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedRenderbufferStorageMultisample, &args ))) WARN( "glNamedRenderbufferStorageMultisample returned %#lx\n", status );
 }
 
 static void WINAPI glNamedRenderbufferStorageMultisampleAdvancedAMD( GLuint renderbuffer, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height )
@@ -14497,7 +14497,7 @@ static void WINAPI glNamedRenderbufferStorageMultisampleAdvancedAMD( GLuint rend
     struct glNamedRenderbufferStorageMultisampleAdvancedAMD_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .samples = samples, .storageSamples = storageSamples, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "renderbuffer %d, samples %d, storageSamples %d, internalformat %d, width %d, height %d\n", renderbuffer, samples, storageSamples, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageMultisampleAdvancedAMD, &args ))) WARN( "glNamedRenderbufferStorageMultisampleAdvancedAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedRenderbufferStorageMultisampleAdvancedAMD, &args ))) WARN( "glNamedRenderbufferStorageMultisampleAdvancedAMD returned %#lx\n", status );
 }
 
 static void WINAPI glNamedRenderbufferStorageMultisampleCoverageEXT( GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height )
@@ -14505,7 +14505,7 @@ static void WINAPI glNamedRenderbufferStorageMultisampleCoverageEXT( GLuint rend
     struct glNamedRenderbufferStorageMultisampleCoverageEXT_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "renderbuffer %d, coverageSamples %d, colorSamples %d, internalformat %d, width %d, height %d\n", renderbuffer, coverageSamples, colorSamples, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageMultisampleCoverageEXT, &args ))) WARN( "glNamedRenderbufferStorageMultisampleCoverageEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedRenderbufferStorageMultisampleCoverageEXT, &args ))) WARN( "glNamedRenderbufferStorageMultisampleCoverageEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedRenderbufferStorageMultisampleEXT( GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
@@ -14513,7 +14513,7 @@ static void WINAPI glNamedRenderbufferStorageMultisampleEXT( GLuint renderbuffer
     struct glNamedRenderbufferStorageMultisampleEXT_params args = { .teb = NtCurrentTeb(), .renderbuffer = renderbuffer, .samples = samples, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "renderbuffer %d, samples %d, internalformat %d, width %d, height %d\n", renderbuffer, samples, internalformat, width, height );
-    if ((status = UNIX_CALL( glNamedRenderbufferStorageMultisampleEXT, &args ))) WARN( "glNamedRenderbufferStorageMultisampleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNamedRenderbufferStorageMultisampleEXT, &args ))) WARN( "glNamedRenderbufferStorageMultisampleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glNamedStringARB( GLenum type, GLint namelen, const GLchar *name, GLint stringlen, const GLchar *string )
@@ -14547,7 +14547,7 @@ static void WINAPI glNormal3fVertex3fSUN( GLfloat nx, GLfloat ny, GLfloat nz, GL
     struct glNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "nx %f, ny %f, nz %f, x %f, y %f, z %f\n", nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glNormal3fVertex3fSUN, &args ))) WARN( "glNormal3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormal3fVertex3fSUN, &args ))) WARN( "glNormal3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glNormal3fVertex3fvSUN( const GLfloat *n, const GLfloat *v )
@@ -14563,7 +14563,7 @@ static void WINAPI glNormal3hNV( GLhalfNV nx, GLhalfNV ny, GLhalfNV nz )
     struct glNormal3hNV_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3hNV, &args ))) WARN( "glNormal3hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormal3hNV, &args ))) WARN( "glNormal3hNV returned %#lx\n", status );
 }
 
 static void WINAPI glNormal3hvNV( const GLhalfNV *v )
@@ -14579,7 +14579,7 @@ static void WINAPI glNormal3xOES( GLfixed nx, GLfixed ny, GLfixed nz )
     struct glNormal3xOES_params args = { .teb = NtCurrentTeb(), .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "nx %d, ny %d, nz %d\n", nx, ny, nz );
-    if ((status = UNIX_CALL( glNormal3xOES, &args ))) WARN( "glNormal3xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormal3xOES, &args ))) WARN( "glNormal3xOES returned %#lx\n", status );
 }
 
 static void WINAPI glNormal3xvOES( const GLfixed *coords )
@@ -14595,7 +14595,7 @@ static void WINAPI glNormalFormatNV( GLenum type, GLsizei stride )
     struct glNormalFormatNV_params args = { .teb = NtCurrentTeb(), .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "type %d, stride %d\n", type, stride );
-    if ((status = UNIX_CALL( glNormalFormatNV, &args ))) WARN( "glNormalFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormalFormatNV, &args ))) WARN( "glNormalFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glNormalP3ui( GLenum type, GLuint coords )
@@ -14603,7 +14603,7 @@ static void WINAPI glNormalP3ui( GLenum type, GLuint coords )
     struct glNormalP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glNormalP3ui, &args ))) WARN( "glNormalP3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormalP3ui, &args ))) WARN( "glNormalP3ui returned %#lx\n", status );
 }
 
 static void WINAPI glNormalP3uiv( GLenum type, const GLuint *coords )
@@ -14643,7 +14643,7 @@ static void WINAPI glNormalStream3bATI( GLenum stream, GLbyte nx, GLbyte ny, GLb
     struct glNormalStream3bATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "stream %d, nx %d, ny %d, nz %d\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3bATI, &args ))) WARN( "glNormalStream3bATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormalStream3bATI, &args ))) WARN( "glNormalStream3bATI returned %#lx\n", status );
 }
 
 static void WINAPI glNormalStream3bvATI( GLenum stream, const GLbyte *coords )
@@ -14659,7 +14659,7 @@ static void WINAPI glNormalStream3dATI( GLenum stream, GLdouble nx, GLdouble ny,
     struct glNormalStream3dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "stream %d, nx %f, ny %f, nz %f\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3dATI, &args ))) WARN( "glNormalStream3dATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormalStream3dATI, &args ))) WARN( "glNormalStream3dATI returned %#lx\n", status );
 }
 
 static void WINAPI glNormalStream3dvATI( GLenum stream, const GLdouble *coords )
@@ -14675,7 +14675,7 @@ static void WINAPI glNormalStream3fATI( GLenum stream, GLfloat nx, GLfloat ny, G
     struct glNormalStream3fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "stream %d, nx %f, ny %f, nz %f\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3fATI, &args ))) WARN( "glNormalStream3fATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormalStream3fATI, &args ))) WARN( "glNormalStream3fATI returned %#lx\n", status );
 }
 
 static void WINAPI glNormalStream3fvATI( GLenum stream, const GLfloat *coords )
@@ -14691,7 +14691,7 @@ static void WINAPI glNormalStream3iATI( GLenum stream, GLint nx, GLint ny, GLint
     struct glNormalStream3iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "stream %d, nx %d, ny %d, nz %d\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3iATI, &args ))) WARN( "glNormalStream3iATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormalStream3iATI, &args ))) WARN( "glNormalStream3iATI returned %#lx\n", status );
 }
 
 static void WINAPI glNormalStream3ivATI( GLenum stream, const GLint *coords )
@@ -14707,7 +14707,7 @@ static void WINAPI glNormalStream3sATI( GLenum stream, GLshort nx, GLshort ny, G
     struct glNormalStream3sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .nx = nx, .ny = ny, .nz = nz };
     NTSTATUS status;
     TRACE( "stream %d, nx %d, ny %d, nz %d\n", stream, nx, ny, nz );
-    if ((status = UNIX_CALL( glNormalStream3sATI, &args ))) WARN( "glNormalStream3sATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glNormalStream3sATI, &args ))) WARN( "glNormalStream3sATI returned %#lx\n", status );
 }
 
 static void WINAPI glNormalStream3svATI( GLenum stream, const GLshort *coords )
@@ -14757,7 +14757,7 @@ static void WINAPI glOrthofOES( GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfl
     struct glOrthofOES_params args = { .teb = NtCurrentTeb(), .l = l, .r = r, .b = b, .t = t, .n = n, .f = f };
     NTSTATUS status;
     TRACE( "l %f, r %f, b %f, t %f, n %f, f %f\n", l, r, b, t, n, f );
-    if ((status = UNIX_CALL( glOrthofOES, &args ))) WARN( "glOrthofOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glOrthofOES, &args ))) WARN( "glOrthofOES returned %#lx\n", status );
 }
 
 static void WINAPI glOrthoxOES( GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f )
@@ -14765,7 +14765,7 @@ static void WINAPI glOrthoxOES( GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfi
     struct glOrthoxOES_params args = { .teb = NtCurrentTeb(), .l = l, .r = r, .b = b, .t = t, .n = n, .f = f };
     NTSTATUS status;
     TRACE( "l %d, r %d, b %d, t %d, n %d, f %d\n", l, r, b, t, n, f );
-    if ((status = UNIX_CALL( glOrthoxOES, &args ))) WARN( "glOrthoxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glOrthoxOES, &args ))) WARN( "glOrthoxOES returned %#lx\n", status );
 }
 
 static void WINAPI glPNTrianglesfATI( GLenum pname, GLfloat param )
@@ -14773,7 +14773,7 @@ static void WINAPI glPNTrianglesfATI( GLenum pname, GLfloat param )
     struct glPNTrianglesfATI_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPNTrianglesfATI, &args ))) WARN( "glPNTrianglesfATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPNTrianglesfATI, &args ))) WARN( "glPNTrianglesfATI returned %#lx\n", status );
 }
 
 static void WINAPI glPNTrianglesiATI( GLenum pname, GLint param )
@@ -14781,7 +14781,7 @@ static void WINAPI glPNTrianglesiATI( GLenum pname, GLint param )
     struct glPNTrianglesiATI_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPNTrianglesiATI, &args ))) WARN( "glPNTrianglesiATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPNTrianglesiATI, &args ))) WARN( "glPNTrianglesiATI returned %#lx\n", status );
 }
 
 static void WINAPI glPassTexCoordATI( GLuint dst, GLuint coord, GLenum swizzle )
@@ -14789,7 +14789,7 @@ static void WINAPI glPassTexCoordATI( GLuint dst, GLuint coord, GLenum swizzle )
     struct glPassTexCoordATI_params args = { .teb = NtCurrentTeb(), .dst = dst, .coord = coord, .swizzle = swizzle };
     NTSTATUS status;
     TRACE( "dst %d, coord %d, swizzle %d\n", dst, coord, swizzle );
-    if ((status = UNIX_CALL( glPassTexCoordATI, &args ))) WARN( "glPassTexCoordATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPassTexCoordATI, &args ))) WARN( "glPassTexCoordATI returned %#lx\n", status );
 }
 
 static void WINAPI glPassThroughxOES( GLfixed token )
@@ -14797,7 +14797,7 @@ static void WINAPI glPassThroughxOES( GLfixed token )
     struct glPassThroughxOES_params args = { .teb = NtCurrentTeb(), .token = token };
     NTSTATUS status;
     TRACE( "token %d\n", token );
-    if ((status = UNIX_CALL( glPassThroughxOES, &args ))) WARN( "glPassThroughxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPassThroughxOES, &args ))) WARN( "glPassThroughxOES returned %#lx\n", status );
 }
 
 static void WINAPI glPatchParameterfv( GLenum pname, const GLfloat *values )
@@ -14813,7 +14813,7 @@ static void WINAPI glPatchParameteri( GLenum pname, GLint value )
     struct glPatchParameteri_params args = { .teb = NtCurrentTeb(), .pname = pname, .value = value };
     NTSTATUS status;
     TRACE( "pname %d, value %d\n", pname, value );
-    if ((status = UNIX_CALL( glPatchParameteri, &args ))) WARN( "glPatchParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPatchParameteri, &args ))) WARN( "glPatchParameteri returned %#lx\n", status );
 }
 
 static void WINAPI glPathColorGenNV( GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat *coeffs )
@@ -14845,7 +14845,7 @@ static void WINAPI glPathCoverDepthFuncNV( GLenum func )
     struct glPathCoverDepthFuncNV_params args = { .teb = NtCurrentTeb(), .func = func };
     NTSTATUS status;
     TRACE( "func %d\n", func );
-    if ((status = UNIX_CALL( glPathCoverDepthFuncNV, &args ))) WARN( "glPathCoverDepthFuncNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPathCoverDepthFuncNV, &args ))) WARN( "glPathCoverDepthFuncNV returned %#lx\n", status );
 }
 
 static void WINAPI glPathDashArrayNV( GLuint path, GLsizei dashCount, const GLfloat *dashArray )
@@ -14861,7 +14861,7 @@ static void WINAPI glPathFogGenNV( GLenum genMode )
     struct glPathFogGenNV_params args = { .teb = NtCurrentTeb(), .genMode = genMode };
     NTSTATUS status;
     TRACE( "genMode %d\n", genMode );
-    if ((status = UNIX_CALL( glPathFogGenNV, &args ))) WARN( "glPathFogGenNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPathFogGenNV, &args ))) WARN( "glPathFogGenNV returned %#lx\n", status );
 }
 
 static GLenum WINAPI glPathGlyphIndexArrayNV( GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale )
@@ -14913,7 +14913,7 @@ static void WINAPI glPathParameterfNV( GLuint path, GLenum pname, GLfloat value
     struct glPathParameterfNV_params args = { .teb = NtCurrentTeb(), .path = path, .pname = pname, .value = value };
     NTSTATUS status;
     TRACE( "path %d, pname %d, value %f\n", path, pname, value );
-    if ((status = UNIX_CALL( glPathParameterfNV, &args ))) WARN( "glPathParameterfNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPathParameterfNV, &args ))) WARN( "glPathParameterfNV returned %#lx\n", status );
 }
 
 static void WINAPI glPathParameterfvNV( GLuint path, GLenum pname, const GLfloat *value )
@@ -14929,7 +14929,7 @@ static void WINAPI glPathParameteriNV( GLuint path, GLenum pname, GLint value )
     struct glPathParameteriNV_params args = { .teb = NtCurrentTeb(), .path = path, .pname = pname, .value = value };
     NTSTATUS status;
     TRACE( "path %d, pname %d, value %d\n", path, pname, value );
-    if ((status = UNIX_CALL( glPathParameteriNV, &args ))) WARN( "glPathParameteriNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPathParameteriNV, &args ))) WARN( "glPathParameteriNV returned %#lx\n", status );
 }
 
 static void WINAPI glPathParameterivNV( GLuint path, GLenum pname, const GLint *value )
@@ -14945,7 +14945,7 @@ static void WINAPI glPathStencilDepthOffsetNV( GLfloat factor, GLfloat units )
     struct glPathStencilDepthOffsetNV_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units };
     NTSTATUS status;
     TRACE( "factor %f, units %f\n", factor, units );
-    if ((status = UNIX_CALL( glPathStencilDepthOffsetNV, &args ))) WARN( "glPathStencilDepthOffsetNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPathStencilDepthOffsetNV, &args ))) WARN( "glPathStencilDepthOffsetNV returned %#lx\n", status );
 }
 
 static void WINAPI glPathStencilFuncNV( GLenum func, GLint ref, GLuint mask )
@@ -14953,7 +14953,7 @@ static void WINAPI glPathStencilFuncNV( GLenum func, GLint ref, GLuint mask )
     struct glPathStencilFuncNV_params args = { .teb = NtCurrentTeb(), .func = func, .ref = ref, .mask = mask };
     NTSTATUS status;
     TRACE( "func %d, ref %d, mask %d\n", func, ref, mask );
-    if ((status = UNIX_CALL( glPathStencilFuncNV, &args ))) WARN( "glPathStencilFuncNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPathStencilFuncNV, &args ))) WARN( "glPathStencilFuncNV returned %#lx\n", status );
 }
 
 static void WINAPI glPathStringNV( GLuint path, GLenum format, GLsizei length, const void *pathString )
@@ -14993,7 +14993,7 @@ static void WINAPI glPauseTransformFeedback(void)
     struct glPauseTransformFeedback_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPauseTransformFeedback, &args ))) WARN( "glPauseTransformFeedback returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPauseTransformFeedback, &args ))) WARN( "glPauseTransformFeedback returned %#lx\n", status );
 }
 
 static void WINAPI glPauseTransformFeedbackNV(void)
@@ -15001,7 +15001,7 @@ static void WINAPI glPauseTransformFeedbackNV(void)
     struct glPauseTransformFeedbackNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPauseTransformFeedbackNV, &args ))) WARN( "glPauseTransformFeedbackNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPauseTransformFeedbackNV, &args ))) WARN( "glPauseTransformFeedbackNV returned %#lx\n", status );
 }
 
 static void WINAPI glPixelDataRangeNV( GLenum target, GLsizei length, const void *pointer )
@@ -15025,7 +15025,7 @@ static void WINAPI glPixelStorex( GLenum pname, GLfixed param )
     struct glPixelStorex_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelStorex, &args ))) WARN( "glPixelStorex returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelStorex, &args ))) WARN( "glPixelStorex returned %#lx\n", status );
 }
 
 static void WINAPI glPixelTexGenParameterfSGIS( GLenum pname, GLfloat param )
@@ -15033,7 +15033,7 @@ static void WINAPI glPixelTexGenParameterfSGIS( GLenum pname, GLfloat param )
     struct glPixelTexGenParameterfSGIS_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTexGenParameterfSGIS, &args ))) WARN( "glPixelTexGenParameterfSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelTexGenParameterfSGIS, &args ))) WARN( "glPixelTexGenParameterfSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glPixelTexGenParameterfvSGIS( GLenum pname, const GLfloat *params )
@@ -15049,7 +15049,7 @@ static void WINAPI glPixelTexGenParameteriSGIS( GLenum pname, GLint param )
     struct glPixelTexGenParameteriSGIS_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTexGenParameteriSGIS, &args ))) WARN( "glPixelTexGenParameteriSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelTexGenParameteriSGIS, &args ))) WARN( "glPixelTexGenParameteriSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glPixelTexGenParameterivSGIS( GLenum pname, const GLint *params )
@@ -15065,7 +15065,7 @@ static void WINAPI glPixelTexGenSGIX( GLenum mode )
     struct glPixelTexGenSGIX_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glPixelTexGenSGIX, &args ))) WARN( "glPixelTexGenSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelTexGenSGIX, &args ))) WARN( "glPixelTexGenSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glPixelTransferxOES( GLenum pname, GLfixed param )
@@ -15073,7 +15073,7 @@ static void WINAPI glPixelTransferxOES( GLenum pname, GLfixed param )
     struct glPixelTransferxOES_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPixelTransferxOES, &args ))) WARN( "glPixelTransferxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelTransferxOES, &args ))) WARN( "glPixelTransferxOES returned %#lx\n", status );
 }
 
 static void WINAPI glPixelTransformParameterfEXT( GLenum target, GLenum pname, GLfloat param )
@@ -15081,7 +15081,7 @@ static void WINAPI glPixelTransformParameterfEXT( GLenum target, GLenum pname, G
     struct glPixelTransformParameterfEXT_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %f\n", target, pname, param );
-    if ((status = UNIX_CALL( glPixelTransformParameterfEXT, &args ))) WARN( "glPixelTransformParameterfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelTransformParameterfEXT, &args ))) WARN( "glPixelTransformParameterfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glPixelTransformParameterfvEXT( GLenum target, GLenum pname, const GLfloat *params )
@@ -15097,7 +15097,7 @@ static void WINAPI glPixelTransformParameteriEXT( GLenum target, GLenum pname, G
     struct glPixelTransformParameteriEXT_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glPixelTransformParameteriEXT, &args ))) WARN( "glPixelTransformParameteriEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelTransformParameteriEXT, &args ))) WARN( "glPixelTransformParameteriEXT returned %#lx\n", status );
 }
 
 static void WINAPI glPixelTransformParameterivEXT( GLenum target, GLenum pname, const GLint *params )
@@ -15113,7 +15113,7 @@ static void WINAPI glPixelZoomxOES( GLfixed xfactor, GLfixed yfactor )
     struct glPixelZoomxOES_params args = { .teb = NtCurrentTeb(), .xfactor = xfactor, .yfactor = yfactor };
     NTSTATUS status;
     TRACE( "xfactor %d, yfactor %d\n", xfactor, yfactor );
-    if ((status = UNIX_CALL( glPixelZoomxOES, &args ))) WARN( "glPixelZoomxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPixelZoomxOES, &args ))) WARN( "glPixelZoomxOES returned %#lx\n", status );
 }
 
 static GLboolean WINAPI glPointAlongPathNV( GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY )
@@ -15130,7 +15130,7 @@ static void WINAPI glPointParameterf( GLenum pname, GLfloat param )
     struct glPointParameterf_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameterf, &args ))) WARN( "glPointParameterf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPointParameterf, &args ))) WARN( "glPointParameterf returned %#lx\n", status );
 }
 
 static void WINAPI glPointParameterfARB( GLenum pname, GLfloat param )
@@ -15138,7 +15138,7 @@ static void WINAPI glPointParameterfARB( GLenum pname, GLfloat param )
     struct glPointParameterfARB_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameterfARB, &args ))) WARN( "glPointParameterfARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPointParameterfARB, &args ))) WARN( "glPointParameterfARB returned %#lx\n", status );
 }
 
 static void WINAPI glPointParameterfEXT( GLenum pname, GLfloat param )
@@ -15146,7 +15146,7 @@ static void WINAPI glPointParameterfEXT( GLenum pname, GLfloat param )
     struct glPointParameterfEXT_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameterfEXT, &args ))) WARN( "glPointParameterfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPointParameterfEXT, &args ))) WARN( "glPointParameterfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glPointParameterfSGIS( GLenum pname, GLfloat param )
@@ -15154,7 +15154,7 @@ static void WINAPI glPointParameterfSGIS( GLenum pname, GLfloat param )
     struct glPointParameterfSGIS_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameterfSGIS, &args ))) WARN( "glPointParameterfSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPointParameterfSGIS, &args ))) WARN( "glPointParameterfSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glPointParameterfv( GLenum pname, const GLfloat *params )
@@ -15194,7 +15194,7 @@ static void WINAPI glPointParameteri( GLenum pname, GLint param )
     struct glPointParameteri_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameteri, &args ))) WARN( "glPointParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPointParameteri, &args ))) WARN( "glPointParameteri returned %#lx\n", status );
 }
 
 static void WINAPI glPointParameteriNV( GLenum pname, GLint param )
@@ -15202,7 +15202,7 @@ static void WINAPI glPointParameteriNV( GLenum pname, GLint param )
     struct glPointParameteriNV_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glPointParameteriNV, &args ))) WARN( "glPointParameteriNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPointParameteriNV, &args ))) WARN( "glPointParameteriNV returned %#lx\n", status );
 }
 
 static void WINAPI glPointParameteriv( GLenum pname, const GLint *params )
@@ -15234,7 +15234,7 @@ static void WINAPI glPointSizexOES( GLfixed size )
     struct glPointSizexOES_params args = { .teb = NtCurrentTeb(), .size = size };
     NTSTATUS status;
     TRACE( "size %d\n", size );
-    if ((status = UNIX_CALL( glPointSizexOES, &args ))) WARN( "glPointSizexOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPointSizexOES, &args ))) WARN( "glPointSizexOES returned %#lx\n", status );
 }
 
 static GLint WINAPI glPollAsyncSGIX( GLuint *markerp )
@@ -15260,7 +15260,7 @@ static void WINAPI glPolygonOffsetClamp( GLfloat factor, GLfloat units, GLfloat
     struct glPolygonOffsetClamp_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units, .clamp = clamp };
     NTSTATUS status;
     TRACE( "factor %f, units %f, clamp %f\n", factor, units, clamp );
-    if ((status = UNIX_CALL( glPolygonOffsetClamp, &args ))) WARN( "glPolygonOffsetClamp returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPolygonOffsetClamp, &args ))) WARN( "glPolygonOffsetClamp returned %#lx\n", status );
 }
 
 static void WINAPI glPolygonOffsetClampEXT( GLfloat factor, GLfloat units, GLfloat clamp )
@@ -15268,7 +15268,7 @@ static void WINAPI glPolygonOffsetClampEXT( GLfloat factor, GLfloat units, GLflo
     struct glPolygonOffsetClampEXT_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units, .clamp = clamp };
     NTSTATUS status;
     TRACE( "factor %f, units %f, clamp %f\n", factor, units, clamp );
-    if ((status = UNIX_CALL( glPolygonOffsetClampEXT, &args ))) WARN( "glPolygonOffsetClampEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPolygonOffsetClampEXT, &args ))) WARN( "glPolygonOffsetClampEXT returned %#lx\n", status );
 }
 
 static void WINAPI glPolygonOffsetEXT( GLfloat factor, GLfloat bias )
@@ -15276,7 +15276,7 @@ static void WINAPI glPolygonOffsetEXT( GLfloat factor, GLfloat bias )
     struct glPolygonOffsetEXT_params args = { .teb = NtCurrentTeb(), .factor = factor, .bias = bias };
     NTSTATUS status;
     TRACE( "factor %f, bias %f\n", factor, bias );
-    if ((status = UNIX_CALL( glPolygonOffsetEXT, &args ))) WARN( "glPolygonOffsetEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPolygonOffsetEXT, &args ))) WARN( "glPolygonOffsetEXT returned %#lx\n", status );
 }
 
 static void WINAPI glPolygonOffsetxOES( GLfixed factor, GLfixed units )
@@ -15284,7 +15284,7 @@ static void WINAPI glPolygonOffsetxOES( GLfixed factor, GLfixed units )
     struct glPolygonOffsetxOES_params args = { .teb = NtCurrentTeb(), .factor = factor, .units = units };
     NTSTATUS status;
     TRACE( "factor %d, units %d\n", factor, units );
-    if ((status = UNIX_CALL( glPolygonOffsetxOES, &args ))) WARN( "glPolygonOffsetxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPolygonOffsetxOES, &args ))) WARN( "glPolygonOffsetxOES returned %#lx\n", status );
 }
 
 static void WINAPI glPopDebugGroup(void)
@@ -15292,7 +15292,7 @@ static void WINAPI glPopDebugGroup(void)
     struct glPopDebugGroup_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopDebugGroup, &args ))) WARN( "glPopDebugGroup returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPopDebugGroup, &args ))) WARN( "glPopDebugGroup returned %#lx\n", status );
 }
 
 static void WINAPI glPopGroupMarkerEXT(void)
@@ -15300,7 +15300,7 @@ static void WINAPI glPopGroupMarkerEXT(void)
     struct glPopGroupMarkerEXT_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPopGroupMarkerEXT, &args ))) WARN( "glPopGroupMarkerEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPopGroupMarkerEXT, &args ))) WARN( "glPopGroupMarkerEXT returned %#lx\n", status );
 }
 
 static void WINAPI glPresentFrameDualFillNV( GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3 )
@@ -15308,7 +15308,7 @@ static void WINAPI glPresentFrameDualFillNV( GLuint video_slot, GLuint64EXT minP
     struct glPresentFrameDualFillNV_params args = { .teb = NtCurrentTeb(), .video_slot = video_slot, .minPresentTime = minPresentTime, .beginPresentTimeId = beginPresentTimeId, .presentDurationId = presentDurationId, .type = type, .target0 = target0, .fill0 = fill0, .target1 = target1, .fill1 = fill1, .target2 = target2, .fill2 = fill2, .target3 = target3, .fill3 = fill3 };
     NTSTATUS status;
     TRACE( "video_slot %d, minPresentTime %s, beginPresentTimeId %d, presentDurationId %d, type %d, target0 %d, fill0 %d, target1 %d, fill1 %d, target2 %d, fill2 %d, target3 %d, fill3 %d\n", video_slot, wine_dbgstr_longlong(minPresentTime), beginPresentTimeId, presentDurationId, type, target0, fill0, target1, fill1, target2, fill2, target3, fill3 );
-    if ((status = UNIX_CALL( glPresentFrameDualFillNV, &args ))) WARN( "glPresentFrameDualFillNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPresentFrameDualFillNV, &args ))) WARN( "glPresentFrameDualFillNV returned %#lx\n", status );
 }
 
 static void WINAPI glPresentFrameKeyedNV( GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1 )
@@ -15316,7 +15316,7 @@ static void WINAPI glPresentFrameKeyedNV( GLuint video_slot, GLuint64EXT minPres
     struct glPresentFrameKeyedNV_params args = { .teb = NtCurrentTeb(), .video_slot = video_slot, .minPresentTime = minPresentTime, .beginPresentTimeId = beginPresentTimeId, .presentDurationId = presentDurationId, .type = type, .target0 = target0, .fill0 = fill0, .key0 = key0, .target1 = target1, .fill1 = fill1, .key1 = key1 };
     NTSTATUS status;
     TRACE( "video_slot %d, minPresentTime %s, beginPresentTimeId %d, presentDurationId %d, type %d, target0 %d, fill0 %d, key0 %d, target1 %d, fill1 %d, key1 %d\n", video_slot, wine_dbgstr_longlong(minPresentTime), beginPresentTimeId, presentDurationId, type, target0, fill0, key0, target1, fill1, key1 );
-    if ((status = UNIX_CALL( glPresentFrameKeyedNV, &args ))) WARN( "glPresentFrameKeyedNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPresentFrameKeyedNV, &args ))) WARN( "glPresentFrameKeyedNV returned %#lx\n", status );
 }
 
 static void WINAPI glPrimitiveBoundingBoxARB( GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW )
@@ -15324,7 +15324,7 @@ static void WINAPI glPrimitiveBoundingBoxARB( GLfloat minX, GLfloat minY, GLfloa
     struct glPrimitiveBoundingBoxARB_params args = { .teb = NtCurrentTeb(), .minX = minX, .minY = minY, .minZ = minZ, .minW = minW, .maxX = maxX, .maxY = maxY, .maxZ = maxZ, .maxW = maxW };
     NTSTATUS status;
     TRACE( "minX %f, minY %f, minZ %f, minW %f, maxX %f, maxY %f, maxZ %f, maxW %f\n", minX, minY, minZ, minW, maxX, maxY, maxZ, maxW );
-    if ((status = UNIX_CALL( glPrimitiveBoundingBoxARB, &args ))) WARN( "glPrimitiveBoundingBoxARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPrimitiveBoundingBoxARB, &args ))) WARN( "glPrimitiveBoundingBoxARB returned %#lx\n", status );
 }
 
 static void WINAPI glPrimitiveRestartIndex( GLuint index )
@@ -15332,7 +15332,7 @@ static void WINAPI glPrimitiveRestartIndex( GLuint index )
     struct glPrimitiveRestartIndex_params args = { .teb = NtCurrentTeb(), .index = index };
     NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glPrimitiveRestartIndex, &args ))) WARN( "glPrimitiveRestartIndex returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPrimitiveRestartIndex, &args ))) WARN( "glPrimitiveRestartIndex returned %#lx\n", status );
 }
 
 static void WINAPI glPrimitiveRestartIndexNV( GLuint index )
@@ -15340,7 +15340,7 @@ static void WINAPI glPrimitiveRestartIndexNV( GLuint index )
     struct glPrimitiveRestartIndexNV_params args = { .teb = NtCurrentTeb(), .index = index };
     NTSTATUS status;
     TRACE( "index %d\n", index );
-    if ((status = UNIX_CALL( glPrimitiveRestartIndexNV, &args ))) WARN( "glPrimitiveRestartIndexNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPrimitiveRestartIndexNV, &args ))) WARN( "glPrimitiveRestartIndexNV returned %#lx\n", status );
 }
 
 static void WINAPI glPrimitiveRestartNV(void)
@@ -15348,7 +15348,7 @@ static void WINAPI glPrimitiveRestartNV(void)
     struct glPrimitiveRestartNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glPrimitiveRestartNV, &args ))) WARN( "glPrimitiveRestartNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPrimitiveRestartNV, &args ))) WARN( "glPrimitiveRestartNV returned %#lx\n", status );
 }
 
 static void WINAPI glPrioritizeTexturesEXT( GLsizei n, const GLuint *textures, const GLclampf *priorities )
@@ -15404,7 +15404,7 @@ static void WINAPI glProgramEnvParameter4dARB( GLenum target, GLuint index, GLdo
     struct glProgramEnvParameter4dARB_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramEnvParameter4dARB, &args ))) WARN( "glProgramEnvParameter4dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramEnvParameter4dARB, &args ))) WARN( "glProgramEnvParameter4dARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramEnvParameter4dvARB( GLenum target, GLuint index, const GLdouble *params )
@@ -15420,7 +15420,7 @@ static void WINAPI glProgramEnvParameter4fARB( GLenum target, GLuint index, GLfl
     struct glProgramEnvParameter4fARB_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramEnvParameter4fARB, &args ))) WARN( "glProgramEnvParameter4fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramEnvParameter4fARB, &args ))) WARN( "glProgramEnvParameter4fARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramEnvParameter4fvARB( GLenum target, GLuint index, const GLfloat *params )
@@ -15436,7 +15436,7 @@ static void WINAPI glProgramEnvParameterI4iNV( GLenum target, GLuint index, GLin
     struct glProgramEnvParameterI4iNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %d, y %d, z %d, w %d\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramEnvParameterI4iNV, &args ))) WARN( "glProgramEnvParameterI4iNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramEnvParameterI4iNV, &args ))) WARN( "glProgramEnvParameterI4iNV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramEnvParameterI4ivNV( GLenum target, GLuint index, const GLint *params )
@@ -15452,7 +15452,7 @@ static void WINAPI glProgramEnvParameterI4uiNV( GLenum target, GLuint index, GLu
     struct glProgramEnvParameterI4uiNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %d, y %d, z %d, w %d\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramEnvParameterI4uiNV, &args ))) WARN( "glProgramEnvParameterI4uiNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramEnvParameterI4uiNV, &args ))) WARN( "glProgramEnvParameterI4uiNV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramEnvParameterI4uivNV( GLenum target, GLuint index, const GLuint *params )
@@ -15492,7 +15492,7 @@ static void WINAPI glProgramLocalParameter4dARB( GLenum target, GLuint index, GL
     struct glProgramLocalParameter4dARB_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramLocalParameter4dARB, &args ))) WARN( "glProgramLocalParameter4dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramLocalParameter4dARB, &args ))) WARN( "glProgramLocalParameter4dARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramLocalParameter4dvARB( GLenum target, GLuint index, const GLdouble *params )
@@ -15508,7 +15508,7 @@ static void WINAPI glProgramLocalParameter4fARB( GLenum target, GLuint index, GL
     struct glProgramLocalParameter4fARB_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramLocalParameter4fARB, &args ))) WARN( "glProgramLocalParameter4fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramLocalParameter4fARB, &args ))) WARN( "glProgramLocalParameter4fARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramLocalParameter4fvARB( GLenum target, GLuint index, const GLfloat *params )
@@ -15524,7 +15524,7 @@ static void WINAPI glProgramLocalParameterI4iNV( GLenum target, GLuint index, GL
     struct glProgramLocalParameterI4iNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %d, y %d, z %d, w %d\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramLocalParameterI4iNV, &args ))) WARN( "glProgramLocalParameterI4iNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramLocalParameterI4iNV, &args ))) WARN( "glProgramLocalParameterI4iNV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramLocalParameterI4ivNV( GLenum target, GLuint index, const GLint *params )
@@ -15540,7 +15540,7 @@ static void WINAPI glProgramLocalParameterI4uiNV( GLenum target, GLuint index, G
     struct glProgramLocalParameterI4uiNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %d, y %d, z %d, w %d\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramLocalParameterI4uiNV, &args ))) WARN( "glProgramLocalParameterI4uiNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramLocalParameterI4uiNV, &args ))) WARN( "glProgramLocalParameterI4uiNV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramLocalParameterI4uivNV( GLenum target, GLuint index, const GLuint *params )
@@ -15612,7 +15612,7 @@ static void WINAPI glProgramParameter4dNV( GLenum target, GLuint index, GLdouble
     struct glProgramParameter4dNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramParameter4dNV, &args ))) WARN( "glProgramParameter4dNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramParameter4dNV, &args ))) WARN( "glProgramParameter4dNV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramParameter4dvNV( GLenum target, GLuint index, const GLdouble *v )
@@ -15628,7 +15628,7 @@ static void WINAPI glProgramParameter4fNV( GLenum target, GLuint index, GLfloat
     struct glProgramParameter4fNV_params args = { .teb = NtCurrentTeb(), .target = target, .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "target %d, index %d, x %f, y %f, z %f, w %f\n", target, index, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramParameter4fNV, &args ))) WARN( "glProgramParameter4fNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramParameter4fNV, &args ))) WARN( "glProgramParameter4fNV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramParameter4fvNV( GLenum target, GLuint index, const GLfloat *v )
@@ -15644,7 +15644,7 @@ static void WINAPI glProgramParameteri( GLuint program, GLenum pname, GLint valu
     struct glProgramParameteri_params args = { .teb = NtCurrentTeb(), .program = program, .pname = pname, .value = value };
     NTSTATUS status;
     TRACE( "program %d, pname %d, value %d\n", program, pname, value );
-    if ((status = UNIX_CALL( glProgramParameteri, &args ))) WARN( "glProgramParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramParameteri, &args ))) WARN( "glProgramParameteri returned %#lx\n", status );
 }
 
 static void WINAPI glProgramParameteriARB( GLuint program, GLenum pname, GLint value )
@@ -15652,7 +15652,7 @@ static void WINAPI glProgramParameteriARB( GLuint program, GLenum pname, GLint v
     struct glProgramParameteriARB_params args = { .teb = NtCurrentTeb(), .program = program, .pname = pname, .value = value };
     NTSTATUS status;
     TRACE( "program %d, pname %d, value %d\n", program, pname, value );
-    if ((status = UNIX_CALL( glProgramParameteriARB, &args ))) WARN( "glProgramParameteriARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramParameteriARB, &args ))) WARN( "glProgramParameteriARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramParameteriEXT( GLuint program, GLenum pname, GLint value )
@@ -15660,7 +15660,7 @@ static void WINAPI glProgramParameteriEXT( GLuint program, GLenum pname, GLint v
     struct glProgramParameteriEXT_params args = { .teb = NtCurrentTeb(), .program = program, .pname = pname, .value = value };
     NTSTATUS status;
     TRACE( "program %d, pname %d, value %d\n", program, pname, value );
-    if ((status = UNIX_CALL( glProgramParameteriEXT, &args ))) WARN( "glProgramParameteriEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramParameteriEXT, &args ))) WARN( "glProgramParameteriEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramParameters4dvNV( GLenum target, GLuint index, GLsizei count, const GLdouble *v )
@@ -15708,7 +15708,7 @@ static void WINAPI glProgramUniform1d( GLuint program, GLint location, GLdouble
     struct glProgramUniform1d_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1d, &args ))) WARN( "glProgramUniform1d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1d, &args ))) WARN( "glProgramUniform1d returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1dEXT( GLuint program, GLint location, GLdouble x )
@@ -15716,7 +15716,7 @@ static void WINAPI glProgramUniform1dEXT( GLuint program, GLint location, GLdoub
     struct glProgramUniform1dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %f\n", program, location, x );
-    if ((status = UNIX_CALL( glProgramUniform1dEXT, &args ))) WARN( "glProgramUniform1dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1dEXT, &args ))) WARN( "glProgramUniform1dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1dv( GLuint program, GLint location, GLsizei count, const GLdouble *value )
@@ -15740,7 +15740,7 @@ static void WINAPI glProgramUniform1f( GLuint program, GLint location, GLfloat v
     struct glProgramUniform1f_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1f, &args ))) WARN( "glProgramUniform1f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1f, &args ))) WARN( "glProgramUniform1f returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1fEXT( GLuint program, GLint location, GLfloat v0 )
@@ -15748,7 +15748,7 @@ static void WINAPI glProgramUniform1fEXT( GLuint program, GLint location, GLfloa
     struct glProgramUniform1fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1fEXT, &args ))) WARN( "glProgramUniform1fEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1fEXT, &args ))) WARN( "glProgramUniform1fEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1fv( GLuint program, GLint location, GLsizei count, const GLfloat *value )
@@ -15772,7 +15772,7 @@ static void WINAPI glProgramUniform1i( GLuint program, GLint location, GLint v0
     struct glProgramUniform1i_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1i, &args ))) WARN( "glProgramUniform1i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1i, &args ))) WARN( "glProgramUniform1i returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1i64ARB( GLuint program, GLint location, GLint64 x )
@@ -15780,7 +15780,7 @@ static void WINAPI glProgramUniform1i64ARB( GLuint program, GLint location, GLin
     struct glProgramUniform1i64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s\n", program, location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glProgramUniform1i64ARB, &args ))) WARN( "glProgramUniform1i64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1i64ARB, &args ))) WARN( "glProgramUniform1i64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1i64NV( GLuint program, GLint location, GLint64EXT x )
@@ -15788,7 +15788,7 @@ static void WINAPI glProgramUniform1i64NV( GLuint program, GLint location, GLint
     struct glProgramUniform1i64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s\n", program, location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glProgramUniform1i64NV, &args ))) WARN( "glProgramUniform1i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1i64NV, &args ))) WARN( "glProgramUniform1i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1i64vARB( GLuint program, GLint location, GLsizei count, const GLint64 *value )
@@ -15812,7 +15812,7 @@ static void WINAPI glProgramUniform1iEXT( GLuint program, GLint location, GLint
     struct glProgramUniform1iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1iEXT, &args ))) WARN( "glProgramUniform1iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1iEXT, &args ))) WARN( "glProgramUniform1iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1iv( GLuint program, GLint location, GLsizei count, const GLint *value )
@@ -15836,7 +15836,7 @@ static void WINAPI glProgramUniform1ui( GLuint program, GLint location, GLuint v
     struct glProgramUniform1ui_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1ui, &args ))) WARN( "glProgramUniform1ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1ui, &args ))) WARN( "glProgramUniform1ui returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1ui64ARB( GLuint program, GLint location, GLuint64 x )
@@ -15844,7 +15844,7 @@ static void WINAPI glProgramUniform1ui64ARB( GLuint program, GLint location, GLu
     struct glProgramUniform1ui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s\n", program, location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glProgramUniform1ui64ARB, &args ))) WARN( "glProgramUniform1ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1ui64ARB, &args ))) WARN( "glProgramUniform1ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1ui64NV( GLuint program, GLint location, GLuint64EXT x )
@@ -15852,7 +15852,7 @@ static void WINAPI glProgramUniform1ui64NV( GLuint program, GLint location, GLui
     struct glProgramUniform1ui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s\n", program, location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glProgramUniform1ui64NV, &args ))) WARN( "glProgramUniform1ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1ui64NV, &args ))) WARN( "glProgramUniform1ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1ui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *value )
@@ -15876,7 +15876,7 @@ static void WINAPI glProgramUniform1uiEXT( GLuint program, GLint location, GLuin
     struct glProgramUniform1uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d\n", program, location, v0 );
-    if ((status = UNIX_CALL( glProgramUniform1uiEXT, &args ))) WARN( "glProgramUniform1uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform1uiEXT, &args ))) WARN( "glProgramUniform1uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform1uiv( GLuint program, GLint location, GLsizei count, const GLuint *value )
@@ -15900,7 +15900,7 @@ static void WINAPI glProgramUniform2d( GLuint program, GLint location, GLdouble
     struct glProgramUniform2d_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2d, &args ))) WARN( "glProgramUniform2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2d, &args ))) WARN( "glProgramUniform2d returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2dEXT( GLuint program, GLint location, GLdouble x, GLdouble y )
@@ -15908,7 +15908,7 @@ static void WINAPI glProgramUniform2dEXT( GLuint program, GLint location, GLdoub
     struct glProgramUniform2dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %f, y %f\n", program, location, x, y );
-    if ((status = UNIX_CALL( glProgramUniform2dEXT, &args ))) WARN( "glProgramUniform2dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2dEXT, &args ))) WARN( "glProgramUniform2dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2dv( GLuint program, GLint location, GLsizei count, const GLdouble *value )
@@ -15932,7 +15932,7 @@ static void WINAPI glProgramUniform2f( GLuint program, GLint location, GLfloat v
     struct glProgramUniform2f_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2f, &args ))) WARN( "glProgramUniform2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2f, &args ))) WARN( "glProgramUniform2f returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2fEXT( GLuint program, GLint location, GLfloat v0, GLfloat v1 )
@@ -15940,7 +15940,7 @@ static void WINAPI glProgramUniform2fEXT( GLuint program, GLint location, GLfloa
     struct glProgramUniform2fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2fEXT, &args ))) WARN( "glProgramUniform2fEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2fEXT, &args ))) WARN( "glProgramUniform2fEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2fv( GLuint program, GLint location, GLsizei count, const GLfloat *value )
@@ -15964,7 +15964,7 @@ static void WINAPI glProgramUniform2i( GLuint program, GLint location, GLint v0,
     struct glProgramUniform2i_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2i, &args ))) WARN( "glProgramUniform2i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2i, &args ))) WARN( "glProgramUniform2i returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2i64ARB( GLuint program, GLint location, GLint64 x, GLint64 y )
@@ -15972,7 +15972,7 @@ static void WINAPI glProgramUniform2i64ARB( GLuint program, GLint location, GLin
     struct glProgramUniform2i64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glProgramUniform2i64ARB, &args ))) WARN( "glProgramUniform2i64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2i64ARB, &args ))) WARN( "glProgramUniform2i64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2i64NV( GLuint program, GLint location, GLint64EXT x, GLint64EXT y )
@@ -15980,7 +15980,7 @@ static void WINAPI glProgramUniform2i64NV( GLuint program, GLint location, GLint
     struct glProgramUniform2i64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glProgramUniform2i64NV, &args ))) WARN( "glProgramUniform2i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2i64NV, &args ))) WARN( "glProgramUniform2i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2i64vARB( GLuint program, GLint location, GLsizei count, const GLint64 *value )
@@ -16004,7 +16004,7 @@ static void WINAPI glProgramUniform2iEXT( GLuint program, GLint location, GLint
     struct glProgramUniform2iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2iEXT, &args ))) WARN( "glProgramUniform2iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2iEXT, &args ))) WARN( "glProgramUniform2iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2iv( GLuint program, GLint location, GLsizei count, const GLint *value )
@@ -16028,7 +16028,7 @@ static void WINAPI glProgramUniform2ui( GLuint program, GLint location, GLuint v
     struct glProgramUniform2ui_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2ui, &args ))) WARN( "glProgramUniform2ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2ui, &args ))) WARN( "glProgramUniform2ui returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2ui64ARB( GLuint program, GLint location, GLuint64 x, GLuint64 y )
@@ -16036,7 +16036,7 @@ static void WINAPI glProgramUniform2ui64ARB( GLuint program, GLint location, GLu
     struct glProgramUniform2ui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glProgramUniform2ui64ARB, &args ))) WARN( "glProgramUniform2ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2ui64ARB, &args ))) WARN( "glProgramUniform2ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2ui64NV( GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y )
@@ -16044,7 +16044,7 @@ static void WINAPI glProgramUniform2ui64NV( GLuint program, GLint location, GLui
     struct glProgramUniform2ui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glProgramUniform2ui64NV, &args ))) WARN( "glProgramUniform2ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2ui64NV, &args ))) WARN( "glProgramUniform2ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2ui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *value )
@@ -16068,7 +16068,7 @@ static void WINAPI glProgramUniform2uiEXT( GLuint program, GLint location, GLuin
     struct glProgramUniform2uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d\n", program, location, v0, v1 );
-    if ((status = UNIX_CALL( glProgramUniform2uiEXT, &args ))) WARN( "glProgramUniform2uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform2uiEXT, &args ))) WARN( "glProgramUniform2uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform2uiv( GLuint program, GLint location, GLsizei count, const GLuint *value )
@@ -16092,7 +16092,7 @@ static void WINAPI glProgramUniform3d( GLuint program, GLint location, GLdouble
     struct glProgramUniform3d_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3d, &args ))) WARN( "glProgramUniform3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3d, &args ))) WARN( "glProgramUniform3d returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3dEXT( GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z )
@@ -16100,7 +16100,7 @@ static void WINAPI glProgramUniform3dEXT( GLuint program, GLint location, GLdoub
     struct glProgramUniform3dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %f, y %f, z %f\n", program, location, x, y, z );
-    if ((status = UNIX_CALL( glProgramUniform3dEXT, &args ))) WARN( "glProgramUniform3dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3dEXT, &args ))) WARN( "glProgramUniform3dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3dv( GLuint program, GLint location, GLsizei count, const GLdouble *value )
@@ -16124,7 +16124,7 @@ static void WINAPI glProgramUniform3f( GLuint program, GLint location, GLfloat v
     struct glProgramUniform3f_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3f, &args ))) WARN( "glProgramUniform3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3f, &args ))) WARN( "glProgramUniform3f returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3fEXT( GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
@@ -16132,7 +16132,7 @@ static void WINAPI glProgramUniform3fEXT( GLuint program, GLint location, GLfloa
     struct glProgramUniform3fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3fEXT, &args ))) WARN( "glProgramUniform3fEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3fEXT, &args ))) WARN( "glProgramUniform3fEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3fv( GLuint program, GLint location, GLsizei count, const GLfloat *value )
@@ -16156,7 +16156,7 @@ static void WINAPI glProgramUniform3i( GLuint program, GLint location, GLint v0,
     struct glProgramUniform3i_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3i, &args ))) WARN( "glProgramUniform3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3i, &args ))) WARN( "glProgramUniform3i returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3i64ARB( GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z )
@@ -16164,7 +16164,7 @@ static void WINAPI glProgramUniform3i64ARB( GLuint program, GLint location, GLin
     struct glProgramUniform3i64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glProgramUniform3i64ARB, &args ))) WARN( "glProgramUniform3i64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3i64ARB, &args ))) WARN( "glProgramUniform3i64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3i64NV( GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z )
@@ -16172,7 +16172,7 @@ static void WINAPI glProgramUniform3i64NV( GLuint program, GLint location, GLint
     struct glProgramUniform3i64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glProgramUniform3i64NV, &args ))) WARN( "glProgramUniform3i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3i64NV, &args ))) WARN( "glProgramUniform3i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3i64vARB( GLuint program, GLint location, GLsizei count, const GLint64 *value )
@@ -16196,7 +16196,7 @@ static void WINAPI glProgramUniform3iEXT( GLuint program, GLint location, GLint
     struct glProgramUniform3iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3iEXT, &args ))) WARN( "glProgramUniform3iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3iEXT, &args ))) WARN( "glProgramUniform3iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3iv( GLuint program, GLint location, GLsizei count, const GLint *value )
@@ -16220,7 +16220,7 @@ static void WINAPI glProgramUniform3ui( GLuint program, GLint location, GLuint v
     struct glProgramUniform3ui_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3ui, &args ))) WARN( "glProgramUniform3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3ui, &args ))) WARN( "glProgramUniform3ui returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3ui64ARB( GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z )
@@ -16228,7 +16228,7 @@ static void WINAPI glProgramUniform3ui64ARB( GLuint program, GLint location, GLu
     struct glProgramUniform3ui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glProgramUniform3ui64ARB, &args ))) WARN( "glProgramUniform3ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3ui64ARB, &args ))) WARN( "glProgramUniform3ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3ui64NV( GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z )
@@ -16236,7 +16236,7 @@ static void WINAPI glProgramUniform3ui64NV( GLuint program, GLint location, GLui
     struct glProgramUniform3ui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glProgramUniform3ui64NV, &args ))) WARN( "glProgramUniform3ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3ui64NV, &args ))) WARN( "glProgramUniform3ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3ui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *value )
@@ -16260,7 +16260,7 @@ static void WINAPI glProgramUniform3uiEXT( GLuint program, GLint location, GLuin
     struct glProgramUniform3uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d\n", program, location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glProgramUniform3uiEXT, &args ))) WARN( "glProgramUniform3uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform3uiEXT, &args ))) WARN( "glProgramUniform3uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform3uiv( GLuint program, GLint location, GLsizei count, const GLuint *value )
@@ -16284,7 +16284,7 @@ static void WINAPI glProgramUniform4d( GLuint program, GLint location, GLdouble
     struct glProgramUniform4d_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4d, &args ))) WARN( "glProgramUniform4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4d, &args ))) WARN( "glProgramUniform4d returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4dEXT( GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
@@ -16292,7 +16292,7 @@ static void WINAPI glProgramUniform4dEXT( GLuint program, GLint location, GLdoub
     struct glProgramUniform4dEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %f, y %f, z %f, w %f\n", program, location, x, y, z, w );
-    if ((status = UNIX_CALL( glProgramUniform4dEXT, &args ))) WARN( "glProgramUniform4dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4dEXT, &args ))) WARN( "glProgramUniform4dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4dv( GLuint program, GLint location, GLsizei count, const GLdouble *value )
@@ -16316,7 +16316,7 @@ static void WINAPI glProgramUniform4f( GLuint program, GLint location, GLfloat v
     struct glProgramUniform4f_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4f, &args ))) WARN( "glProgramUniform4f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4f, &args ))) WARN( "glProgramUniform4f returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4fEXT( GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
@@ -16324,7 +16324,7 @@ static void WINAPI glProgramUniform4fEXT( GLuint program, GLint location, GLfloa
     struct glProgramUniform4fEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4fEXT, &args ))) WARN( "glProgramUniform4fEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4fEXT, &args ))) WARN( "glProgramUniform4fEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4fv( GLuint program, GLint location, GLsizei count, const GLfloat *value )
@@ -16348,7 +16348,7 @@ static void WINAPI glProgramUniform4i( GLuint program, GLint location, GLint v0,
     struct glProgramUniform4i_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4i, &args ))) WARN( "glProgramUniform4i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4i, &args ))) WARN( "glProgramUniform4i returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4i64ARB( GLuint program, GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w )
@@ -16356,7 +16356,7 @@ static void WINAPI glProgramUniform4i64ARB( GLuint program, GLint location, GLin
     struct glProgramUniform4i64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s, w %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glProgramUniform4i64ARB, &args ))) WARN( "glProgramUniform4i64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4i64ARB, &args ))) WARN( "glProgramUniform4i64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4i64NV( GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w )
@@ -16364,7 +16364,7 @@ static void WINAPI glProgramUniform4i64NV( GLuint program, GLint location, GLint
     struct glProgramUniform4i64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s, w %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glProgramUniform4i64NV, &args ))) WARN( "glProgramUniform4i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4i64NV, &args ))) WARN( "glProgramUniform4i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4i64vARB( GLuint program, GLint location, GLsizei count, const GLint64 *value )
@@ -16388,7 +16388,7 @@ static void WINAPI glProgramUniform4iEXT( GLuint program, GLint location, GLint
     struct glProgramUniform4iEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4iEXT, &args ))) WARN( "glProgramUniform4iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4iEXT, &args ))) WARN( "glProgramUniform4iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4iv( GLuint program, GLint location, GLsizei count, const GLint *value )
@@ -16412,7 +16412,7 @@ static void WINAPI glProgramUniform4ui( GLuint program, GLint location, GLuint v
     struct glProgramUniform4ui_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4ui, &args ))) WARN( "glProgramUniform4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4ui, &args ))) WARN( "glProgramUniform4ui returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4ui64ARB( GLuint program, GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w )
@@ -16420,7 +16420,7 @@ static void WINAPI glProgramUniform4ui64ARB( GLuint program, GLint location, GLu
     struct glProgramUniform4ui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s, w %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glProgramUniform4ui64ARB, &args ))) WARN( "glProgramUniform4ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4ui64ARB, &args ))) WARN( "glProgramUniform4ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4ui64NV( GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w )
@@ -16428,7 +16428,7 @@ static void WINAPI glProgramUniform4ui64NV( GLuint program, GLint location, GLui
     struct glProgramUniform4ui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "program %d, location %d, x %s, y %s, z %s, w %s\n", program, location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glProgramUniform4ui64NV, &args ))) WARN( "glProgramUniform4ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4ui64NV, &args ))) WARN( "glProgramUniform4ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4ui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *value )
@@ -16452,7 +16452,7 @@ static void WINAPI glProgramUniform4uiEXT( GLuint program, GLint location, GLuin
     struct glProgramUniform4uiEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "program %d, location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", program, location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glProgramUniform4uiEXT, &args ))) WARN( "glProgramUniform4uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniform4uiEXT, &args ))) WARN( "glProgramUniform4uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniform4uiv( GLuint program, GLint location, GLsizei count, const GLuint *value )
@@ -16476,7 +16476,7 @@ static void WINAPI glProgramUniformHandleui64ARB( GLuint program, GLint location
     struct glProgramUniformHandleui64ARB_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .value = value };
     NTSTATUS status;
     TRACE( "program %d, location %d, value %s\n", program, location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glProgramUniformHandleui64ARB, &args ))) WARN( "glProgramUniformHandleui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniformHandleui64ARB, &args ))) WARN( "glProgramUniformHandleui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniformHandleui64NV( GLuint program, GLint location, GLuint64 value )
@@ -16484,7 +16484,7 @@ static void WINAPI glProgramUniformHandleui64NV( GLuint program, GLint location,
     struct glProgramUniformHandleui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .value = value };
     NTSTATUS status;
     TRACE( "program %d, location %d, value %s\n", program, location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glProgramUniformHandleui64NV, &args ))) WARN( "glProgramUniformHandleui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniformHandleui64NV, &args ))) WARN( "glProgramUniformHandleui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniformHandleui64vARB( GLuint program, GLint location, GLsizei count, const GLuint64 *values )
@@ -16796,7 +16796,7 @@ static void WINAPI glProgramUniformui64NV( GLuint program, GLint location, GLuin
     struct glProgramUniformui64NV_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .value = value };
     NTSTATUS status;
     TRACE( "program %d, location %d, value %s\n", program, location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glProgramUniformui64NV, &args ))) WARN( "glProgramUniformui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramUniformui64NV, &args ))) WARN( "glProgramUniformui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glProgramUniformui64vNV( GLuint program, GLint location, GLsizei count, const GLuint64EXT *value )
@@ -16812,7 +16812,7 @@ static void WINAPI glProgramVertexLimitNV( GLenum target, GLint limit )
     struct glProgramVertexLimitNV_params args = { .teb = NtCurrentTeb(), .target = target, .limit = limit };
     NTSTATUS status;
     TRACE( "target %d, limit %d\n", target, limit );
-    if ((status = UNIX_CALL( glProgramVertexLimitNV, &args ))) WARN( "glProgramVertexLimitNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProgramVertexLimitNV, &args ))) WARN( "glProgramVertexLimitNV returned %#lx\n", status );
 }
 
 static void WINAPI glProvokingVertex( GLenum mode )
@@ -16820,7 +16820,7 @@ static void WINAPI glProvokingVertex( GLenum mode )
     struct glProvokingVertex_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glProvokingVertex, &args ))) WARN( "glProvokingVertex returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProvokingVertex, &args ))) WARN( "glProvokingVertex returned %#lx\n", status );
 }
 
 static void WINAPI glProvokingVertexEXT( GLenum mode )
@@ -16828,7 +16828,7 @@ static void WINAPI glProvokingVertexEXT( GLenum mode )
     struct glProvokingVertexEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glProvokingVertexEXT, &args ))) WARN( "glProvokingVertexEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glProvokingVertexEXT, &args ))) WARN( "glProvokingVertexEXT returned %#lx\n", status );
 }
 
 static void WINAPI glPushClientAttribDefaultEXT( GLbitfield mask )
@@ -16836,7 +16836,7 @@ static void WINAPI glPushClientAttribDefaultEXT( GLbitfield mask )
     struct glPushClientAttribDefaultEXT_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glPushClientAttribDefaultEXT, &args ))) WARN( "glPushClientAttribDefaultEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glPushClientAttribDefaultEXT, &args ))) WARN( "glPushClientAttribDefaultEXT returned %#lx\n", status );
 }
 
 static void WINAPI glPushDebugGroup( GLenum source, GLuint id, GLsizei length, const GLchar *message )
@@ -16860,7 +16860,7 @@ static void WINAPI glQueryCounter( GLuint id, GLenum target )
     struct glQueryCounter_params args = { .teb = NtCurrentTeb(), .id = id, .target = target };
     NTSTATUS status;
     TRACE( "id %d, target %d\n", id, target );
-    if ((status = UNIX_CALL( glQueryCounter, &args ))) WARN( "glQueryCounter returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glQueryCounter, &args ))) WARN( "glQueryCounter returned %#lx\n", status );
 }
 
 static GLbitfield WINAPI glQueryMatrixxOES( GLfixed *mantissa, GLint *exponent )
@@ -16877,7 +16877,7 @@ static void WINAPI glQueryObjectParameteruiAMD( GLenum target, GLuint id, GLenum
     struct glQueryObjectParameteruiAMD_params args = { .teb = NtCurrentTeb(), .target = target, .id = id, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, id %d, pname %d, param %d\n", target, id, pname, param );
-    if ((status = UNIX_CALL( glQueryObjectParameteruiAMD, &args ))) WARN( "glQueryObjectParameteruiAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glQueryObjectParameteruiAMD, &args ))) WARN( "glQueryObjectParameteruiAMD returned %#lx\n", status );
 }
 
 static GLint WINAPI glQueryResourceNV( GLenum queryType, GLint tagId, GLuint count, GLint *buffer )
@@ -16902,7 +16902,7 @@ static void WINAPI glRasterPos2xOES( GLfixed x, GLfixed y )
     struct glRasterPos2xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glRasterPos2xOES, &args ))) WARN( "glRasterPos2xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos2xOES, &args ))) WARN( "glRasterPos2xOES returned %#lx\n", status );
 }
 
 static void WINAPI glRasterPos2xvOES( const GLfixed *coords )
@@ -16918,7 +16918,7 @@ static void WINAPI glRasterPos3xOES( GLfixed x, GLfixed y, GLfixed z )
     struct glRasterPos3xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glRasterPos3xOES, &args ))) WARN( "glRasterPos3xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos3xOES, &args ))) WARN( "glRasterPos3xOES returned %#lx\n", status );
 }
 
 static void WINAPI glRasterPos3xvOES( const GLfixed *coords )
@@ -16934,7 +16934,7 @@ static void WINAPI glRasterPos4xOES( GLfixed x, GLfixed y, GLfixed z, GLfixed w
     struct glRasterPos4xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glRasterPos4xOES, &args ))) WARN( "glRasterPos4xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterPos4xOES, &args ))) WARN( "glRasterPos4xOES returned %#lx\n", status );
 }
 
 static void WINAPI glRasterPos4xvOES( const GLfixed *coords )
@@ -16950,7 +16950,7 @@ static void WINAPI glRasterSamplesEXT( GLuint samples, GLboolean fixedsampleloca
     struct glRasterSamplesEXT_params args = { .teb = NtCurrentTeb(), .samples = samples, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "samples %d, fixedsamplelocations %d\n", samples, fixedsamplelocations );
-    if ((status = UNIX_CALL( glRasterSamplesEXT, &args ))) WARN( "glRasterSamplesEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRasterSamplesEXT, &args ))) WARN( "glRasterSamplesEXT returned %#lx\n", status );
 }
 
 static void WINAPI glReadBufferRegion( GLenum region, GLint x, GLint y, GLsizei width, GLsizei height )
@@ -16958,7 +16958,7 @@ static void WINAPI glReadBufferRegion( GLenum region, GLint x, GLint y, GLsizei
     struct glReadBufferRegion_params args = { .teb = NtCurrentTeb(), .region = region, .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "region %d, x %d, y %d, width %d, height %d\n", region, x, y, width, height );
-    if ((status = UNIX_CALL( glReadBufferRegion, &args ))) WARN( "glReadBufferRegion returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReadBufferRegion, &args ))) WARN( "glReadBufferRegion returned %#lx\n", status );
 }
 
 static void WINAPI glReadInstrumentsSGIX( GLint marker )
@@ -16966,7 +16966,7 @@ static void WINAPI glReadInstrumentsSGIX( GLint marker )
     struct glReadInstrumentsSGIX_params args = { .teb = NtCurrentTeb(), .marker = marker };
     NTSTATUS status;
     TRACE( "marker %d\n", marker );
-    if ((status = UNIX_CALL( glReadInstrumentsSGIX, &args ))) WARN( "glReadInstrumentsSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReadInstrumentsSGIX, &args ))) WARN( "glReadInstrumentsSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glReadnPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data )
@@ -16990,7 +16990,7 @@ static void WINAPI glRectxOES( GLfixed x1, GLfixed y1, GLfixed x2, GLfixed y2 )
     struct glRectxOES_params args = { .teb = NtCurrentTeb(), .x1 = x1, .y1 = y1, .x2 = x2, .y2 = y2 };
     NTSTATUS status;
     TRACE( "x1 %d, y1 %d, x2 %d, y2 %d\n", x1, y1, x2, y2 );
-    if ((status = UNIX_CALL( glRectxOES, &args ))) WARN( "glRectxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRectxOES, &args ))) WARN( "glRectxOES returned %#lx\n", status );
 }
 
 static void WINAPI glRectxvOES( const GLfixed *v1, const GLfixed *v2 )
@@ -17023,7 +17023,7 @@ static void WINAPI glReleaseShaderCompiler(void)
     struct glReleaseShaderCompiler_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glReleaseShaderCompiler, &args ))) WARN( "glReleaseShaderCompiler returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReleaseShaderCompiler, &args ))) WARN( "glReleaseShaderCompiler returned %#lx\n", status );
 }
 
 static void WINAPI glRenderGpuMaskNV( GLbitfield mask )
@@ -17031,7 +17031,7 @@ static void WINAPI glRenderGpuMaskNV( GLbitfield mask )
     struct glRenderGpuMaskNV_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glRenderGpuMaskNV, &args ))) WARN( "glRenderGpuMaskNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRenderGpuMaskNV, &args ))) WARN( "glRenderGpuMaskNV returned %#lx\n", status );
 }
 
 static void WINAPI glRenderbufferStorage( GLenum target, GLenum internalformat, GLsizei width, GLsizei height )
@@ -17039,7 +17039,7 @@ static void WINAPI glRenderbufferStorage( GLenum target, GLenum internalformat,
     struct glRenderbufferStorage_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, width %d, height %d\n", target, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorage, &args ))) WARN( "glRenderbufferStorage returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRenderbufferStorage, &args ))) WARN( "glRenderbufferStorage returned %#lx\n", status );
 }
 
 static void WINAPI glRenderbufferStorageEXT( GLenum target, GLenum internalformat, GLsizei width, GLsizei height )
@@ -17047,7 +17047,7 @@ static void WINAPI glRenderbufferStorageEXT( GLenum target, GLenum internalforma
     struct glRenderbufferStorageEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, width %d, height %d\n", target, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageEXT, &args ))) WARN( "glRenderbufferStorageEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRenderbufferStorageEXT, &args ))) WARN( "glRenderbufferStorageEXT returned %#lx\n", status );
 }
 
 static void WINAPI glRenderbufferStorageMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
@@ -17055,7 +17055,7 @@ static void WINAPI glRenderbufferStorageMultisample( GLenum target, GLsizei samp
     struct glRenderbufferStorageMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d\n", target, samples, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageMultisample, &args ))) WARN( "glRenderbufferStorageMultisample returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRenderbufferStorageMultisample, &args ))) WARN( "glRenderbufferStorageMultisample returned %#lx\n", status );
 }
 
 static void WINAPI glRenderbufferStorageMultisampleAdvancedAMD( GLenum target, GLsizei samples, GLsizei storageSamples, GLenum internalformat, GLsizei width, GLsizei height )
@@ -17063,7 +17063,7 @@ static void WINAPI glRenderbufferStorageMultisampleAdvancedAMD( GLenum target, G
     struct glRenderbufferStorageMultisampleAdvancedAMD_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .storageSamples = storageSamples, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, samples %d, storageSamples %d, internalformat %d, width %d, height %d\n", target, samples, storageSamples, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageMultisampleAdvancedAMD, &args ))) WARN( "glRenderbufferStorageMultisampleAdvancedAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRenderbufferStorageMultisampleAdvancedAMD, &args ))) WARN( "glRenderbufferStorageMultisampleAdvancedAMD returned %#lx\n", status );
 }
 
 static void WINAPI glRenderbufferStorageMultisampleCoverageNV( GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height )
@@ -17071,7 +17071,7 @@ static void WINAPI glRenderbufferStorageMultisampleCoverageNV( GLenum target, GL
     struct glRenderbufferStorageMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, coverageSamples %d, colorSamples %d, internalformat %d, width %d, height %d\n", target, coverageSamples, colorSamples, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageMultisampleCoverageNV, &args ))) WARN( "glRenderbufferStorageMultisampleCoverageNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRenderbufferStorageMultisampleCoverageNV, &args ))) WARN( "glRenderbufferStorageMultisampleCoverageNV returned %#lx\n", status );
 }
 
 static void WINAPI glRenderbufferStorageMultisampleEXT( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
@@ -17079,7 +17079,7 @@ static void WINAPI glRenderbufferStorageMultisampleEXT( GLenum target, GLsizei s
     struct glRenderbufferStorageMultisampleEXT_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d\n", target, samples, internalformat, width, height );
-    if ((status = UNIX_CALL( glRenderbufferStorageMultisampleEXT, &args ))) WARN( "glRenderbufferStorageMultisampleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRenderbufferStorageMultisampleEXT, &args ))) WARN( "glRenderbufferStorageMultisampleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodePointerSUN( GLenum type, GLsizei stride, const void **pointer )
@@ -17095,7 +17095,7 @@ static void WINAPI glReplacementCodeubSUN( GLubyte code )
     struct glReplacementCodeubSUN_params args = { .teb = NtCurrentTeb(), .code = code };
     NTSTATUS status;
     TRACE( "code %d\n", code );
-    if ((status = UNIX_CALL( glReplacementCodeubSUN, &args ))) WARN( "glReplacementCodeubSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeubSUN, &args ))) WARN( "glReplacementCodeubSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeubvSUN( const GLubyte *code )
@@ -17111,7 +17111,7 @@ static void WINAPI glReplacementCodeuiColor3fVertex3fSUN( GLuint rc, GLfloat r,
     struct glReplacementCodeuiColor3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .r = r, .g = g, .b = b, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "rc %d, r %f, g %f, b %f, x %f, y %f, z %f\n", rc, r, g, b, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiColor3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiColor3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiColor3fVertex3fvSUN( const GLuint *rc, const GLfloat *c, const GLfloat *v )
@@ -17127,7 +17127,7 @@ static void WINAPI glReplacementCodeuiColor4fNormal3fVertex3fSUN( GLuint rc, GLf
     struct glReplacementCodeuiColor4fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "rc %d, r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", rc, r, g, b, a, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiColor4fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor4fNormal3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiColor4fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor4fNormal3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiColor4fNormal3fVertex3fvSUN( const GLuint *rc, const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -17143,7 +17143,7 @@ static void WINAPI glReplacementCodeuiColor4ubVertex3fSUN( GLuint rc, GLubyte r,
     struct glReplacementCodeuiColor4ubVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .r = r, .g = g, .b = b, .a = a, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "rc %d, r %d, g %d, b %d, a %d, x %f, y %f, z %f\n", rc, r, g, b, a, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiColor4ubVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor4ubVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiColor4ubVertex3fSUN, &args ))) WARN( "glReplacementCodeuiColor4ubVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiColor4ubVertex3fvSUN( const GLuint *rc, const GLubyte *c, const GLfloat *v )
@@ -17159,7 +17159,7 @@ static void WINAPI glReplacementCodeuiNormal3fVertex3fSUN( GLuint rc, GLfloat nx
     struct glReplacementCodeuiNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "rc %d, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", rc, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiNormal3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiNormal3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiNormal3fVertex3fvSUN( const GLuint *rc, const GLfloat *n, const GLfloat *v )
@@ -17175,7 +17175,7 @@ static void WINAPI glReplacementCodeuiSUN( GLuint code )
     struct glReplacementCodeuiSUN_params args = { .teb = NtCurrentTeb(), .code = code };
     NTSTATUS status;
     TRACE( "code %d\n", code );
-    if ((status = UNIX_CALL( glReplacementCodeuiSUN, &args ))) WARN( "glReplacementCodeuiSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiSUN, &args ))) WARN( "glReplacementCodeuiSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN( GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z )
@@ -17183,7 +17183,7 @@ static void WINAPI glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN( GLui
     struct glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .s = s, .t = t, .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "rc %d, s %f, t %f, r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", rc, s, t, r, g, b, a, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN( const GLuint *rc, const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -17199,7 +17199,7 @@ static void WINAPI glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN( GLuint rc,
     struct glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .s = s, .t = t, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "rc %d, s %f, t %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", rc, s, t, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN( const GLuint *rc, const GLfloat *tc, const GLfloat *n, const GLfloat *v )
@@ -17215,7 +17215,7 @@ static void WINAPI glReplacementCodeuiTexCoord2fVertex3fSUN( GLuint rc, GLfloat
     struct glReplacementCodeuiTexCoord2fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .s = s, .t = t, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "rc %d, s %f, t %f, x %f, y %f, z %f\n", rc, s, t, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiTexCoord2fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiTexCoord2fVertex3fSUN, &args ))) WARN( "glReplacementCodeuiTexCoord2fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiTexCoord2fVertex3fvSUN( const GLuint *rc, const GLfloat *tc, const GLfloat *v )
@@ -17231,7 +17231,7 @@ static void WINAPI glReplacementCodeuiVertex3fSUN( GLuint rc, GLfloat x, GLfloat
     struct glReplacementCodeuiVertex3fSUN_params args = { .teb = NtCurrentTeb(), .rc = rc, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "rc %d, x %f, y %f, z %f\n", rc, x, y, z );
-    if ((status = UNIX_CALL( glReplacementCodeuiVertex3fSUN, &args ))) WARN( "glReplacementCodeuiVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeuiVertex3fSUN, &args ))) WARN( "glReplacementCodeuiVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeuiVertex3fvSUN( const GLuint *rc, const GLfloat *v )
@@ -17255,7 +17255,7 @@ static void WINAPI glReplacementCodeusSUN( GLushort code )
     struct glReplacementCodeusSUN_params args = { .teb = NtCurrentTeb(), .code = code };
     NTSTATUS status;
     TRACE( "code %d\n", code );
-    if ((status = UNIX_CALL( glReplacementCodeusSUN, &args ))) WARN( "glReplacementCodeusSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glReplacementCodeusSUN, &args ))) WARN( "glReplacementCodeusSUN returned %#lx\n", status );
 }
 
 static void WINAPI glReplacementCodeusvSUN( const GLushort *code )
@@ -17279,7 +17279,7 @@ static void WINAPI glResetHistogram( GLenum target )
     struct glResetHistogram_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glResetHistogram, &args ))) WARN( "glResetHistogram returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResetHistogram, &args ))) WARN( "glResetHistogram returned %#lx\n", status );
 }
 
 static void WINAPI glResetHistogramEXT( GLenum target )
@@ -17287,7 +17287,7 @@ static void WINAPI glResetHistogramEXT( GLenum target )
     struct glResetHistogramEXT_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glResetHistogramEXT, &args ))) WARN( "glResetHistogramEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResetHistogramEXT, &args ))) WARN( "glResetHistogramEXT returned %#lx\n", status );
 }
 
 static void WINAPI glResetMemoryObjectParameterNV( GLuint memory, GLenum pname )
@@ -17295,7 +17295,7 @@ static void WINAPI glResetMemoryObjectParameterNV( GLuint memory, GLenum pname )
     struct glResetMemoryObjectParameterNV_params args = { .teb = NtCurrentTeb(), .memory = memory, .pname = pname };
     NTSTATUS status;
     TRACE( "memory %d, pname %d\n", memory, pname );
-    if ((status = UNIX_CALL( glResetMemoryObjectParameterNV, &args ))) WARN( "glResetMemoryObjectParameterNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResetMemoryObjectParameterNV, &args ))) WARN( "glResetMemoryObjectParameterNV returned %#lx\n", status );
 }
 
 static void WINAPI glResetMinmax( GLenum target )
@@ -17303,7 +17303,7 @@ static void WINAPI glResetMinmax( GLenum target )
     struct glResetMinmax_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glResetMinmax, &args ))) WARN( "glResetMinmax returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResetMinmax, &args ))) WARN( "glResetMinmax returned %#lx\n", status );
 }
 
 static void WINAPI glResetMinmaxEXT( GLenum target )
@@ -17311,7 +17311,7 @@ static void WINAPI glResetMinmaxEXT( GLenum target )
     struct glResetMinmaxEXT_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glResetMinmaxEXT, &args ))) WARN( "glResetMinmaxEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResetMinmaxEXT, &args ))) WARN( "glResetMinmaxEXT returned %#lx\n", status );
 }
 
 static void WINAPI glResizeBuffersMESA(void)
@@ -17319,7 +17319,7 @@ static void WINAPI glResizeBuffersMESA(void)
     struct glResizeBuffersMESA_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glResizeBuffersMESA, &args ))) WARN( "glResizeBuffersMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResizeBuffersMESA, &args ))) WARN( "glResizeBuffersMESA returned %#lx\n", status );
 }
 
 static void WINAPI glResolveDepthValuesNV(void)
@@ -17327,7 +17327,7 @@ static void WINAPI glResolveDepthValuesNV(void)
     struct glResolveDepthValuesNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glResolveDepthValuesNV, &args ))) WARN( "glResolveDepthValuesNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResolveDepthValuesNV, &args ))) WARN( "glResolveDepthValuesNV returned %#lx\n", status );
 }
 
 static void WINAPI glResumeTransformFeedback(void)
@@ -17335,7 +17335,7 @@ static void WINAPI glResumeTransformFeedback(void)
     struct glResumeTransformFeedback_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glResumeTransformFeedback, &args ))) WARN( "glResumeTransformFeedback returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResumeTransformFeedback, &args ))) WARN( "glResumeTransformFeedback returned %#lx\n", status );
 }
 
 static void WINAPI glResumeTransformFeedbackNV(void)
@@ -17343,7 +17343,7 @@ static void WINAPI glResumeTransformFeedbackNV(void)
     struct glResumeTransformFeedbackNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glResumeTransformFeedbackNV, &args ))) WARN( "glResumeTransformFeedbackNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glResumeTransformFeedbackNV, &args ))) WARN( "glResumeTransformFeedbackNV returned %#lx\n", status );
 }
 
 static void WINAPI glRotatexOES( GLfixed angle, GLfixed x, GLfixed y, GLfixed z )
@@ -17351,7 +17351,7 @@ static void WINAPI glRotatexOES( GLfixed angle, GLfixed x, GLfixed y, GLfixed z
     struct glRotatexOES_params args = { .teb = NtCurrentTeb(), .angle = angle, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "angle %d, x %d, y %d, z %d\n", angle, x, y, z );
-    if ((status = UNIX_CALL( glRotatexOES, &args ))) WARN( "glRotatexOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glRotatexOES, &args ))) WARN( "glRotatexOES returned %#lx\n", status );
 }
 
 static void WINAPI glSampleCoverage( GLfloat value, GLboolean invert )
@@ -17359,7 +17359,7 @@ static void WINAPI glSampleCoverage( GLfloat value, GLboolean invert )
     struct glSampleCoverage_params args = { .teb = NtCurrentTeb(), .value = value, .invert = invert };
     NTSTATUS status;
     TRACE( "value %f, invert %d\n", value, invert );
-    if ((status = UNIX_CALL( glSampleCoverage, &args ))) WARN( "glSampleCoverage returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSampleCoverage, &args ))) WARN( "glSampleCoverage returned %#lx\n", status );
 }
 
 static void WINAPI glSampleCoverageARB( GLfloat value, GLboolean invert )
@@ -17367,7 +17367,7 @@ static void WINAPI glSampleCoverageARB( GLfloat value, GLboolean invert )
     struct glSampleCoverageARB_params args = { .teb = NtCurrentTeb(), .value = value, .invert = invert };
     NTSTATUS status;
     TRACE( "value %f, invert %d\n", value, invert );
-    if ((status = UNIX_CALL( glSampleCoverageARB, &args ))) WARN( "glSampleCoverageARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSampleCoverageARB, &args ))) WARN( "glSampleCoverageARB returned %#lx\n", status );
 }
 
 static void WINAPI glSampleMapATI( GLuint dst, GLuint interp, GLenum swizzle )
@@ -17375,7 +17375,7 @@ static void WINAPI glSampleMapATI( GLuint dst, GLuint interp, GLenum swizzle )
     struct glSampleMapATI_params args = { .teb = NtCurrentTeb(), .dst = dst, .interp = interp, .swizzle = swizzle };
     NTSTATUS status;
     TRACE( "dst %d, interp %d, swizzle %d\n", dst, interp, swizzle );
-    if ((status = UNIX_CALL( glSampleMapATI, &args ))) WARN( "glSampleMapATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSampleMapATI, &args ))) WARN( "glSampleMapATI returned %#lx\n", status );
 }
 
 static void WINAPI glSampleMaskEXT( GLclampf value, GLboolean invert )
@@ -17383,7 +17383,7 @@ static void WINAPI glSampleMaskEXT( GLclampf value, GLboolean invert )
     struct glSampleMaskEXT_params args = { .teb = NtCurrentTeb(), .value = value, .invert = invert };
     NTSTATUS status;
     TRACE( "value %f, invert %d\n", value, invert );
-    if ((status = UNIX_CALL( glSampleMaskEXT, &args ))) WARN( "glSampleMaskEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSampleMaskEXT, &args ))) WARN( "glSampleMaskEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSampleMaskIndexedNV( GLuint index, GLbitfield mask )
@@ -17391,7 +17391,7 @@ static void WINAPI glSampleMaskIndexedNV( GLuint index, GLbitfield mask )
     struct glSampleMaskIndexedNV_params args = { .teb = NtCurrentTeb(), .index = index, .mask = mask };
     NTSTATUS status;
     TRACE( "index %d, mask %d\n", index, mask );
-    if ((status = UNIX_CALL( glSampleMaskIndexedNV, &args ))) WARN( "glSampleMaskIndexedNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSampleMaskIndexedNV, &args ))) WARN( "glSampleMaskIndexedNV returned %#lx\n", status );
 }
 
 static void WINAPI glSampleMaskSGIS( GLclampf value, GLboolean invert )
@@ -17399,7 +17399,7 @@ static void WINAPI glSampleMaskSGIS( GLclampf value, GLboolean invert )
     struct glSampleMaskSGIS_params args = { .teb = NtCurrentTeb(), .value = value, .invert = invert };
     NTSTATUS status;
     TRACE( "value %f, invert %d\n", value, invert );
-    if ((status = UNIX_CALL( glSampleMaskSGIS, &args ))) WARN( "glSampleMaskSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSampleMaskSGIS, &args ))) WARN( "glSampleMaskSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glSampleMaski( GLuint maskNumber, GLbitfield mask )
@@ -17407,7 +17407,7 @@ static void WINAPI glSampleMaski( GLuint maskNumber, GLbitfield mask )
     struct glSampleMaski_params args = { .teb = NtCurrentTeb(), .maskNumber = maskNumber, .mask = mask };
     NTSTATUS status;
     TRACE( "maskNumber %d, mask %d\n", maskNumber, mask );
-    if ((status = UNIX_CALL( glSampleMaski, &args ))) WARN( "glSampleMaski returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSampleMaski, &args ))) WARN( "glSampleMaski returned %#lx\n", status );
 }
 
 static void WINAPI glSamplePatternEXT( GLenum pattern )
@@ -17415,7 +17415,7 @@ static void WINAPI glSamplePatternEXT( GLenum pattern )
     struct glSamplePatternEXT_params args = { .teb = NtCurrentTeb(), .pattern = pattern };
     NTSTATUS status;
     TRACE( "pattern %d\n", pattern );
-    if ((status = UNIX_CALL( glSamplePatternEXT, &args ))) WARN( "glSamplePatternEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSamplePatternEXT, &args ))) WARN( "glSamplePatternEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSamplePatternSGIS( GLenum pattern )
@@ -17423,7 +17423,7 @@ static void WINAPI glSamplePatternSGIS( GLenum pattern )
     struct glSamplePatternSGIS_params args = { .teb = NtCurrentTeb(), .pattern = pattern };
     NTSTATUS status;
     TRACE( "pattern %d\n", pattern );
-    if ((status = UNIX_CALL( glSamplePatternSGIS, &args ))) WARN( "glSamplePatternSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSamplePatternSGIS, &args ))) WARN( "glSamplePatternSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glSamplerParameterIiv( GLuint sampler, GLenum pname, const GLint *param )
@@ -17447,7 +17447,7 @@ static void WINAPI glSamplerParameterf( GLuint sampler, GLenum pname, GLfloat pa
     struct glSamplerParameterf_params args = { .teb = NtCurrentTeb(), .sampler = sampler, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "sampler %d, pname %d, param %f\n", sampler, pname, param );
-    if ((status = UNIX_CALL( glSamplerParameterf, &args ))) WARN( "glSamplerParameterf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSamplerParameterf, &args ))) WARN( "glSamplerParameterf returned %#lx\n", status );
 }
 
 static void WINAPI glSamplerParameterfv( GLuint sampler, GLenum pname, const GLfloat *param )
@@ -17463,7 +17463,7 @@ static void WINAPI glSamplerParameteri( GLuint sampler, GLenum pname, GLint para
     struct glSamplerParameteri_params args = { .teb = NtCurrentTeb(), .sampler = sampler, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "sampler %d, pname %d, param %d\n", sampler, pname, param );
-    if ((status = UNIX_CALL( glSamplerParameteri, &args ))) WARN( "glSamplerParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSamplerParameteri, &args ))) WARN( "glSamplerParameteri returned %#lx\n", status );
 }
 
 static void WINAPI glSamplerParameteriv( GLuint sampler, GLenum pname, const GLint *param )
@@ -17479,7 +17479,7 @@ static void WINAPI glScalexOES( GLfixed x, GLfixed y, GLfixed z )
     struct glScalexOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glScalexOES, &args ))) WARN( "glScalexOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glScalexOES, &args ))) WARN( "glScalexOES returned %#lx\n", status );
 }
 
 static void WINAPI glScissorArrayv( GLuint first, GLsizei count, const GLint *v )
@@ -17503,7 +17503,7 @@ static void WINAPI glScissorExclusiveNV( GLint x, GLint y, GLsizei width, GLsize
     struct glScissorExclusiveNV_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "x %d, y %d, width %d, height %d\n", x, y, width, height );
-    if ((status = UNIX_CALL( glScissorExclusiveNV, &args ))) WARN( "glScissorExclusiveNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glScissorExclusiveNV, &args ))) WARN( "glScissorExclusiveNV returned %#lx\n", status );
 }
 
 static void WINAPI glScissorIndexed( GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height )
@@ -17511,7 +17511,7 @@ static void WINAPI glScissorIndexed( GLuint index, GLint left, GLint bottom, GLs
     struct glScissorIndexed_params args = { .teb = NtCurrentTeb(), .index = index, .left = left, .bottom = bottom, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "index %d, left %d, bottom %d, width %d, height %d\n", index, left, bottom, width, height );
-    if ((status = UNIX_CALL( glScissorIndexed, &args ))) WARN( "glScissorIndexed returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glScissorIndexed, &args ))) WARN( "glScissorIndexed returned %#lx\n", status );
 }
 
 static void WINAPI glScissorIndexedv( GLuint index, const GLint *v )
@@ -17527,7 +17527,7 @@ static void WINAPI glSecondaryColor3b( GLbyte red, GLbyte green, GLbyte blue )
     struct glSecondaryColor3b_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3b, &args ))) WARN( "glSecondaryColor3b returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3b, &args ))) WARN( "glSecondaryColor3b returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3bEXT( GLbyte red, GLbyte green, GLbyte blue )
@@ -17535,7 +17535,7 @@ static void WINAPI glSecondaryColor3bEXT( GLbyte red, GLbyte green, GLbyte blue
     struct glSecondaryColor3bEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3bEXT, &args ))) WARN( "glSecondaryColor3bEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3bEXT, &args ))) WARN( "glSecondaryColor3bEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3bv( const GLbyte *v )
@@ -17559,7 +17559,7 @@ static void WINAPI glSecondaryColor3d( GLdouble red, GLdouble green, GLdouble bl
     struct glSecondaryColor3d_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3d, &args ))) WARN( "glSecondaryColor3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3d, &args ))) WARN( "glSecondaryColor3d returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3dEXT( GLdouble red, GLdouble green, GLdouble blue )
@@ -17567,7 +17567,7 @@ static void WINAPI glSecondaryColor3dEXT( GLdouble red, GLdouble green, GLdouble
     struct glSecondaryColor3dEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3dEXT, &args ))) WARN( "glSecondaryColor3dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3dEXT, &args ))) WARN( "glSecondaryColor3dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3dv( const GLdouble *v )
@@ -17591,7 +17591,7 @@ static void WINAPI glSecondaryColor3f( GLfloat red, GLfloat green, GLfloat blue
     struct glSecondaryColor3f_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3f, &args ))) WARN( "glSecondaryColor3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3f, &args ))) WARN( "glSecondaryColor3f returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3fEXT( GLfloat red, GLfloat green, GLfloat blue )
@@ -17599,7 +17599,7 @@ static void WINAPI glSecondaryColor3fEXT( GLfloat red, GLfloat green, GLfloat bl
     struct glSecondaryColor3fEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %f, green %f, blue %f\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3fEXT, &args ))) WARN( "glSecondaryColor3fEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3fEXT, &args ))) WARN( "glSecondaryColor3fEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3fv( const GLfloat *v )
@@ -17623,7 +17623,7 @@ static void WINAPI glSecondaryColor3hNV( GLhalfNV red, GLhalfNV green, GLhalfNV
     struct glSecondaryColor3hNV_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3hNV, &args ))) WARN( "glSecondaryColor3hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3hNV, &args ))) WARN( "glSecondaryColor3hNV returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3hvNV( const GLhalfNV *v )
@@ -17639,7 +17639,7 @@ static void WINAPI glSecondaryColor3i( GLint red, GLint green, GLint blue )
     struct glSecondaryColor3i_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3i, &args ))) WARN( "glSecondaryColor3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3i, &args ))) WARN( "glSecondaryColor3i returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3iEXT( GLint red, GLint green, GLint blue )
@@ -17647,7 +17647,7 @@ static void WINAPI glSecondaryColor3iEXT( GLint red, GLint green, GLint blue )
     struct glSecondaryColor3iEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3iEXT, &args ))) WARN( "glSecondaryColor3iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3iEXT, &args ))) WARN( "glSecondaryColor3iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3iv( const GLint *v )
@@ -17671,7 +17671,7 @@ static void WINAPI glSecondaryColor3s( GLshort red, GLshort green, GLshort blue
     struct glSecondaryColor3s_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3s, &args ))) WARN( "glSecondaryColor3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3s, &args ))) WARN( "glSecondaryColor3s returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3sEXT( GLshort red, GLshort green, GLshort blue )
@@ -17679,7 +17679,7 @@ static void WINAPI glSecondaryColor3sEXT( GLshort red, GLshort green, GLshort bl
     struct glSecondaryColor3sEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3sEXT, &args ))) WARN( "glSecondaryColor3sEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3sEXT, &args ))) WARN( "glSecondaryColor3sEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3sv( const GLshort *v )
@@ -17703,7 +17703,7 @@ static void WINAPI glSecondaryColor3ub( GLubyte red, GLubyte green, GLubyte blue
     struct glSecondaryColor3ub_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3ub, &args ))) WARN( "glSecondaryColor3ub returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3ub, &args ))) WARN( "glSecondaryColor3ub returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3ubEXT( GLubyte red, GLubyte green, GLubyte blue )
@@ -17711,7 +17711,7 @@ static void WINAPI glSecondaryColor3ubEXT( GLubyte red, GLubyte green, GLubyte b
     struct glSecondaryColor3ubEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3ubEXT, &args ))) WARN( "glSecondaryColor3ubEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3ubEXT, &args ))) WARN( "glSecondaryColor3ubEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3ubv( const GLubyte *v )
@@ -17735,7 +17735,7 @@ static void WINAPI glSecondaryColor3ui( GLuint red, GLuint green, GLuint blue )
     struct glSecondaryColor3ui_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3ui, &args ))) WARN( "glSecondaryColor3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3ui, &args ))) WARN( "glSecondaryColor3ui returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3uiEXT( GLuint red, GLuint green, GLuint blue )
@@ -17743,7 +17743,7 @@ static void WINAPI glSecondaryColor3uiEXT( GLuint red, GLuint green, GLuint blue
     struct glSecondaryColor3uiEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3uiEXT, &args ))) WARN( "glSecondaryColor3uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3uiEXT, &args ))) WARN( "glSecondaryColor3uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3uiv( const GLuint *v )
@@ -17767,7 +17767,7 @@ static void WINAPI glSecondaryColor3us( GLushort red, GLushort green, GLushort b
     struct glSecondaryColor3us_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3us, &args ))) WARN( "glSecondaryColor3us returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3us, &args ))) WARN( "glSecondaryColor3us returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3usEXT( GLushort red, GLushort green, GLushort blue )
@@ -17775,7 +17775,7 @@ static void WINAPI glSecondaryColor3usEXT( GLushort red, GLushort green, GLushor
     struct glSecondaryColor3usEXT_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d\n", red, green, blue );
-    if ((status = UNIX_CALL( glSecondaryColor3usEXT, &args ))) WARN( "glSecondaryColor3usEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColor3usEXT, &args ))) WARN( "glSecondaryColor3usEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColor3usv( const GLushort *v )
@@ -17799,7 +17799,7 @@ static void WINAPI glSecondaryColorFormatNV( GLint size, GLenum type, GLsizei st
     struct glSecondaryColorFormatNV_params args = { .teb = NtCurrentTeb(), .size = size, .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "size %d, type %d, stride %d\n", size, type, stride );
-    if ((status = UNIX_CALL( glSecondaryColorFormatNV, &args ))) WARN( "glSecondaryColorFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColorFormatNV, &args ))) WARN( "glSecondaryColorFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColorP3ui( GLenum type, GLuint color )
@@ -17807,7 +17807,7 @@ static void WINAPI glSecondaryColorP3ui( GLenum type, GLuint color )
     struct glSecondaryColorP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .color = color };
     NTSTATUS status;
     TRACE( "type %d, color %d\n", type, color );
-    if ((status = UNIX_CALL( glSecondaryColorP3ui, &args ))) WARN( "glSecondaryColorP3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSecondaryColorP3ui, &args ))) WARN( "glSecondaryColorP3ui returned %#lx\n", status );
 }
 
 static void WINAPI glSecondaryColorP3uiv( GLenum type, const GLuint *color )
@@ -17855,7 +17855,7 @@ static void WINAPI glSelectTextureCoordSetSGIS( GLenum target )
     struct glSelectTextureCoordSetSGIS_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glSelectTextureCoordSetSGIS, &args ))) WARN( "glSelectTextureCoordSetSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSelectTextureCoordSetSGIS, &args ))) WARN( "glSelectTextureCoordSetSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glSelectTextureSGIS( GLenum target )
@@ -17863,7 +17863,7 @@ static void WINAPI glSelectTextureSGIS( GLenum target )
     struct glSelectTextureSGIS_params args = { .teb = NtCurrentTeb(), .target = target };
     NTSTATUS status;
     TRACE( "target %d\n", target );
-    if ((status = UNIX_CALL( glSelectTextureSGIS, &args ))) WARN( "glSelectTextureSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSelectTextureSGIS, &args ))) WARN( "glSelectTextureSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glSemaphoreParameterui64vEXT( GLuint semaphore, GLenum pname, const GLuint64 *params )
@@ -17895,7 +17895,7 @@ static void WINAPI glSetFenceAPPLE( GLuint fence )
     struct glSetFenceAPPLE_params args = { .teb = NtCurrentTeb(), .fence = fence };
     NTSTATUS status;
     TRACE( "fence %d\n", fence );
-    if ((status = UNIX_CALL( glSetFenceAPPLE, &args ))) WARN( "glSetFenceAPPLE returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSetFenceAPPLE, &args ))) WARN( "glSetFenceAPPLE returned %#lx\n", status );
 }
 
 static void WINAPI glSetFenceNV( GLuint fence, GLenum condition )
@@ -17903,7 +17903,7 @@ static void WINAPI glSetFenceNV( GLuint fence, GLenum condition )
     struct glSetFenceNV_params args = { .teb = NtCurrentTeb(), .fence = fence, .condition = condition };
     NTSTATUS status;
     TRACE( "fence %d, condition %d\n", fence, condition );
-    if ((status = UNIX_CALL( glSetFenceNV, &args ))) WARN( "glSetFenceNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSetFenceNV, &args ))) WARN( "glSetFenceNV returned %#lx\n", status );
 }
 
 static void WINAPI glSetFragmentShaderConstantATI( GLuint dst, const GLfloat *value )
@@ -17951,7 +17951,7 @@ static void WINAPI glShaderOp1EXT( GLenum op, GLuint res, GLuint arg1 )
     struct glShaderOp1EXT_params args = { .teb = NtCurrentTeb(), .op = op, .res = res, .arg1 = arg1 };
     NTSTATUS status;
     TRACE( "op %d, res %d, arg1 %d\n", op, res, arg1 );
-    if ((status = UNIX_CALL( glShaderOp1EXT, &args ))) WARN( "glShaderOp1EXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glShaderOp1EXT, &args ))) WARN( "glShaderOp1EXT returned %#lx\n", status );
 }
 
 static void WINAPI glShaderOp2EXT( GLenum op, GLuint res, GLuint arg1, GLuint arg2 )
@@ -17959,7 +17959,7 @@ static void WINAPI glShaderOp2EXT( GLenum op, GLuint res, GLuint arg1, GLuint ar
     struct glShaderOp2EXT_params args = { .teb = NtCurrentTeb(), .op = op, .res = res, .arg1 = arg1, .arg2 = arg2 };
     NTSTATUS status;
     TRACE( "op %d, res %d, arg1 %d, arg2 %d\n", op, res, arg1, arg2 );
-    if ((status = UNIX_CALL( glShaderOp2EXT, &args ))) WARN( "glShaderOp2EXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glShaderOp2EXT, &args ))) WARN( "glShaderOp2EXT returned %#lx\n", status );
 }
 
 static void WINAPI glShaderOp3EXT( GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3 )
@@ -17967,7 +17967,7 @@ static void WINAPI glShaderOp3EXT( GLenum op, GLuint res, GLuint arg1, GLuint ar
     struct glShaderOp3EXT_params args = { .teb = NtCurrentTeb(), .op = op, .res = res, .arg1 = arg1, .arg2 = arg2, .arg3 = arg3 };
     NTSTATUS status;
     TRACE( "op %d, res %d, arg1 %d, arg2 %d, arg3 %d\n", op, res, arg1, arg2, arg3 );
-    if ((status = UNIX_CALL( glShaderOp3EXT, &args ))) WARN( "glShaderOp3EXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glShaderOp3EXT, &args ))) WARN( "glShaderOp3EXT returned %#lx\n", status );
 }
 
 static void WINAPI glShaderSource( GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length )
@@ -17991,7 +17991,7 @@ static void WINAPI glShaderStorageBlockBinding( GLuint program, GLuint storageBl
     struct glShaderStorageBlockBinding_params args = { .teb = NtCurrentTeb(), .program = program, .storageBlockIndex = storageBlockIndex, .storageBlockBinding = storageBlockBinding };
     NTSTATUS status;
     TRACE( "program %d, storageBlockIndex %d, storageBlockBinding %d\n", program, storageBlockIndex, storageBlockBinding );
-    if ((status = UNIX_CALL( glShaderStorageBlockBinding, &args ))) WARN( "glShaderStorageBlockBinding returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glShaderStorageBlockBinding, &args ))) WARN( "glShaderStorageBlockBinding returned %#lx\n", status );
 }
 
 static void WINAPI glShadingRateImageBarrierNV( GLboolean synchronize )
@@ -17999,7 +17999,7 @@ static void WINAPI glShadingRateImageBarrierNV( GLboolean synchronize )
     struct glShadingRateImageBarrierNV_params args = { .teb = NtCurrentTeb(), .synchronize = synchronize };
     NTSTATUS status;
     TRACE( "synchronize %d\n", synchronize );
-    if ((status = UNIX_CALL( glShadingRateImageBarrierNV, &args ))) WARN( "glShadingRateImageBarrierNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glShadingRateImageBarrierNV, &args ))) WARN( "glShadingRateImageBarrierNV returned %#lx\n", status );
 }
 
 static void WINAPI glShadingRateImagePaletteNV( GLuint viewport, GLuint first, GLsizei count, const GLenum *rates )
@@ -18023,7 +18023,7 @@ static void WINAPI glShadingRateSampleOrderNV( GLenum order )
     struct glShadingRateSampleOrderNV_params args = { .teb = NtCurrentTeb(), .order = order };
     NTSTATUS status;
     TRACE( "order %d\n", order );
-    if ((status = UNIX_CALL( glShadingRateSampleOrderNV, &args ))) WARN( "glShadingRateSampleOrderNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glShadingRateSampleOrderNV, &args ))) WARN( "glShadingRateSampleOrderNV returned %#lx\n", status );
 }
 
 static void WINAPI glSharpenTexFuncSGIS( GLenum target, GLsizei n, const GLfloat *points )
@@ -18055,7 +18055,7 @@ static void WINAPI glSignalVkFenceNV( GLuint64 vkFence )
     struct glSignalVkFenceNV_params args = { .teb = NtCurrentTeb(), .vkFence = vkFence };
     NTSTATUS status;
     TRACE( "vkFence %s\n", wine_dbgstr_longlong(vkFence) );
-    if ((status = UNIX_CALL( glSignalVkFenceNV, &args ))) WARN( "glSignalVkFenceNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSignalVkFenceNV, &args ))) WARN( "glSignalVkFenceNV returned %#lx\n", status );
 }
 
 static void WINAPI glSignalVkSemaphoreNV( GLuint64 vkSemaphore )
@@ -18063,7 +18063,7 @@ static void WINAPI glSignalVkSemaphoreNV( GLuint64 vkSemaphore )
     struct glSignalVkSemaphoreNV_params args = { .teb = NtCurrentTeb(), .vkSemaphore = vkSemaphore };
     NTSTATUS status;
     TRACE( "vkSemaphore %s\n", wine_dbgstr_longlong(vkSemaphore) );
-    if ((status = UNIX_CALL( glSignalVkSemaphoreNV, &args ))) WARN( "glSignalVkSemaphoreNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSignalVkSemaphoreNV, &args ))) WARN( "glSignalVkSemaphoreNV returned %#lx\n", status );
 }
 
 static void WINAPI glSpecializeShader( GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue )
@@ -18087,7 +18087,7 @@ static void WINAPI glSpriteParameterfSGIX( GLenum pname, GLfloat param )
     struct glSpriteParameterfSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glSpriteParameterfSGIX, &args ))) WARN( "glSpriteParameterfSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSpriteParameterfSGIX, &args ))) WARN( "glSpriteParameterfSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glSpriteParameterfvSGIX( GLenum pname, const GLfloat *params )
@@ -18103,7 +18103,7 @@ static void WINAPI glSpriteParameteriSGIX( GLenum pname, GLint param )
     struct glSpriteParameteriSGIX_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glSpriteParameteriSGIX, &args ))) WARN( "glSpriteParameteriSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSpriteParameteriSGIX, &args ))) WARN( "glSpriteParameteriSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glSpriteParameterivSGIX( GLenum pname, const GLint *params )
@@ -18119,7 +18119,7 @@ static void WINAPI glStartInstrumentsSGIX(void)
     struct glStartInstrumentsSGIX_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glStartInstrumentsSGIX, &args ))) WARN( "glStartInstrumentsSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStartInstrumentsSGIX, &args ))) WARN( "glStartInstrumentsSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glStateCaptureNV( GLuint state, GLenum mode )
@@ -18127,7 +18127,7 @@ static void WINAPI glStateCaptureNV( GLuint state, GLenum mode )
     struct glStateCaptureNV_params args = { .teb = NtCurrentTeb(), .state = state, .mode = mode };
     NTSTATUS status;
     TRACE( "state %d, mode %d\n", state, mode );
-    if ((status = UNIX_CALL( glStateCaptureNV, &args ))) WARN( "glStateCaptureNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStateCaptureNV, &args ))) WARN( "glStateCaptureNV returned %#lx\n", status );
 }
 
 static void WINAPI glStencilClearTagEXT( GLsizei stencilTagBits, GLuint stencilClearTag )
@@ -18135,7 +18135,7 @@ static void WINAPI glStencilClearTagEXT( GLsizei stencilTagBits, GLuint stencilC
     struct glStencilClearTagEXT_params args = { .teb = NtCurrentTeb(), .stencilTagBits = stencilTagBits, .stencilClearTag = stencilClearTag };
     NTSTATUS status;
     TRACE( "stencilTagBits %d, stencilClearTag %d\n", stencilTagBits, stencilClearTag );
-    if ((status = UNIX_CALL( glStencilClearTagEXT, &args ))) WARN( "glStencilClearTagEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilClearTagEXT, &args ))) WARN( "glStencilClearTagEXT returned %#lx\n", status );
 }
 
 static void WINAPI glStencilFillPathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues )
@@ -18151,7 +18151,7 @@ static void WINAPI glStencilFillPathNV( GLuint path, GLenum fillMode, GLuint mas
     struct glStencilFillPathNV_params args = { .teb = NtCurrentTeb(), .path = path, .fillMode = fillMode, .mask = mask };
     NTSTATUS status;
     TRACE( "path %d, fillMode %d, mask %d\n", path, fillMode, mask );
-    if ((status = UNIX_CALL( glStencilFillPathNV, &args ))) WARN( "glStencilFillPathNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilFillPathNV, &args ))) WARN( "glStencilFillPathNV returned %#lx\n", status );
 }
 
 static void WINAPI glStencilFuncSeparate( GLenum face, GLenum func, GLint ref, GLuint mask )
@@ -18159,7 +18159,7 @@ static void WINAPI glStencilFuncSeparate( GLenum face, GLenum func, GLint ref, G
     struct glStencilFuncSeparate_params args = { .teb = NtCurrentTeb(), .face = face, .func = func, .ref = ref, .mask = mask };
     NTSTATUS status;
     TRACE( "face %d, func %d, ref %d, mask %d\n", face, func, ref, mask );
-    if ((status = UNIX_CALL( glStencilFuncSeparate, &args ))) WARN( "glStencilFuncSeparate returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilFuncSeparate, &args ))) WARN( "glStencilFuncSeparate returned %#lx\n", status );
 }
 
 static void WINAPI glStencilFuncSeparateATI( GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask )
@@ -18167,7 +18167,7 @@ static void WINAPI glStencilFuncSeparateATI( GLenum frontfunc, GLenum backfunc,
     struct glStencilFuncSeparateATI_params args = { .teb = NtCurrentTeb(), .frontfunc = frontfunc, .backfunc = backfunc, .ref = ref, .mask = mask };
     NTSTATUS status;
     TRACE( "frontfunc %d, backfunc %d, ref %d, mask %d\n", frontfunc, backfunc, ref, mask );
-    if ((status = UNIX_CALL( glStencilFuncSeparateATI, &args ))) WARN( "glStencilFuncSeparateATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilFuncSeparateATI, &args ))) WARN( "glStencilFuncSeparateATI returned %#lx\n", status );
 }
 
 static void WINAPI glStencilMaskSeparate( GLenum face, GLuint mask )
@@ -18175,7 +18175,7 @@ static void WINAPI glStencilMaskSeparate( GLenum face, GLuint mask )
     struct glStencilMaskSeparate_params args = { .teb = NtCurrentTeb(), .face = face, .mask = mask };
     NTSTATUS status;
     TRACE( "face %d, mask %d\n", face, mask );
-    if ((status = UNIX_CALL( glStencilMaskSeparate, &args ))) WARN( "glStencilMaskSeparate returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilMaskSeparate, &args ))) WARN( "glStencilMaskSeparate returned %#lx\n", status );
 }
 
 static void WINAPI glStencilOpSeparate( GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass )
@@ -18183,7 +18183,7 @@ static void WINAPI glStencilOpSeparate( GLenum face, GLenum sfail, GLenum dpfail
     struct glStencilOpSeparate_params args = { .teb = NtCurrentTeb(), .face = face, .sfail = sfail, .dpfail = dpfail, .dppass = dppass };
     NTSTATUS status;
     TRACE( "face %d, sfail %d, dpfail %d, dppass %d\n", face, sfail, dpfail, dppass );
-    if ((status = UNIX_CALL( glStencilOpSeparate, &args ))) WARN( "glStencilOpSeparate returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilOpSeparate, &args ))) WARN( "glStencilOpSeparate returned %#lx\n", status );
 }
 
 static void WINAPI glStencilOpSeparateATI( GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass )
@@ -18191,7 +18191,7 @@ static void WINAPI glStencilOpSeparateATI( GLenum face, GLenum sfail, GLenum dpf
     struct glStencilOpSeparateATI_params args = { .teb = NtCurrentTeb(), .face = face, .sfail = sfail, .dpfail = dpfail, .dppass = dppass };
     NTSTATUS status;
     TRACE( "face %d, sfail %d, dpfail %d, dppass %d\n", face, sfail, dpfail, dppass );
-    if ((status = UNIX_CALL( glStencilOpSeparateATI, &args ))) WARN( "glStencilOpSeparateATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilOpSeparateATI, &args ))) WARN( "glStencilOpSeparateATI returned %#lx\n", status );
 }
 
 static void WINAPI glStencilOpValueAMD( GLenum face, GLuint value )
@@ -18199,7 +18199,7 @@ static void WINAPI glStencilOpValueAMD( GLenum face, GLuint value )
     struct glStencilOpValueAMD_params args = { .teb = NtCurrentTeb(), .face = face, .value = value };
     NTSTATUS status;
     TRACE( "face %d, value %d\n", face, value );
-    if ((status = UNIX_CALL( glStencilOpValueAMD, &args ))) WARN( "glStencilOpValueAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilOpValueAMD, &args ))) WARN( "glStencilOpValueAMD returned %#lx\n", status );
 }
 
 static void WINAPI glStencilStrokePathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues )
@@ -18215,7 +18215,7 @@ static void WINAPI glStencilStrokePathNV( GLuint path, GLint reference, GLuint m
     struct glStencilStrokePathNV_params args = { .teb = NtCurrentTeb(), .path = path, .reference = reference, .mask = mask };
     NTSTATUS status;
     TRACE( "path %d, reference %d, mask %d\n", path, reference, mask );
-    if ((status = UNIX_CALL( glStencilStrokePathNV, &args ))) WARN( "glStencilStrokePathNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilStrokePathNV, &args ))) WARN( "glStencilStrokePathNV returned %#lx\n", status );
 }
 
 static void WINAPI glStencilThenCoverFillPathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues )
@@ -18231,7 +18231,7 @@ static void WINAPI glStencilThenCoverFillPathNV( GLuint path, GLenum fillMode, G
     struct glStencilThenCoverFillPathNV_params args = { .teb = NtCurrentTeb(), .path = path, .fillMode = fillMode, .mask = mask, .coverMode = coverMode };
     NTSTATUS status;
     TRACE( "path %d, fillMode %d, mask %d, coverMode %d\n", path, fillMode, mask, coverMode );
-    if ((status = UNIX_CALL( glStencilThenCoverFillPathNV, &args ))) WARN( "glStencilThenCoverFillPathNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilThenCoverFillPathNV, &args ))) WARN( "glStencilThenCoverFillPathNV returned %#lx\n", status );
 }
 
 static void WINAPI glStencilThenCoverStrokePathInstancedNV( GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues )
@@ -18247,7 +18247,7 @@ static void WINAPI glStencilThenCoverStrokePathNV( GLuint path, GLint reference,
     struct glStencilThenCoverStrokePathNV_params args = { .teb = NtCurrentTeb(), .path = path, .reference = reference, .mask = mask, .coverMode = coverMode };
     NTSTATUS status;
     TRACE( "path %d, reference %d, mask %d, coverMode %d\n", path, reference, mask, coverMode );
-    if ((status = UNIX_CALL( glStencilThenCoverStrokePathNV, &args ))) WARN( "glStencilThenCoverStrokePathNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStencilThenCoverStrokePathNV, &args ))) WARN( "glStencilThenCoverStrokePathNV returned %#lx\n", status );
 }
 
 static void WINAPI glStopInstrumentsSGIX( GLint marker )
@@ -18255,7 +18255,7 @@ static void WINAPI glStopInstrumentsSGIX( GLint marker )
     struct glStopInstrumentsSGIX_params args = { .teb = NtCurrentTeb(), .marker = marker };
     NTSTATUS status;
     TRACE( "marker %d\n", marker );
-    if ((status = UNIX_CALL( glStopInstrumentsSGIX, &args ))) WARN( "glStopInstrumentsSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glStopInstrumentsSGIX, &args ))) WARN( "glStopInstrumentsSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glStringMarkerGREMEDY( GLsizei len, const void *string )
@@ -18271,7 +18271,7 @@ static void WINAPI glSubpixelPrecisionBiasNV( GLuint xbits, GLuint ybits )
     struct glSubpixelPrecisionBiasNV_params args = { .teb = NtCurrentTeb(), .xbits = xbits, .ybits = ybits };
     NTSTATUS status;
     TRACE( "xbits %d, ybits %d\n", xbits, ybits );
-    if ((status = UNIX_CALL( glSubpixelPrecisionBiasNV, &args ))) WARN( "glSubpixelPrecisionBiasNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSubpixelPrecisionBiasNV, &args ))) WARN( "glSubpixelPrecisionBiasNV returned %#lx\n", status );
 }
 
 static void WINAPI glSwizzleEXT( GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW )
@@ -18279,7 +18279,7 @@ static void WINAPI glSwizzleEXT( GLuint res, GLuint in, GLenum outX, GLenum outY
     struct glSwizzleEXT_params args = { .teb = NtCurrentTeb(), .res = res, .in = in, .outX = outX, .outY = outY, .outZ = outZ, .outW = outW };
     NTSTATUS status;
     TRACE( "res %d, in %d, outX %d, outY %d, outZ %d, outW %d\n", res, in, outX, outY, outZ, outW );
-    if ((status = UNIX_CALL( glSwizzleEXT, &args ))) WARN( "glSwizzleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSwizzleEXT, &args ))) WARN( "glSwizzleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glSyncTextureINTEL( GLuint texture )
@@ -18287,7 +18287,7 @@ static void WINAPI glSyncTextureINTEL( GLuint texture )
     struct glSyncTextureINTEL_params args = { .teb = NtCurrentTeb(), .texture = texture };
     NTSTATUS status;
     TRACE( "texture %d\n", texture );
-    if ((status = UNIX_CALL( glSyncTextureINTEL, &args ))) WARN( "glSyncTextureINTEL returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glSyncTextureINTEL, &args ))) WARN( "glSyncTextureINTEL returned %#lx\n", status );
 }
 
 static void WINAPI glTagSampleBufferSGIX(void)
@@ -18295,7 +18295,7 @@ static void WINAPI glTagSampleBufferSGIX(void)
     struct glTagSampleBufferSGIX_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glTagSampleBufferSGIX, &args ))) WARN( "glTagSampleBufferSGIX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTagSampleBufferSGIX, &args ))) WARN( "glTagSampleBufferSGIX returned %#lx\n", status );
 }
 
 static void WINAPI glTangent3bEXT( GLbyte tx, GLbyte ty, GLbyte tz )
@@ -18303,7 +18303,7 @@ static void WINAPI glTangent3bEXT( GLbyte tx, GLbyte ty, GLbyte tz )
     struct glTangent3bEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
     NTSTATUS status;
     TRACE( "tx %d, ty %d, tz %d\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3bEXT, &args ))) WARN( "glTangent3bEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTangent3bEXT, &args ))) WARN( "glTangent3bEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTangent3bvEXT( const GLbyte *v )
@@ -18319,7 +18319,7 @@ static void WINAPI glTangent3dEXT( GLdouble tx, GLdouble ty, GLdouble tz )
     struct glTangent3dEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
     NTSTATUS status;
     TRACE( "tx %f, ty %f, tz %f\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3dEXT, &args ))) WARN( "glTangent3dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTangent3dEXT, &args ))) WARN( "glTangent3dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTangent3dvEXT( const GLdouble *v )
@@ -18335,7 +18335,7 @@ static void WINAPI glTangent3fEXT( GLfloat tx, GLfloat ty, GLfloat tz )
     struct glTangent3fEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
     NTSTATUS status;
     TRACE( "tx %f, ty %f, tz %f\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3fEXT, &args ))) WARN( "glTangent3fEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTangent3fEXT, &args ))) WARN( "glTangent3fEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTangent3fvEXT( const GLfloat *v )
@@ -18351,7 +18351,7 @@ static void WINAPI glTangent3iEXT( GLint tx, GLint ty, GLint tz )
     struct glTangent3iEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
     NTSTATUS status;
     TRACE( "tx %d, ty %d, tz %d\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3iEXT, &args ))) WARN( "glTangent3iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTangent3iEXT, &args ))) WARN( "glTangent3iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTangent3ivEXT( const GLint *v )
@@ -18367,7 +18367,7 @@ static void WINAPI glTangent3sEXT( GLshort tx, GLshort ty, GLshort tz )
     struct glTangent3sEXT_params args = { .teb = NtCurrentTeb(), .tx = tx, .ty = ty, .tz = tz };
     NTSTATUS status;
     TRACE( "tx %d, ty %d, tz %d\n", tx, ty, tz );
-    if ((status = UNIX_CALL( glTangent3sEXT, &args ))) WARN( "glTangent3sEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTangent3sEXT, &args ))) WARN( "glTangent3sEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTangent3svEXT( const GLshort *v )
@@ -18391,7 +18391,7 @@ static void WINAPI glTbufferMask3DFX( GLuint mask )
     struct glTbufferMask3DFX_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glTbufferMask3DFX, &args ))) WARN( "glTbufferMask3DFX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTbufferMask3DFX, &args ))) WARN( "glTbufferMask3DFX returned %#lx\n", status );
 }
 
 static void WINAPI glTessellationFactorAMD( GLfloat factor )
@@ -18399,7 +18399,7 @@ static void WINAPI glTessellationFactorAMD( GLfloat factor )
     struct glTessellationFactorAMD_params args = { .teb = NtCurrentTeb(), .factor = factor };
     NTSTATUS status;
     TRACE( "factor %f\n", factor );
-    if ((status = UNIX_CALL( glTessellationFactorAMD, &args ))) WARN( "glTessellationFactorAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTessellationFactorAMD, &args ))) WARN( "glTessellationFactorAMD returned %#lx\n", status );
 }
 
 static void WINAPI glTessellationModeAMD( GLenum mode )
@@ -18407,7 +18407,7 @@ static void WINAPI glTessellationModeAMD( GLenum mode )
     struct glTessellationModeAMD_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glTessellationModeAMD, &args ))) WARN( "glTessellationModeAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTessellationModeAMD, &args ))) WARN( "glTessellationModeAMD returned %#lx\n", status );
 }
 
 static GLboolean WINAPI glTestFenceAPPLE( GLuint fence )
@@ -18442,7 +18442,7 @@ static void WINAPI glTexAttachMemoryNV( GLenum target, GLuint memory, GLuint64 o
     struct glTexAttachMemoryNV_params args = { .teb = NtCurrentTeb(), .target = target, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "target %d, memory %d, offset %s\n", target, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexAttachMemoryNV, &args ))) WARN( "glTexAttachMemoryNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexAttachMemoryNV, &args ))) WARN( "glTexAttachMemoryNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexBuffer( GLenum target, GLenum internalformat, GLuint buffer )
@@ -18450,7 +18450,7 @@ static void WINAPI glTexBuffer( GLenum target, GLenum internalformat, GLuint buf
     struct glTexBuffer_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .buffer = buffer };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, buffer %d\n", target, internalformat, buffer );
-    if ((status = UNIX_CALL( glTexBuffer, &args ))) WARN( "glTexBuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexBuffer, &args ))) WARN( "glTexBuffer returned %#lx\n", status );
 }
 
 static void WINAPI glTexBufferARB( GLenum target, GLenum internalformat, GLuint buffer )
@@ -18458,7 +18458,7 @@ static void WINAPI glTexBufferARB( GLenum target, GLenum internalformat, GLuint
     struct glTexBufferARB_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .buffer = buffer };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, buffer %d\n", target, internalformat, buffer );
-    if ((status = UNIX_CALL( glTexBufferARB, &args ))) WARN( "glTexBufferARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexBufferARB, &args ))) WARN( "glTexBufferARB returned %#lx\n", status );
 }
 
 static void WINAPI glTexBufferEXT( GLenum target, GLenum internalformat, GLuint buffer )
@@ -18466,7 +18466,7 @@ static void WINAPI glTexBufferEXT( GLenum target, GLenum internalformat, GLuint
     struct glTexBufferEXT_params args = { .teb = NtCurrentTeb(), .target = target, .internalformat = internalformat, .buffer = buffer };
     NTSTATUS status;
     TRACE( "target %d, internalformat %d, buffer %d\n", target, internalformat, buffer );
-    if ((status = UNIX_CALL( glTexBufferEXT, &args ))) WARN( "glTexBufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexBufferEXT, &args ))) WARN( "glTexBufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTexBufferRange( GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size )
@@ -18498,7 +18498,7 @@ static void WINAPI glTexCoord1bOES( GLbyte s )
     struct glTexCoord1bOES_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1bOES, &args ))) WARN( "glTexCoord1bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord1bOES, &args ))) WARN( "glTexCoord1bOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord1bvOES( const GLbyte *coords )
@@ -18514,7 +18514,7 @@ static void WINAPI glTexCoord1hNV( GLhalfNV s )
     struct glTexCoord1hNV_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1hNV, &args ))) WARN( "glTexCoord1hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord1hNV, &args ))) WARN( "glTexCoord1hNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord1hvNV( const GLhalfNV *v )
@@ -18530,7 +18530,7 @@ static void WINAPI glTexCoord1xOES( GLfixed s )
     struct glTexCoord1xOES_params args = { .teb = NtCurrentTeb(), .s = s };
     NTSTATUS status;
     TRACE( "s %d\n", s );
-    if ((status = UNIX_CALL( glTexCoord1xOES, &args ))) WARN( "glTexCoord1xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord1xOES, &args ))) WARN( "glTexCoord1xOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord1xvOES( const GLfixed *coords )
@@ -18546,7 +18546,7 @@ static void WINAPI glTexCoord2bOES( GLbyte s, GLbyte t )
     struct glTexCoord2bOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2bOES, &args ))) WARN( "glTexCoord2bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2bOES, &args ))) WARN( "glTexCoord2bOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord2bvOES( const GLbyte *coords )
@@ -18562,7 +18562,7 @@ static void WINAPI glTexCoord2fColor3fVertex3fSUN( GLfloat s, GLfloat t, GLfloat
     struct glTexCoord2fColor3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .g = g, .b = b, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f, g %f, b %f, x %f, y %f, z %f\n", s, t, r, g, b, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fColor3fVertex3fSUN, &args ))) WARN( "glTexCoord2fColor3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2fColor3fVertex3fSUN, &args ))) WARN( "glTexCoord2fColor3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord2fColor3fVertex3fvSUN( const GLfloat *tc, const GLfloat *c, const GLfloat *v )
@@ -18578,7 +18578,7 @@ static void WINAPI glTexCoord2fColor4fNormal3fVertex3fSUN( GLfloat s, GLfloat t,
     struct glTexCoord2fColor4fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", s, t, r, g, b, a, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fColor4fNormal3fVertex3fSUN, &args ))) WARN( "glTexCoord2fColor4fNormal3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2fColor4fNormal3fVertex3fSUN, &args ))) WARN( "glTexCoord2fColor4fNormal3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord2fColor4fNormal3fVertex3fvSUN( const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -18594,7 +18594,7 @@ static void WINAPI glTexCoord2fColor4ubVertex3fSUN( GLfloat s, GLfloat t, GLubyt
     struct glTexCoord2fColor4ubVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .g = g, .b = b, .a = a, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "s %f, t %f, r %d, g %d, b %d, a %d, x %f, y %f, z %f\n", s, t, r, g, b, a, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fColor4ubVertex3fSUN, &args ))) WARN( "glTexCoord2fColor4ubVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2fColor4ubVertex3fSUN, &args ))) WARN( "glTexCoord2fColor4ubVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord2fColor4ubVertex3fvSUN( const GLfloat *tc, const GLubyte *c, const GLfloat *v )
@@ -18610,7 +18610,7 @@ static void WINAPI glTexCoord2fNormal3fVertex3fSUN( GLfloat s, GLfloat t, GLfloa
     struct glTexCoord2fNormal3fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "s %f, t %f, nx %f, ny %f, nz %f, x %f, y %f, z %f\n", s, t, nx, ny, nz, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fNormal3fVertex3fSUN, &args ))) WARN( "glTexCoord2fNormal3fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2fNormal3fVertex3fSUN, &args ))) WARN( "glTexCoord2fNormal3fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord2fNormal3fVertex3fvSUN( const GLfloat *tc, const GLfloat *n, const GLfloat *v )
@@ -18626,7 +18626,7 @@ static void WINAPI glTexCoord2fVertex3fSUN( GLfloat s, GLfloat t, GLfloat x, GLf
     struct glTexCoord2fVertex3fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "s %f, t %f, x %f, y %f, z %f\n", s, t, x, y, z );
-    if ((status = UNIX_CALL( glTexCoord2fVertex3fSUN, &args ))) WARN( "glTexCoord2fVertex3fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2fVertex3fSUN, &args ))) WARN( "glTexCoord2fVertex3fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord2fVertex3fvSUN( const GLfloat *tc, const GLfloat *v )
@@ -18642,7 +18642,7 @@ static void WINAPI glTexCoord2hNV( GLhalfNV s, GLhalfNV t )
     struct glTexCoord2hNV_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2hNV, &args ))) WARN( "glTexCoord2hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2hNV, &args ))) WARN( "glTexCoord2hNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord2hvNV( const GLhalfNV *v )
@@ -18658,7 +18658,7 @@ static void WINAPI glTexCoord2xOES( GLfixed s, GLfixed t )
     struct glTexCoord2xOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t };
     NTSTATUS status;
     TRACE( "s %d, t %d\n", s, t );
-    if ((status = UNIX_CALL( glTexCoord2xOES, &args ))) WARN( "glTexCoord2xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord2xOES, &args ))) WARN( "glTexCoord2xOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord2xvOES( const GLfixed *coords )
@@ -18674,7 +18674,7 @@ static void WINAPI glTexCoord3bOES( GLbyte s, GLbyte t, GLbyte r )
     struct glTexCoord3bOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3bOES, &args ))) WARN( "glTexCoord3bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord3bOES, &args ))) WARN( "glTexCoord3bOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord3bvOES( const GLbyte *coords )
@@ -18690,7 +18690,7 @@ static void WINAPI glTexCoord3hNV( GLhalfNV s, GLhalfNV t, GLhalfNV r )
     struct glTexCoord3hNV_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3hNV, &args ))) WARN( "glTexCoord3hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord3hNV, &args ))) WARN( "glTexCoord3hNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord3hvNV( const GLhalfNV *v )
@@ -18706,7 +18706,7 @@ static void WINAPI glTexCoord3xOES( GLfixed s, GLfixed t, GLfixed r )
     struct glTexCoord3xOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d\n", s, t, r );
-    if ((status = UNIX_CALL( glTexCoord3xOES, &args ))) WARN( "glTexCoord3xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord3xOES, &args ))) WARN( "glTexCoord3xOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord3xvOES( const GLfixed *coords )
@@ -18722,7 +18722,7 @@ static void WINAPI glTexCoord4bOES( GLbyte s, GLbyte t, GLbyte r, GLbyte q )
     struct glTexCoord4bOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4bOES, &args ))) WARN( "glTexCoord4bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4bOES, &args ))) WARN( "glTexCoord4bOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord4bvOES( const GLbyte *coords )
@@ -18738,7 +18738,7 @@ static void WINAPI glTexCoord4fColor4fNormal3fVertex4fSUN( GLfloat s, GLfloat t,
     struct glTexCoord4fColor4fNormal3fVertex4fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .p = p, .q = q, .r = r, .g = g, .b = b, .a = a, .nx = nx, .ny = ny, .nz = nz, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "s %f, t %f, p %f, q %f, r %f, g %f, b %f, a %f, nx %f, ny %f, nz %f, x %f, y %f, z %f, w %f\n", s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w );
-    if ((status = UNIX_CALL( glTexCoord4fColor4fNormal3fVertex4fSUN, &args ))) WARN( "glTexCoord4fColor4fNormal3fVertex4fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4fColor4fNormal3fVertex4fSUN, &args ))) WARN( "glTexCoord4fColor4fNormal3fVertex4fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord4fColor4fNormal3fVertex4fvSUN( const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v )
@@ -18754,7 +18754,7 @@ static void WINAPI glTexCoord4fVertex4fSUN( GLfloat s, GLfloat t, GLfloat p, GLf
     struct glTexCoord4fVertex4fSUN_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .p = p, .q = q, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "s %f, t %f, p %f, q %f, x %f, y %f, z %f, w %f\n", s, t, p, q, x, y, z, w );
-    if ((status = UNIX_CALL( glTexCoord4fVertex4fSUN, &args ))) WARN( "glTexCoord4fVertex4fSUN returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4fVertex4fSUN, &args ))) WARN( "glTexCoord4fVertex4fSUN returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord4fVertex4fvSUN( const GLfloat *tc, const GLfloat *v )
@@ -18770,7 +18770,7 @@ static void WINAPI glTexCoord4hNV( GLhalfNV s, GLhalfNV t, GLhalfNV r, GLhalfNV
     struct glTexCoord4hNV_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4hNV, &args ))) WARN( "glTexCoord4hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4hNV, &args ))) WARN( "glTexCoord4hNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord4hvNV( const GLhalfNV *v )
@@ -18786,7 +18786,7 @@ static void WINAPI glTexCoord4xOES( GLfixed s, GLfixed t, GLfixed r, GLfixed q )
     struct glTexCoord4xOES_params args = { .teb = NtCurrentTeb(), .s = s, .t = t, .r = r, .q = q };
     NTSTATUS status;
     TRACE( "s %d, t %d, r %d, q %d\n", s, t, r, q );
-    if ((status = UNIX_CALL( glTexCoord4xOES, &args ))) WARN( "glTexCoord4xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoord4xOES, &args ))) WARN( "glTexCoord4xOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoord4xvOES( const GLfixed *coords )
@@ -18802,7 +18802,7 @@ static void WINAPI glTexCoordFormatNV( GLint size, GLenum type, GLsizei stride )
     struct glTexCoordFormatNV_params args = { .teb = NtCurrentTeb(), .size = size, .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "size %d, type %d, stride %d\n", size, type, stride );
-    if ((status = UNIX_CALL( glTexCoordFormatNV, &args ))) WARN( "glTexCoordFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoordFormatNV, &args ))) WARN( "glTexCoordFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoordP1ui( GLenum type, GLuint coords )
@@ -18810,7 +18810,7 @@ static void WINAPI glTexCoordP1ui( GLenum type, GLuint coords )
     struct glTexCoordP1ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glTexCoordP1ui, &args ))) WARN( "glTexCoordP1ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoordP1ui, &args ))) WARN( "glTexCoordP1ui returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoordP1uiv( GLenum type, const GLuint *coords )
@@ -18826,7 +18826,7 @@ static void WINAPI glTexCoordP2ui( GLenum type, GLuint coords )
     struct glTexCoordP2ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glTexCoordP2ui, &args ))) WARN( "glTexCoordP2ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoordP2ui, &args ))) WARN( "glTexCoordP2ui returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoordP2uiv( GLenum type, const GLuint *coords )
@@ -18842,7 +18842,7 @@ static void WINAPI glTexCoordP3ui( GLenum type, GLuint coords )
     struct glTexCoordP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glTexCoordP3ui, &args ))) WARN( "glTexCoordP3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoordP3ui, &args ))) WARN( "glTexCoordP3ui returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoordP3uiv( GLenum type, const GLuint *coords )
@@ -18858,7 +18858,7 @@ static void WINAPI glTexCoordP4ui( GLenum type, GLuint coords )
     struct glTexCoordP4ui_params args = { .teb = NtCurrentTeb(), .type = type, .coords = coords };
     NTSTATUS status;
     TRACE( "type %d, coords %d\n", type, coords );
-    if ((status = UNIX_CALL( glTexCoordP4ui, &args ))) WARN( "glTexCoordP4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexCoordP4ui, &args ))) WARN( "glTexCoordP4ui returned %#lx\n", status );
 }
 
 static void WINAPI glTexCoordP4uiv( GLenum type, const GLuint *coords )
@@ -18898,7 +18898,7 @@ static void WINAPI glTexEnvxOES( GLenum target, GLenum pname, GLfixed param )
     struct glTexEnvxOES_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexEnvxOES, &args ))) WARN( "glTexEnvxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexEnvxOES, &args ))) WARN( "glTexEnvxOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexEnvxvOES( GLenum target, GLenum pname, const GLfixed *params )
@@ -18922,7 +18922,7 @@ static void WINAPI glTexGenxOES( GLenum coord, GLenum pname, GLfixed param )
     struct glTexGenxOES_params args = { .teb = NtCurrentTeb(), .coord = coord, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "coord %d, pname %d, param %d\n", coord, pname, param );
-    if ((status = UNIX_CALL( glTexGenxOES, &args ))) WARN( "glTexGenxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexGenxOES, &args ))) WARN( "glTexGenxOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexGenxvOES( GLenum coord, GLenum pname, const GLfixed *params )
@@ -18938,7 +18938,7 @@ static void WINAPI glTexImage2DMultisample( GLenum target, GLsizei samples, GLen
     struct glTexImage2DMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d, fixedsamplelocations %d\n", target, samples, internalformat, width, height, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTexImage2DMultisample, &args ))) WARN( "glTexImage2DMultisample returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexImage2DMultisample, &args ))) WARN( "glTexImage2DMultisample returned %#lx\n", status );
 }
 
 static void WINAPI glTexImage2DMultisampleCoverageNV( GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations )
@@ -18946,7 +18946,7 @@ static void WINAPI glTexImage2DMultisampleCoverageNV( GLenum target, GLsizei cov
     struct glTexImage2DMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations };
     NTSTATUS status;
     TRACE( "target %d, coverageSamples %d, colorSamples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d\n", target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTexImage2DMultisampleCoverageNV, &args ))) WARN( "glTexImage2DMultisampleCoverageNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexImage2DMultisampleCoverageNV, &args ))) WARN( "glTexImage2DMultisampleCoverageNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexImage3D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels )
@@ -18970,7 +18970,7 @@ static void WINAPI glTexImage3DMultisample( GLenum target, GLsizei samples, GLen
     struct glTexImage3DMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .depth = depth, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d, depth %d, fixedsamplelocations %d\n", target, samples, internalformat, width, height, depth, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTexImage3DMultisample, &args ))) WARN( "glTexImage3DMultisample returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexImage3DMultisample, &args ))) WARN( "glTexImage3DMultisample returned %#lx\n", status );
 }
 
 static void WINAPI glTexImage3DMultisampleCoverageNV( GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations )
@@ -18978,7 +18978,7 @@ static void WINAPI glTexImage3DMultisampleCoverageNV( GLenum target, GLsizei cov
     struct glTexImage3DMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations };
     NTSTATUS status;
     TRACE( "target %d, coverageSamples %d, colorSamples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d\n", target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTexImage3DMultisampleCoverageNV, &args ))) WARN( "glTexImage3DMultisampleCoverageNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexImage3DMultisampleCoverageNV, &args ))) WARN( "glTexImage3DMultisampleCoverageNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexImage4DSGIS( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const void *pixels )
@@ -18994,7 +18994,7 @@ static void WINAPI glTexPageCommitmentARB( GLenum target, GLint level, GLint xof
     struct glTexPageCommitmentARB_params args = { .teb = NtCurrentTeb(), .target = target, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .width = width, .height = height, .depth = depth, .commit = commit };
     NTSTATUS status;
     TRACE( "target %d, level %d, xoffset %d, yoffset %d, zoffset %d, width %d, height %d, depth %d, commit %d\n", target, level, xoffset, yoffset, zoffset, width, height, depth, commit );
-    if ((status = UNIX_CALL( glTexPageCommitmentARB, &args ))) WARN( "glTexPageCommitmentARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexPageCommitmentARB, &args ))) WARN( "glTexPageCommitmentARB returned %#lx\n", status );
 }
 
 static void WINAPI glTexParameterIiv( GLenum target, GLenum pname, const GLint *params )
@@ -19034,7 +19034,7 @@ static void WINAPI glTexParameterxOES( GLenum target, GLenum pname, GLfixed para
     struct glTexParameterxOES_params args = { .teb = NtCurrentTeb(), .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "target %d, pname %d, param %d\n", target, pname, param );
-    if ((status = UNIX_CALL( glTexParameterxOES, &args ))) WARN( "glTexParameterxOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexParameterxOES, &args ))) WARN( "glTexParameterxOES returned %#lx\n", status );
 }
 
 static void WINAPI glTexParameterxvOES( GLenum target, GLenum pname, const GLfixed *params )
@@ -19050,7 +19050,7 @@ static void WINAPI glTexRenderbufferNV( GLenum target, GLuint renderbuffer )
     struct glTexRenderbufferNV_params args = { .teb = NtCurrentTeb(), .target = target, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "target %d, renderbuffer %d\n", target, renderbuffer );
-    if ((status = UNIX_CALL( glTexRenderbufferNV, &args ))) WARN( "glTexRenderbufferNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexRenderbufferNV, &args ))) WARN( "glTexRenderbufferNV returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorage1D( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width )
@@ -19058,7 +19058,7 @@ static void WINAPI glTexStorage1D( GLenum target, GLsizei levels, GLenum interna
     struct glTexStorage1D_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalformat = internalformat, .width = width };
     NTSTATUS status;
     TRACE( "target %d, levels %d, internalformat %d, width %d\n", target, levels, internalformat, width );
-    if ((status = UNIX_CALL( glTexStorage1D, &args ))) WARN( "glTexStorage1D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorage1D, &args ))) WARN( "glTexStorage1D returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorage2D( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height )
@@ -19066,7 +19066,7 @@ static void WINAPI glTexStorage2D( GLenum target, GLsizei levels, GLenum interna
     struct glTexStorage2D_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "target %d, levels %d, internalformat %d, width %d, height %d\n", target, levels, internalformat, width, height );
-    if ((status = UNIX_CALL( glTexStorage2D, &args ))) WARN( "glTexStorage2D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorage2D, &args ))) WARN( "glTexStorage2D returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorage2DMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations )
@@ -19074,7 +19074,7 @@ static void WINAPI glTexStorage2DMultisample( GLenum target, GLsizei samples, GL
     struct glTexStorage2DMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d, fixedsamplelocations %d\n", target, samples, internalformat, width, height, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTexStorage2DMultisample, &args ))) WARN( "glTexStorage2DMultisample returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorage2DMultisample, &args ))) WARN( "glTexStorage2DMultisample returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorage3D( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth )
@@ -19082,7 +19082,7 @@ static void WINAPI glTexStorage3D( GLenum target, GLsizei levels, GLenum interna
     struct glTexStorage3D_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalformat = internalformat, .width = width, .height = height, .depth = depth };
     NTSTATUS status;
     TRACE( "target %d, levels %d, internalformat %d, width %d, height %d, depth %d\n", target, levels, internalformat, width, height, depth );
-    if ((status = UNIX_CALL( glTexStorage3D, &args ))) WARN( "glTexStorage3D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorage3D, &args ))) WARN( "glTexStorage3D returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorage3DMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations )
@@ -19090,7 +19090,7 @@ static void WINAPI glTexStorage3DMultisample( GLenum target, GLsizei samples, GL
     struct glTexStorage3DMultisample_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .depth = depth, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "target %d, samples %d, internalformat %d, width %d, height %d, depth %d, fixedsamplelocations %d\n", target, samples, internalformat, width, height, depth, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTexStorage3DMultisample, &args ))) WARN( "glTexStorage3DMultisample returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorage3DMultisample, &args ))) WARN( "glTexStorage3DMultisample returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorageMem1DEXT( GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset )
@@ -19098,7 +19098,7 @@ static void WINAPI glTexStorageMem1DEXT( GLenum target, GLsizei levels, GLenum i
     struct glTexStorageMem1DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalFormat = internalFormat, .width = width, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "target %d, levels %d, internalFormat %d, width %d, memory %d, offset %s\n", target, levels, internalFormat, width, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem1DEXT, &args ))) WARN( "glTexStorageMem1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorageMem1DEXT, &args ))) WARN( "glTexStorageMem1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorageMem2DEXT( GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset )
@@ -19106,7 +19106,7 @@ static void WINAPI glTexStorageMem2DEXT( GLenum target, GLsizei levels, GLenum i
     struct glTexStorageMem2DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalFormat = internalFormat, .width = width, .height = height, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "target %d, levels %d, internalFormat %d, width %d, height %d, memory %d, offset %s\n", target, levels, internalFormat, width, height, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem2DEXT, &args ))) WARN( "glTexStorageMem2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorageMem2DEXT, &args ))) WARN( "glTexStorageMem2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorageMem2DMultisampleEXT( GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset )
@@ -19114,7 +19114,7 @@ static void WINAPI glTexStorageMem2DMultisampleEXT( GLenum target, GLsizei sampl
     struct glTexStorageMem2DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "target %d, samples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d, memory %d, offset %s\n", target, samples, internalFormat, width, height, fixedSampleLocations, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem2DMultisampleEXT, &args ))) WARN( "glTexStorageMem2DMultisampleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorageMem2DMultisampleEXT, &args ))) WARN( "glTexStorageMem2DMultisampleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorageMem3DEXT( GLenum target, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset )
@@ -19122,7 +19122,7 @@ static void WINAPI glTexStorageMem3DEXT( GLenum target, GLsizei levels, GLenum i
     struct glTexStorageMem3DEXT_params args = { .teb = NtCurrentTeb(), .target = target, .levels = levels, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "target %d, levels %d, internalFormat %d, width %d, height %d, depth %d, memory %d, offset %s\n", target, levels, internalFormat, width, height, depth, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem3DEXT, &args ))) WARN( "glTexStorageMem3DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorageMem3DEXT, &args ))) WARN( "glTexStorageMem3DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorageMem3DMultisampleEXT( GLenum target, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset )
@@ -19130,7 +19130,7 @@ static void WINAPI glTexStorageMem3DMultisampleEXT( GLenum target, GLsizei sampl
     struct glTexStorageMem3DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .target = target, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "target %d, samples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d, memory %d, offset %s\n", target, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTexStorageMem3DMultisampleEXT, &args ))) WARN( "glTexStorageMem3DMultisampleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorageMem3DMultisampleEXT, &args ))) WARN( "glTexStorageMem3DMultisampleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTexStorageSparseAMD( GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags )
@@ -19138,7 +19138,7 @@ static void WINAPI glTexStorageSparseAMD( GLenum target, GLenum internalFormat,
     struct glTexStorageSparseAMD_params args = { .teb = NtCurrentTeb(), .target = target, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .layers = layers, .flags = flags };
     NTSTATUS status;
     TRACE( "target %d, internalFormat %d, width %d, height %d, depth %d, layers %d, flags %d\n", target, internalFormat, width, height, depth, layers, flags );
-    if ((status = UNIX_CALL( glTexStorageSparseAMD, &args ))) WARN( "glTexStorageSparseAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexStorageSparseAMD, &args ))) WARN( "glTexStorageSparseAMD returned %#lx\n", status );
 }
 
 static void WINAPI glTexSubImage1DEXT( GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels )
@@ -19186,7 +19186,7 @@ static void WINAPI glTextureAttachMemoryNV( GLuint texture, GLuint memory, GLuin
     struct glTextureAttachMemoryNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "texture %d, memory %d, offset %s\n", texture, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureAttachMemoryNV, &args ))) WARN( "glTextureAttachMemoryNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureAttachMemoryNV, &args ))) WARN( "glTextureAttachMemoryNV returned %#lx\n", status );
 }
 
 static void WINAPI glTextureBarrier(void)
@@ -19194,7 +19194,7 @@ static void WINAPI glTextureBarrier(void)
     struct glTextureBarrier_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glTextureBarrier, &args ))) WARN( "glTextureBarrier returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureBarrier, &args ))) WARN( "glTextureBarrier returned %#lx\n", status );
 }
 
 static void WINAPI glTextureBarrierNV(void)
@@ -19202,7 +19202,7 @@ static void WINAPI glTextureBarrierNV(void)
     struct glTextureBarrierNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glTextureBarrierNV, &args ))) WARN( "glTextureBarrierNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureBarrierNV, &args ))) WARN( "glTextureBarrierNV returned %#lx\n", status );
 }
 
 static void WINAPI glTextureBuffer( GLuint texture, GLenum internalformat, GLuint buffer )
@@ -19210,7 +19210,7 @@ static void WINAPI glTextureBuffer( GLuint texture, GLenum internalformat, GLuin
     struct glTextureBuffer_params args = { .teb = NtCurrentTeb(), .texture = texture, .internalformat = internalformat, .buffer = buffer };
     NTSTATUS status;
     TRACE( "texture %d, internalformat %d, buffer %d\n", texture, internalformat, buffer );
-    if ((status = UNIX_CALL( glTextureBuffer, &args ))) WARN( "glTextureBuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureBuffer, &args ))) WARN( "glTextureBuffer returned %#lx\n", status );
 }
 
 static void WINAPI glTextureBufferEXT( GLuint texture, GLenum target, GLenum internalformat, GLuint buffer )
@@ -19218,7 +19218,7 @@ static void WINAPI glTextureBufferEXT( GLuint texture, GLenum target, GLenum int
     struct glTextureBufferEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .internalformat = internalformat, .buffer = buffer };
     NTSTATUS status;
     TRACE( "texture %d, target %d, internalformat %d, buffer %d\n", texture, target, internalformat, buffer );
-    if ((status = UNIX_CALL( glTextureBufferEXT, &args ))) WARN( "glTextureBufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureBufferEXT, &args ))) WARN( "glTextureBufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureBufferRange( GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size )
@@ -19242,7 +19242,7 @@ static void WINAPI glTextureColorMaskSGIS( GLboolean red, GLboolean green, GLboo
     struct glTextureColorMaskSGIS_params args = { .teb = NtCurrentTeb(), .red = red, .green = green, .blue = blue, .alpha = alpha };
     NTSTATUS status;
     TRACE( "red %d, green %d, blue %d, alpha %d\n", red, green, blue, alpha );
-    if ((status = UNIX_CALL( glTextureColorMaskSGIS, &args ))) WARN( "glTextureColorMaskSGIS returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureColorMaskSGIS, &args ))) WARN( "glTextureColorMaskSGIS returned %#lx\n", status );
 }
 
 static void WINAPI glTextureImage1DEXT( GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels )
@@ -19266,7 +19266,7 @@ static void WINAPI glTextureImage2DMultisampleCoverageNV( GLuint texture, GLenum
     struct glTextureImage2DMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations };
     NTSTATUS status;
     TRACE( "texture %d, target %d, coverageSamples %d, colorSamples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d\n", texture, target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTextureImage2DMultisampleCoverageNV, &args ))) WARN( "glTextureImage2DMultisampleCoverageNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureImage2DMultisampleCoverageNV, &args ))) WARN( "glTextureImage2DMultisampleCoverageNV returned %#lx\n", status );
 }
 
 static void WINAPI glTextureImage2DMultisampleNV( GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations )
@@ -19274,7 +19274,7 @@ static void WINAPI glTextureImage2DMultisampleNV( GLuint texture, GLenum target,
     struct glTextureImage2DMultisampleNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations };
     NTSTATUS status;
     TRACE( "texture %d, target %d, samples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d\n", texture, target, samples, internalFormat, width, height, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTextureImage2DMultisampleNV, &args ))) WARN( "glTextureImage2DMultisampleNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureImage2DMultisampleNV, &args ))) WARN( "glTextureImage2DMultisampleNV returned %#lx\n", status );
 }
 
 static void WINAPI glTextureImage3DEXT( GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels )
@@ -19290,7 +19290,7 @@ static void WINAPI glTextureImage3DMultisampleCoverageNV( GLuint texture, GLenum
     struct glTextureImage3DMultisampleCoverageNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .coverageSamples = coverageSamples, .colorSamples = colorSamples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations };
     NTSTATUS status;
     TRACE( "texture %d, target %d, coverageSamples %d, colorSamples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d\n", texture, target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTextureImage3DMultisampleCoverageNV, &args ))) WARN( "glTextureImage3DMultisampleCoverageNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureImage3DMultisampleCoverageNV, &args ))) WARN( "glTextureImage3DMultisampleCoverageNV returned %#lx\n", status );
 }
 
 static void WINAPI glTextureImage3DMultisampleNV( GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations )
@@ -19298,7 +19298,7 @@ static void WINAPI glTextureImage3DMultisampleNV( GLuint texture, GLenum target,
     struct glTextureImage3DMultisampleNV_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations };
     NTSTATUS status;
     TRACE( "texture %d, target %d, samples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d\n", texture, target, samples, internalFormat, width, height, depth, fixedSampleLocations );
-    if ((status = UNIX_CALL( glTextureImage3DMultisampleNV, &args ))) WARN( "glTextureImage3DMultisampleNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureImage3DMultisampleNV, &args ))) WARN( "glTextureImage3DMultisampleNV returned %#lx\n", status );
 }
 
 static void WINAPI glTextureLightEXT( GLenum pname )
@@ -19306,7 +19306,7 @@ static void WINAPI glTextureLightEXT( GLenum pname )
     struct glTextureLightEXT_params args = { .teb = NtCurrentTeb(), .pname = pname };
     NTSTATUS status;
     TRACE( "pname %d\n", pname );
-    if ((status = UNIX_CALL( glTextureLightEXT, &args ))) WARN( "glTextureLightEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureLightEXT, &args ))) WARN( "glTextureLightEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureMaterialEXT( GLenum face, GLenum mode )
@@ -19314,7 +19314,7 @@ static void WINAPI glTextureMaterialEXT( GLenum face, GLenum mode )
     struct glTextureMaterialEXT_params args = { .teb = NtCurrentTeb(), .face = face, .mode = mode };
     NTSTATUS status;
     TRACE( "face %d, mode %d\n", face, mode );
-    if ((status = UNIX_CALL( glTextureMaterialEXT, &args ))) WARN( "glTextureMaterialEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureMaterialEXT, &args ))) WARN( "glTextureMaterialEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureNormalEXT( GLenum mode )
@@ -19322,7 +19322,7 @@ static void WINAPI glTextureNormalEXT( GLenum mode )
     struct glTextureNormalEXT_params args = { .teb = NtCurrentTeb(), .mode = mode };
     NTSTATUS status;
     TRACE( "mode %d\n", mode );
-    if ((status = UNIX_CALL( glTextureNormalEXT, &args ))) WARN( "glTextureNormalEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureNormalEXT, &args ))) WARN( "glTextureNormalEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTexturePageCommitmentEXT( GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit )
@@ -19330,7 +19330,7 @@ static void WINAPI glTexturePageCommitmentEXT( GLuint texture, GLint level, GLin
     struct glTexturePageCommitmentEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level, .xoffset = xoffset, .yoffset = yoffset, .zoffset = zoffset, .width = width, .height = height, .depth = depth, .commit = commit };
     NTSTATUS status;
     TRACE( "texture %d, level %d, xoffset %d, yoffset %d, zoffset %d, width %d, height %d, depth %d, commit %d\n", texture, level, xoffset, yoffset, zoffset, width, height, depth, commit );
-    if ((status = UNIX_CALL( glTexturePageCommitmentEXT, &args ))) WARN( "glTexturePageCommitmentEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTexturePageCommitmentEXT, &args ))) WARN( "glTexturePageCommitmentEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureParameterIiv( GLuint texture, GLenum pname, const GLint *params )
@@ -19370,7 +19370,7 @@ static void WINAPI glTextureParameterf( GLuint texture, GLenum pname, GLfloat pa
     struct glTextureParameterf_params args = { .teb = NtCurrentTeb(), .texture = texture, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texture %d, pname %d, param %f\n", texture, pname, param );
-    if ((status = UNIX_CALL( glTextureParameterf, &args ))) WARN( "glTextureParameterf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureParameterf, &args ))) WARN( "glTextureParameterf returned %#lx\n", status );
 }
 
 static void WINAPI glTextureParameterfEXT( GLuint texture, GLenum target, GLenum pname, GLfloat param )
@@ -19378,7 +19378,7 @@ static void WINAPI glTextureParameterfEXT( GLuint texture, GLenum target, GLenum
     struct glTextureParameterfEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texture %d, target %d, pname %d, param %f\n", texture, target, pname, param );
-    if ((status = UNIX_CALL( glTextureParameterfEXT, &args ))) WARN( "glTextureParameterfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureParameterfEXT, &args ))) WARN( "glTextureParameterfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureParameterfv( GLuint texture, GLenum pname, const GLfloat *param )
@@ -19402,7 +19402,7 @@ static void WINAPI glTextureParameteri( GLuint texture, GLenum pname, GLint para
     struct glTextureParameteri_params args = { .teb = NtCurrentTeb(), .texture = texture, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texture %d, pname %d, param %d\n", texture, pname, param );
-    if ((status = UNIX_CALL( glTextureParameteri, &args ))) WARN( "glTextureParameteri returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureParameteri, &args ))) WARN( "glTextureParameteri returned %#lx\n", status );
 }
 
 static void WINAPI glTextureParameteriEXT( GLuint texture, GLenum target, GLenum pname, GLint param )
@@ -19410,7 +19410,7 @@ static void WINAPI glTextureParameteriEXT( GLuint texture, GLenum target, GLenum
     struct glTextureParameteriEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "texture %d, target %d, pname %d, param %d\n", texture, target, pname, param );
-    if ((status = UNIX_CALL( glTextureParameteriEXT, &args ))) WARN( "glTextureParameteriEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureParameteriEXT, &args ))) WARN( "glTextureParameteriEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureParameteriv( GLuint texture, GLenum pname, const GLint *param )
@@ -19442,7 +19442,7 @@ static void WINAPI glTextureRenderbufferEXT( GLuint texture, GLenum target, GLui
     struct glTextureRenderbufferEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .renderbuffer = renderbuffer };
     NTSTATUS status;
     TRACE( "texture %d, target %d, renderbuffer %d\n", texture, target, renderbuffer );
-    if ((status = UNIX_CALL( glTextureRenderbufferEXT, &args ))) WARN( "glTextureRenderbufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureRenderbufferEXT, &args ))) WARN( "glTextureRenderbufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage1D( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width )
@@ -19450,7 +19450,7 @@ static void WINAPI glTextureStorage1D( GLuint texture, GLsizei levels, GLenum in
     struct glTextureStorage1D_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalformat = internalformat, .width = width };
     NTSTATUS status;
     TRACE( "texture %d, levels %d, internalformat %d, width %d\n", texture, levels, internalformat, width );
-    if ((status = UNIX_CALL( glTextureStorage1D, &args ))) WARN( "glTextureStorage1D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage1D, &args ))) WARN( "glTextureStorage1D returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage1DEXT( GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width )
@@ -19458,7 +19458,7 @@ static void WINAPI glTextureStorage1DEXT( GLuint texture, GLenum target, GLsizei
     struct glTextureStorage1DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .levels = levels, .internalformat = internalformat, .width = width };
     NTSTATUS status;
     TRACE( "texture %d, target %d, levels %d, internalformat %d, width %d\n", texture, target, levels, internalformat, width );
-    if ((status = UNIX_CALL( glTextureStorage1DEXT, &args ))) WARN( "glTextureStorage1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage1DEXT, &args ))) WARN( "glTextureStorage1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage2D( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height )
@@ -19466,7 +19466,7 @@ static void WINAPI glTextureStorage2D( GLuint texture, GLsizei levels, GLenum in
     struct glTextureStorage2D_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "texture %d, levels %d, internalformat %d, width %d, height %d\n", texture, levels, internalformat, width, height );
-    if ((status = UNIX_CALL( glTextureStorage2D, &args ))) WARN( "glTextureStorage2D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage2D, &args ))) WARN( "glTextureStorage2D returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage2DEXT( GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height )
@@ -19474,7 +19474,7 @@ static void WINAPI glTextureStorage2DEXT( GLuint texture, GLenum target, GLsizei
     struct glTextureStorage2DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .levels = levels, .internalformat = internalformat, .width = width, .height = height };
     NTSTATUS status;
     TRACE( "texture %d, target %d, levels %d, internalformat %d, width %d, height %d\n", texture, target, levels, internalformat, width, height );
-    if ((status = UNIX_CALL( glTextureStorage2DEXT, &args ))) WARN( "glTextureStorage2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage2DEXT, &args ))) WARN( "glTextureStorage2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage2DMultisample( GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations )
@@ -19482,7 +19482,7 @@ static void WINAPI glTextureStorage2DMultisample( GLuint texture, GLsizei sample
     struct glTextureStorage2DMultisample_params args = { .teb = NtCurrentTeb(), .texture = texture, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "texture %d, samples %d, internalformat %d, width %d, height %d, fixedsamplelocations %d\n", texture, samples, internalformat, width, height, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTextureStorage2DMultisample, &args ))) WARN( "glTextureStorage2DMultisample returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage2DMultisample, &args ))) WARN( "glTextureStorage2DMultisample returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage2DMultisampleEXT( GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations )
@@ -19490,7 +19490,7 @@ static void WINAPI glTextureStorage2DMultisampleEXT( GLuint texture, GLenum targ
     struct glTextureStorage2DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "texture %d, target %d, samples %d, internalformat %d, width %d, height %d, fixedsamplelocations %d\n", texture, target, samples, internalformat, width, height, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTextureStorage2DMultisampleEXT, &args ))) WARN( "glTextureStorage2DMultisampleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage2DMultisampleEXT, &args ))) WARN( "glTextureStorage2DMultisampleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage3D( GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth )
@@ -19498,7 +19498,7 @@ static void WINAPI glTextureStorage3D( GLuint texture, GLsizei levels, GLenum in
     struct glTextureStorage3D_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalformat = internalformat, .width = width, .height = height, .depth = depth };
     NTSTATUS status;
     TRACE( "texture %d, levels %d, internalformat %d, width %d, height %d, depth %d\n", texture, levels, internalformat, width, height, depth );
-    if ((status = UNIX_CALL( glTextureStorage3D, &args ))) WARN( "glTextureStorage3D returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage3D, &args ))) WARN( "glTextureStorage3D returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage3DEXT( GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth )
@@ -19506,7 +19506,7 @@ static void WINAPI glTextureStorage3DEXT( GLuint texture, GLenum target, GLsizei
     struct glTextureStorage3DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .levels = levels, .internalformat = internalformat, .width = width, .height = height, .depth = depth };
     NTSTATUS status;
     TRACE( "texture %d, target %d, levels %d, internalformat %d, width %d, height %d, depth %d\n", texture, target, levels, internalformat, width, height, depth );
-    if ((status = UNIX_CALL( glTextureStorage3DEXT, &args ))) WARN( "glTextureStorage3DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage3DEXT, &args ))) WARN( "glTextureStorage3DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage3DMultisample( GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations )
@@ -19514,7 +19514,7 @@ static void WINAPI glTextureStorage3DMultisample( GLuint texture, GLsizei sample
     struct glTextureStorage3DMultisample_params args = { .teb = NtCurrentTeb(), .texture = texture, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .depth = depth, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "texture %d, samples %d, internalformat %d, width %d, height %d, depth %d, fixedsamplelocations %d\n", texture, samples, internalformat, width, height, depth, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTextureStorage3DMultisample, &args ))) WARN( "glTextureStorage3DMultisample returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage3DMultisample, &args ))) WARN( "glTextureStorage3DMultisample returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorage3DMultisampleEXT( GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations )
@@ -19522,7 +19522,7 @@ static void WINAPI glTextureStorage3DMultisampleEXT( GLuint texture, GLenum targ
     struct glTextureStorage3DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .samples = samples, .internalformat = internalformat, .width = width, .height = height, .depth = depth, .fixedsamplelocations = fixedsamplelocations };
     NTSTATUS status;
     TRACE( "texture %d, target %d, samples %d, internalformat %d, width %d, height %d, depth %d, fixedsamplelocations %d\n", texture, target, samples, internalformat, width, height, depth, fixedsamplelocations );
-    if ((status = UNIX_CALL( glTextureStorage3DMultisampleEXT, &args ))) WARN( "glTextureStorage3DMultisampleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorage3DMultisampleEXT, &args ))) WARN( "glTextureStorage3DMultisampleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorageMem1DEXT( GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLuint memory, GLuint64 offset )
@@ -19530,7 +19530,7 @@ static void WINAPI glTextureStorageMem1DEXT( GLuint texture, GLsizei levels, GLe
     struct glTextureStorageMem1DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalFormat = internalFormat, .width = width, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "texture %d, levels %d, internalFormat %d, width %d, memory %d, offset %s\n", texture, levels, internalFormat, width, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem1DEXT, &args ))) WARN( "glTextureStorageMem1DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorageMem1DEXT, &args ))) WARN( "glTextureStorageMem1DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorageMem2DEXT( GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLuint memory, GLuint64 offset )
@@ -19538,7 +19538,7 @@ static void WINAPI glTextureStorageMem2DEXT( GLuint texture, GLsizei levels, GLe
     struct glTextureStorageMem2DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalFormat = internalFormat, .width = width, .height = height, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "texture %d, levels %d, internalFormat %d, width %d, height %d, memory %d, offset %s\n", texture, levels, internalFormat, width, height, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem2DEXT, &args ))) WARN( "glTextureStorageMem2DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorageMem2DEXT, &args ))) WARN( "glTextureStorageMem2DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorageMem2DMultisampleEXT( GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset )
@@ -19546,7 +19546,7 @@ static void WINAPI glTextureStorageMem2DMultisampleEXT( GLuint texture, GLsizei
     struct glTextureStorageMem2DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .fixedSampleLocations = fixedSampleLocations, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "texture %d, samples %d, internalFormat %d, width %d, height %d, fixedSampleLocations %d, memory %d, offset %s\n", texture, samples, internalFormat, width, height, fixedSampleLocations, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem2DMultisampleEXT, &args ))) WARN( "glTextureStorageMem2DMultisampleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorageMem2DMultisampleEXT, &args ))) WARN( "glTextureStorageMem2DMultisampleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorageMem3DEXT( GLuint texture, GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLuint memory, GLuint64 offset )
@@ -19554,7 +19554,7 @@ static void WINAPI glTextureStorageMem3DEXT( GLuint texture, GLsizei levels, GLe
     struct glTextureStorageMem3DEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .levels = levels, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "texture %d, levels %d, internalFormat %d, width %d, height %d, depth %d, memory %d, offset %s\n", texture, levels, internalFormat, width, height, depth, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem3DEXT, &args ))) WARN( "glTextureStorageMem3DEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorageMem3DEXT, &args ))) WARN( "glTextureStorageMem3DEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorageMem3DMultisampleEXT( GLuint texture, GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations, GLuint memory, GLuint64 offset )
@@ -19562,7 +19562,7 @@ static void WINAPI glTextureStorageMem3DMultisampleEXT( GLuint texture, GLsizei
     struct glTextureStorageMem3DMultisampleEXT_params args = { .teb = NtCurrentTeb(), .texture = texture, .samples = samples, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .fixedSampleLocations = fixedSampleLocations, .memory = memory, .offset = offset };
     NTSTATUS status;
     TRACE( "texture %d, samples %d, internalFormat %d, width %d, height %d, depth %d, fixedSampleLocations %d, memory %d, offset %s\n", texture, samples, internalFormat, width, height, depth, fixedSampleLocations, memory, wine_dbgstr_longlong(offset) );
-    if ((status = UNIX_CALL( glTextureStorageMem3DMultisampleEXT, &args ))) WARN( "glTextureStorageMem3DMultisampleEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorageMem3DMultisampleEXT, &args ))) WARN( "glTextureStorageMem3DMultisampleEXT returned %#lx\n", status );
 }
 
 static void WINAPI glTextureStorageSparseAMD( GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags )
@@ -19570,7 +19570,7 @@ static void WINAPI glTextureStorageSparseAMD( GLuint texture, GLenum target, GLe
     struct glTextureStorageSparseAMD_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .internalFormat = internalFormat, .width = width, .height = height, .depth = depth, .layers = layers, .flags = flags };
     NTSTATUS status;
     TRACE( "texture %d, target %d, internalFormat %d, width %d, height %d, depth %d, layers %d, flags %d\n", texture, target, internalFormat, width, height, depth, layers, flags );
-    if ((status = UNIX_CALL( glTextureStorageSparseAMD, &args ))) WARN( "glTextureStorageSparseAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureStorageSparseAMD, &args ))) WARN( "glTextureStorageSparseAMD returned %#lx\n", status );
 }
 
 static void WINAPI glTextureSubImage1D( GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels )
@@ -19626,7 +19626,7 @@ static void WINAPI glTextureView( GLuint texture, GLenum target, GLuint origtext
     struct glTextureView_params args = { .teb = NtCurrentTeb(), .texture = texture, .target = target, .origtexture = origtexture, .internalformat = internalformat, .minlevel = minlevel, .numlevels = numlevels, .minlayer = minlayer, .numlayers = numlayers };
     NTSTATUS status;
     TRACE( "texture %d, target %d, origtexture %d, internalformat %d, minlevel %d, numlevels %d, minlayer %d, numlayers %d\n", texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers );
-    if ((status = UNIX_CALL( glTextureView, &args ))) WARN( "glTextureView returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTextureView, &args ))) WARN( "glTextureView returned %#lx\n", status );
 }
 
 static void WINAPI glTrackMatrixNV( GLenum target, GLuint address, GLenum matrix, GLenum transform )
@@ -19634,7 +19634,7 @@ static void WINAPI glTrackMatrixNV( GLenum target, GLuint address, GLenum matrix
     struct glTrackMatrixNV_params args = { .teb = NtCurrentTeb(), .target = target, .address = address, .matrix = matrix, .transform = transform };
     NTSTATUS status;
     TRACE( "target %d, address %d, matrix %d, transform %d\n", target, address, matrix, transform );
-    if ((status = UNIX_CALL( glTrackMatrixNV, &args ))) WARN( "glTrackMatrixNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTrackMatrixNV, &args ))) WARN( "glTrackMatrixNV returned %#lx\n", status );
 }
 
 static void WINAPI glTransformFeedbackAttribsNV( GLsizei count, const GLint *attribs, GLenum bufferMode )
@@ -19650,7 +19650,7 @@ static void WINAPI glTransformFeedbackBufferBase( GLuint xfb, GLuint index, GLui
     struct glTransformFeedbackBufferBase_params args = { .teb = NtCurrentTeb(), .xfb = xfb, .index = index, .buffer = buffer };
     NTSTATUS status;
     TRACE( "xfb %d, index %d, buffer %d\n", xfb, index, buffer );
-    if ((status = UNIX_CALL( glTransformFeedbackBufferBase, &args ))) WARN( "glTransformFeedbackBufferBase returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTransformFeedbackBufferBase, &args ))) WARN( "glTransformFeedbackBufferBase returned %#lx\n", status );
 }
 
 static void WINAPI glTransformFeedbackBufferRange( GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size )
@@ -19706,7 +19706,7 @@ static void WINAPI glTranslatexOES( GLfixed x, GLfixed y, GLfixed z )
     struct glTranslatexOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glTranslatexOES, &args ))) WARN( "glTranslatexOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glTranslatexOES, &args ))) WARN( "glTranslatexOES returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1d( GLint location, GLdouble x )
@@ -19714,7 +19714,7 @@ static void WINAPI glUniform1d( GLint location, GLdouble x )
     struct glUniform1d_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
     NTSTATUS status;
     TRACE( "location %d, x %f\n", location, x );
-    if ((status = UNIX_CALL( glUniform1d, &args ))) WARN( "glUniform1d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1d, &args ))) WARN( "glUniform1d returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1dv( GLint location, GLsizei count, const GLdouble *value )
@@ -19730,7 +19730,7 @@ static void WINAPI glUniform1f( GLint location, GLfloat v0 )
     struct glUniform1f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "location %d, v0 %f\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1f, &args ))) WARN( "glUniform1f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1f, &args ))) WARN( "glUniform1f returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1fARB( GLint location, GLfloat v0 )
@@ -19738,7 +19738,7 @@ static void WINAPI glUniform1fARB( GLint location, GLfloat v0 )
     struct glUniform1fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "location %d, v0 %f\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1fARB, &args ))) WARN( "glUniform1fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1fARB, &args ))) WARN( "glUniform1fARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1fv( GLint location, GLsizei count, const GLfloat *value )
@@ -19762,7 +19762,7 @@ static void WINAPI glUniform1i( GLint location, GLint v0 )
     struct glUniform1i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1i, &args ))) WARN( "glUniform1i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1i, &args ))) WARN( "glUniform1i returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1i64ARB( GLint location, GLint64 x )
@@ -19770,7 +19770,7 @@ static void WINAPI glUniform1i64ARB( GLint location, GLint64 x )
     struct glUniform1i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
     NTSTATUS status;
     TRACE( "location %d, x %s\n", location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glUniform1i64ARB, &args ))) WARN( "glUniform1i64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1i64ARB, &args ))) WARN( "glUniform1i64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1i64NV( GLint location, GLint64EXT x )
@@ -19778,7 +19778,7 @@ static void WINAPI glUniform1i64NV( GLint location, GLint64EXT x )
     struct glUniform1i64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
     NTSTATUS status;
     TRACE( "location %d, x %s\n", location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glUniform1i64NV, &args ))) WARN( "glUniform1i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1i64NV, &args ))) WARN( "glUniform1i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1i64vARB( GLint location, GLsizei count, const GLint64 *value )
@@ -19802,7 +19802,7 @@ static void WINAPI glUniform1iARB( GLint location, GLint v0 )
     struct glUniform1iARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1iARB, &args ))) WARN( "glUniform1iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1iARB, &args ))) WARN( "glUniform1iARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1iv( GLint location, GLsizei count, const GLint *value )
@@ -19826,7 +19826,7 @@ static void WINAPI glUniform1ui( GLint location, GLuint v0 )
     struct glUniform1ui_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1ui, &args ))) WARN( "glUniform1ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1ui, &args ))) WARN( "glUniform1ui returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1ui64ARB( GLint location, GLuint64 x )
@@ -19834,7 +19834,7 @@ static void WINAPI glUniform1ui64ARB( GLint location, GLuint64 x )
     struct glUniform1ui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
     NTSTATUS status;
     TRACE( "location %d, x %s\n", location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glUniform1ui64ARB, &args ))) WARN( "glUniform1ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1ui64ARB, &args ))) WARN( "glUniform1ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1ui64NV( GLint location, GLuint64EXT x )
@@ -19842,7 +19842,7 @@ static void WINAPI glUniform1ui64NV( GLint location, GLuint64EXT x )
     struct glUniform1ui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x };
     NTSTATUS status;
     TRACE( "location %d, x %s\n", location, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glUniform1ui64NV, &args ))) WARN( "glUniform1ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1ui64NV, &args ))) WARN( "glUniform1ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1ui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -19866,7 +19866,7 @@ static void WINAPI glUniform1uiEXT( GLint location, GLuint v0 )
     struct glUniform1uiEXT_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d\n", location, v0 );
-    if ((status = UNIX_CALL( glUniform1uiEXT, &args ))) WARN( "glUniform1uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform1uiEXT, &args ))) WARN( "glUniform1uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glUniform1uiv( GLint location, GLsizei count, const GLuint *value )
@@ -19890,7 +19890,7 @@ static void WINAPI glUniform2d( GLint location, GLdouble x, GLdouble y )
     struct glUniform2d_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "location %d, x %f, y %f\n", location, x, y );
-    if ((status = UNIX_CALL( glUniform2d, &args ))) WARN( "glUniform2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2d, &args ))) WARN( "glUniform2d returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2dv( GLint location, GLsizei count, const GLdouble *value )
@@ -19906,7 +19906,7 @@ static void WINAPI glUniform2f( GLint location, GLfloat v0, GLfloat v1 )
     struct glUniform2f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2f, &args ))) WARN( "glUniform2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2f, &args ))) WARN( "glUniform2f returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2fARB( GLint location, GLfloat v0, GLfloat v1 )
@@ -19914,7 +19914,7 @@ static void WINAPI glUniform2fARB( GLint location, GLfloat v0, GLfloat v1 )
     struct glUniform2fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2fARB, &args ))) WARN( "glUniform2fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2fARB, &args ))) WARN( "glUniform2fARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2fv( GLint location, GLsizei count, const GLfloat *value )
@@ -19938,7 +19938,7 @@ static void WINAPI glUniform2i( GLint location, GLint v0, GLint v1 )
     struct glUniform2i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2i, &args ))) WARN( "glUniform2i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2i, &args ))) WARN( "glUniform2i returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2i64ARB( GLint location, GLint64 x, GLint64 y )
@@ -19946,7 +19946,7 @@ static void WINAPI glUniform2i64ARB( GLint location, GLint64 x, GLint64 y )
     struct glUniform2i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glUniform2i64ARB, &args ))) WARN( "glUniform2i64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2i64ARB, &args ))) WARN( "glUniform2i64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2i64NV( GLint location, GLint64EXT x, GLint64EXT y )
@@ -19954,7 +19954,7 @@ static void WINAPI glUniform2i64NV( GLint location, GLint64EXT x, GLint64EXT y )
     struct glUniform2i64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glUniform2i64NV, &args ))) WARN( "glUniform2i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2i64NV, &args ))) WARN( "glUniform2i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2i64vARB( GLint location, GLsizei count, const GLint64 *value )
@@ -19978,7 +19978,7 @@ static void WINAPI glUniform2iARB( GLint location, GLint v0, GLint v1 )
     struct glUniform2iARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2iARB, &args ))) WARN( "glUniform2iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2iARB, &args ))) WARN( "glUniform2iARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2iv( GLint location, GLsizei count, const GLint *value )
@@ -20002,7 +20002,7 @@ static void WINAPI glUniform2ui( GLint location, GLuint v0, GLuint v1 )
     struct glUniform2ui_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2ui, &args ))) WARN( "glUniform2ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2ui, &args ))) WARN( "glUniform2ui returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2ui64ARB( GLint location, GLuint64 x, GLuint64 y )
@@ -20010,7 +20010,7 @@ static void WINAPI glUniform2ui64ARB( GLint location, GLuint64 x, GLuint64 y )
     struct glUniform2ui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glUniform2ui64ARB, &args ))) WARN( "glUniform2ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2ui64ARB, &args ))) WARN( "glUniform2ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2ui64NV( GLint location, GLuint64EXT x, GLuint64EXT y )
@@ -20018,7 +20018,7 @@ static void WINAPI glUniform2ui64NV( GLint location, GLuint64EXT x, GLuint64EXT
     struct glUniform2ui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glUniform2ui64NV, &args ))) WARN( "glUniform2ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2ui64NV, &args ))) WARN( "glUniform2ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2ui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -20042,7 +20042,7 @@ static void WINAPI glUniform2uiEXT( GLint location, GLuint v0, GLuint v1 )
     struct glUniform2uiEXT_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d\n", location, v0, v1 );
-    if ((status = UNIX_CALL( glUniform2uiEXT, &args ))) WARN( "glUniform2uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform2uiEXT, &args ))) WARN( "glUniform2uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glUniform2uiv( GLint location, GLsizei count, const GLuint *value )
@@ -20066,7 +20066,7 @@ static void WINAPI glUniform3d( GLint location, GLdouble x, GLdouble y, GLdouble
     struct glUniform3d_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "location %d, x %f, y %f, z %f\n", location, x, y, z );
-    if ((status = UNIX_CALL( glUniform3d, &args ))) WARN( "glUniform3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3d, &args ))) WARN( "glUniform3d returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3dv( GLint location, GLsizei count, const GLdouble *value )
@@ -20082,7 +20082,7 @@ static void WINAPI glUniform3f( GLint location, GLfloat v0, GLfloat v1, GLfloat
     struct glUniform3f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f, v2 %f\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3f, &args ))) WARN( "glUniform3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3f, &args ))) WARN( "glUniform3f returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3fARB( GLint location, GLfloat v0, GLfloat v1, GLfloat v2 )
@@ -20090,7 +20090,7 @@ static void WINAPI glUniform3fARB( GLint location, GLfloat v0, GLfloat v1, GLflo
     struct glUniform3fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f, v2 %f\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3fARB, &args ))) WARN( "glUniform3fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3fARB, &args ))) WARN( "glUniform3fARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3fv( GLint location, GLsizei count, const GLfloat *value )
@@ -20114,7 +20114,7 @@ static void WINAPI glUniform3i( GLint location, GLint v0, GLint v1, GLint v2 )
     struct glUniform3i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3i, &args ))) WARN( "glUniform3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3i, &args ))) WARN( "glUniform3i returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3i64ARB( GLint location, GLint64 x, GLint64 y, GLint64 z )
@@ -20122,7 +20122,7 @@ static void WINAPI glUniform3i64ARB( GLint location, GLint64 x, GLint64 y, GLint
     struct glUniform3i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glUniform3i64ARB, &args ))) WARN( "glUniform3i64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3i64ARB, &args ))) WARN( "glUniform3i64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3i64NV( GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z )
@@ -20130,7 +20130,7 @@ static void WINAPI glUniform3i64NV( GLint location, GLint64EXT x, GLint64EXT y,
     struct glUniform3i64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glUniform3i64NV, &args ))) WARN( "glUniform3i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3i64NV, &args ))) WARN( "glUniform3i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3i64vARB( GLint location, GLsizei count, const GLint64 *value )
@@ -20154,7 +20154,7 @@ static void WINAPI glUniform3iARB( GLint location, GLint v0, GLint v1, GLint v2
     struct glUniform3iARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3iARB, &args ))) WARN( "glUniform3iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3iARB, &args ))) WARN( "glUniform3iARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3iv( GLint location, GLsizei count, const GLint *value )
@@ -20178,7 +20178,7 @@ static void WINAPI glUniform3ui( GLint location, GLuint v0, GLuint v1, GLuint v2
     struct glUniform3ui_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3ui, &args ))) WARN( "glUniform3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3ui, &args ))) WARN( "glUniform3ui returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3ui64ARB( GLint location, GLuint64 x, GLuint64 y, GLuint64 z )
@@ -20186,7 +20186,7 @@ static void WINAPI glUniform3ui64ARB( GLint location, GLuint64 x, GLuint64 y, GL
     struct glUniform3ui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glUniform3ui64ARB, &args ))) WARN( "glUniform3ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3ui64ARB, &args ))) WARN( "glUniform3ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3ui64NV( GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z )
@@ -20194,7 +20194,7 @@ static void WINAPI glUniform3ui64NV( GLint location, GLuint64EXT x, GLuint64EXT
     struct glUniform3ui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glUniform3ui64NV, &args ))) WARN( "glUniform3ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3ui64NV, &args ))) WARN( "glUniform3ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3ui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -20218,7 +20218,7 @@ static void WINAPI glUniform3uiEXT( GLint location, GLuint v0, GLuint v1, GLuint
     struct glUniform3uiEXT_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d\n", location, v0, v1, v2 );
-    if ((status = UNIX_CALL( glUniform3uiEXT, &args ))) WARN( "glUniform3uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform3uiEXT, &args ))) WARN( "glUniform3uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glUniform3uiv( GLint location, GLsizei count, const GLuint *value )
@@ -20242,7 +20242,7 @@ static void WINAPI glUniform4d( GLint location, GLdouble x, GLdouble y, GLdouble
     struct glUniform4d_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "location %d, x %f, y %f, z %f, w %f\n", location, x, y, z, w );
-    if ((status = UNIX_CALL( glUniform4d, &args ))) WARN( "glUniform4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4d, &args ))) WARN( "glUniform4d returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4dv( GLint location, GLsizei count, const GLdouble *value )
@@ -20258,7 +20258,7 @@ static void WINAPI glUniform4f( GLint location, GLfloat v0, GLfloat v1, GLfloat
     struct glUniform4f_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4f, &args ))) WARN( "glUniform4f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4f, &args ))) WARN( "glUniform4f returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4fARB( GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 )
@@ -20266,7 +20266,7 @@ static void WINAPI glUniform4fARB( GLint location, GLfloat v0, GLfloat v1, GLflo
     struct glUniform4fARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "location %d, v0 %f, v1 %f, v2 %f, v3 %f\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4fARB, &args ))) WARN( "glUniform4fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4fARB, &args ))) WARN( "glUniform4fARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4fv( GLint location, GLsizei count, const GLfloat *value )
@@ -20290,7 +20290,7 @@ static void WINAPI glUniform4i( GLint location, GLint v0, GLint v1, GLint v2, GL
     struct glUniform4i_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4i, &args ))) WARN( "glUniform4i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4i, &args ))) WARN( "glUniform4i returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4i64ARB( GLint location, GLint64 x, GLint64 y, GLint64 z, GLint64 w )
@@ -20298,7 +20298,7 @@ static void WINAPI glUniform4i64ARB( GLint location, GLint64 x, GLint64 y, GLint
     struct glUniform4i64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s, w %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glUniform4i64ARB, &args ))) WARN( "glUniform4i64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4i64ARB, &args ))) WARN( "glUniform4i64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4i64NV( GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w )
@@ -20306,7 +20306,7 @@ static void WINAPI glUniform4i64NV( GLint location, GLint64EXT x, GLint64EXT y,
     struct glUniform4i64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s, w %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glUniform4i64NV, &args ))) WARN( "glUniform4i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4i64NV, &args ))) WARN( "glUniform4i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4i64vARB( GLint location, GLsizei count, const GLint64 *value )
@@ -20330,7 +20330,7 @@ static void WINAPI glUniform4iARB( GLint location, GLint v0, GLint v1, GLint v2,
     struct glUniform4iARB_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4iARB, &args ))) WARN( "glUniform4iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4iARB, &args ))) WARN( "glUniform4iARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4iv( GLint location, GLsizei count, const GLint *value )
@@ -20354,7 +20354,7 @@ static void WINAPI glUniform4ui( GLint location, GLuint v0, GLuint v1, GLuint v2
     struct glUniform4ui_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4ui, &args ))) WARN( "glUniform4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4ui, &args ))) WARN( "glUniform4ui returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4ui64ARB( GLint location, GLuint64 x, GLuint64 y, GLuint64 z, GLuint64 w )
@@ -20362,7 +20362,7 @@ static void WINAPI glUniform4ui64ARB( GLint location, GLuint64 x, GLuint64 y, GL
     struct glUniform4ui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s, w %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glUniform4ui64ARB, &args ))) WARN( "glUniform4ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4ui64ARB, &args ))) WARN( "glUniform4ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4ui64NV( GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w )
@@ -20370,7 +20370,7 @@ static void WINAPI glUniform4ui64NV( GLint location, GLuint64EXT x, GLuint64EXT
     struct glUniform4ui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "location %d, x %s, y %s, z %s, w %s\n", location, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glUniform4ui64NV, &args ))) WARN( "glUniform4ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4ui64NV, &args ))) WARN( "glUniform4ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4ui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -20394,7 +20394,7 @@ static void WINAPI glUniform4uiEXT( GLint location, GLuint v0, GLuint v1, GLuint
     struct glUniform4uiEXT_params args = { .teb = NtCurrentTeb(), .location = location, .v0 = v0, .v1 = v1, .v2 = v2, .v3 = v3 };
     NTSTATUS status;
     TRACE( "location %d, v0 %d, v1 %d, v2 %d, v3 %d\n", location, v0, v1, v2, v3 );
-    if ((status = UNIX_CALL( glUniform4uiEXT, &args ))) WARN( "glUniform4uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniform4uiEXT, &args ))) WARN( "glUniform4uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glUniform4uiv( GLint location, GLsizei count, const GLuint *value )
@@ -20418,7 +20418,7 @@ static void WINAPI glUniformBlockBinding( GLuint program, GLuint uniformBlockInd
     struct glUniformBlockBinding_params args = { .teb = NtCurrentTeb(), .program = program, .uniformBlockIndex = uniformBlockIndex, .uniformBlockBinding = uniformBlockBinding };
     NTSTATUS status;
     TRACE( "program %d, uniformBlockIndex %d, uniformBlockBinding %d\n", program, uniformBlockIndex, uniformBlockBinding );
-    if ((status = UNIX_CALL( glUniformBlockBinding, &args ))) WARN( "glUniformBlockBinding returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniformBlockBinding, &args ))) WARN( "glUniformBlockBinding returned %#lx\n", status );
 }
 
 static void WINAPI glUniformBufferEXT( GLuint program, GLint location, GLuint buffer )
@@ -20426,7 +20426,7 @@ static void WINAPI glUniformBufferEXT( GLuint program, GLint location, GLuint bu
     struct glUniformBufferEXT_params args = { .teb = NtCurrentTeb(), .program = program, .location = location, .buffer = buffer };
     NTSTATUS status;
     TRACE( "program %d, location %d, buffer %d\n", program, location, buffer );
-    if ((status = UNIX_CALL( glUniformBufferEXT, &args ))) WARN( "glUniformBufferEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniformBufferEXT, &args ))) WARN( "glUniformBufferEXT returned %#lx\n", status );
 }
 
 static void WINAPI glUniformHandleui64ARB( GLint location, GLuint64 value )
@@ -20434,7 +20434,7 @@ static void WINAPI glUniformHandleui64ARB( GLint location, GLuint64 value )
     struct glUniformHandleui64ARB_params args = { .teb = NtCurrentTeb(), .location = location, .value = value };
     NTSTATUS status;
     TRACE( "location %d, value %s\n", location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glUniformHandleui64ARB, &args ))) WARN( "glUniformHandleui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniformHandleui64ARB, &args ))) WARN( "glUniformHandleui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glUniformHandleui64NV( GLint location, GLuint64 value )
@@ -20442,7 +20442,7 @@ static void WINAPI glUniformHandleui64NV( GLint location, GLuint64 value )
     struct glUniformHandleui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .value = value };
     NTSTATUS status;
     TRACE( "location %d, value %s\n", location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glUniformHandleui64NV, &args ))) WARN( "glUniformHandleui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniformHandleui64NV, &args ))) WARN( "glUniformHandleui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniformHandleui64vARB( GLint location, GLsizei count, const GLuint64 *value )
@@ -20642,7 +20642,7 @@ static void WINAPI glUniformui64NV( GLint location, GLuint64EXT value )
     struct glUniformui64NV_params args = { .teb = NtCurrentTeb(), .location = location, .value = value };
     NTSTATUS status;
     TRACE( "location %d, value %s\n", location, wine_dbgstr_longlong(value) );
-    if ((status = UNIX_CALL( glUniformui64NV, &args ))) WARN( "glUniformui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUniformui64NV, &args ))) WARN( "glUniformui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glUniformui64vNV( GLint location, GLsizei count, const GLuint64EXT *value )
@@ -20658,7 +20658,7 @@ static void WINAPI glUnlockArraysEXT(void)
     struct glUnlockArraysEXT_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glUnlockArraysEXT, &args ))) WARN( "glUnlockArraysEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUnlockArraysEXT, &args ))) WARN( "glUnlockArraysEXT returned %#lx\n", status );
 }
 
 static void WINAPI glUnmapObjectBufferATI( GLuint buffer )
@@ -20666,7 +20666,7 @@ static void WINAPI glUnmapObjectBufferATI( GLuint buffer )
     struct glUnmapObjectBufferATI_params args = { .teb = NtCurrentTeb(), .buffer = buffer };
     NTSTATUS status;
     TRACE( "buffer %d\n", buffer );
-    if ((status = UNIX_CALL( glUnmapObjectBufferATI, &args ))) WARN( "glUnmapObjectBufferATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUnmapObjectBufferATI, &args ))) WARN( "glUnmapObjectBufferATI returned %#lx\n", status );
 }
 
 static void WINAPI glUnmapTexture2DINTEL( GLuint texture, GLint level )
@@ -20674,7 +20674,7 @@ static void WINAPI glUnmapTexture2DINTEL( GLuint texture, GLint level )
     struct glUnmapTexture2DINTEL_params args = { .teb = NtCurrentTeb(), .texture = texture, .level = level };
     NTSTATUS status;
     TRACE( "texture %d, level %d\n", texture, level );
-    if ((status = UNIX_CALL( glUnmapTexture2DINTEL, &args ))) WARN( "glUnmapTexture2DINTEL returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUnmapTexture2DINTEL, &args ))) WARN( "glUnmapTexture2DINTEL returned %#lx\n", status );
 }
 
 static void WINAPI glUpdateObjectBufferATI( GLuint buffer, GLuint offset, GLsizei size, const void *pointer, GLenum preserve )
@@ -20690,7 +20690,7 @@ static void WINAPI glUploadGpuMaskNVX( GLbitfield mask )
     struct glUploadGpuMaskNVX_params args = { .teb = NtCurrentTeb(), .mask = mask };
     NTSTATUS status;
     TRACE( "mask %d\n", mask );
-    if ((status = UNIX_CALL( glUploadGpuMaskNVX, &args ))) WARN( "glUploadGpuMaskNVX returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUploadGpuMaskNVX, &args ))) WARN( "glUploadGpuMaskNVX returned %#lx\n", status );
 }
 
 static void WINAPI glUseProgram( GLuint program )
@@ -20698,7 +20698,7 @@ static void WINAPI glUseProgram( GLuint program )
     struct glUseProgram_params args = { .teb = NtCurrentTeb(), .program = program };
     NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glUseProgram, &args ))) WARN( "glUseProgram returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUseProgram, &args ))) WARN( "glUseProgram returned %#lx\n", status );
 }
 
 static void WINAPI glUseProgramObjectARB( GLhandleARB programObj )
@@ -20706,7 +20706,7 @@ static void WINAPI glUseProgramObjectARB( GLhandleARB programObj )
     struct glUseProgramObjectARB_params args = { .teb = NtCurrentTeb(), .programObj = programObj };
     NTSTATUS status;
     TRACE( "programObj %d\n", programObj );
-    if ((status = UNIX_CALL( glUseProgramObjectARB, &args ))) WARN( "glUseProgramObjectARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUseProgramObjectARB, &args ))) WARN( "glUseProgramObjectARB returned %#lx\n", status );
 }
 
 static void WINAPI glUseProgramStages( GLuint pipeline, GLbitfield stages, GLuint program )
@@ -20714,7 +20714,7 @@ static void WINAPI glUseProgramStages( GLuint pipeline, GLbitfield stages, GLuin
     struct glUseProgramStages_params args = { .teb = NtCurrentTeb(), .pipeline = pipeline, .stages = stages, .program = program };
     NTSTATUS status;
     TRACE( "pipeline %d, stages %d, program %d\n", pipeline, stages, program );
-    if ((status = UNIX_CALL( glUseProgramStages, &args ))) WARN( "glUseProgramStages returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUseProgramStages, &args ))) WARN( "glUseProgramStages returned %#lx\n", status );
 }
 
 static void WINAPI glUseShaderProgramEXT( GLenum type, GLuint program )
@@ -20722,7 +20722,7 @@ static void WINAPI glUseShaderProgramEXT( GLenum type, GLuint program )
     struct glUseShaderProgramEXT_params args = { .teb = NtCurrentTeb(), .type = type, .program = program };
     NTSTATUS status;
     TRACE( "type %d, program %d\n", type, program );
-    if ((status = UNIX_CALL( glUseShaderProgramEXT, &args ))) WARN( "glUseShaderProgramEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glUseShaderProgramEXT, &args ))) WARN( "glUseShaderProgramEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVDPAUFiniNV(void)
@@ -20730,7 +20730,7 @@ static void WINAPI glVDPAUFiniNV(void)
     struct glVDPAUFiniNV_params args = { .teb = NtCurrentTeb() };
     NTSTATUS status;
     TRACE( "\n" );
-    if ((status = UNIX_CALL( glVDPAUFiniNV, &args ))) WARN( "glVDPAUFiniNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVDPAUFiniNV, &args ))) WARN( "glVDPAUFiniNV returned %#lx\n", status );
 }
 
 static void WINAPI glVDPAUGetSurfaceivNV( GLvdpauSurfaceNV surface, GLenum pname, GLsizei count, GLsizei *length, GLint *values )
@@ -20798,7 +20798,7 @@ static void WINAPI glVDPAUSurfaceAccessNV( GLvdpauSurfaceNV surface, GLenum acce
     struct glVDPAUSurfaceAccessNV_params args = { .teb = NtCurrentTeb(), .surface = surface, .access = access };
     NTSTATUS status;
     TRACE( "surface %Id, access %d\n", surface, access );
-    if ((status = UNIX_CALL( glVDPAUSurfaceAccessNV, &args ))) WARN( "glVDPAUSurfaceAccessNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVDPAUSurfaceAccessNV, &args ))) WARN( "glVDPAUSurfaceAccessNV returned %#lx\n", status );
 }
 
 static void WINAPI glVDPAUUnmapSurfacesNV( GLsizei numSurface, const GLvdpauSurfaceNV *surfaces )
@@ -20814,7 +20814,7 @@ static void WINAPI glVDPAUUnregisterSurfaceNV( GLvdpauSurfaceNV surface )
     struct glVDPAUUnregisterSurfaceNV_params args = { .teb = NtCurrentTeb(), .surface = surface };
     NTSTATUS status;
     TRACE( "surface %Id\n", surface );
-    if ((status = UNIX_CALL( glVDPAUUnregisterSurfaceNV, &args ))) WARN( "glVDPAUUnregisterSurfaceNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVDPAUUnregisterSurfaceNV, &args ))) WARN( "glVDPAUUnregisterSurfaceNV returned %#lx\n", status );
 }
 
 static void WINAPI glValidateProgram( GLuint program )
@@ -20822,7 +20822,7 @@ static void WINAPI glValidateProgram( GLuint program )
     struct glValidateProgram_params args = { .teb = NtCurrentTeb(), .program = program };
     NTSTATUS status;
     TRACE( "program %d\n", program );
-    if ((status = UNIX_CALL( glValidateProgram, &args ))) WARN( "glValidateProgram returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glValidateProgram, &args ))) WARN( "glValidateProgram returned %#lx\n", status );
 }
 
 static void WINAPI glValidateProgramARB( GLhandleARB programObj )
@@ -20830,7 +20830,7 @@ static void WINAPI glValidateProgramARB( GLhandleARB programObj )
     struct glValidateProgramARB_params args = { .teb = NtCurrentTeb(), .programObj = programObj };
     NTSTATUS status;
     TRACE( "programObj %d\n", programObj );
-    if ((status = UNIX_CALL( glValidateProgramARB, &args ))) WARN( "glValidateProgramARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glValidateProgramARB, &args ))) WARN( "glValidateProgramARB returned %#lx\n", status );
 }
 
 static void WINAPI glValidateProgramPipeline( GLuint pipeline )
@@ -20838,7 +20838,7 @@ static void WINAPI glValidateProgramPipeline( GLuint pipeline )
     struct glValidateProgramPipeline_params args = { .teb = NtCurrentTeb(), .pipeline = pipeline };
     NTSTATUS status;
     TRACE( "pipeline %d\n", pipeline );
-    if ((status = UNIX_CALL( glValidateProgramPipeline, &args ))) WARN( "glValidateProgramPipeline returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glValidateProgramPipeline, &args ))) WARN( "glValidateProgramPipeline returned %#lx\n", status );
 }
 
 static void WINAPI glVariantArrayObjectATI( GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset )
@@ -20846,7 +20846,7 @@ static void WINAPI glVariantArrayObjectATI( GLuint id, GLenum type, GLsizei stri
     struct glVariantArrayObjectATI_params args = { .teb = NtCurrentTeb(), .id = id, .type = type, .stride = stride, .buffer = buffer, .offset = offset };
     NTSTATUS status;
     TRACE( "id %d, type %d, stride %d, buffer %d, offset %d\n", id, type, stride, buffer, offset );
-    if ((status = UNIX_CALL( glVariantArrayObjectATI, &args ))) WARN( "glVariantArrayObjectATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVariantArrayObjectATI, &args ))) WARN( "glVariantArrayObjectATI returned %#lx\n", status );
 }
 
 static void WINAPI glVariantPointerEXT( GLuint id, GLenum type, GLuint stride, const void *addr )
@@ -20926,7 +20926,7 @@ static void WINAPI glVertex2bOES( GLbyte x, GLbyte y )
     struct glVertex2bOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex2bOES, &args ))) WARN( "glVertex2bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex2bOES, &args ))) WARN( "glVertex2bOES returned %#lx\n", status );
 }
 
 static void WINAPI glVertex2bvOES( const GLbyte *coords )
@@ -20942,7 +20942,7 @@ static void WINAPI glVertex2hNV( GLhalfNV x, GLhalfNV y )
     struct glVertex2hNV_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex2hNV, &args ))) WARN( "glVertex2hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex2hNV, &args ))) WARN( "glVertex2hNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertex2hvNV( const GLhalfNV *v )
@@ -20958,7 +20958,7 @@ static void WINAPI glVertex2xOES( GLfixed x )
     struct glVertex2xOES_params args = { .teb = NtCurrentTeb(), .x = x };
     NTSTATUS status;
     TRACE( "x %d\n", x );
-    if ((status = UNIX_CALL( glVertex2xOES, &args ))) WARN( "glVertex2xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex2xOES, &args ))) WARN( "glVertex2xOES returned %#lx\n", status );
 }
 
 static void WINAPI glVertex2xvOES( const GLfixed *coords )
@@ -20974,7 +20974,7 @@ static void WINAPI glVertex3bOES( GLbyte x, GLbyte y, GLbyte z )
     struct glVertex3bOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3bOES, &args ))) WARN( "glVertex3bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex3bOES, &args ))) WARN( "glVertex3bOES returned %#lx\n", status );
 }
 
 static void WINAPI glVertex3bvOES( const GLbyte *coords )
@@ -20990,7 +20990,7 @@ static void WINAPI glVertex3hNV( GLhalfNV x, GLhalfNV y, GLhalfNV z )
     struct glVertex3hNV_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex3hNV, &args ))) WARN( "glVertex3hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex3hNV, &args ))) WARN( "glVertex3hNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertex3hvNV( const GLhalfNV *v )
@@ -21006,7 +21006,7 @@ static void WINAPI glVertex3xOES( GLfixed x, GLfixed y )
     struct glVertex3xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glVertex3xOES, &args ))) WARN( "glVertex3xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex3xOES, &args ))) WARN( "glVertex3xOES returned %#lx\n", status );
 }
 
 static void WINAPI glVertex3xvOES( const GLfixed *coords )
@@ -21022,7 +21022,7 @@ static void WINAPI glVertex4bOES( GLbyte x, GLbyte y, GLbyte z, GLbyte w )
     struct glVertex4bOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4bOES, &args ))) WARN( "glVertex4bOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex4bOES, &args ))) WARN( "glVertex4bOES returned %#lx\n", status );
 }
 
 static void WINAPI glVertex4bvOES( const GLbyte *coords )
@@ -21038,7 +21038,7 @@ static void WINAPI glVertex4hNV( GLhalfNV x, GLhalfNV y, GLhalfNV z, GLhalfNV w
     struct glVertex4hNV_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glVertex4hNV, &args ))) WARN( "glVertex4hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex4hNV, &args ))) WARN( "glVertex4hNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertex4hvNV( const GLhalfNV *v )
@@ -21054,7 +21054,7 @@ static void WINAPI glVertex4xOES( GLfixed x, GLfixed y, GLfixed z )
     struct glVertex4xOES_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glVertex4xOES, &args ))) WARN( "glVertex4xOES returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertex4xOES, &args ))) WARN( "glVertex4xOES returned %#lx\n", status );
 }
 
 static void WINAPI glVertex4xvOES( const GLfixed *coords )
@@ -21070,7 +21070,7 @@ static void WINAPI glVertexArrayAttribBinding( GLuint vaobj, GLuint attribindex,
     struct glVertexArrayAttribBinding_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .bindingindex = bindingindex };
     NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, bindingindex %d\n", vaobj, attribindex, bindingindex );
-    if ((status = UNIX_CALL( glVertexArrayAttribBinding, &args ))) WARN( "glVertexArrayAttribBinding returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayAttribBinding, &args ))) WARN( "glVertexArrayAttribBinding returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayAttribFormat( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset )
@@ -21078,7 +21078,7 @@ static void WINAPI glVertexArrayAttribFormat( GLuint vaobj, GLuint attribindex,
     struct glVertexArrayAttribFormat_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .normalized = normalized, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, normalized %d, relativeoffset %d\n", vaobj, attribindex, size, type, normalized, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayAttribFormat, &args ))) WARN( "glVertexArrayAttribFormat returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayAttribFormat, &args ))) WARN( "glVertexArrayAttribFormat returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayAttribIFormat( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
@@ -21086,7 +21086,7 @@ static void WINAPI glVertexArrayAttribIFormat( GLuint vaobj, GLuint attribindex,
     struct glVertexArrayAttribIFormat_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, relativeoffset %d\n", vaobj, attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayAttribIFormat, &args ))) WARN( "glVertexArrayAttribIFormat returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayAttribIFormat, &args ))) WARN( "glVertexArrayAttribIFormat returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayAttribLFormat( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
@@ -21094,7 +21094,7 @@ static void WINAPI glVertexArrayAttribLFormat( GLuint vaobj, GLuint attribindex,
     struct glVertexArrayAttribLFormat_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, relativeoffset %d\n", vaobj, attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayAttribLFormat, &args ))) WARN( "glVertexArrayAttribLFormat returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayAttribLFormat, &args ))) WARN( "glVertexArrayAttribLFormat returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayBindVertexBufferEXT( GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride )
@@ -21110,7 +21110,7 @@ static void WINAPI glVertexArrayBindingDivisor( GLuint vaobj, GLuint bindinginde
     struct glVertexArrayBindingDivisor_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .bindingindex = bindingindex, .divisor = divisor };
     NTSTATUS status;
     TRACE( "vaobj %d, bindingindex %d, divisor %d\n", vaobj, bindingindex, divisor );
-    if ((status = UNIX_CALL( glVertexArrayBindingDivisor, &args ))) WARN( "glVertexArrayBindingDivisor returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayBindingDivisor, &args ))) WARN( "glVertexArrayBindingDivisor returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayColorOffsetEXT( GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset )
@@ -21134,7 +21134,7 @@ static void WINAPI glVertexArrayElementBuffer( GLuint vaobj, GLuint buffer )
     struct glVertexArrayElementBuffer_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .buffer = buffer };
     NTSTATUS status;
     TRACE( "vaobj %d, buffer %d\n", vaobj, buffer );
-    if ((status = UNIX_CALL( glVertexArrayElementBuffer, &args ))) WARN( "glVertexArrayElementBuffer returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayElementBuffer, &args ))) WARN( "glVertexArrayElementBuffer returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayFogCoordOffsetEXT( GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset )
@@ -21174,7 +21174,7 @@ static void WINAPI glVertexArrayParameteriAPPLE( GLenum pname, GLint param )
     struct glVertexArrayParameteriAPPLE_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glVertexArrayParameteriAPPLE, &args ))) WARN( "glVertexArrayParameteriAPPLE returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayParameteriAPPLE, &args ))) WARN( "glVertexArrayParameteriAPPLE returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayRangeAPPLE( GLsizei length, void *pointer )
@@ -21214,7 +21214,7 @@ static void WINAPI glVertexArrayVertexAttribBindingEXT( GLuint vaobj, GLuint att
     struct glVertexArrayVertexAttribBindingEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .bindingindex = bindingindex };
     NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, bindingindex %d\n", vaobj, attribindex, bindingindex );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribBindingEXT, &args ))) WARN( "glVertexArrayVertexAttribBindingEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayVertexAttribBindingEXT, &args ))) WARN( "glVertexArrayVertexAttribBindingEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayVertexAttribDivisorEXT( GLuint vaobj, GLuint index, GLuint divisor )
@@ -21222,7 +21222,7 @@ static void WINAPI glVertexArrayVertexAttribDivisorEXT( GLuint vaobj, GLuint ind
     struct glVertexArrayVertexAttribDivisorEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .index = index, .divisor = divisor };
     NTSTATUS status;
     TRACE( "vaobj %d, index %d, divisor %d\n", vaobj, index, divisor );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribDivisorEXT, &args ))) WARN( "glVertexArrayVertexAttribDivisorEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayVertexAttribDivisorEXT, &args ))) WARN( "glVertexArrayVertexAttribDivisorEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayVertexAttribFormatEXT( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset )
@@ -21230,7 +21230,7 @@ static void WINAPI glVertexArrayVertexAttribFormatEXT( GLuint vaobj, GLuint attr
     struct glVertexArrayVertexAttribFormatEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .normalized = normalized, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, normalized %d, relativeoffset %d\n", vaobj, attribindex, size, type, normalized, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribFormatEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayVertexAttribFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribFormatEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayVertexAttribIFormatEXT( GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset )
@@ -21238,7 +21238,7 @@ static void WINAPI glVertexArrayVertexAttribIFormatEXT( GLuint vaobj, GLuint att
     struct glVertexArrayVertexAttribIFormatEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, relativeoffset %d\n", vaobj, attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribIFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribIFormatEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayVertexAttribIFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribIFormatEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayVertexAttribIOffsetEXT( GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset )
@@ -21254,7 +21254,7 @@ static void WINAPI glVertexArrayVertexAttribLFormatEXT( GLuint vaobj, GLuint att
     struct glVertexArrayVertexAttribLFormatEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "vaobj %d, attribindex %d, size %d, type %d, relativeoffset %d\n", vaobj, attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexArrayVertexAttribLFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribLFormatEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayVertexAttribLFormatEXT, &args ))) WARN( "glVertexArrayVertexAttribLFormatEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayVertexAttribLOffsetEXT( GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset )
@@ -21278,7 +21278,7 @@ static void WINAPI glVertexArrayVertexBindingDivisorEXT( GLuint vaobj, GLuint bi
     struct glVertexArrayVertexBindingDivisorEXT_params args = { .teb = NtCurrentTeb(), .vaobj = vaobj, .bindingindex = bindingindex, .divisor = divisor };
     NTSTATUS status;
     TRACE( "vaobj %d, bindingindex %d, divisor %d\n", vaobj, bindingindex, divisor );
-    if ((status = UNIX_CALL( glVertexArrayVertexBindingDivisorEXT, &args ))) WARN( "glVertexArrayVertexBindingDivisorEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexArrayVertexBindingDivisorEXT, &args ))) WARN( "glVertexArrayVertexBindingDivisorEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexArrayVertexBuffer( GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride )
@@ -21310,7 +21310,7 @@ static void WINAPI glVertexAttrib1d( GLuint index, GLdouble x )
     struct glVertexAttrib1d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1d, &args ))) WARN( "glVertexAttrib1d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1d, &args ))) WARN( "glVertexAttrib1d returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1dARB( GLuint index, GLdouble x )
@@ -21318,7 +21318,7 @@ static void WINAPI glVertexAttrib1dARB( GLuint index, GLdouble x )
     struct glVertexAttrib1dARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1dARB, &args ))) WARN( "glVertexAttrib1dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1dARB, &args ))) WARN( "glVertexAttrib1dARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1dNV( GLuint index, GLdouble x )
@@ -21326,7 +21326,7 @@ static void WINAPI glVertexAttrib1dNV( GLuint index, GLdouble x )
     struct glVertexAttrib1dNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1dNV, &args ))) WARN( "glVertexAttrib1dNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1dNV, &args ))) WARN( "glVertexAttrib1dNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1dv( GLuint index, const GLdouble *v )
@@ -21358,7 +21358,7 @@ static void WINAPI glVertexAttrib1f( GLuint index, GLfloat x )
     struct glVertexAttrib1f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1f, &args ))) WARN( "glVertexAttrib1f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1f, &args ))) WARN( "glVertexAttrib1f returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1fARB( GLuint index, GLfloat x )
@@ -21366,7 +21366,7 @@ static void WINAPI glVertexAttrib1fARB( GLuint index, GLfloat x )
     struct glVertexAttrib1fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1fARB, &args ))) WARN( "glVertexAttrib1fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1fARB, &args ))) WARN( "glVertexAttrib1fARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1fNV( GLuint index, GLfloat x )
@@ -21374,7 +21374,7 @@ static void WINAPI glVertexAttrib1fNV( GLuint index, GLfloat x )
     struct glVertexAttrib1fNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1fNV, &args ))) WARN( "glVertexAttrib1fNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1fNV, &args ))) WARN( "glVertexAttrib1fNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1fv( GLuint index, const GLfloat *v )
@@ -21406,7 +21406,7 @@ static void WINAPI glVertexAttrib1hNV( GLuint index, GLhalfNV x )
     struct glVertexAttrib1hNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1hNV, &args ))) WARN( "glVertexAttrib1hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1hNV, &args ))) WARN( "glVertexAttrib1hNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1hvNV( GLuint index, const GLhalfNV *v )
@@ -21422,7 +21422,7 @@ static void WINAPI glVertexAttrib1s( GLuint index, GLshort x )
     struct glVertexAttrib1s_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1s, &args ))) WARN( "glVertexAttrib1s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1s, &args ))) WARN( "glVertexAttrib1s returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1sARB( GLuint index, GLshort x )
@@ -21430,7 +21430,7 @@ static void WINAPI glVertexAttrib1sARB( GLuint index, GLshort x )
     struct glVertexAttrib1sARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1sARB, &args ))) WARN( "glVertexAttrib1sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1sARB, &args ))) WARN( "glVertexAttrib1sARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1sNV( GLuint index, GLshort x )
@@ -21438,7 +21438,7 @@ static void WINAPI glVertexAttrib1sNV( GLuint index, GLshort x )
     struct glVertexAttrib1sNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttrib1sNV, &args ))) WARN( "glVertexAttrib1sNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib1sNV, &args ))) WARN( "glVertexAttrib1sNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib1sv( GLuint index, const GLshort *v )
@@ -21470,7 +21470,7 @@ static void WINAPI glVertexAttrib2d( GLuint index, GLdouble x, GLdouble y )
     struct glVertexAttrib2d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2d, &args ))) WARN( "glVertexAttrib2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2d, &args ))) WARN( "glVertexAttrib2d returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2dARB( GLuint index, GLdouble x, GLdouble y )
@@ -21478,7 +21478,7 @@ static void WINAPI glVertexAttrib2dARB( GLuint index, GLdouble x, GLdouble y )
     struct glVertexAttrib2dARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2dARB, &args ))) WARN( "glVertexAttrib2dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2dARB, &args ))) WARN( "glVertexAttrib2dARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2dNV( GLuint index, GLdouble x, GLdouble y )
@@ -21486,7 +21486,7 @@ static void WINAPI glVertexAttrib2dNV( GLuint index, GLdouble x, GLdouble y )
     struct glVertexAttrib2dNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2dNV, &args ))) WARN( "glVertexAttrib2dNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2dNV, &args ))) WARN( "glVertexAttrib2dNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2dv( GLuint index, const GLdouble *v )
@@ -21518,7 +21518,7 @@ static void WINAPI glVertexAttrib2f( GLuint index, GLfloat x, GLfloat y )
     struct glVertexAttrib2f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2f, &args ))) WARN( "glVertexAttrib2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2f, &args ))) WARN( "glVertexAttrib2f returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2fARB( GLuint index, GLfloat x, GLfloat y )
@@ -21526,7 +21526,7 @@ static void WINAPI glVertexAttrib2fARB( GLuint index, GLfloat x, GLfloat y )
     struct glVertexAttrib2fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2fARB, &args ))) WARN( "glVertexAttrib2fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2fARB, &args ))) WARN( "glVertexAttrib2fARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2fNV( GLuint index, GLfloat x, GLfloat y )
@@ -21534,7 +21534,7 @@ static void WINAPI glVertexAttrib2fNV( GLuint index, GLfloat x, GLfloat y )
     struct glVertexAttrib2fNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2fNV, &args ))) WARN( "glVertexAttrib2fNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2fNV, &args ))) WARN( "glVertexAttrib2fNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2fv( GLuint index, const GLfloat *v )
@@ -21566,7 +21566,7 @@ static void WINAPI glVertexAttrib2hNV( GLuint index, GLhalfNV x, GLhalfNV y )
     struct glVertexAttrib2hNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2hNV, &args ))) WARN( "glVertexAttrib2hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2hNV, &args ))) WARN( "glVertexAttrib2hNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2hvNV( GLuint index, const GLhalfNV *v )
@@ -21582,7 +21582,7 @@ static void WINAPI glVertexAttrib2s( GLuint index, GLshort x, GLshort y )
     struct glVertexAttrib2s_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2s, &args ))) WARN( "glVertexAttrib2s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2s, &args ))) WARN( "glVertexAttrib2s returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2sARB( GLuint index, GLshort x, GLshort y )
@@ -21590,7 +21590,7 @@ static void WINAPI glVertexAttrib2sARB( GLuint index, GLshort x, GLshort y )
     struct glVertexAttrib2sARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2sARB, &args ))) WARN( "glVertexAttrib2sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2sARB, &args ))) WARN( "glVertexAttrib2sARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2sNV( GLuint index, GLshort x, GLshort y )
@@ -21598,7 +21598,7 @@ static void WINAPI glVertexAttrib2sNV( GLuint index, GLshort x, GLshort y )
     struct glVertexAttrib2sNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttrib2sNV, &args ))) WARN( "glVertexAttrib2sNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib2sNV, &args ))) WARN( "glVertexAttrib2sNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib2sv( GLuint index, const GLshort *v )
@@ -21630,7 +21630,7 @@ static void WINAPI glVertexAttrib3d( GLuint index, GLdouble x, GLdouble y, GLdou
     struct glVertexAttrib3d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3d, &args ))) WARN( "glVertexAttrib3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3d, &args ))) WARN( "glVertexAttrib3d returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3dARB( GLuint index, GLdouble x, GLdouble y, GLdouble z )
@@ -21638,7 +21638,7 @@ static void WINAPI glVertexAttrib3dARB( GLuint index, GLdouble x, GLdouble y, GL
     struct glVertexAttrib3dARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3dARB, &args ))) WARN( "glVertexAttrib3dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3dARB, &args ))) WARN( "glVertexAttrib3dARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3dNV( GLuint index, GLdouble x, GLdouble y, GLdouble z )
@@ -21646,7 +21646,7 @@ static void WINAPI glVertexAttrib3dNV( GLuint index, GLdouble x, GLdouble y, GLd
     struct glVertexAttrib3dNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3dNV, &args ))) WARN( "glVertexAttrib3dNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3dNV, &args ))) WARN( "glVertexAttrib3dNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3dv( GLuint index, const GLdouble *v )
@@ -21678,7 +21678,7 @@ static void WINAPI glVertexAttrib3f( GLuint index, GLfloat x, GLfloat y, GLfloat
     struct glVertexAttrib3f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3f, &args ))) WARN( "glVertexAttrib3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3f, &args ))) WARN( "glVertexAttrib3f returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3fARB( GLuint index, GLfloat x, GLfloat y, GLfloat z )
@@ -21686,7 +21686,7 @@ static void WINAPI glVertexAttrib3fARB( GLuint index, GLfloat x, GLfloat y, GLfl
     struct glVertexAttrib3fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3fARB, &args ))) WARN( "glVertexAttrib3fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3fARB, &args ))) WARN( "glVertexAttrib3fARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3fNV( GLuint index, GLfloat x, GLfloat y, GLfloat z )
@@ -21694,7 +21694,7 @@ static void WINAPI glVertexAttrib3fNV( GLuint index, GLfloat x, GLfloat y, GLflo
     struct glVertexAttrib3fNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3fNV, &args ))) WARN( "glVertexAttrib3fNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3fNV, &args ))) WARN( "glVertexAttrib3fNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3fv( GLuint index, const GLfloat *v )
@@ -21726,7 +21726,7 @@ static void WINAPI glVertexAttrib3hNV( GLuint index, GLhalfNV x, GLhalfNV y, GLh
     struct glVertexAttrib3hNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3hNV, &args ))) WARN( "glVertexAttrib3hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3hNV, &args ))) WARN( "glVertexAttrib3hNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3hvNV( GLuint index, const GLhalfNV *v )
@@ -21742,7 +21742,7 @@ static void WINAPI glVertexAttrib3s( GLuint index, GLshort x, GLshort y, GLshort
     struct glVertexAttrib3s_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3s, &args ))) WARN( "glVertexAttrib3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3s, &args ))) WARN( "glVertexAttrib3s returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3sARB( GLuint index, GLshort x, GLshort y, GLshort z )
@@ -21750,7 +21750,7 @@ static void WINAPI glVertexAttrib3sARB( GLuint index, GLshort x, GLshort y, GLsh
     struct glVertexAttrib3sARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3sARB, &args ))) WARN( "glVertexAttrib3sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3sARB, &args ))) WARN( "glVertexAttrib3sARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3sNV( GLuint index, GLshort x, GLshort y, GLshort z )
@@ -21758,7 +21758,7 @@ static void WINAPI glVertexAttrib3sNV( GLuint index, GLshort x, GLshort y, GLsho
     struct glVertexAttrib3sNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttrib3sNV, &args ))) WARN( "glVertexAttrib3sNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib3sNV, &args ))) WARN( "glVertexAttrib3sNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib3sv( GLuint index, const GLshort *v )
@@ -21838,7 +21838,7 @@ static void WINAPI glVertexAttrib4Nub( GLuint index, GLubyte x, GLubyte y, GLuby
     struct glVertexAttrib4Nub_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4Nub, &args ))) WARN( "glVertexAttrib4Nub returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4Nub, &args ))) WARN( "glVertexAttrib4Nub returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4NubARB( GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w )
@@ -21846,7 +21846,7 @@ static void WINAPI glVertexAttrib4NubARB( GLuint index, GLubyte x, GLubyte y, GL
     struct glVertexAttrib4NubARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4NubARB, &args ))) WARN( "glVertexAttrib4NubARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4NubARB, &args ))) WARN( "glVertexAttrib4NubARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4Nubv( GLuint index, const GLubyte *v )
@@ -21918,7 +21918,7 @@ static void WINAPI glVertexAttrib4d( GLuint index, GLdouble x, GLdouble y, GLdou
     struct glVertexAttrib4d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4d, &args ))) WARN( "glVertexAttrib4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4d, &args ))) WARN( "glVertexAttrib4d returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4dARB( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
@@ -21926,7 +21926,7 @@ static void WINAPI glVertexAttrib4dARB( GLuint index, GLdouble x, GLdouble y, GL
     struct glVertexAttrib4dARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4dARB, &args ))) WARN( "glVertexAttrib4dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4dARB, &args ))) WARN( "glVertexAttrib4dARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4dNV( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
@@ -21934,7 +21934,7 @@ static void WINAPI glVertexAttrib4dNV( GLuint index, GLdouble x, GLdouble y, GLd
     struct glVertexAttrib4dNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4dNV, &args ))) WARN( "glVertexAttrib4dNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4dNV, &args ))) WARN( "glVertexAttrib4dNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4dv( GLuint index, const GLdouble *v )
@@ -21966,7 +21966,7 @@ static void WINAPI glVertexAttrib4f( GLuint index, GLfloat x, GLfloat y, GLfloat
     struct glVertexAttrib4f_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4f, &args ))) WARN( "glVertexAttrib4f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4f, &args ))) WARN( "glVertexAttrib4f returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4fARB( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
@@ -21974,7 +21974,7 @@ static void WINAPI glVertexAttrib4fARB( GLuint index, GLfloat x, GLfloat y, GLfl
     struct glVertexAttrib4fARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4fARB, &args ))) WARN( "glVertexAttrib4fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4fARB, &args ))) WARN( "glVertexAttrib4fARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4fNV( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
@@ -21982,7 +21982,7 @@ static void WINAPI glVertexAttrib4fNV( GLuint index, GLfloat x, GLfloat y, GLflo
     struct glVertexAttrib4fNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4fNV, &args ))) WARN( "glVertexAttrib4fNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4fNV, &args ))) WARN( "glVertexAttrib4fNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4fv( GLuint index, const GLfloat *v )
@@ -22014,7 +22014,7 @@ static void WINAPI glVertexAttrib4hNV( GLuint index, GLhalfNV x, GLhalfNV y, GLh
     struct glVertexAttrib4hNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4hNV, &args ))) WARN( "glVertexAttrib4hNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4hNV, &args ))) WARN( "glVertexAttrib4hNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4hvNV( GLuint index, const GLhalfNV *v )
@@ -22046,7 +22046,7 @@ static void WINAPI glVertexAttrib4s( GLuint index, GLshort x, GLshort y, GLshort
     struct glVertexAttrib4s_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4s, &args ))) WARN( "glVertexAttrib4s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4s, &args ))) WARN( "glVertexAttrib4s returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4sARB( GLuint index, GLshort x, GLshort y, GLshort z, GLshort w )
@@ -22054,7 +22054,7 @@ static void WINAPI glVertexAttrib4sARB( GLuint index, GLshort x, GLshort y, GLsh
     struct glVertexAttrib4sARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4sARB, &args ))) WARN( "glVertexAttrib4sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4sARB, &args ))) WARN( "glVertexAttrib4sARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4sNV( GLuint index, GLshort x, GLshort y, GLshort z, GLshort w )
@@ -22062,7 +22062,7 @@ static void WINAPI glVertexAttrib4sNV( GLuint index, GLshort x, GLshort y, GLsho
     struct glVertexAttrib4sNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4sNV, &args ))) WARN( "glVertexAttrib4sNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4sNV, &args ))) WARN( "glVertexAttrib4sNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4sv( GLuint index, const GLshort *v )
@@ -22094,7 +22094,7 @@ static void WINAPI glVertexAttrib4ubNV( GLuint index, GLubyte x, GLubyte y, GLub
     struct glVertexAttrib4ubNV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttrib4ubNV, &args ))) WARN( "glVertexAttrib4ubNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttrib4ubNV, &args ))) WARN( "glVertexAttrib4ubNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttrib4ubv( GLuint index, const GLubyte *v )
@@ -22158,7 +22158,7 @@ static void WINAPI glVertexAttribArrayObjectATI( GLuint index, GLint size, GLenu
     struct glVertexAttribArrayObjectATI_params args = { .teb = NtCurrentTeb(), .index = index, .size = size, .type = type, .normalized = normalized, .stride = stride, .buffer = buffer, .offset = offset };
     NTSTATUS status;
     TRACE( "index %d, size %d, type %d, normalized %d, stride %d, buffer %d, offset %d\n", index, size, type, normalized, stride, buffer, offset );
-    if ((status = UNIX_CALL( glVertexAttribArrayObjectATI, &args ))) WARN( "glVertexAttribArrayObjectATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribArrayObjectATI, &args ))) WARN( "glVertexAttribArrayObjectATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribBinding( GLuint attribindex, GLuint bindingindex )
@@ -22166,7 +22166,7 @@ static void WINAPI glVertexAttribBinding( GLuint attribindex, GLuint bindinginde
     struct glVertexAttribBinding_params args = { .teb = NtCurrentTeb(), .attribindex = attribindex, .bindingindex = bindingindex };
     NTSTATUS status;
     TRACE( "attribindex %d, bindingindex %d\n", attribindex, bindingindex );
-    if ((status = UNIX_CALL( glVertexAttribBinding, &args ))) WARN( "glVertexAttribBinding returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribBinding, &args ))) WARN( "glVertexAttribBinding returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribDivisor( GLuint index, GLuint divisor )
@@ -22174,7 +22174,7 @@ static void WINAPI glVertexAttribDivisor( GLuint index, GLuint divisor )
     struct glVertexAttribDivisor_params args = { .teb = NtCurrentTeb(), .index = index, .divisor = divisor };
     NTSTATUS status;
     TRACE( "index %d, divisor %d\n", index, divisor );
-    if ((status = UNIX_CALL( glVertexAttribDivisor, &args ))) WARN( "glVertexAttribDivisor returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribDivisor, &args ))) WARN( "glVertexAttribDivisor returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribDivisorARB( GLuint index, GLuint divisor )
@@ -22182,7 +22182,7 @@ static void WINAPI glVertexAttribDivisorARB( GLuint index, GLuint divisor )
     struct glVertexAttribDivisorARB_params args = { .teb = NtCurrentTeb(), .index = index, .divisor = divisor };
     NTSTATUS status;
     TRACE( "index %d, divisor %d\n", index, divisor );
-    if ((status = UNIX_CALL( glVertexAttribDivisorARB, &args ))) WARN( "glVertexAttribDivisorARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribDivisorARB, &args ))) WARN( "glVertexAttribDivisorARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribFormat( GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset )
@@ -22190,7 +22190,7 @@ static void WINAPI glVertexAttribFormat( GLuint attribindex, GLint size, GLenum
     struct glVertexAttribFormat_params args = { .teb = NtCurrentTeb(), .attribindex = attribindex, .size = size, .type = type, .normalized = normalized, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "attribindex %d, size %d, type %d, normalized %d, relativeoffset %d\n", attribindex, size, type, normalized, relativeoffset );
-    if ((status = UNIX_CALL( glVertexAttribFormat, &args ))) WARN( "glVertexAttribFormat returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribFormat, &args ))) WARN( "glVertexAttribFormat returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribFormatNV( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride )
@@ -22198,7 +22198,7 @@ static void WINAPI glVertexAttribFormatNV( GLuint index, GLint size, GLenum type
     struct glVertexAttribFormatNV_params args = { .teb = NtCurrentTeb(), .index = index, .size = size, .type = type, .normalized = normalized, .stride = stride };
     NTSTATUS status;
     TRACE( "index %d, size %d, type %d, normalized %d, stride %d\n", index, size, type, normalized, stride );
-    if ((status = UNIX_CALL( glVertexAttribFormatNV, &args ))) WARN( "glVertexAttribFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribFormatNV, &args ))) WARN( "glVertexAttribFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI1i( GLuint index, GLint x )
@@ -22206,7 +22206,7 @@ static void WINAPI glVertexAttribI1i( GLuint index, GLint x )
     struct glVertexAttribI1i_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribI1i, &args ))) WARN( "glVertexAttribI1i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI1i, &args ))) WARN( "glVertexAttribI1i returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI1iEXT( GLuint index, GLint x )
@@ -22214,7 +22214,7 @@ static void WINAPI glVertexAttribI1iEXT( GLuint index, GLint x )
     struct glVertexAttribI1iEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribI1iEXT, &args ))) WARN( "glVertexAttribI1iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI1iEXT, &args ))) WARN( "glVertexAttribI1iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI1iv( GLuint index, const GLint *v )
@@ -22238,7 +22238,7 @@ static void WINAPI glVertexAttribI1ui( GLuint index, GLuint x )
     struct glVertexAttribI1ui_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribI1ui, &args ))) WARN( "glVertexAttribI1ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI1ui, &args ))) WARN( "glVertexAttribI1ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI1uiEXT( GLuint index, GLuint x )
@@ -22246,7 +22246,7 @@ static void WINAPI glVertexAttribI1uiEXT( GLuint index, GLuint x )
     struct glVertexAttribI1uiEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %d\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribI1uiEXT, &args ))) WARN( "glVertexAttribI1uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI1uiEXT, &args ))) WARN( "glVertexAttribI1uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI1uiv( GLuint index, const GLuint *v )
@@ -22270,7 +22270,7 @@ static void WINAPI glVertexAttribI2i( GLuint index, GLint x, GLint y )
     struct glVertexAttribI2i_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribI2i, &args ))) WARN( "glVertexAttribI2i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI2i, &args ))) WARN( "glVertexAttribI2i returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI2iEXT( GLuint index, GLint x, GLint y )
@@ -22278,7 +22278,7 @@ static void WINAPI glVertexAttribI2iEXT( GLuint index, GLint x, GLint y )
     struct glVertexAttribI2iEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribI2iEXT, &args ))) WARN( "glVertexAttribI2iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI2iEXT, &args ))) WARN( "glVertexAttribI2iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI2iv( GLuint index, const GLint *v )
@@ -22302,7 +22302,7 @@ static void WINAPI glVertexAttribI2ui( GLuint index, GLuint x, GLuint y )
     struct glVertexAttribI2ui_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribI2ui, &args ))) WARN( "glVertexAttribI2ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI2ui, &args ))) WARN( "glVertexAttribI2ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI2uiEXT( GLuint index, GLuint x, GLuint y )
@@ -22310,7 +22310,7 @@ static void WINAPI glVertexAttribI2uiEXT( GLuint index, GLuint x, GLuint y )
     struct glVertexAttribI2uiEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribI2uiEXT, &args ))) WARN( "glVertexAttribI2uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI2uiEXT, &args ))) WARN( "glVertexAttribI2uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI2uiv( GLuint index, const GLuint *v )
@@ -22334,7 +22334,7 @@ static void WINAPI glVertexAttribI3i( GLuint index, GLint x, GLint y, GLint z )
     struct glVertexAttribI3i_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribI3i, &args ))) WARN( "glVertexAttribI3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI3i, &args ))) WARN( "glVertexAttribI3i returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI3iEXT( GLuint index, GLint x, GLint y, GLint z )
@@ -22342,7 +22342,7 @@ static void WINAPI glVertexAttribI3iEXT( GLuint index, GLint x, GLint y, GLint z
     struct glVertexAttribI3iEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribI3iEXT, &args ))) WARN( "glVertexAttribI3iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI3iEXT, &args ))) WARN( "glVertexAttribI3iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI3iv( GLuint index, const GLint *v )
@@ -22366,7 +22366,7 @@ static void WINAPI glVertexAttribI3ui( GLuint index, GLuint x, GLuint y, GLuint
     struct glVertexAttribI3ui_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribI3ui, &args ))) WARN( "glVertexAttribI3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI3ui, &args ))) WARN( "glVertexAttribI3ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI3uiEXT( GLuint index, GLuint x, GLuint y, GLuint z )
@@ -22374,7 +22374,7 @@ static void WINAPI glVertexAttribI3uiEXT( GLuint index, GLuint x, GLuint y, GLui
     struct glVertexAttribI3uiEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribI3uiEXT, &args ))) WARN( "glVertexAttribI3uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI3uiEXT, &args ))) WARN( "glVertexAttribI3uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI3uiv( GLuint index, const GLuint *v )
@@ -22414,7 +22414,7 @@ static void WINAPI glVertexAttribI4i( GLuint index, GLint x, GLint y, GLint z, G
     struct glVertexAttribI4i_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribI4i, &args ))) WARN( "glVertexAttribI4i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI4i, &args ))) WARN( "glVertexAttribI4i returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI4iEXT( GLuint index, GLint x, GLint y, GLint z, GLint w )
@@ -22422,7 +22422,7 @@ static void WINAPI glVertexAttribI4iEXT( GLuint index, GLint x, GLint y, GLint z
     struct glVertexAttribI4iEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribI4iEXT, &args ))) WARN( "glVertexAttribI4iEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI4iEXT, &args ))) WARN( "glVertexAttribI4iEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI4iv( GLuint index, const GLint *v )
@@ -22478,7 +22478,7 @@ static void WINAPI glVertexAttribI4ui( GLuint index, GLuint x, GLuint y, GLuint
     struct glVertexAttribI4ui_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribI4ui, &args ))) WARN( "glVertexAttribI4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI4ui, &args ))) WARN( "glVertexAttribI4ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI4uiEXT( GLuint index, GLuint x, GLuint y, GLuint z, GLuint w )
@@ -22486,7 +22486,7 @@ static void WINAPI glVertexAttribI4uiEXT( GLuint index, GLuint x, GLuint y, GLui
     struct glVertexAttribI4uiEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %d, y %d, z %d, w %d\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribI4uiEXT, &args ))) WARN( "glVertexAttribI4uiEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribI4uiEXT, &args ))) WARN( "glVertexAttribI4uiEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribI4uiv( GLuint index, const GLuint *v )
@@ -22526,7 +22526,7 @@ static void WINAPI glVertexAttribIFormat( GLuint attribindex, GLint size, GLenum
     struct glVertexAttribIFormat_params args = { .teb = NtCurrentTeb(), .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "attribindex %d, size %d, type %d, relativeoffset %d\n", attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexAttribIFormat, &args ))) WARN( "glVertexAttribIFormat returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribIFormat, &args ))) WARN( "glVertexAttribIFormat returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribIFormatNV( GLuint index, GLint size, GLenum type, GLsizei stride )
@@ -22534,7 +22534,7 @@ static void WINAPI glVertexAttribIFormatNV( GLuint index, GLint size, GLenum typ
     struct glVertexAttribIFormatNV_params args = { .teb = NtCurrentTeb(), .index = index, .size = size, .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "index %d, size %d, type %d, stride %d\n", index, size, type, stride );
-    if ((status = UNIX_CALL( glVertexAttribIFormatNV, &args ))) WARN( "glVertexAttribIFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribIFormatNV, &args ))) WARN( "glVertexAttribIFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribIPointer( GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer )
@@ -22558,7 +22558,7 @@ static void WINAPI glVertexAttribL1d( GLuint index, GLdouble x )
     struct glVertexAttribL1d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribL1d, &args ))) WARN( "glVertexAttribL1d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL1d, &args ))) WARN( "glVertexAttribL1d returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL1dEXT( GLuint index, GLdouble x )
@@ -22566,7 +22566,7 @@ static void WINAPI glVertexAttribL1dEXT( GLuint index, GLdouble x )
     struct glVertexAttribL1dEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %f\n", index, x );
-    if ((status = UNIX_CALL( glVertexAttribL1dEXT, &args ))) WARN( "glVertexAttribL1dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL1dEXT, &args ))) WARN( "glVertexAttribL1dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL1dv( GLuint index, const GLdouble *v )
@@ -22590,7 +22590,7 @@ static void WINAPI glVertexAttribL1i64NV( GLuint index, GLint64EXT x )
     struct glVertexAttribL1i64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %s\n", index, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glVertexAttribL1i64NV, &args ))) WARN( "glVertexAttribL1i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL1i64NV, &args ))) WARN( "glVertexAttribL1i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL1i64vNV( GLuint index, const GLint64EXT *v )
@@ -22606,7 +22606,7 @@ static void WINAPI glVertexAttribL1ui64ARB( GLuint index, GLuint64EXT x )
     struct glVertexAttribL1ui64ARB_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %s\n", index, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glVertexAttribL1ui64ARB, &args ))) WARN( "glVertexAttribL1ui64ARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL1ui64ARB, &args ))) WARN( "glVertexAttribL1ui64ARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL1ui64NV( GLuint index, GLuint64EXT x )
@@ -22614,7 +22614,7 @@ static void WINAPI glVertexAttribL1ui64NV( GLuint index, GLuint64EXT x )
     struct glVertexAttribL1ui64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x };
     NTSTATUS status;
     TRACE( "index %d, x %s\n", index, wine_dbgstr_longlong(x) );
-    if ((status = UNIX_CALL( glVertexAttribL1ui64NV, &args ))) WARN( "glVertexAttribL1ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL1ui64NV, &args ))) WARN( "glVertexAttribL1ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL1ui64vARB( GLuint index, const GLuint64EXT *v )
@@ -22638,7 +22638,7 @@ static void WINAPI glVertexAttribL2d( GLuint index, GLdouble x, GLdouble y )
     struct glVertexAttribL2d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribL2d, &args ))) WARN( "glVertexAttribL2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL2d, &args ))) WARN( "glVertexAttribL2d returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL2dEXT( GLuint index, GLdouble x, GLdouble y )
@@ -22646,7 +22646,7 @@ static void WINAPI glVertexAttribL2dEXT( GLuint index, GLdouble x, GLdouble y )
     struct glVertexAttribL2dEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f\n", index, x, y );
-    if ((status = UNIX_CALL( glVertexAttribL2dEXT, &args ))) WARN( "glVertexAttribL2dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL2dEXT, &args ))) WARN( "glVertexAttribL2dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL2dv( GLuint index, const GLdouble *v )
@@ -22670,7 +22670,7 @@ static void WINAPI glVertexAttribL2i64NV( GLuint index, GLint64EXT x, GLint64EXT
     struct glVertexAttribL2i64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %s, y %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glVertexAttribL2i64NV, &args ))) WARN( "glVertexAttribL2i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL2i64NV, &args ))) WARN( "glVertexAttribL2i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL2i64vNV( GLuint index, const GLint64EXT *v )
@@ -22686,7 +22686,7 @@ static void WINAPI glVertexAttribL2ui64NV( GLuint index, GLuint64EXT x, GLuint64
     struct glVertexAttribL2ui64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "index %d, x %s, y %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y) );
-    if ((status = UNIX_CALL( glVertexAttribL2ui64NV, &args ))) WARN( "glVertexAttribL2ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL2ui64NV, &args ))) WARN( "glVertexAttribL2ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL2ui64vNV( GLuint index, const GLuint64EXT *v )
@@ -22702,7 +22702,7 @@ static void WINAPI glVertexAttribL3d( GLuint index, GLdouble x, GLdouble y, GLdo
     struct glVertexAttribL3d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribL3d, &args ))) WARN( "glVertexAttribL3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL3d, &args ))) WARN( "glVertexAttribL3d returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL3dEXT( GLuint index, GLdouble x, GLdouble y, GLdouble z )
@@ -22710,7 +22710,7 @@ static void WINAPI glVertexAttribL3dEXT( GLuint index, GLdouble x, GLdouble y, G
     struct glVertexAttribL3dEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f\n", index, x, y, z );
-    if ((status = UNIX_CALL( glVertexAttribL3dEXT, &args ))) WARN( "glVertexAttribL3dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL3dEXT, &args ))) WARN( "glVertexAttribL3dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL3dv( GLuint index, const GLdouble *v )
@@ -22734,7 +22734,7 @@ static void WINAPI glVertexAttribL3i64NV( GLuint index, GLint64EXT x, GLint64EXT
     struct glVertexAttribL3i64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %s, y %s, z %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glVertexAttribL3i64NV, &args ))) WARN( "glVertexAttribL3i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL3i64NV, &args ))) WARN( "glVertexAttribL3i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL3i64vNV( GLuint index, const GLint64EXT *v )
@@ -22750,7 +22750,7 @@ static void WINAPI glVertexAttribL3ui64NV( GLuint index, GLuint64EXT x, GLuint64
     struct glVertexAttribL3ui64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "index %d, x %s, y %s, z %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z) );
-    if ((status = UNIX_CALL( glVertexAttribL3ui64NV, &args ))) WARN( "glVertexAttribL3ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL3ui64NV, &args ))) WARN( "glVertexAttribL3ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL3ui64vNV( GLuint index, const GLuint64EXT *v )
@@ -22766,7 +22766,7 @@ static void WINAPI glVertexAttribL4d( GLuint index, GLdouble x, GLdouble y, GLdo
     struct glVertexAttribL4d_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribL4d, &args ))) WARN( "glVertexAttribL4d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL4d, &args ))) WARN( "glVertexAttribL4d returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL4dEXT( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w )
@@ -22774,7 +22774,7 @@ static void WINAPI glVertexAttribL4dEXT( GLuint index, GLdouble x, GLdouble y, G
     struct glVertexAttribL4dEXT_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, z %f, w %f\n", index, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexAttribL4dEXT, &args ))) WARN( "glVertexAttribL4dEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL4dEXT, &args ))) WARN( "glVertexAttribL4dEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL4dv( GLuint index, const GLdouble *v )
@@ -22798,7 +22798,7 @@ static void WINAPI glVertexAttribL4i64NV( GLuint index, GLint64EXT x, GLint64EXT
     struct glVertexAttribL4i64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %s, y %s, z %s, w %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glVertexAttribL4i64NV, &args ))) WARN( "glVertexAttribL4i64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL4i64NV, &args ))) WARN( "glVertexAttribL4i64NV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL4i64vNV( GLuint index, const GLint64EXT *v )
@@ -22814,7 +22814,7 @@ static void WINAPI glVertexAttribL4ui64NV( GLuint index, GLuint64EXT x, GLuint64
     struct glVertexAttribL4ui64NV_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "index %d, x %s, y %s, z %s, w %s\n", index, wine_dbgstr_longlong(x), wine_dbgstr_longlong(y), wine_dbgstr_longlong(z), wine_dbgstr_longlong(w) );
-    if ((status = UNIX_CALL( glVertexAttribL4ui64NV, &args ))) WARN( "glVertexAttribL4ui64NV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribL4ui64NV, &args ))) WARN( "glVertexAttribL4ui64NV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribL4ui64vNV( GLuint index, const GLuint64EXT *v )
@@ -22830,7 +22830,7 @@ static void WINAPI glVertexAttribLFormat( GLuint attribindex, GLint size, GLenum
     struct glVertexAttribLFormat_params args = { .teb = NtCurrentTeb(), .attribindex = attribindex, .size = size, .type = type, .relativeoffset = relativeoffset };
     NTSTATUS status;
     TRACE( "attribindex %d, size %d, type %d, relativeoffset %d\n", attribindex, size, type, relativeoffset );
-    if ((status = UNIX_CALL( glVertexAttribLFormat, &args ))) WARN( "glVertexAttribLFormat returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribLFormat, &args ))) WARN( "glVertexAttribLFormat returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribLFormatNV( GLuint index, GLint size, GLenum type, GLsizei stride )
@@ -22838,7 +22838,7 @@ static void WINAPI glVertexAttribLFormatNV( GLuint index, GLint size, GLenum typ
     struct glVertexAttribLFormatNV_params args = { .teb = NtCurrentTeb(), .index = index, .size = size, .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "index %d, size %d, type %d, stride %d\n", index, size, type, stride );
-    if ((status = UNIX_CALL( glVertexAttribLFormatNV, &args ))) WARN( "glVertexAttribLFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribLFormatNV, &args ))) WARN( "glVertexAttribLFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribLPointer( GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer )
@@ -22862,7 +22862,7 @@ static void WINAPI glVertexAttribP1ui( GLuint index, GLenum type, GLboolean norm
     struct glVertexAttribP1ui_params args = { .teb = NtCurrentTeb(), .index = index, .type = type, .normalized = normalized, .value = value };
     NTSTATUS status;
     TRACE( "index %d, type %d, normalized %d, value %d\n", index, type, normalized, value );
-    if ((status = UNIX_CALL( glVertexAttribP1ui, &args ))) WARN( "glVertexAttribP1ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribP1ui, &args ))) WARN( "glVertexAttribP1ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribP1uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value )
@@ -22878,7 +22878,7 @@ static void WINAPI glVertexAttribP2ui( GLuint index, GLenum type, GLboolean norm
     struct glVertexAttribP2ui_params args = { .teb = NtCurrentTeb(), .index = index, .type = type, .normalized = normalized, .value = value };
     NTSTATUS status;
     TRACE( "index %d, type %d, normalized %d, value %d\n", index, type, normalized, value );
-    if ((status = UNIX_CALL( glVertexAttribP2ui, &args ))) WARN( "glVertexAttribP2ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribP2ui, &args ))) WARN( "glVertexAttribP2ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribP2uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value )
@@ -22894,7 +22894,7 @@ static void WINAPI glVertexAttribP3ui( GLuint index, GLenum type, GLboolean norm
     struct glVertexAttribP3ui_params args = { .teb = NtCurrentTeb(), .index = index, .type = type, .normalized = normalized, .value = value };
     NTSTATUS status;
     TRACE( "index %d, type %d, normalized %d, value %d\n", index, type, normalized, value );
-    if ((status = UNIX_CALL( glVertexAttribP3ui, &args ))) WARN( "glVertexAttribP3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribP3ui, &args ))) WARN( "glVertexAttribP3ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribP3uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value )
@@ -22910,7 +22910,7 @@ static void WINAPI glVertexAttribP4ui( GLuint index, GLenum type, GLboolean norm
     struct glVertexAttribP4ui_params args = { .teb = NtCurrentTeb(), .index = index, .type = type, .normalized = normalized, .value = value };
     NTSTATUS status;
     TRACE( "index %d, type %d, normalized %d, value %d\n", index, type, normalized, value );
-    if ((status = UNIX_CALL( glVertexAttribP4ui, &args ))) WARN( "glVertexAttribP4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribP4ui, &args ))) WARN( "glVertexAttribP4ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribP4uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value )
@@ -22926,7 +22926,7 @@ static void WINAPI glVertexAttribParameteriAMD( GLuint index, GLenum pname, GLin
     struct glVertexAttribParameteriAMD_params args = { .teb = NtCurrentTeb(), .index = index, .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "index %d, pname %d, param %d\n", index, pname, param );
-    if ((status = UNIX_CALL( glVertexAttribParameteriAMD, &args ))) WARN( "glVertexAttribParameteriAMD returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexAttribParameteriAMD, &args ))) WARN( "glVertexAttribParameteriAMD returned %#lx\n", status );
 }
 
 static void WINAPI glVertexAttribPointer( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer )
@@ -23094,7 +23094,7 @@ static void WINAPI glVertexBindingDivisor( GLuint bindingindex, GLuint divisor )
     struct glVertexBindingDivisor_params args = { .teb = NtCurrentTeb(), .bindingindex = bindingindex, .divisor = divisor };
     NTSTATUS status;
     TRACE( "bindingindex %d, divisor %d\n", bindingindex, divisor );
-    if ((status = UNIX_CALL( glVertexBindingDivisor, &args ))) WARN( "glVertexBindingDivisor returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexBindingDivisor, &args ))) WARN( "glVertexBindingDivisor returned %#lx\n", status );
 }
 
 static void WINAPI glVertexBlendARB( GLint count )
@@ -23102,7 +23102,7 @@ static void WINAPI glVertexBlendARB( GLint count )
     struct glVertexBlendARB_params args = { .teb = NtCurrentTeb(), .count = count };
     NTSTATUS status;
     TRACE( "count %d\n", count );
-    if ((status = UNIX_CALL( glVertexBlendARB, &args ))) WARN( "glVertexBlendARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexBlendARB, &args ))) WARN( "glVertexBlendARB returned %#lx\n", status );
 }
 
 static void WINAPI glVertexBlendEnvfATI( GLenum pname, GLfloat param )
@@ -23110,7 +23110,7 @@ static void WINAPI glVertexBlendEnvfATI( GLenum pname, GLfloat param )
     struct glVertexBlendEnvfATI_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %f\n", pname, param );
-    if ((status = UNIX_CALL( glVertexBlendEnvfATI, &args ))) WARN( "glVertexBlendEnvfATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexBlendEnvfATI, &args ))) WARN( "glVertexBlendEnvfATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexBlendEnviATI( GLenum pname, GLint param )
@@ -23118,7 +23118,7 @@ static void WINAPI glVertexBlendEnviATI( GLenum pname, GLint param )
     struct glVertexBlendEnviATI_params args = { .teb = NtCurrentTeb(), .pname = pname, .param = param };
     NTSTATUS status;
     TRACE( "pname %d, param %d\n", pname, param );
-    if ((status = UNIX_CALL( glVertexBlendEnviATI, &args ))) WARN( "glVertexBlendEnviATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexBlendEnviATI, &args ))) WARN( "glVertexBlendEnviATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexFormatNV( GLint size, GLenum type, GLsizei stride )
@@ -23126,7 +23126,7 @@ static void WINAPI glVertexFormatNV( GLint size, GLenum type, GLsizei stride )
     struct glVertexFormatNV_params args = { .teb = NtCurrentTeb(), .size = size, .type = type, .stride = stride };
     NTSTATUS status;
     TRACE( "size %d, type %d, stride %d\n", size, type, stride );
-    if ((status = UNIX_CALL( glVertexFormatNV, &args ))) WARN( "glVertexFormatNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexFormatNV, &args ))) WARN( "glVertexFormatNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexP2ui( GLenum type, GLuint value )
@@ -23134,7 +23134,7 @@ static void WINAPI glVertexP2ui( GLenum type, GLuint value )
     struct glVertexP2ui_params args = { .teb = NtCurrentTeb(), .type = type, .value = value };
     NTSTATUS status;
     TRACE( "type %d, value %d\n", type, value );
-    if ((status = UNIX_CALL( glVertexP2ui, &args ))) WARN( "glVertexP2ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexP2ui, &args ))) WARN( "glVertexP2ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexP2uiv( GLenum type, const GLuint *value )
@@ -23150,7 +23150,7 @@ static void WINAPI glVertexP3ui( GLenum type, GLuint value )
     struct glVertexP3ui_params args = { .teb = NtCurrentTeb(), .type = type, .value = value };
     NTSTATUS status;
     TRACE( "type %d, value %d\n", type, value );
-    if ((status = UNIX_CALL( glVertexP3ui, &args ))) WARN( "glVertexP3ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexP3ui, &args ))) WARN( "glVertexP3ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexP3uiv( GLenum type, const GLuint *value )
@@ -23166,7 +23166,7 @@ static void WINAPI glVertexP4ui( GLenum type, GLuint value )
     struct glVertexP4ui_params args = { .teb = NtCurrentTeb(), .type = type, .value = value };
     NTSTATUS status;
     TRACE( "type %d, value %d\n", type, value );
-    if ((status = UNIX_CALL( glVertexP4ui, &args ))) WARN( "glVertexP4ui returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexP4ui, &args ))) WARN( "glVertexP4ui returned %#lx\n", status );
 }
 
 static void WINAPI glVertexP4uiv( GLenum type, const GLuint *value )
@@ -23206,7 +23206,7 @@ static void WINAPI glVertexStream1dATI( GLenum stream, GLdouble x )
     struct glVertexStream1dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x };
     NTSTATUS status;
     TRACE( "stream %d, x %f\n", stream, x );
-    if ((status = UNIX_CALL( glVertexStream1dATI, &args ))) WARN( "glVertexStream1dATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream1dATI, &args ))) WARN( "glVertexStream1dATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream1dvATI( GLenum stream, const GLdouble *coords )
@@ -23222,7 +23222,7 @@ static void WINAPI glVertexStream1fATI( GLenum stream, GLfloat x )
     struct glVertexStream1fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x };
     NTSTATUS status;
     TRACE( "stream %d, x %f\n", stream, x );
-    if ((status = UNIX_CALL( glVertexStream1fATI, &args ))) WARN( "glVertexStream1fATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream1fATI, &args ))) WARN( "glVertexStream1fATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream1fvATI( GLenum stream, const GLfloat *coords )
@@ -23238,7 +23238,7 @@ static void WINAPI glVertexStream1iATI( GLenum stream, GLint x )
     struct glVertexStream1iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x };
     NTSTATUS status;
     TRACE( "stream %d, x %d\n", stream, x );
-    if ((status = UNIX_CALL( glVertexStream1iATI, &args ))) WARN( "glVertexStream1iATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream1iATI, &args ))) WARN( "glVertexStream1iATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream1ivATI( GLenum stream, const GLint *coords )
@@ -23254,7 +23254,7 @@ static void WINAPI glVertexStream1sATI( GLenum stream, GLshort x )
     struct glVertexStream1sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x };
     NTSTATUS status;
     TRACE( "stream %d, x %d\n", stream, x );
-    if ((status = UNIX_CALL( glVertexStream1sATI, &args ))) WARN( "glVertexStream1sATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream1sATI, &args ))) WARN( "glVertexStream1sATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream1svATI( GLenum stream, const GLshort *coords )
@@ -23270,7 +23270,7 @@ static void WINAPI glVertexStream2dATI( GLenum stream, GLdouble x, GLdouble y )
     struct glVertexStream2dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "stream %d, x %f, y %f\n", stream, x, y );
-    if ((status = UNIX_CALL( glVertexStream2dATI, &args ))) WARN( "glVertexStream2dATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream2dATI, &args ))) WARN( "glVertexStream2dATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream2dvATI( GLenum stream, const GLdouble *coords )
@@ -23286,7 +23286,7 @@ static void WINAPI glVertexStream2fATI( GLenum stream, GLfloat x, GLfloat y )
     struct glVertexStream2fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "stream %d, x %f, y %f\n", stream, x, y );
-    if ((status = UNIX_CALL( glVertexStream2fATI, &args ))) WARN( "glVertexStream2fATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream2fATI, &args ))) WARN( "glVertexStream2fATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream2fvATI( GLenum stream, const GLfloat *coords )
@@ -23302,7 +23302,7 @@ static void WINAPI glVertexStream2iATI( GLenum stream, GLint x, GLint y )
     struct glVertexStream2iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "stream %d, x %d, y %d\n", stream, x, y );
-    if ((status = UNIX_CALL( glVertexStream2iATI, &args ))) WARN( "glVertexStream2iATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream2iATI, &args ))) WARN( "glVertexStream2iATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream2ivATI( GLenum stream, const GLint *coords )
@@ -23318,7 +23318,7 @@ static void WINAPI glVertexStream2sATI( GLenum stream, GLshort x, GLshort y )
     struct glVertexStream2sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y };
     NTSTATUS status;
     TRACE( "stream %d, x %d, y %d\n", stream, x, y );
-    if ((status = UNIX_CALL( glVertexStream2sATI, &args ))) WARN( "glVertexStream2sATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream2sATI, &args ))) WARN( "glVertexStream2sATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream2svATI( GLenum stream, const GLshort *coords )
@@ -23334,7 +23334,7 @@ static void WINAPI glVertexStream3dATI( GLenum stream, GLdouble x, GLdouble y, G
     struct glVertexStream3dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "stream %d, x %f, y %f, z %f\n", stream, x, y, z );
-    if ((status = UNIX_CALL( glVertexStream3dATI, &args ))) WARN( "glVertexStream3dATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream3dATI, &args ))) WARN( "glVertexStream3dATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream3dvATI( GLenum stream, const GLdouble *coords )
@@ -23350,7 +23350,7 @@ static void WINAPI glVertexStream3fATI( GLenum stream, GLfloat x, GLfloat y, GLf
     struct glVertexStream3fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "stream %d, x %f, y %f, z %f\n", stream, x, y, z );
-    if ((status = UNIX_CALL( glVertexStream3fATI, &args ))) WARN( "glVertexStream3fATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream3fATI, &args ))) WARN( "glVertexStream3fATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream3fvATI( GLenum stream, const GLfloat *coords )
@@ -23366,7 +23366,7 @@ static void WINAPI glVertexStream3iATI( GLenum stream, GLint x, GLint y, GLint z
     struct glVertexStream3iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "stream %d, x %d, y %d, z %d\n", stream, x, y, z );
-    if ((status = UNIX_CALL( glVertexStream3iATI, &args ))) WARN( "glVertexStream3iATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream3iATI, &args ))) WARN( "glVertexStream3iATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream3ivATI( GLenum stream, const GLint *coords )
@@ -23382,7 +23382,7 @@ static void WINAPI glVertexStream3sATI( GLenum stream, GLshort x, GLshort y, GLs
     struct glVertexStream3sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "stream %d, x %d, y %d, z %d\n", stream, x, y, z );
-    if ((status = UNIX_CALL( glVertexStream3sATI, &args ))) WARN( "glVertexStream3sATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream3sATI, &args ))) WARN( "glVertexStream3sATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream3svATI( GLenum stream, const GLshort *coords )
@@ -23398,7 +23398,7 @@ static void WINAPI glVertexStream4dATI( GLenum stream, GLdouble x, GLdouble y, G
     struct glVertexStream4dATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "stream %d, x %f, y %f, z %f, w %f\n", stream, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexStream4dATI, &args ))) WARN( "glVertexStream4dATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream4dATI, &args ))) WARN( "glVertexStream4dATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream4dvATI( GLenum stream, const GLdouble *coords )
@@ -23414,7 +23414,7 @@ static void WINAPI glVertexStream4fATI( GLenum stream, GLfloat x, GLfloat y, GLf
     struct glVertexStream4fATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "stream %d, x %f, y %f, z %f, w %f\n", stream, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexStream4fATI, &args ))) WARN( "glVertexStream4fATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream4fATI, &args ))) WARN( "glVertexStream4fATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream4fvATI( GLenum stream, const GLfloat *coords )
@@ -23430,7 +23430,7 @@ static void WINAPI glVertexStream4iATI( GLenum stream, GLint x, GLint y, GLint z
     struct glVertexStream4iATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "stream %d, x %d, y %d, z %d, w %d\n", stream, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexStream4iATI, &args ))) WARN( "glVertexStream4iATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream4iATI, &args ))) WARN( "glVertexStream4iATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream4ivATI( GLenum stream, const GLint *coords )
@@ -23446,7 +23446,7 @@ static void WINAPI glVertexStream4sATI( GLenum stream, GLshort x, GLshort y, GLs
     struct glVertexStream4sATI_params args = { .teb = NtCurrentTeb(), .stream = stream, .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "stream %d, x %d, y %d, z %d, w %d\n", stream, x, y, z, w );
-    if ((status = UNIX_CALL( glVertexStream4sATI, &args ))) WARN( "glVertexStream4sATI returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexStream4sATI, &args ))) WARN( "glVertexStream4sATI returned %#lx\n", status );
 }
 
 static void WINAPI glVertexStream4svATI( GLenum stream, const GLshort *coords )
@@ -23470,7 +23470,7 @@ static void WINAPI glVertexWeightfEXT( GLfloat weight )
     struct glVertexWeightfEXT_params args = { .teb = NtCurrentTeb(), .weight = weight };
     NTSTATUS status;
     TRACE( "weight %f\n", weight );
-    if ((status = UNIX_CALL( glVertexWeightfEXT, &args ))) WARN( "glVertexWeightfEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexWeightfEXT, &args ))) WARN( "glVertexWeightfEXT returned %#lx\n", status );
 }
 
 static void WINAPI glVertexWeightfvEXT( const GLfloat *weight )
@@ -23486,7 +23486,7 @@ static void WINAPI glVertexWeighthNV( GLhalfNV weight )
     struct glVertexWeighthNV_params args = { .teb = NtCurrentTeb(), .weight = weight };
     NTSTATUS status;
     TRACE( "weight %d\n", weight );
-    if ((status = UNIX_CALL( glVertexWeighthNV, &args ))) WARN( "glVertexWeighthNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glVertexWeighthNV, &args ))) WARN( "glVertexWeighthNV returned %#lx\n", status );
 }
 
 static void WINAPI glVertexWeighthvNV( const GLhalfNV *weight )
@@ -23543,7 +23543,7 @@ static void WINAPI glViewportIndexedf( GLuint index, GLfloat x, GLfloat y, GLflo
     struct glViewportIndexedf_params args = { .teb = NtCurrentTeb(), .index = index, .x = x, .y = y, .w = w, .h = h };
     NTSTATUS status;
     TRACE( "index %d, x %f, y %f, w %f, h %f\n", index, x, y, w, h );
-    if ((status = UNIX_CALL( glViewportIndexedf, &args ))) WARN( "glViewportIndexedf returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glViewportIndexedf, &args ))) WARN( "glViewportIndexedf returned %#lx\n", status );
 }
 
 static void WINAPI glViewportIndexedfv( GLuint index, const GLfloat *v )
@@ -23559,7 +23559,7 @@ static void WINAPI glViewportPositionWScaleNV( GLuint index, GLfloat xcoeff, GLf
     struct glViewportPositionWScaleNV_params args = { .teb = NtCurrentTeb(), .index = index, .xcoeff = xcoeff, .ycoeff = ycoeff };
     NTSTATUS status;
     TRACE( "index %d, xcoeff %f, ycoeff %f\n", index, xcoeff, ycoeff );
-    if ((status = UNIX_CALL( glViewportPositionWScaleNV, &args ))) WARN( "glViewportPositionWScaleNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glViewportPositionWScaleNV, &args ))) WARN( "glViewportPositionWScaleNV returned %#lx\n", status );
 }
 
 static void WINAPI glViewportSwizzleNV( GLuint index, GLenum swizzlex, GLenum swizzley, GLenum swizzlez, GLenum swizzlew )
@@ -23567,7 +23567,7 @@ static void WINAPI glViewportSwizzleNV( GLuint index, GLenum swizzlex, GLenum sw
     struct glViewportSwizzleNV_params args = { .teb = NtCurrentTeb(), .index = index, .swizzlex = swizzlex, .swizzley = swizzley, .swizzlez = swizzlez, .swizzlew = swizzlew };
     NTSTATUS status;
     TRACE( "index %d, swizzlex %d, swizzley %d, swizzlez %d, swizzlew %d\n", index, swizzlex, swizzley, swizzlez, swizzlew );
-    if ((status = UNIX_CALL( glViewportSwizzleNV, &args ))) WARN( "glViewportSwizzleNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glViewportSwizzleNV, &args ))) WARN( "glViewportSwizzleNV returned %#lx\n", status );
 }
 
 static void WINAPI glWaitSemaphoreEXT( GLuint semaphore, GLuint numBufferBarriers, const GLuint *buffers, GLuint numTextureBarriers, const GLuint *textures, const GLenum *srcLayouts )
@@ -23599,7 +23599,7 @@ static void WINAPI glWaitVkSemaphoreNV( GLuint64 vkSemaphore )
     struct glWaitVkSemaphoreNV_params args = { .teb = NtCurrentTeb(), .vkSemaphore = vkSemaphore };
     NTSTATUS status;
     TRACE( "vkSemaphore %s\n", wine_dbgstr_longlong(vkSemaphore) );
-    if ((status = UNIX_CALL( glWaitVkSemaphoreNV, &args ))) WARN( "glWaitVkSemaphoreNV returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWaitVkSemaphoreNV, &args ))) WARN( "glWaitVkSemaphoreNV returned %#lx\n", status );
 }
 
 static void WINAPI glWeightPathsNV( GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights )
@@ -23687,7 +23687,7 @@ static void WINAPI glWindowPos2d( GLdouble x, GLdouble y )
     struct glWindowPos2d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2d, &args ))) WARN( "glWindowPos2d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2d, &args ))) WARN( "glWindowPos2d returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2dARB( GLdouble x, GLdouble y )
@@ -23695,7 +23695,7 @@ static void WINAPI glWindowPos2dARB( GLdouble x, GLdouble y )
     struct glWindowPos2dARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2dARB, &args ))) WARN( "glWindowPos2dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2dARB, &args ))) WARN( "glWindowPos2dARB returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2dMESA( GLdouble x, GLdouble y )
@@ -23703,7 +23703,7 @@ static void WINAPI glWindowPos2dMESA( GLdouble x, GLdouble y )
     struct glWindowPos2dMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2dMESA, &args ))) WARN( "glWindowPos2dMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2dMESA, &args ))) WARN( "glWindowPos2dMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2dv( const GLdouble *v )
@@ -23735,7 +23735,7 @@ static void WINAPI glWindowPos2f( GLfloat x, GLfloat y )
     struct glWindowPos2f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2f, &args ))) WARN( "glWindowPos2f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2f, &args ))) WARN( "glWindowPos2f returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2fARB( GLfloat x, GLfloat y )
@@ -23743,7 +23743,7 @@ static void WINAPI glWindowPos2fARB( GLfloat x, GLfloat y )
     struct glWindowPos2fARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2fARB, &args ))) WARN( "glWindowPos2fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2fARB, &args ))) WARN( "glWindowPos2fARB returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2fMESA( GLfloat x, GLfloat y )
@@ -23751,7 +23751,7 @@ static void WINAPI glWindowPos2fMESA( GLfloat x, GLfloat y )
     struct glWindowPos2fMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %f, y %f\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2fMESA, &args ))) WARN( "glWindowPos2fMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2fMESA, &args ))) WARN( "glWindowPos2fMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2fv( const GLfloat *v )
@@ -23783,7 +23783,7 @@ static void WINAPI glWindowPos2i( GLint x, GLint y )
     struct glWindowPos2i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2i, &args ))) WARN( "glWindowPos2i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2i, &args ))) WARN( "glWindowPos2i returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2iARB( GLint x, GLint y )
@@ -23791,7 +23791,7 @@ static void WINAPI glWindowPos2iARB( GLint x, GLint y )
     struct glWindowPos2iARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2iARB, &args ))) WARN( "glWindowPos2iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2iARB, &args ))) WARN( "glWindowPos2iARB returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2iMESA( GLint x, GLint y )
@@ -23799,7 +23799,7 @@ static void WINAPI glWindowPos2iMESA( GLint x, GLint y )
     struct glWindowPos2iMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2iMESA, &args ))) WARN( "glWindowPos2iMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2iMESA, &args ))) WARN( "glWindowPos2iMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2iv( const GLint *v )
@@ -23831,7 +23831,7 @@ static void WINAPI glWindowPos2s( GLshort x, GLshort y )
     struct glWindowPos2s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2s, &args ))) WARN( "glWindowPos2s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2s, &args ))) WARN( "glWindowPos2s returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2sARB( GLshort x, GLshort y )
@@ -23839,7 +23839,7 @@ static void WINAPI glWindowPos2sARB( GLshort x, GLshort y )
     struct glWindowPos2sARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2sARB, &args ))) WARN( "glWindowPos2sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2sARB, &args ))) WARN( "glWindowPos2sARB returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2sMESA( GLshort x, GLshort y )
@@ -23847,7 +23847,7 @@ static void WINAPI glWindowPos2sMESA( GLshort x, GLshort y )
     struct glWindowPos2sMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y };
     NTSTATUS status;
     TRACE( "x %d, y %d\n", x, y );
-    if ((status = UNIX_CALL( glWindowPos2sMESA, &args ))) WARN( "glWindowPos2sMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos2sMESA, &args ))) WARN( "glWindowPos2sMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos2sv( const GLshort *v )
@@ -23879,7 +23879,7 @@ static void WINAPI glWindowPos3d( GLdouble x, GLdouble y, GLdouble z )
     struct glWindowPos3d_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3d, &args ))) WARN( "glWindowPos3d returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3d, &args ))) WARN( "glWindowPos3d returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3dARB( GLdouble x, GLdouble y, GLdouble z )
@@ -23887,7 +23887,7 @@ static void WINAPI glWindowPos3dARB( GLdouble x, GLdouble y, GLdouble z )
     struct glWindowPos3dARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3dARB, &args ))) WARN( "glWindowPos3dARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3dARB, &args ))) WARN( "glWindowPos3dARB returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3dMESA( GLdouble x, GLdouble y, GLdouble z )
@@ -23895,7 +23895,7 @@ static void WINAPI glWindowPos3dMESA( GLdouble x, GLdouble y, GLdouble z )
     struct glWindowPos3dMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3dMESA, &args ))) WARN( "glWindowPos3dMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3dMESA, &args ))) WARN( "glWindowPos3dMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3dv( const GLdouble *v )
@@ -23927,7 +23927,7 @@ static void WINAPI glWindowPos3f( GLfloat x, GLfloat y, GLfloat z )
     struct glWindowPos3f_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3f, &args ))) WARN( "glWindowPos3f returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3f, &args ))) WARN( "glWindowPos3f returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3fARB( GLfloat x, GLfloat y, GLfloat z )
@@ -23935,7 +23935,7 @@ static void WINAPI glWindowPos3fARB( GLfloat x, GLfloat y, GLfloat z )
     struct glWindowPos3fARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3fARB, &args ))) WARN( "glWindowPos3fARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3fARB, &args ))) WARN( "glWindowPos3fARB returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3fMESA( GLfloat x, GLfloat y, GLfloat z )
@@ -23943,7 +23943,7 @@ static void WINAPI glWindowPos3fMESA( GLfloat x, GLfloat y, GLfloat z )
     struct glWindowPos3fMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3fMESA, &args ))) WARN( "glWindowPos3fMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3fMESA, &args ))) WARN( "glWindowPos3fMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3fv( const GLfloat *v )
@@ -23975,7 +23975,7 @@ static void WINAPI glWindowPos3i( GLint x, GLint y, GLint z )
     struct glWindowPos3i_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3i, &args ))) WARN( "glWindowPos3i returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3i, &args ))) WARN( "glWindowPos3i returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3iARB( GLint x, GLint y, GLint z )
@@ -23983,7 +23983,7 @@ static void WINAPI glWindowPos3iARB( GLint x, GLint y, GLint z )
     struct glWindowPos3iARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3iARB, &args ))) WARN( "glWindowPos3iARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3iARB, &args ))) WARN( "glWindowPos3iARB returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3iMESA( GLint x, GLint y, GLint z )
@@ -23991,7 +23991,7 @@ static void WINAPI glWindowPos3iMESA( GLint x, GLint y, GLint z )
     struct glWindowPos3iMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3iMESA, &args ))) WARN( "glWindowPos3iMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3iMESA, &args ))) WARN( "glWindowPos3iMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3iv( const GLint *v )
@@ -24023,7 +24023,7 @@ static void WINAPI glWindowPos3s( GLshort x, GLshort y, GLshort z )
     struct glWindowPos3s_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3s, &args ))) WARN( "glWindowPos3s returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3s, &args ))) WARN( "glWindowPos3s returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3sARB( GLshort x, GLshort y, GLshort z )
@@ -24031,7 +24031,7 @@ static void WINAPI glWindowPos3sARB( GLshort x, GLshort y, GLshort z )
     struct glWindowPos3sARB_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3sARB, &args ))) WARN( "glWindowPos3sARB returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3sARB, &args ))) WARN( "glWindowPos3sARB returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3sMESA( GLshort x, GLshort y, GLshort z )
@@ -24039,7 +24039,7 @@ static void WINAPI glWindowPos3sMESA( GLshort x, GLshort y, GLshort z )
     struct glWindowPos3sMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d\n", x, y, z );
-    if ((status = UNIX_CALL( glWindowPos3sMESA, &args ))) WARN( "glWindowPos3sMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos3sMESA, &args ))) WARN( "glWindowPos3sMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos3sv( const GLshort *v )
@@ -24071,7 +24071,7 @@ static void WINAPI glWindowPos4dMESA( GLdouble x, GLdouble y, GLdouble z, GLdoub
     struct glWindowPos4dMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glWindowPos4dMESA, &args ))) WARN( "glWindowPos4dMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos4dMESA, &args ))) WARN( "glWindowPos4dMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos4dvMESA( const GLdouble *v )
@@ -24087,7 +24087,7 @@ static void WINAPI glWindowPos4fMESA( GLfloat x, GLfloat y, GLfloat z, GLfloat w
     struct glWindowPos4fMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %f, y %f, z %f, w %f\n", x, y, z, w );
-    if ((status = UNIX_CALL( glWindowPos4fMESA, &args ))) WARN( "glWindowPos4fMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos4fMESA, &args ))) WARN( "glWindowPos4fMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos4fvMESA( const GLfloat *v )
@@ -24103,7 +24103,7 @@ static void WINAPI glWindowPos4iMESA( GLint x, GLint y, GLint z, GLint w )
     struct glWindowPos4iMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glWindowPos4iMESA, &args ))) WARN( "glWindowPos4iMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos4iMESA, &args ))) WARN( "glWindowPos4iMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos4ivMESA( const GLint *v )
@@ -24119,7 +24119,7 @@ static void WINAPI glWindowPos4sMESA( GLshort x, GLshort y, GLshort z, GLshort w
     struct glWindowPos4sMESA_params args = { .teb = NtCurrentTeb(), .x = x, .y = y, .z = z, .w = w };
     NTSTATUS status;
     TRACE( "x %d, y %d, z %d, w %d\n", x, y, z, w );
-    if ((status = UNIX_CALL( glWindowPos4sMESA, &args ))) WARN( "glWindowPos4sMESA returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWindowPos4sMESA, &args ))) WARN( "glWindowPos4sMESA returned %#lx\n", status );
 }
 
 static void WINAPI glWindowPos4svMESA( const GLshort *v )
@@ -24143,7 +24143,7 @@ static void WINAPI glWriteMaskEXT( GLuint res, GLuint in, GLenum outX, GLenum ou
     struct glWriteMaskEXT_params args = { .teb = NtCurrentTeb(), .res = res, .in = in, .outX = outX, .outY = outY, .outZ = outZ, .outW = outW };
     NTSTATUS status;
     TRACE( "res %d, in %d, outX %d, outY %d, outZ %d, outW %d\n", res, in, outX, outY, outZ, outW );
-    if ((status = UNIX_CALL( glWriteMaskEXT, &args ))) WARN( "glWriteMaskEXT returned %#lx\n", status );
+    if ((status = UNIX_BATCH_CALL( glWriteMaskEXT, &args ))) WARN( "glWriteMaskEXT returned %#lx\n", status );
 }
 
 static void * WINAPI wglAllocateMemoryNV( GLsizei size, GLfloat readfreq, GLfloat writefreq, GLfloat priority )
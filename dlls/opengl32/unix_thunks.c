@@ -26,6 +26,7 @@ extern NTSTATUS process_attach( void *args );
 extern NTSTATUS thread_attach( void *args );
 extern NTSTATUS process_detach( void *args );
 extern NTSTATUS get_pixel_formats( void *args );
+extern NTSTATUS batch_calls( void *args );
 extern NTSTATUS wgl_wglCopyContext( void *args );
 extern NTSTATUS wgl_wglCreateContext( void *args );
 extern NTSTATUS wgl_wglDeleteContext( void *args );
@@ -24201,6 +24202,7 @@ const unixlib_entry_t __wine_unix_call_funcs[] =
     thread_attach,
     process_detach,
     get_pixel_formats,
+    batch_calls,
     wgl_wglCopyContext,
     wgl_wglCreateContext,
     wgl_wglDeleteContext,
@@ -27251,6 +27253,7 @@ typedef ULONG PTR32;
 extern NTSTATUS wow64_thread_attach( void *args );
 extern NTSTATUS wow64_process_detach( void *args );
 extern NTSTATUS wow64_get_pixel_formats( void *args );
+extern NTSTATUS wow64_batch_calls( void *args );
 
 static NTSTATUS wow64_wgl_wglCopyContext( void *args )
 {
@@ -92300,6 +92303,7 @@ const unixlib_entry_t __wine_unix_call_wow64_funcs[] =
     wow64_thread_attach,
     wow64_process_detach,
     wow64_get_pixel_formats,
+    wow64_batch_calls,
     wow64_wgl_wglCopyContext,
     wow64_wgl_wglCreateContext,
     wow64_wgl_wglDeleteContext,
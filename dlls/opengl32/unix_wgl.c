@@ -1179,6 +1179,21 @@ NTSTATUS get_pixel_formats( void *args )
     return STATUS_SUCCESS;
 }
 
+NTSTATUS batch_calls( void *args )
+{
+    struct batch_calls_params *params = args;
+    const char *ptr = params->data, *end = ptr + params->size;
+    const struct batch_call *call;
+
+    for (; ptr < end; ptr += call->size)
+    {
+        call = (const struct batch_call *)ptr;
+        if (call->code >= funcs_count) return STATUS_INVALID_PARAMETER;
+        __wine_unix_call_funcs[call->code]( (void *)(call + 1) );
+    }
+    return STATUS_SUCCESS;
+}
+
 #ifdef _WIN64
 
 typedef ULONG PTR32;
@@ -2261,6 +2276,26 @@ NTSTATUS wow64_process_detach( void *args )
     return STATUS_SUCCESS;
 }
 
+NTSTATUS wow64_batch_calls( void *args )
+{
+    struct
+    {
+        PTR32 teb;
+        PTR32 data;
+        UINT size;
+    } *params32 = args;
+    const char *ptr = ULongToPtr( params32->data ), *end = ptr + params32->size;
+    const struct batch_call *call;
+
+    for (; ptr < end; ptr += call->size)
+    {
+        call = (const struct batch_call *)ptr;
+        if (call->code >= funcs_count) return STATUS_INVALID_PARAMETER;
+        __wine_unix_call_wow64_funcs[call->code]( (void *)(call + 1) );
+    }
+    return STATUS_SUCCESS;
+}
+
 NTSTATUS wow64_get_pixel_formats( void *args )
 {
     struct
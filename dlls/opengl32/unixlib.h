@@ -25337,12 +25337,26 @@ struct get_pixel_formats_params
     unsigned int num_onscreen_formats;
 };
 
+struct batch_calls_params
+{
+    TEB *teb;
+    const void *data;
+    UINT size;
+};
+
+struct batch_call
+{
+    UINT code;
+    UINT size; /* size of the call record, including the params that follow */
+};
+
 enum unix_funcs
 {
     unix_process_attach,
     unix_thread_attach,
     unix_process_detach,
     unix_get_pixel_formats,
+    unix_batch_calls,
     unix_wglCopyContext,
     unix_wglCreateContext,
     unix_wglDeleteContext,
@@ -28398,6 +28412,4 @@ struct gl_debug_message_callback_params
     char message[1];
 };
 
-#define UNIX_CALL( func, params ) WINE_UNIX_CALL( unix_ ## func, params )
-
 #endif /* __WINE_OPENGL32_UNIXLIB_H */
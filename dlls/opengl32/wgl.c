@@ -21,6 +21,7 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "ntstatus.h"
@@ -47,6 +48,7 @@ static const MAT2 identity = { {0,1},{0,0},{0,0},{0,1} };
 #define WINE_GL_RESERVED_FORMATS_PTR      3
 #define WINE_GL_RESERVED_FORMATS_NUM      4
 #define WINE_GL_RESERVED_FORMATS_ONSCREEN 5
+#define WINE_GL_RESERVED_BATCH            6
 
 #ifndef _WIN64
 
@@ -1676,13 +1678,13 @@ static void *gl_map_buffer( enum unix_funcs code, GLenum target, GLenum access )
 
     TRACE( "target %d, access %d\n", target, access );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = gl_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
         TRACE( "Unable to map wow64 buffer directly, using copy buffer!\n" );
         if (!(args.ret = _aligned_malloc( (size_t)args.ret, 16 ))) status = STATUS_NO_MEMORY;
-        else if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+        else if (!(status = gl_unix_call( code, &args ))) return args.ret;
         _aligned_free( args.ret );
     }
 #endif
@@ -1740,13 +1742,13 @@ static void *gl_map_named_buffer( enum unix_funcs code, GLuint buffer, GLenum ac
 
     TRACE( "(%d, %d)\n", buffer, access );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = gl_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
         TRACE( "Unable to map wow64 buffer directly, using copy buffer!\n" );
         if (!(args.ret = _aligned_malloc( (size_t)args.ret, 16 ))) status = STATUS_NO_MEMORY;
-        else if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+        else if (!(status = gl_unix_call( code, &args ))) return args.ret;
         _aligned_free( args.ret );
     }
 #endif
@@ -1778,13 +1780,13 @@ static void *gl_map_named_buffer_range( enum unix_funcs code, GLuint buffer, GLi
 
     TRACE( "buffer %d, offset %Id, length %Id, access %d\n", buffer, offset, length, access );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = gl_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
         TRACE( "Unable to map wow64 buffer directly, using copy buffer!\n" );
         if (!(args.ret = _aligned_malloc( length, 16 ))) status = STATUS_NO_MEMORY;
-        else if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+        else if (!(status = gl_unix_call( code, &args ))) return args.ret;
         _aligned_free( args.ret );
     }
 #endif
@@ -1816,7 +1818,7 @@ static GLboolean gl_unmap_buffer( enum unix_funcs code, GLenum target )
 
     TRACE( "target %d\n", target );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = gl_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
@@ -1853,7 +1855,7 @@ static GLboolean gl_unmap_named_buffer( enum unix_funcs code, GLuint buffer )
 
     TRACE( "buffer %d\n", buffer );
 
-    if (!(status = WINE_UNIX_CALL( code, &args ))) return args.ret;
+    if (!(status = gl_unix_call( code, &args ))) return args.ret;
 #ifndef _WIN64
     if (status == STATUS_INVALID_ADDRESS)
     {
@@ -1878,6 +1880,81 @@ GLboolean WINAPI glUnmapNamedBufferEXT( GLuint buffer )
 
 typedef void (WINAPI *gl_debug_message)(GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar *, const void *);
 
+/* Void functions which don't reference client memory are queued and sent to the
+ * unix side in a single call when the queue is full, or before any other unix
+ * call, which covers everything returning data as well as glFlush, glFinish and
+ * wglSwapBuffers. Enabled with WINE_OPENGL_BATCH=1. */
+static BOOL batch_enabled;
+
+/* per-thread queue of calls waiting to be sent to the unix side */
+struct gl_batch
+{
+    UINT size;
+    UINT64 data[0x10000 / sizeof(UINT64)];
+};
+
+static void flush_gl_batch( struct gl_batch *batch )
+{
+    struct batch_calls_params args = { .teb = NtCurrentTeb(), .data = batch->data, .size = batch->size };
+    PVOID *glReserved = NtCurrentTeb()->glReserved1;
+    struct gl_batch *nested;
+    NTSTATUS status;
+
+    /* detach the queue while it is executed, calls made from callbacks get a separate one */
+    glReserved[WINE_GL_RESERVED_BATCH] = NULL;
+    batch->size = 0;
+    if ((status = WINE_UNIX_CALL( unix_batch_calls, &args ))) WARN( "batch_calls returned %#lx\n", status );
+
+    if ((nested = glReserved[WINE_GL_RESERVED_BATCH]))
+    {
+        if (nested->size) flush_gl_batch( nested );
+        free( nested );
+    }
+    glReserved[WINE_GL_RESERVED_BATCH] = batch;
+}
+
+NTSTATUS gl_unix_call( enum unix_funcs code, void *params )
+{
+    struct gl_batch *batch = NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_BATCH];
+
+    if (batch && batch->size) flush_gl_batch( batch );
+    return WINE_UNIX_CALL( code, params );
+}
+
+NTSTATUS batch_unix_call( enum unix_funcs code, void *params, UINT size )
+{
+    PVOID *glReserved = NtCurrentTeb()->glReserved1;
+    struct gl_batch *batch = glReserved[WINE_GL_RESERVED_BATCH];
+    UINT call_size = sizeof(struct batch_call) + ((size + 7) & ~7);
+    struct batch_call *call;
+
+    if (!batch)
+    {
+        if (!batch_enabled || !(batch = malloc( sizeof(*batch) ))) return WINE_UNIX_CALL( code, params );
+        batch->size = 0;
+        glReserved[WINE_GL_RESERVED_BATCH] = batch;
+    }
+
+    if (batch->size + call_size > sizeof(batch->data)) flush_gl_batch( batch );
+    call = (struct batch_call *)((char *)batch->data + batch->size);
+    call->code = code;
+    call->size = call_size;
+    memcpy( call + 1, params, size );
+    batch->size += call_size;
+    return STATUS_SUCCESS;
+}
+
+static void free_gl_batch(void)
+{
+    PVOID *glReserved = NtCurrentTeb()->glReserved1;
+    struct gl_batch *batch = glReserved[WINE_GL_RESERVED_BATCH];
+
+    if (!batch) return;
+    if (batch->size) flush_gl_batch( batch );
+    glReserved[WINE_GL_RESERVED_BATCH] = NULL;
+    free( batch );
+}
+
 static NTSTATUS WINAPI call_gl_debug_message_callback( void *args, ULONG size )
 {
     struct gl_debug_message_callback_params *params = args;
@@ -1897,6 +1974,7 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
     {
         .call_gl_debug_message_callback = (UINT_PTR)call_gl_debug_message_callback,
     };
+    const char *env;
     NTSTATUS status;
 
     switch(reason)
@@ -1908,6 +1986,11 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
             ERR( "Failed to load unixlib, status %#lx\n", status );
             return FALSE;
         }
+        if ((env = getenv( "WINE_OPENGL_BATCH" )) && atoi( env ))
+        {
+            TRACE( "Batching GL calls\n" );
+            batch_enabled = TRUE;
+        }
 
         /* fallthrough */
     case DLL_THREAD_ATTACH:
@@ -1920,12 +2003,14 @@ BOOL WINAPI DllMain( HINSTANCE hinst, DWORD reason, LPVOID reserved )
 
     case DLL_PROCESS_DETACH:
         if (reserved) break;
+        free_gl_batch();
         UNIX_CALL( process_detach, NULL );
 #ifndef _WIN64
         cleanup_wow64_strings();
 #endif
         /* fallthrough */
     case DLL_THREAD_DETACH:
+        free_gl_batch();
         free( NtCurrentTeb()->glReserved1[WINE_GL_RESERVED_FORMATS_PTR] );
         return TRUE;
     }
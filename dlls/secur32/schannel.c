@@ -1306,6 +1306,12 @@ static SECURITY_STATUS SEC_ENTRY schan_QueryContextAttributesW(
         struct get_cipher_info_params params = { ctx->session, info };
         return GNUTLS_CALL( get_cipher_info, &params );
     }
+    case SECPKG_ATTR_SESSION_INFO:
+    {
+        SecPkgContext_SessionInfo *info = buffer;
+        struct get_session_info_params params = { ctx->session, info };
+        return GNUTLS_CALL( get_session_info, &params );
+    }
     default:
         FIXME("Unhandled attribute %#lx\n", attribute);
         return SEC_E_UNSUPPORTED_FUNCTION;
@@ -1337,6 +1343,7 @@ static SECURITY_STATUS SEC_ENTRY schan_QueryContextAttributesA(
     case SECPKG_ATTR_UNIQUE_BINDINGS:
     case SECPKG_ATTR_APPLICATION_PROTOCOL:
     case SECPKG_ATTR_CIPHER_INFO:
+    case SECPKG_ATTR_SESSION_INFO:
         return schan_QueryContextAttributesW(context_handle, attribute, buffer);
 
     default:
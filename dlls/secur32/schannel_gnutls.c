@@ -30,6 +30,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <pthread.h>
+#include <time.h>
 #include <sys/types.h>
 #include <dlfcn.h>
 #ifdef SONAME_LIBGNUTLS
@@ -47,6 +49,7 @@
 #include "secur32_priv.h"
 
 #include "wine/unixlib.h"
+#include "wine/list.h"
 #include "wine/debug.h"
 
 #if defined(SONAME_LIBGNUTLS)
@@ -80,6 +83,9 @@ static int (*pgnutls_privkey_import_rsa_raw)(gnutls_privkey_t, const gnutls_datu
 /* Not present in gnutls version < 3.4.0. */
 static int (*pgnutls_privkey_export_x509)(gnutls_privkey_t, gnutls_x509_privkey_t *);
 
+/* Not present in gnutls version < 3.5.0. */
+static unsigned (*pgnutls_session_get_flags)(gnutls_session_t);
+
 static void *libgnutls_handle;
 #define MAKE_FUNCPTR(f) static typeof(f) * p##f
 MAKE_FUNCPTR(gnutls_alert_get);
@@ -112,6 +118,10 @@ MAKE_FUNCPTR(gnutls_record_recv);
 MAKE_FUNCPTR(gnutls_record_send);
 MAKE_FUNCPTR(gnutls_server_name_set);
 MAKE_FUNCPTR(gnutls_session_channel_binding);
+MAKE_FUNCPTR(gnutls_session_get_data);
+MAKE_FUNCPTR(gnutls_session_get_id);
+MAKE_FUNCPTR(gnutls_session_is_resumed);
+MAKE_FUNCPTR(gnutls_session_set_data);
 MAKE_FUNCPTR(gnutls_set_default_priority);
 MAKE_FUNCPTR(gnutls_transport_get_ptr);
 MAKE_FUNCPTR(gnutls_transport_set_errno);
@@ -146,14 +156,24 @@ MAKE_FUNCPTR(gnutls_x509_privkey_deinit);
 #define GNUTLS_ALPN_SERVER_PRECEDENCE (1<<1)
 #endif
 
+#if GNUTLS_VERSION_NUMBER < 0x030603
+#define GNUTLS_SFLAGS_SESSION_TICKET (1<<7)
+#endif
+
 static inline gnutls_session_t session_from_handle(UINT64 handle)
 {
    return (gnutls_session_t)(ULONG_PTR)handle;
 }
 
-static inline gnutls_certificate_credentials_t certificate_creds_from_handle(UINT64 handle)
+struct schan_certificate_credentials
+{
+    gnutls_certificate_credentials_t creds;
+    BOOL client_cert;
+};
+
+static inline struct schan_certificate_credentials *certificate_creds_from_handle(UINT64 handle)
 {
-    return (gnutls_certificate_credentials_t)(ULONG_PTR)handle;
+    return (struct schan_certificate_credentials *)(ULONG_PTR)handle;
 }
 
 struct schan_buffers
@@ -169,8 +189,182 @@ struct schan_transport
     gnutls_session_t session;
     struct schan_buffers in;
     struct schan_buffers out;
+    char *target;                   /* target name for the session cache, client sessions only */
+    UINT64 cache_cred;              /* credentials identity for the session cache */
+    DWORD cache_protocols;
+    UINT64 handshake_start;
+    BOOL handshake_done;
 };
 
+/* Client side session cache, used to resume sessions with session IDs or
+ * tickets instead of doing a full handshake for every connection. */
+
+#define SESSION_CACHE_MAX_ENTRIES 256
+#define SESSION_CACHE_LIFETIME    (10 * 60 * 60) /* seconds, the Windows default ClientCacheTime */
+
+struct session_cache_entry
+{
+    struct list entry;
+    UINT64 cred;
+    DWORD protocols;
+    UINT64 expires;
+    gnutls_datum_t data;
+    char target[1];
+};
+
+static struct list session_cache = LIST_INIT( session_cache );
+static unsigned int session_cache_count;
+static pthread_mutex_t session_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static struct
+{
+    unsigned int full;
+    unsigned int resumed;
+    UINT64 full_time;
+    UINT64 resumed_time;
+} handshake_stats;
+
+static UINT64 monotonic_time_usec(void)
+{
+    struct timespec ts;
+
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (UINT64)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static struct session_cache_entry *find_session_cache_entry( const struct schan_transport *t, UINT64 now )
+{
+    struct session_cache_entry *entry, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE( entry, next, &session_cache, struct session_cache_entry, entry )
+    {
+        if (entry->expires <= now)
+        {
+            list_remove( &entry->entry );
+            session_cache_count--;
+            free( entry );
+            continue;
+        }
+        if (entry->cred == t->cache_cred && entry->protocols == t->cache_protocols &&
+            !strcmp( entry->target, t->target ))
+            return entry;
+    }
+    return NULL;
+}
+
+static void session_cache_lookup( struct schan_transport *t )
+{
+    struct session_cache_entry *entry;
+    int err;
+
+    pthread_mutex_lock( &session_cache_mutex );
+    if ((entry = find_session_cache_entry( t, monotonic_time_usec() )))
+    {
+        TRACE( "found cached session for %s\n", debugstr_a(t->target) );
+        list_remove( &entry->entry );
+        list_add_head( &session_cache, &entry->entry );
+        if ((err = pgnutls_session_set_data( t->session, entry->data.data, entry->data.size )) < 0)
+            pgnutls_perror( err );
+    }
+    pthread_mutex_unlock( &session_cache_mutex );
+}
+
+static void session_cache_store( struct schan_transport *t )
+{
+    struct session_cache_entry *entry, *old;
+    size_t size = 0, len;
+    UINT64 now;
+    int err;
+
+    if (!t->target || !t->handshake_done) return;
+
+    if ((err = pgnutls_session_get_data( t->session, NULL, &size )) < 0 || !size)
+        return;
+
+    len = strlen( t->target );
+    if (!(entry = malloc( offsetof( struct session_cache_entry, target[len + 1] ) + size ))) return;
+    entry->cred = t->cache_cred;
+    entry->protocols = t->cache_protocols;
+    entry->data.data = (unsigned char *)&entry->target[len + 1];
+    strcpy( entry->target, t->target );
+    if ((err = pgnutls_session_get_data( t->session, entry->data.data, &size )) < 0)
+    {
+        pgnutls_perror( err );
+        free( entry );
+        return;
+    }
+    entry->data.size = size;
+
+    now = monotonic_time_usec();
+    entry->expires = now + (UINT64)SESSION_CACHE_LIFETIME * 1000000;
+
+    pthread_mutex_lock( &session_cache_mutex );
+    if ((old = find_session_cache_entry( t, now )))
+    {
+        list_remove( &old->entry );
+        session_cache_count--;
+        free( old );
+    }
+    list_add_head( &session_cache, &entry->entry );
+    if (++session_cache_count > SESSION_CACHE_MAX_ENTRIES)
+    {
+        entry = LIST_ENTRY( list_tail( &session_cache ), struct session_cache_entry, entry );
+        list_remove( &entry->entry );
+        session_cache_count--;
+        free( entry );
+    }
+    pthread_mutex_unlock( &session_cache_mutex );
+}
+
+static void session_cache_remove_cred( UINT64 cred )
+{
+    struct session_cache_entry *entry, *next;
+
+    pthread_mutex_lock( &session_cache_mutex );
+    LIST_FOR_EACH_ENTRY_SAFE( entry, next, &session_cache, struct session_cache_entry, entry )
+    {
+        if (entry->cred != cred) continue;
+        list_remove( &entry->entry );
+        session_cache_count--;
+        free( entry );
+    }
+    pthread_mutex_unlock( &session_cache_mutex );
+}
+
+static void session_cache_flush(void)
+{
+    struct session_cache_entry *entry, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE( entry, next, &session_cache, struct session_cache_entry, entry )
+    {
+        list_remove( &entry->entry );
+        free( entry );
+    }
+    session_cache_count = 0;
+}
+
+static void update_handshake_stats( struct schan_transport *t )
+{
+    UINT64 elapsed = monotonic_time_usec() - t->handshake_start;
+    BOOL resumed = pgnutls_session_is_resumed( t->session );
+
+    pthread_mutex_lock( &session_cache_mutex );
+    if (resumed)
+    {
+        handshake_stats.resumed++;
+        handshake_stats.resumed_time += elapsed;
+    }
+    else
+    {
+        handshake_stats.full++;
+        handshake_stats.full_time += elapsed;
+    }
+    TRACE( "%s handshake with %s took %s us, %u of %u handshakes resumed\n", resumed ? "resumed" : "full",
+           debugstr_a(t->target), wine_dbgstr_longlong(elapsed), handshake_stats.resumed,
+           handshake_stats.full + handshake_stats.resumed );
+    pthread_mutex_unlock( &session_cache_mutex );
+}
+
 static int compat_cipher_get_block_size(gnutls_cipher_algorithm_t cipher)
 {
     switch(cipher) {
@@ -206,6 +400,11 @@ static int compat_gnutls_privkey_export_x509(gnutls_privkey_t privkey, gnutls_x5
     return GNUTLS_E_UNKNOWN_PK_ALGORITHM;
 }
 
+static unsigned compat_gnutls_session_get_flags(gnutls_session_t session)
+{
+    return 0;
+}
+
 static int compat_gnutls_privkey_import_rsa_raw(gnutls_privkey_t key, const gnutls_datum_t *p1,
                                         const gnutls_datum_t *p2, const gnutls_datum_t *p3,
                                         const gnutls_datum_t *p4, const gnutls_datum_t *p5,
@@ -521,6 +720,14 @@ static NTSTATUS schan_create_session( void *args )
         return STATUS_INTERNAL_ERROR;
     }
     transport->session = s;
+    if (!(cred->credential_use & SECPKG_CRED_INBOUND) && !(flags & GNUTLS_DATAGRAM))
+    {
+        struct schan_certificate_credentials *creds = certificate_creds_from_handle(cred->credentials);
+
+        /* sessions established without a client certificate can be shared by all anonymous credentials */
+        transport->cache_cred = creds->client_cert ? cred->credentials : 0;
+        transport->cache_protocols = cred->enabled_protocols;
+    }
 
     if ((status = set_priority(cred, s)))
     {
@@ -529,7 +736,7 @@ static NTSTATUS schan_create_session( void *args )
         return status;
     }
 
-    err = pgnutls_credentials_set(s, GNUTLS_CRD_CERTIFICATE, certificate_creds_from_handle(cred->credentials));
+    err = pgnutls_credentials_set(s, GNUTLS_CRD_CERTIFICATE, certificate_creds_from_handle(cred->credentials)->creds);
     if (err != GNUTLS_E_SUCCESS)
     {
         pgnutls_perror(err);
@@ -552,8 +759,13 @@ static NTSTATUS schan_dispose_session( void *args )
     const struct session_params *params = args;
     gnutls_session_t s = session_from_handle(params->session);
     struct schan_transport *t = (struct schan_transport *)pgnutls_transport_get_ptr(s);
+    /* TLS 1.3 tickets arrive after the handshake, so only now we may have one. Without
+     * a ticket, gnutls_session_get_data() would try to receive one, which can't work
+     * on a stream session without a pull timeout function. */
+    if (pgnutls_session_get_flags(s) & GNUTLS_SFLAGS_SESSION_TICKET) session_cache_store(t);
     pgnutls_transport_set_ptr(s, NULL);
     pgnutls_deinit(s);
+    free(t->target);
     free(t);
     return STATUS_SUCCESS;
 }
@@ -562,7 +774,13 @@ static NTSTATUS schan_set_session_target( void *args )
 {
     const struct set_session_target_params *params = args;
     gnutls_session_t s = session_from_handle(params->session);
+    struct schan_transport *t = (struct schan_transport *)pgnutls_transport_get_ptr(s);
+
     pgnutls_server_name_set( s, GNUTLS_NAME_DNS, params->target, strlen(params->target) );
+    free( t->target );
+    t->target = NULL;
+    if (t->cache_protocols && (t->target = strdup( params->target )))
+        session_cache_lookup( t );
     return STATUS_SUCCESS;
 }
 
@@ -645,6 +863,7 @@ static NTSTATUS schan_handshake( void *args )
     init_schan_buffers(&t->in, params->input);
     t->in.limit = params->input_size;
     init_schan_buffers(&t->out, params->output);
+    if (!t->handshake_start) t->handshake_start = monotonic_time_usec();
 
     if (params->control_token)
     {
@@ -659,6 +878,12 @@ static NTSTATUS schan_handshake( void *args )
         {
             TRACE("Handshake completed\n");
             status = SEC_E_OK;
+            if (!t->handshake_done)
+            {
+                t->handshake_done = TRUE;
+                update_handshake_stats(t);
+                if (pgnutls_protocol_get_version(s) != GNUTLS_TLS1_3) session_cache_store(t);
+            }
         }
         else if (err == GNUTLS_E_AGAIN)
         {
@@ -1282,6 +1507,19 @@ static NTSTATUS schan_get_application_protocol( void *args )
     return SEC_E_OK;
 }
 
+static NTSTATUS schan_get_session_info( void *args )
+{
+    const struct get_session_info_params *params = args;
+    gnutls_session_t s = session_from_handle(params->session);
+    SecPkgContext_SessionInfo *info = params->info;
+    size_t size = sizeof(info->rgbSessionId);
+
+    memset(info, 0, sizeof(*info));
+    if (pgnutls_session_is_resumed(s)) info->dwFlags |= SSL_SESSION_RECONNECT;
+    if (pgnutls_session_get_id(s, info->rgbSessionId, &size) >= 0) info->cbSessionId = size;
+    return SEC_E_OK;
+}
+
 static NTSTATUS schan_set_dtls_mtu( void *args )
 {
     const struct set_dtls_mtu_params *params = args;
@@ -1405,15 +1643,18 @@ static gnutls_x509_crt_t get_x509_crt(const struct allocate_certificate_credenti
 static NTSTATUS schan_allocate_certificate_credentials( void *args )
 {
     const struct allocate_certificate_credentials_params *params = args;
-    gnutls_certificate_credentials_t creds;
+    struct schan_certificate_credentials *creds;
     gnutls_x509_crt_t crt;
     gnutls_x509_privkey_t key;
     int ret;
 
-    ret = pgnutls_certificate_allocate_credentials(&creds);
+    if (!(creds = calloc(1, sizeof(*creds)))) return STATUS_NO_MEMORY;
+
+    ret = pgnutls_certificate_allocate_credentials(&creds->creds);
     if (ret != GNUTLS_E_SUCCESS)
     {
         pgnutls_perror(ret);
+        free(creds);
         return STATUS_INTERNAL_ERROR;
     }
 
@@ -1425,27 +1666,31 @@ static NTSTATUS schan_allocate_certificate_credentials( void *args )
 
     if (!(crt = get_x509_crt(params)))
     {
-        pgnutls_certificate_free_credentials(creds);
+        pgnutls_certificate_free_credentials(creds->creds);
+        free(creds);
         return STATUS_INTERNAL_ERROR;
     }
 
     if (!(key = get_x509_key(params->key_size, params->key_blob)))
     {
         pgnutls_x509_crt_deinit(crt);
-        pgnutls_certificate_free_credentials(creds);
+        pgnutls_certificate_free_credentials(creds->creds);
+        free(creds);
         return STATUS_INTERNAL_ERROR;
     }
 
-    ret = pgnutls_certificate_set_x509_key(creds, &crt, 1, key);
+    ret = pgnutls_certificate_set_x509_key(creds->creds, &crt, 1, key);
     pgnutls_x509_privkey_deinit(key);
     pgnutls_x509_crt_deinit(crt);
     if (ret != GNUTLS_E_SUCCESS)
     {
         pgnutls_perror(ret);
-        pgnutls_certificate_free_credentials(creds);
+        pgnutls_certificate_free_credentials(creds->creds);
+        free(creds);
         return STATUS_INTERNAL_ERROR;
     }
 
+    creds->client_cert = TRUE;
     params->c->credentials = (ULONG_PTR)creds;
     return STATUS_SUCCESS;
 }
@@ -1453,7 +1698,11 @@ static NTSTATUS schan_allocate_certificate_credentials( void *args )
 static NTSTATUS schan_free_certificate_credentials( void *args )
 {
     const struct free_certificate_credentials_params *params = args;
-    pgnutls_certificate_free_credentials(certificate_creds_from_handle(params->c->credentials));
+    struct schan_certificate_credentials *creds = certificate_creds_from_handle(params->c->credentials);
+
+    if (creds->client_cert) session_cache_remove_cred(params->c->credentials);
+    pgnutls_certificate_free_credentials(creds->creds);
+    free(creds);
     return STATUS_SUCCESS;
 }
 
@@ -1520,6 +1769,10 @@ static NTSTATUS process_attach( void *args )
     LOAD_FUNCPTR(gnutls_record_send);
     LOAD_FUNCPTR(gnutls_server_name_set)
     LOAD_FUNCPTR(gnutls_session_channel_binding)
+    LOAD_FUNCPTR(gnutls_session_get_data)
+    LOAD_FUNCPTR(gnutls_session_get_id)
+    LOAD_FUNCPTR(gnutls_session_is_resumed)
+    LOAD_FUNCPTR(gnutls_session_set_data)
     LOAD_FUNCPTR(gnutls_set_default_priority)
     LOAD_FUNCPTR(gnutls_transport_get_ptr)
     LOAD_FUNCPTR(gnutls_transport_set_errno)
@@ -1572,6 +1825,11 @@ static NTSTATUS process_attach( void *args )
         WARN("gnutls_privkey_import_rsa_raw not found\n");
         pgnutls_privkey_import_rsa_raw = compat_gnutls_privkey_import_rsa_raw;
     }
+    if (!(pgnutls_session_get_flags = dlsym(libgnutls_handle, "gnutls_session_get_flags")))
+    {
+        WARN("gnutls_session_get_flags not found\n");
+        pgnutls_session_get_flags = compat_gnutls_session_get_flags;
+    }
 
     ret = pgnutls_global_init();
     if (ret != GNUTLS_E_SUCCESS)
@@ -1600,6 +1858,13 @@ fail:
 
 static NTSTATUS process_detach( void *args )
 {
+    if (handshake_stats.full || handshake_stats.resumed)
+        TRACE( "%u full handshakes, average %s us; %u resumed handshakes, average %s us\n",
+               handshake_stats.full,
+               wine_dbgstr_longlong(handshake_stats.full ? handshake_stats.full_time / handshake_stats.full : 0),
+               handshake_stats.resumed,
+               wine_dbgstr_longlong(handshake_stats.resumed ? handshake_stats.resumed_time / handshake_stats.resumed : 0) );
+    session_cache_flush();
     pgnutls_global_deinit();
     dlclose(libgnutls_handle);
     libgnutls_handle = NULL;
@@ -1621,6 +1886,7 @@ const unixlib_entry_t __wine_unix_call_funcs[] =
     schan_get_key_signature_algorithm,
     schan_get_max_message_size,
     schan_get_session_cipher_block_size,
+    schan_get_session_info,
     schan_get_session_peer_certificate,
     schan_get_unique_channel_binding,
     schan_handshake,
@@ -1716,6 +1982,21 @@ static NTSTATUS wow64_schan_get_application_protocol( void *args )
     return schan_get_application_protocol(&params);
 }
 
+static NTSTATUS wow64_schan_get_session_info( void *args )
+{
+    struct
+    {
+        schan_session session;
+        PTR32 info;
+    } const *params32 = args;
+    struct get_session_info_params params =
+    {
+        params32->session,
+        ULongToPtr(params32->info),
+    };
+    return schan_get_session_info(&params);
+}
+
 static NTSTATUS wow64_schan_get_connection_info( void *args )
 {
     struct
@@ -1954,6 +2235,7 @@ const unixlib_entry_t __wine_unix_call_wow64_funcs[] =
     schan_get_key_signature_algorithm,
     schan_get_max_message_size,
     schan_get_session_cipher_block_size,
+    wow64_schan_get_session_info,
     wow64_schan_get_session_peer_certificate,
     wow64_schan_get_unique_channel_binding,
     wow64_schan_handshake,
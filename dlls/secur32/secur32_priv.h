@@ -134,6 +134,12 @@ struct get_cipher_info_params
     SecPkgContext_CipherInfo *info;
 };
 
+struct get_session_info_params
+{
+    schan_session session;
+    SecPkgContext_SessionInfo *info;
+};
+
 struct get_session_peer_certificate_params
 {
     schan_session session;
@@ -230,6 +236,7 @@ enum schan_funcs
     unix_get_key_signature_algorithm,
     unix_get_max_message_size,
     unix_get_session_cipher_block_size,
+    unix_get_session_info,
     unix_get_session_peer_certificate,
     unix_get_unique_channel_binding,
     unix_handshake,
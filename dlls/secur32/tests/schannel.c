@@ -2047,6 +2047,87 @@ static void test_connection_shutdown(void)
     FreeCredentialsHandle( &cred_handle );
 }
 
+static BOOL get_session_info(CredHandle *cred_handle, SecPkgContext_SessionInfo *info)
+{
+    SECURITY_STATUS status;
+    SecBufferDesc buffers[2];
+    CtxtHandle context;
+    unsigned buf_size = 8192;
+    SecBuffer *buf;
+    SOCKET sock;
+    ULONG attrs;
+    int ret;
+
+    if ((sock = create_ssl_socket( "test.winehq.org" )) == -1) return FALSE;
+
+    init_buffers(&buffers[0], 4, buf_size);
+    init_buffers(&buffers[1], 4, buf_size);
+
+    buffers[0].pBuffers[0].BufferType = SECBUFFER_TOKEN;
+    status = InitializeSecurityContextA(cred_handle, NULL, (SEC_CHAR *)"test.winehq.org",
+            ISC_REQ_CONFIDENTIALITY|ISC_REQ_STREAM, 0, 0, NULL, 0, &context, &buffers[0], &attrs, NULL);
+    ok(status == SEC_I_CONTINUE_NEEDED, "Got unexpected status %#lx.\n", status);
+
+    while (status == SEC_I_CONTINUE_NEEDED)
+    {
+        buf = &buffers[0].pBuffers[0];
+        send(sock, buf->pvBuffer, buf->cbBuffer, 0);
+        buf->cbBuffer = buf_size;
+
+        buf = &buffers[1].pBuffers[0];
+        buf->cbBuffer = buf_size;
+        buf->BufferType = SECBUFFER_TOKEN;
+        if ((ret = receive_data(sock, buf)) == -1) break;
+        buffers[1].cBuffers = 1;
+
+        status = InitializeSecurityContextA(cred_handle, &context, (SEC_CHAR *)"test.winehq.org",
+                ISC_REQ_CONFIDENTIALITY|ISC_REQ_STREAM, 0, 0, &buffers[1], 0, NULL, &buffers[0], &attrs, NULL);
+    }
+
+    if (status == SEC_E_OK)
+    {
+        status = QueryContextAttributesA(&context, SECPKG_ATTR_SESSION_INFO, info);
+        ok(status == SEC_E_OK, "Got unexpected status %#lx.\n", status);
+    }
+    else skip("Handshake failed, status %#lx.\n", status);
+
+    DeleteSecurityContext(&context);
+    free_buffers(&buffers[0]);
+    free_buffers(&buffers[1]);
+    closesocket(sock);
+    return status == SEC_E_OK;
+}
+
+static void test_session_resumption(void)
+{
+    SecPkgContext_SessionInfo info;
+    SCHANNEL_CRED cred;
+    CredHandle cred_handle;
+    SECURITY_STATUS status;
+
+    init_cred(&cred);
+    cred.grbitEnabledProtocols = SP_PROT_TLS1_2_CLIENT;
+    cred.dwFlags = SCH_CRED_NO_DEFAULT_CREDS|SCH_CRED_MANUAL_CRED_VALIDATION;
+    status = AcquireCredentialsHandleA(NULL, (SEC_CHAR *)UNISP_NAME_A, SECPKG_CRED_OUTBOUND, NULL,
+            &cred, NULL, NULL, &cred_handle, NULL);
+    ok(status == SEC_E_OK, "AcquireCredentialsHandleA failed: %08lx\n", status);
+    if (status != SEC_E_OK) return;
+
+    memset(&info, 0xcc, sizeof(info));
+    if (get_session_info(&cred_handle, &info))
+    {
+        ok(!(info.dwFlags & SSL_SESSION_RECONNECT), "Got unexpected flags %#lx.\n", info.dwFlags);
+        ok(info.cbSessionId <= sizeof(info.rgbSessionId), "Got unexpected size %lu.\n", info.cbSessionId);
+
+        /* A second connection to the same target with the same credentials resumes the session. */
+        memset(&info, 0xcc, sizeof(info));
+        if (get_session_info(&cred_handle, &info))
+            ok(info.dwFlags & SSL_SESSION_RECONNECT, "Got unexpected flags %#lx.\n", info.dwFlags);
+    }
+
+    FreeCredentialsHandle(&cred_handle);
+}
+
 START_TEST(schannel)
 {
     WSADATA wsa_data;
@@ -2061,4 +2142,5 @@ START_TEST(schannel)
     test_server_protocol_negotiation();
     test_dtls();
     test_connection_shutdown();
+    test_session_resumption();
 }
@@ -0,0 +1,188 @@
+/*
+ * DIB driver banded rendering on a worker pool.
+ *
+ * Copyright 2026 The Wine Project
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#if 0
+#pragma makedep unix
+#endif
+
+#include <limits.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include "ntgdi_private.h"
+#include "dibdrv.h"
+
+#include "wine/debug.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(dib);
+
+/* Large operations are split into horizontal bands which are rendered concurrently by the
+ * calling thread and a small pool of helper threads.  The helpers are plain host threads,
+ * so the band callbacks must only touch pixels: no Wine calls, no debug output.
+ * Callers only use this for operations where every destination pixel is computed
+ * independently, so the result is the same as rendering the rectangles in order.
+ * The helpers can't handle faults, so only memory allocated by the driver is accessed
+ * from them; DIB section bits may be guarded or write-watched by the app. */
+
+#define MIN_BAND_PIXELS  (256 * 256)  /* don't bother with smaller operations */
+#define MIN_BAND_HEIGHT  16
+#define MAX_BAND_WORKERS 15
+
+struct band_job
+{
+    band_func   func;
+    void       *context;
+    const RECT *rects;
+    int         count;
+    int         top;
+    int         band_height;
+    int         bands;
+    int         next;     /* next band to render */
+    int         pending;  /* bands not yet finished */
+};
+
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t job_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+static pthread_mutex_t submit_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+static struct band_job *current_job;
+static unsigned int job_serial;
+static unsigned int worker_count;
+
+static void render_band( struct band_job *job, int band )
+{
+    RECT rc;
+    int i, top = job->top + band * job->band_height, bottom = top + job->band_height;
+
+    for (i = 0; i < job->count; i++)
+    {
+        rc = job->rects[i];
+        if (rc.top < top) rc.top = top;
+        if (rc.bottom > bottom) rc.bottom = bottom;
+        if (rc.top < rc.bottom) job->func( job->context, &rc );
+    }
+}
+
+/* called with pool_mutex held */
+static void render_bands( struct band_job *job )
+{
+    int band;
+
+    while (job->next < job->bands)
+    {
+        band = job->next++;
+        pthread_mutex_unlock( &pool_mutex );
+        render_band( job, band );
+        pthread_mutex_lock( &pool_mutex );
+        if (!--job->pending) pthread_cond_signal( &done_cond );
+    }
+}
+
+static void *band_worker( void *arg )
+{
+    unsigned int serial = 0;
+
+    pthread_mutex_lock( &pool_mutex );
+    for (;;)
+    {
+        while (!current_job || serial == job_serial) pthread_cond_wait( &job_cond, &pool_mutex );
+        serial = job_serial;
+        render_bands( current_job );
+    }
+    return NULL;
+}
+
+static void start_workers(void)
+{
+    sigset_t block, old;
+    pthread_attr_t attr;
+    pthread_t thread;
+    long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+    unsigned int i, count = cpus > 1 ? min( cpus - 1, MAX_BAND_WORKERS ) : 0;
+
+    /* keep the process signals away from the helper threads */
+    sigfillset( &block );
+    pthread_sigmask( SIG_BLOCK, &block, &old );
+    pthread_attr_init( &attr );
+    pthread_attr_setdetachstate( &attr, PTHREAD_CREATE_DETACHED );
+    for (i = 0; i < count; i++)
+        if (pthread_create( &thread, &attr, band_worker, NULL )) break;
+    pthread_attr_destroy( &attr );
+    pthread_sigmask( SIG_SETMASK, &old, NULL );
+
+    TRACE( "started %u band workers\n", i );
+    worker_count = i;
+}
+
+/***********************************************************************
+ *           run_in_bands
+ *
+ * Call func for every rectangle, possibly clipped to horizontal bands rendered in parallel.
+ */
+void run_in_bands( const dib_info *dst, const dib_info *src, const RECT *rects, int count,
+                   band_func func, void *context )
+{
+    struct band_job job;
+    int i, top = INT_MAX, bottom = INT_MIN, height;
+    unsigned int pixels = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        pixels += (rects[i].right - rects[i].left) * (rects[i].bottom - rects[i].top);
+        top = min( top, rects[i].top );
+        bottom = max( bottom, rects[i].bottom );
+    }
+    height = bottom - top;
+
+    if (pixels >= MIN_BAND_PIXELS && height >= 2 * MIN_BAND_HEIGHT &&
+        dst->driver_bits && (!src || src->driver_bits))
+    {
+        pthread_once( &pool_once, start_workers );
+
+        /* if another thread is using the pool, render on this one */
+        if (worker_count && !pthread_mutex_trylock( &submit_mutex ))
+        {
+            job.func        = func;
+            job.context     = context;
+            job.rects       = rects;
+            job.count       = count;
+            job.top         = top;
+            job.bands       = min( worker_count + 1, height / MIN_BAND_HEIGHT );
+            job.band_height = (height + job.bands - 1) / job.bands;
+            job.next        = 0;
+            job.pending     = job.bands;
+
+            pthread_mutex_lock( &pool_mutex );
+            current_job = &job;
+            job_serial++;
+            pthread_cond_broadcast( &job_cond );
+            render_bands( &job );
+            while (job.pending) pthread_cond_wait( &done_cond, &pool_mutex );
+            current_job = NULL;
+            pthread_mutex_unlock( &pool_mutex );
+            pthread_mutex_unlock( &submit_mutex );
+            return;
+        }
+    }
+
+    for (i = 0; i < count; i++) func( context, &rects[i] );
+}
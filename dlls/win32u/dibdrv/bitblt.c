@@ -470,9 +470,59 @@ static int get_overlap( const dib_info *dst, const RECT *dst_rect,
     return ret;
 }
 
+struct band_params
+{
+    const dib_info *dst;
+    const dib_info *src;
+    const RECT     *dst_rect;
+    const RECT     *src_rect;
+    int             rop2;
+    DWORD           and, xor;
+    BLENDFUNCTION   blend;
+    const TRIVERTEX *vert;
+    int             mode;
+    BOOL            failed;
+};
+
+static void solid_band( void *context, const RECT *rc )
+{
+    const struct band_params *params = context;
+
+    params->dst->funcs->solid_rects( params->dst, 1, rc, params->and, params->xor );
+}
+
+static void copy_band( void *context, const RECT *rc )
+{
+    const struct band_params *params = context;
+    POINT origin;
+
+    origin.x = params->src_rect->left + rc->left - params->dst_rect->left;
+    origin.y = params->src_rect->top  + rc->top  - params->dst_rect->top;
+    params->dst->funcs->copy_rect( params->dst, rc, params->src, &origin, params->rop2, 0 );
+}
+
+static void blend_band( void *context, const RECT *rc )
+{
+    const struct band_params *params = context;
+    POINT offset;
+
+    offset.x = params->src_rect->left - params->dst_rect->left;
+    offset.y = params->src_rect->top  - params->dst_rect->top;
+    params->dst->funcs->blend_rects( params->dst, 1, rc, params->src, &offset, params->blend );
+}
+
+static void gradient_band( void *context, const RECT *rc )
+{
+    struct band_params *params = context;
+
+    if (!params->dst->funcs->gradient_rect( params->dst, rc, params->vert, params->mode ))
+        params->failed = TRUE;
+}
+
 static void copy_rect( dib_info *dst, const RECT *dst_rect, const dib_info *src, const RECT *src_rect,
                         const struct clipped_rects *clipped_rects, INT rop2 )
 {
+    struct band_params params;
     POINT origin;
     const RECT *rects;
     int i, count, start, end, overlap;
@@ -496,7 +546,10 @@ static void copy_rect( dib_info *dst, const RECT *dst_rect, const dib_info *src,
     case R2_WHITE: xor = ~0u;
         /* fall through */
     case R2_BLACK:
-        dst->funcs->solid_rects( dst, count, rects, and, xor );
+        params.dst = dst;
+        params.and = and;
+        params.xor = xor;
+        run_in_bands( dst, NULL, rects, count, solid_band, &params );
         /* fall through */
     case R2_NOP:
         return;
@@ -545,7 +598,7 @@ static void copy_rect( dib_info *dst, const RECT *dst_rect, const dib_info *src,
             }
         }
     }
-    else  /* left to right, top to bottom */
+    else if (overlap)  /* left to right, top to bottom */
     {
         for (i = 0; i < count; i++)
         {
@@ -554,6 +607,15 @@ static void copy_rect( dib_info *dst, const RECT *dst_rect, const dib_info *src,
             dst->funcs->copy_rect( dst, &rects[i], src, &origin, rop2, overlap );
         }
     }
+    else  /* no overlap, any order will do */
+    {
+        params.dst = dst;
+        params.src = src;
+        params.dst_rect = dst_rect;
+        params.src_rect = src_rect;
+        params.rop2 = rop2;
+        run_in_bands( dst, src, rects, count, copy_band, &params );
+    }
 }
 
 static void mask_rect( dib_info *dst, const RECT *dst_rect, const dib_info *src, const RECT *src_rect,
@@ -590,12 +652,25 @@ static DWORD blend_rect( dib_info *dst, const RECT *dst_rect, const dib_info *sr
 {
     POINT offset;
     struct clipped_rects clipped_rects;
+    struct band_params params;
 
     if (!get_clipped_rects( dst, dst_rect, clip, &clipped_rects )) return ERROR_SUCCESS;
 
-    offset.x = src_rect->left - dst_rect->left;
-    offset.y = src_rect->top  - dst_rect->top;
-    dst->funcs->blend_rects( dst, clipped_rects.count, clipped_rects.rects, src, &offset, blend );
+    if (get_overlap( dst, dst_rect, src, src_rect ))
+    {
+        offset.x = src_rect->left - dst_rect->left;
+        offset.y = src_rect->top  - dst_rect->top;
+        dst->funcs->blend_rects( dst, clipped_rects.count, clipped_rects.rects, src, &offset, blend );
+    }
+    else
+    {
+        params.dst = dst;
+        params.src = src;
+        params.dst_rect = dst_rect;
+        params.src_rect = src_rect;
+        params.blend = blend;
+        run_in_bands( dst, src, clipped_rects.rects, clipped_rects.count, blend_band, &params );
+    }
 
     free_clipped_rects( &clipped_rects );
     return ERROR_SUCCESS;
@@ -682,17 +757,17 @@ static void get_gradient_triangle_vertices( const GRADIENT_TRIANGLE *tri, const
 
 static BOOL gradient_rect( dib_info *dib, TRIVERTEX *v, int mode, HRGN clip, const RECT *bounds )
 {
-    int i;
     struct clipped_rects clipped_rects;
-    BOOL ret = TRUE;
+    struct band_params params;
 
     if (!get_clipped_rects( dib, bounds, clip, &clipped_rects )) return TRUE;
-    for (i = 0; i < clipped_rects.count; i++)
-    {
-        if (!(ret = dib->funcs->gradient_rect( dib, &clipped_rects.rects[i], v, mode ))) break;
-    }
+    params.dst = dib;
+    params.vert = v;
+    params.mode = mode;
+    params.failed = FALSE;
+    run_in_bands( dib, NULL, clipped_rects.rects, clipped_rects.count, gradient_band, &params );
     free_clipped_rects( &clipped_rects );
-    return ret;
+    return !params.failed;
 }
 
 static DWORD copy_src_bits( dib_info *src, RECT *src_rect )
@@ -712,6 +787,7 @@ static DWORD copy_src_bits( dib_info *src, RECT *src_rect )
     src->rect.bottom = height;
     if (src->bits.free) src->bits.free( &src->bits );
     src->bits.is_copy = TRUE;
+    src->driver_bits = TRUE;
     src->bits.ptr = ptr;
     src->bits.free = free_heap_bits;
     src->bits.param = NULL;
@@ -732,6 +808,7 @@ static DWORD create_tmp_dib( const dib_info *copy, int width, int height, dib_in
     ret->rect.bottom = height;
     ret->bits.ptr = malloc( ret->height * ret->stride );
     ret->bits.is_copy = TRUE;
+    ret->driver_bits = TRUE;
     ret->bits.free = free_heap_bits;
     ret->bits.param = NULL;
 
@@ -964,6 +1041,7 @@ DWORD put_image_into_bitmap( BITMAPOBJ *bmp, HRGN clip, BITMAPINFO *info,
 
     init_dib_info_from_bitmapinfo( &src_dib, info, bits->ptr );
     src_dib.bits.is_copy = bits->is_copy;
+    src_dib.driver_bits = bits->is_copy;
 
     if (get_clipped_rects( &dib, &dst->visrect, clip, &clipped_rects ))
     {
@@ -1012,6 +1090,7 @@ DWORD dibdrv_PutImage( PHYSDEV dev, HRGN clip, BITMAPINFO *info,
 
     init_dib_info_from_bitmapinfo( &src_dib, info, bits->ptr );
     src_dib.bits.is_copy = bits->is_copy;
+    src_dib.driver_bits = bits->is_copy;
 
     if (clip && pdev->clip)
     {
@@ -1074,6 +1153,7 @@ DWORD dibdrv_BlendImage( PHYSDEV dev, BITMAPINFO *info, const struct gdi_image_b
 
     init_dib_info_from_bitmapinfo( &src_dib, info, bits->ptr );
     src_dib.bits.is_copy = bits->is_copy;
+    src_dib.driver_bits = bits->is_copy;
     add_clipped_bounds( pdev, &dst->visrect, pdev->clip );
     return blend_rect( &pdev->dib, &dst->visrect, &src_dib, &src->visrect, pdev->clip, blend );
 
@@ -91,6 +91,7 @@ static void init_dib_info(dib_info *dib, const BITMAPINFOHEADER *bi, int stride,
     dib->bits.is_copy = FALSE;
     dib->bits.free    = NULL;
     dib->bits.param   = NULL;
+    dib->driver_bits  = FALSE;
 
     if(dib->height < 0) /* top-down */
     {
@@ -177,6 +178,7 @@ BOOL init_dib_info_from_bitmapobj(dib_info *dib, BITMAPOBJ *bmp)
 
         get_ddb_bitmapinfo( bmp, &info );
         init_dib_info_from_bitmapinfo( dib, &info, bmp->dib.dsBm.bmBits );
+        dib->driver_bits = TRUE;
     }
     else init_dib_info( dib, &bmp->dib.dsBmih, bmp->dib.dsBm.bmWidthBytes,
                         bmp->dib.dsBitfields, bmp->color_table, bmp->dib.dsBm.bmBits );
@@ -819,6 +821,7 @@ void dibdrv_set_window_surface( DC *dc, struct window_surface *surface )
         dibdrv = physdev->dibdrv;
         bits = window_surface_get_color( surface, info );
         init_dib_info_from_bitmapinfo( &dibdrv->dib, info, bits );
+        dibdrv->dib.driver_bits = TRUE;
         dibdrv->dib.rect = dc->attr->vis_rect;
         OffsetRect( &dibdrv->dib.rect, -dc->device_rect.left, -dc->device_rect.top );
         dibdrv->bounds = &surface->bounds;
@@ -25,6 +25,7 @@ typedef struct
     RECT rect;  /* visible rectangle relative to bitmap origin */
     int stride; /* stride in bytes.  Will be -ve for bottom-up dibs (see bits). */
     struct gdi_image_bits bits; /* bits.ptr points to the top-left corner of the dib. */
+    BOOL driver_bits; /* bits are allocated by the driver and never visible to the app */
 
     DWORD red_mask, green_mask, blue_mask;
     int red_shift, green_shift, blue_shift;
@@ -223,6 +224,22 @@ extern const primitive_funcs funcs_4;
 extern const primitive_funcs funcs_1;
 extern const primitive_funcs funcs_null;
 
+/* vectorized row helpers, they return the number of pixels (or bytes) processed */
+struct simd_funcs
+{
+    int                   (* rop_bytes)(BYTE *ptr, int len, DWORD and, DWORD xor);
+    int              (* blend_argb_row)(DWORD *dst, const DWORD *src, int len);
+    int        (* blend_argb_alpha_row)(DWORD *dst, const DWORD *src, int len, DWORD alpha);
+    int (* blend_argb_constant_alpha_row)(DWORD *dst, const DWORD *src, int len, DWORD alpha);
+    int   (* blend_argb_no_src_alpha_row)(DWORD *dst, const DWORD *src, int len, DWORD alpha);
+};
+
+extern const struct simd_funcs *simd_funcs;
+
+typedef void (*band_func)( void *context, const RECT *rc );
+extern void run_in_bands( const dib_info *dst, const dib_info *src, const RECT *rects, int count,
+                          band_func func, void *context );
+
 struct rop_codes
 {
     DWORD a1, a2, x1, x2;
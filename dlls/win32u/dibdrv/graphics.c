@@ -55,10 +55,17 @@ struct cached_font
     LOGFONTW              lf;
     XFORM                 xform;
     UINT                  aa_flags;
+    LONG                  size;  /* memory used by the cached glyphs */
     struct cached_glyph **glyphs[GLYPH_NBTYPES][GLYPH_CACHE_PAGES];
 };
 
+/* unused fonts are evicted in LRU order once either limit is exceeded; when the
+ * fonts in use reach the size limit, new glyphs are rendered without being cached */
+#define FONT_CACHE_MAX_UNUSED  16
+#define FONT_CACHE_MAX_SIZE    (8 * 1024 * 1024)
+
 static struct list font_cache = LIST_INIT( font_cache );
+static LONG font_cache_size;
 
 static pthread_mutex_t font_cache_lock = PTHREAD_MUTEX_INITIALIZER;
 
@@ -551,10 +558,47 @@ static int font_cache_cmp( const struct cached_font *p1, const struct cached_fon
     return ret;
 }
 
+static void free_cached_font( struct cached_font *font )
+{
+    UINT i, j, k;
+
+    for (i = 0; i < GLYPH_NBTYPES; i++)
+    {
+        for (j = 0; j < GLYPH_CACHE_PAGES; j++)
+        {
+            if (!font->glyphs[i][j]) continue;
+            for (k = 0; k < GLYPH_CACHE_PAGE_SIZE; k++)
+                free( font->glyphs[i][j][k] );
+            free( font->glyphs[i][j] );
+        }
+    }
+    InterlockedExchangeAdd( &font_cache_size, -font->size );
+    free( font );
+}
+
+/* free the least recently used fonts that no DC is using, font_cache_lock must be held */
+static void trim_font_cache(void)
+{
+    struct cached_font *ptr, *next;
+    UINT unused = 0;
+
+    LIST_FOR_EACH_ENTRY( ptr, &font_cache, struct cached_font, entry )
+        if (!ptr->ref) unused++;
+
+    LIST_FOR_EACH_ENTRY_SAFE_REV( ptr, next, &font_cache, struct cached_font, entry )
+    {
+        if (unused <= FONT_CACHE_MAX_UNUSED && font_cache_size <= FONT_CACHE_MAX_SIZE) break;
+        if (ptr->ref) continue;
+        TRACE( "evicting %p, %d bytes\n", ptr, (int)ptr->size );
+        list_remove( &ptr->entry );
+        free_cached_font( ptr );
+        unused--;
+    }
+}
+
 static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
 {
-    struct cached_font font, *ptr, *last_unused = NULL;
-    UINT i = 0, j, k;
+    struct cached_font font, *ptr;
 
     NtGdiExtGetObjectW( hfont, sizeof(font.lf), &font.lf );
     font.xform = dc->xformWorld2Vport;
@@ -578,29 +622,10 @@ static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
             list_remove( &ptr->entry );
             goto done;
         }
-        if (!ptr->ref)
-        {
-            i++;
-            last_unused = ptr;
-        }
     }
 
-    if (i > 5)  /* keep at least 5 of the most-recently used fonts around */
-    {
-        ptr = last_unused;
-        for (i = 0; i < GLYPH_NBTYPES; i++)
-        {
-            for (j = 0; j < GLYPH_CACHE_PAGES; j++)
-            {
-                if (!ptr->glyphs[i][j]) continue;
-                for (k = 0; k < GLYPH_CACHE_PAGE_SIZE; k++)
-                    free( ptr->glyphs[i][j][k] );
-                free( ptr->glyphs[i][j] );
-            }
-        }
-        list_remove( &ptr->entry );
-    }
-    else if (!(ptr = malloc( sizeof(*ptr) )))
+    trim_font_cache();
+    if (!(ptr = malloc( sizeof(*ptr) )))
     {
         pthread_mutex_unlock( &font_cache_lock );
         return NULL;
@@ -608,6 +633,7 @@ static struct cached_font *add_cached_font( DC *dc, HFONT hfont, UINT aa_flags )
 
     *ptr = font;
     ptr->ref = 1;
+    ptr->size = 0;
     memset( ptr->glyphs, 0, sizeof(ptr->glyphs) );
 done:
     list_add_head( &font_cache, &ptr->entry );
@@ -621,29 +647,46 @@ void release_cached_font( struct cached_font *font )
     if (font) InterlockedDecrement( &font->ref );
 }
 
+/* returns the glyph to use, *cached is set to FALSE if the caller must free it */
 static struct cached_glyph *add_cached_glyph( struct cached_font *font, UINT index, UINT flags,
-                                              struct cached_glyph *glyph )
+                                              struct cached_glyph *glyph, DWORD size, BOOL *cached )
 {
     struct cached_glyph *ret;
     enum glyph_type type = (flags & ETO_GLYPH_INDEX) ? GLYPH_INDEX : GLYPH_WCHAR;
     UINT page = index / GLYPH_CACHE_PAGE_SIZE;
     UINT entry = index % GLYPH_CACHE_PAGE_SIZE;
+    LONG page_size = GLYPH_CACHE_PAGE_SIZE * sizeof(*font->glyphs[type][page]);
+
+    *cached = FALSE;
+    if (font_cache_size + size + page_size > FONT_CACHE_MAX_SIZE)
+    {
+        pthread_mutex_lock( &font_cache_lock );
+        trim_font_cache();
+        pthread_mutex_unlock( &font_cache_lock );
+        if (font_cache_size + size + page_size > FONT_CACHE_MAX_SIZE) return glyph;
+    }
 
     if (!font->glyphs[type][page])
     {
         struct cached_glyph **ptr;
 
-        ptr = calloc( 1, GLYPH_CACHE_PAGE_SIZE * sizeof(*ptr) );
-        if (!ptr)
-        {
-            free( glyph );
-            return NULL;
-        }
+        if (!(ptr = calloc( 1, page_size ))) return glyph;
         if (InterlockedCompareExchangePointer( (void **)&font->glyphs[type][page], ptr, NULL ))
             free( ptr );
+        else
+        {
+            InterlockedExchangeAdd( &font->size, page_size );
+            InterlockedExchangeAdd( &font_cache_size, page_size );
+        }
     }
+    *cached = TRUE;
     ret = InterlockedCompareExchangePointer( (void **)&font->glyphs[type][page][entry], glyph, NULL );
-    if (!ret) ret = glyph;
+    if (!ret)
+    {
+        ret = glyph;
+        InterlockedExchangeAdd( &font->size, size );
+        InterlockedExchangeAdd( &font_cache_size, size );
+    }
     else free( glyph );
     return ret;
 }
@@ -742,7 +785,8 @@ static const int padding[4] = {0, 3, 2, 1};
  * For non-antialiased bitmaps convert them to the 17-level format
  * using only values 0 or 16.
  */
-static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font, UINT index, UINT flags )
+static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font, UINT index, UINT flags,
+                                                BOOL *cached )
 {
     UINT ggo_flags = font->aa_flags;
     static const MAT2 identity = { {0,1}, {0,0}, {0,0}, {0,1} };
@@ -804,7 +848,7 @@ static struct cached_glyph *cache_glyph_bitmap( DC *dc, struct cached_font *font
 
 done:
     glyph->metrics = metrics;
-    return add_cached_glyph( font, index, flags, glyph );
+    return add_cached_glyph( font, index, flags, glyph, FIELD_OFFSET( struct cached_glyph, bits[size] ), cached );
 }
 
 static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT x, INT y,
@@ -813,6 +857,7 @@ static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT
 {
     UINT i;
     struct cached_glyph *glyph;
+    BOOL cached;
     dib_info glyph_dib;
     DWORD text_color;
     struct font_intensities intensity;
@@ -821,6 +866,7 @@ static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT
     glyph_dib.rect.left    = 0;
     glyph_dib.rect.top     = 0;
     glyph_dib.bits.is_copy = FALSE;
+    glyph_dib.driver_bits  = TRUE;
     glyph_dib.bits.free    = NULL;
 
     text_color = get_pixel_color( dc, dib, dc->attr->text_color, TRUE );
@@ -832,8 +878,9 @@ static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT
 
     for (i = 0; i < count; i++)
     {
+        cached = TRUE;
         if (!(glyph = get_cached_glyph( font, str[i], flags )) &&
-            !(glyph = cache_glyph_bitmap( dc, font, str[i], flags ))) continue;
+            !(glyph = cache_glyph_bitmap( dc, font, str[i], flags, &cached ))) continue;
 
         glyph_dib.width       = glyph->metrics.gmBlackBoxX;
         glyph_dib.height      = glyph->metrics.gmBlackBoxY;
@@ -859,6 +906,7 @@ static void render_string( DC *dc, dib_info *dib, struct cached_font *font, INT
             x += glyph->metrics.gmCellIncX;
             y += glyph->metrics.gmCellIncY;
         }
+        if (!cached) free( glyph );
     }
 }
 
@@ -280,8 +280,12 @@ static void solid_rects_32(const dib_info *dib, int num, const RECT *rc, DWORD a
         start = get_pixel_ptr_32(dib, rc->left, rc->top);
         if (and)
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 4)
-                for(x = rc->left, ptr = start; x < rc->right; x++)
+            {
+                x = rc->left;
+                if (simd_funcs) x += simd_funcs->rop_bytes( (BYTE *)start, (rc->right - rc->left) * 4, and, xor ) / 4;
+                for(ptr = start + x - rc->left; x < rc->right; x++)
                     do_rop_32(ptr++, and, xor);
+            }
         else
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 4)
                 memset_32( start, xor, rc->right - rc->left );
@@ -431,8 +435,13 @@ static void solid_rects_16(const dib_info *dib, int num, const RECT *rc, DWORD a
         start = get_pixel_ptr_16(dib, rc->left, rc->top);
         if (and)
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 2)
-                for(x = rc->left, ptr = start; x < rc->right; x++)
+            {
+                x = rc->left;
+                if (simd_funcs) x += simd_funcs->rop_bytes( (BYTE *)start, (rc->right - rc->left) * 2,
+                                                            (and & 0xffff) * 0x10001, (xor & 0xffff) * 0x10001 ) / 2;
+                for(ptr = start + x - rc->left; x < rc->right; x++)
                     do_rop_16(ptr++, and, xor);
+            }
         else
             for(y = rc->top; y < rc->bottom; y++, start += dib->stride / 2)
                 memset_16( start, xor, rc->right - rc->left );
@@ -4685,32 +4694,48 @@ static inline DWORD blend_rgb( BYTE dst_r, BYTE dst_g, BYTE dst_b, DWORD src, BL
 static void blend_rects_8888(const dib_info *dst, int num, const RECT *rc,
                              const dib_info *src, const POINT *offset, BLENDFUNCTION blend)
 {
-    int i, x, y;
+    int i, x, y, width;
 
     for (i = 0; i < num; i++, rc++)
     {
         DWORD *src_ptr = get_pixel_ptr_32( src, rc->left + offset->x, rc->top + offset->y );
         DWORD *dst_ptr = get_pixel_ptr_32( dst, rc->left, rc->top );
 
+        width = rc->right - rc->left;
         if (blend.AlphaFormat & AC_SRC_ALPHA)
         {
             if (blend.SourceConstantAlpha == 255)
                 for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                    for (x = 0; x < rc->right - rc->left; x++)
+                {
+                    x = simd_funcs ? simd_funcs->blend_argb_row( dst_ptr, src_ptr, width ) : 0;
+                    for (; x < width; x++)
                         dst_ptr[x] = blend_argb( dst_ptr[x], src_ptr[x] );
+                }
             else
                 for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                    for (x = 0; x < rc->right - rc->left; x++)
+                {
+                    x = simd_funcs ? simd_funcs->blend_argb_alpha_row( dst_ptr, src_ptr, width,
+                                                                       blend.SourceConstantAlpha ) : 0;
+                    for (; x < width; x++)
                         dst_ptr[x] = blend_argb_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
+                }
         }
         else if (src->compression == BI_RGB)
             for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                for (x = 0; x < rc->right - rc->left; x++)
+            {
+                x = simd_funcs ? simd_funcs->blend_argb_constant_alpha_row( dst_ptr, src_ptr, width,
+                                                                            blend.SourceConstantAlpha ) : 0;
+                for (; x < width; x++)
                     dst_ptr[x] = blend_argb_constant_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
+            }
         else
             for (y = rc->top; y < rc->bottom; y++, dst_ptr += dst->stride / 4, src_ptr += src->stride / 4)
-                for (x = 0; x < rc->right - rc->left; x++)
+            {
+                x = simd_funcs ? simd_funcs->blend_argb_no_src_alpha_row( dst_ptr, src_ptr, width,
+                                                                          blend.SourceConstantAlpha ) : 0;
+                for (; x < width; x++)
                     dst_ptr[x] = blend_argb_no_src_alpha( dst_ptr[x], src_ptr[x], blend.SourceConstantAlpha );
+            }
     }
 }
 
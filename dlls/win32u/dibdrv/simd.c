@@ -0,0 +1,423 @@
+/*
+ * DIB driver vectorized primitives.
+ *
+ * Copyright 2026 The Wine Project
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#if 0
+#pragma makedep unix
+#endif
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <immintrin.h>
+#define HAVE_SIMD_X86
+#elif defined(__GNUC__) && (defined(__ARM_NEON) || defined(__aarch64__))
+#include <arm_neon.h>
+#define HAVE_SIMD_NEON
+#endif
+
+#include "ntgdi_private.h"
+#include "dibdrv.h"
+
+#include "wine/debug.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(dib);
+
+/* The row helpers below must give exactly the same results as the scalar code in primitives.c.
+ * Blending divides by 255 with rounding, which is done on 16-bit lanes as (x * 0x8081) >> 23,
+ * exact for every value that can occur here.  The scalar blend_argb() ORs the per-channel sums
+ * together, so a sum overflowing 8 bits leaks into the low bit of the next channel; the vector
+ * code reproduces that instead of saturating. */
+
+const struct simd_funcs *simd_funcs = NULL;
+
+#ifdef HAVE_SIMD_X86
+
+#define SSE2_FUNC __attribute__((target("sse2")))
+#define AVX2_FUNC __attribute__((target("avx2")))
+
+static inline SSE2_FUNC __m128i div255_sse2( __m128i x )
+{
+    return _mm_srli_epi16( _mm_mulhi_epu16( x, _mm_set1_epi16( 0x8081 )), 7 );
+}
+
+/* recombine 16-bit channel sums the way the scalar code does */
+static inline SSE2_FUNC __m128i fold_carry_sse2( __m128i sum )
+{
+    __m128i carry = _mm_slli_epi64( _mm_srli_epi16( sum, 8 ), 16 );
+    return _mm_or_si128( _mm_and_si128( sum, _mm_set1_epi16( 0xff ) ), carry );
+}
+
+static inline SSE2_FUNC __m128i broadcast_alpha_sse2( __m128i x )
+{
+    return _mm_shufflehi_epi16( _mm_shufflelo_epi16( x, 0xff ), 0xff );
+}
+
+/* dst = src + dst * (255 - src_alpha) / 255 on two unpacked pixels */
+static inline SSE2_FUNC __m128i blend_argb_sse2( __m128i dst, __m128i src )
+{
+    __m128i inv = _mm_sub_epi16( _mm_set1_epi16( 255 ), broadcast_alpha_sse2( src ));
+    dst = _mm_add_epi16( _mm_mullo_epi16( dst, inv ), _mm_set1_epi16( 127 ));
+    return fold_carry_sse2( _mm_add_epi16( src, div255_sse2( dst )));
+}
+
+/* (src * alpha + dst * (255 - alpha) + 127) / 255 on two unpacked pixels */
+static inline SSE2_FUNC __m128i blend_constant_sse2( __m128i dst, __m128i src, __m128i alpha, __m128i inv )
+{
+    __m128i x = _mm_add_epi16( _mm_mullo_epi16( src, alpha ), _mm_mullo_epi16( dst, inv ));
+    return div255_sse2( _mm_add_epi16( x, _mm_set1_epi16( 127 )));
+}
+
+static SSE2_FUNC int rop_bytes_sse2( BYTE *ptr, int len, DWORD and, DWORD xor )
+{
+    __m128i and_mask = _mm_set1_epi32( and ), xor_mask = _mm_set1_epi32( xor );
+    int i;
+
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        __m128i val = _mm_loadu_si128( (__m128i *)(ptr + i) );
+        _mm_storeu_si128( (__m128i *)(ptr + i), _mm_xor_si128( _mm_and_si128( val, and_mask ), xor_mask ));
+    }
+    return i;
+}
+
+static SSE2_FUNC int blend_argb_row_sse2( DWORD *dst, const DWORD *src, int len )
+{
+    __m128i zero = _mm_setzero_si128();
+    int x;
+
+    for (x = 0; x + 4 <= len; x += 4)
+    {
+        __m128i s = _mm_loadu_si128( (const __m128i *)(src + x) );
+        __m128i d = _mm_loadu_si128( (const __m128i *)(dst + x) );
+        __m128i lo = blend_argb_sse2( _mm_unpacklo_epi8( d, zero ), _mm_unpacklo_epi8( s, zero ));
+        __m128i hi = blend_argb_sse2( _mm_unpackhi_epi8( d, zero ), _mm_unpackhi_epi8( s, zero ));
+        _mm_storeu_si128( (__m128i *)(dst + x), _mm_packus_epi16( lo, hi ));
+    }
+    return x;
+}
+
+static SSE2_FUNC int blend_argb_alpha_row_sse2( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    __m128i zero = _mm_setzero_si128(), a = _mm_set1_epi16( alpha ), round = _mm_set1_epi16( 127 );
+    int x;
+
+    for (x = 0; x + 4 <= len; x += 4)
+    {
+        __m128i s = _mm_loadu_si128( (const __m128i *)(src + x) );
+        __m128i d = _mm_loadu_si128( (const __m128i *)(dst + x) );
+        __m128i s_lo = div255_sse2( _mm_add_epi16( _mm_mullo_epi16( _mm_unpacklo_epi8( s, zero ), a ), round ));
+        __m128i s_hi = div255_sse2( _mm_add_epi16( _mm_mullo_epi16( _mm_unpackhi_epi8( s, zero ), a ), round ));
+        __m128i lo = blend_argb_sse2( _mm_unpacklo_epi8( d, zero ), s_lo );
+        __m128i hi = blend_argb_sse2( _mm_unpackhi_epi8( d, zero ), s_hi );
+        _mm_storeu_si128( (__m128i *)(dst + x), _mm_packus_epi16( lo, hi ));
+    }
+    return x;
+}
+
+static SSE2_FUNC int blend_constant_row_sse2( DWORD *dst, const DWORD *src, int len, DWORD alpha, DWORD src_or )
+{
+    __m128i zero = _mm_setzero_si128(), or_mask = _mm_set1_epi32( src_or );
+    __m128i a = _mm_set1_epi16( alpha ), inv = _mm_set1_epi16( 255 - alpha );
+    int x;
+
+    for (x = 0; x + 4 <= len; x += 4)
+    {
+        __m128i s = _mm_or_si128( _mm_loadu_si128( (const __m128i *)(src + x) ), or_mask );
+        __m128i d = _mm_loadu_si128( (const __m128i *)(dst + x) );
+        __m128i lo = blend_constant_sse2( _mm_unpacklo_epi8( d, zero ), _mm_unpacklo_epi8( s, zero ), a, inv );
+        __m128i hi = blend_constant_sse2( _mm_unpackhi_epi8( d, zero ), _mm_unpackhi_epi8( s, zero ), a, inv );
+        _mm_storeu_si128( (__m128i *)(dst + x), _mm_packus_epi16( lo, hi ));
+    }
+    return x;
+}
+
+static int blend_argb_constant_alpha_row_sse2( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    return blend_constant_row_sse2( dst, src, len, alpha, 0 );
+}
+
+static int blend_argb_no_src_alpha_row_sse2( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    return blend_constant_row_sse2( dst, src, len, alpha, 0xff000000 );
+}
+
+static const struct simd_funcs simd_funcs_sse2 =
+{
+    rop_bytes_sse2,
+    blend_argb_row_sse2,
+    blend_argb_alpha_row_sse2,
+    blend_argb_constant_alpha_row_sse2,
+    blend_argb_no_src_alpha_row_sse2,
+};
+
+/* The AVX2 versions work on 256-bit vectors; unpack and pack operate within each 128-bit
+ * lane, so pixel order is preserved without any permutes. */
+
+static inline AVX2_FUNC __m256i div255_avx2( __m256i x )
+{
+    return _mm256_srli_epi16( _mm256_mulhi_epu16( x, _mm256_set1_epi16( 0x8081 )), 7 );
+}
+
+static inline AVX2_FUNC __m256i fold_carry_avx2( __m256i sum )
+{
+    __m256i carry = _mm256_slli_epi64( _mm256_srli_epi16( sum, 8 ), 16 );
+    return _mm256_or_si256( _mm256_and_si256( sum, _mm256_set1_epi16( 0xff ) ), carry );
+}
+
+static inline AVX2_FUNC __m256i broadcast_alpha_avx2( __m256i x )
+{
+    return _mm256_shufflehi_epi16( _mm256_shufflelo_epi16( x, 0xff ), 0xff );
+}
+
+static inline AVX2_FUNC __m256i blend_argb_avx2( __m256i dst, __m256i src )
+{
+    __m256i inv = _mm256_sub_epi16( _mm256_set1_epi16( 255 ), broadcast_alpha_avx2( src ));
+    dst = _mm256_add_epi16( _mm256_mullo_epi16( dst, inv ), _mm256_set1_epi16( 127 ));
+    return fold_carry_avx2( _mm256_add_epi16( src, div255_avx2( dst )));
+}
+
+static inline AVX2_FUNC __m256i blend_constant_avx2( __m256i dst, __m256i src, __m256i alpha, __m256i inv )
+{
+    __m256i x = _mm256_add_epi16( _mm256_mullo_epi16( src, alpha ), _mm256_mullo_epi16( dst, inv ));
+    return div255_avx2( _mm256_add_epi16( x, _mm256_set1_epi16( 127 )));
+}
+
+static AVX2_FUNC int rop_bytes_avx2( BYTE *ptr, int len, DWORD and, DWORD xor )
+{
+    __m256i and_mask = _mm256_set1_epi32( and ), xor_mask = _mm256_set1_epi32( xor );
+    int i;
+
+    for (i = 0; i + 32 <= len; i += 32)
+    {
+        __m256i val = _mm256_loadu_si256( (__m256i *)(ptr + i) );
+        _mm256_storeu_si256( (__m256i *)(ptr + i), _mm256_xor_si256( _mm256_and_si256( val, and_mask ), xor_mask ));
+    }
+    return i + rop_bytes_sse2( ptr + i, len - i, and, xor );
+}
+
+static AVX2_FUNC int blend_argb_row_avx2( DWORD *dst, const DWORD *src, int len )
+{
+    __m256i zero = _mm256_setzero_si256();
+    int x;
+
+    for (x = 0; x + 8 <= len; x += 8)
+    {
+        __m256i s = _mm256_loadu_si256( (const __m256i *)(src + x) );
+        __m256i d = _mm256_loadu_si256( (const __m256i *)(dst + x) );
+        __m256i lo = blend_argb_avx2( _mm256_unpacklo_epi8( d, zero ), _mm256_unpacklo_epi8( s, zero ));
+        __m256i hi = blend_argb_avx2( _mm256_unpackhi_epi8( d, zero ), _mm256_unpackhi_epi8( s, zero ));
+        _mm256_storeu_si256( (__m256i *)(dst + x), _mm256_packus_epi16( lo, hi ));
+    }
+    return x + blend_argb_row_sse2( dst + x, src + x, len - x );
+}
+
+static AVX2_FUNC int blend_argb_alpha_row_avx2( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    __m256i zero = _mm256_setzero_si256(), a = _mm256_set1_epi16( alpha ), round = _mm256_set1_epi16( 127 );
+    int x;
+
+    for (x = 0; x + 8 <= len; x += 8)
+    {
+        __m256i s = _mm256_loadu_si256( (const __m256i *)(src + x) );
+        __m256i d = _mm256_loadu_si256( (const __m256i *)(dst + x) );
+        __m256i s_lo = div255_avx2( _mm256_add_epi16( _mm256_mullo_epi16( _mm256_unpacklo_epi8( s, zero ), a ), round ));
+        __m256i s_hi = div255_avx2( _mm256_add_epi16( _mm256_mullo_epi16( _mm256_unpackhi_epi8( s, zero ), a ), round ));
+        __m256i lo = blend_argb_avx2( _mm256_unpacklo_epi8( d, zero ), s_lo );
+        __m256i hi = blend_argb_avx2( _mm256_unpackhi_epi8( d, zero ), s_hi );
+        _mm256_storeu_si256( (__m256i *)(dst + x), _mm256_packus_epi16( lo, hi ));
+    }
+    return x + blend_argb_alpha_row_sse2( dst + x, src + x, len - x, alpha );
+}
+
+static AVX2_FUNC int blend_constant_row_avx2( DWORD *dst, const DWORD *src, int len, DWORD alpha, DWORD src_or )
+{
+    __m256i zero = _mm256_setzero_si256(), or_mask = _mm256_set1_epi32( src_or );
+    __m256i a = _mm256_set1_epi16( alpha ), inv = _mm256_set1_epi16( 255 - alpha );
+    int x;
+
+    for (x = 0; x + 8 <= len; x += 8)
+    {
+        __m256i s = _mm256_or_si256( _mm256_loadu_si256( (const __m256i *)(src + x) ), or_mask );
+        __m256i d = _mm256_loadu_si256( (const __m256i *)(dst + x) );
+        __m256i lo = blend_constant_avx2( _mm256_unpacklo_epi8( d, zero ), _mm256_unpacklo_epi8( s, zero ), a, inv );
+        __m256i hi = blend_constant_avx2( _mm256_unpackhi_epi8( d, zero ), _mm256_unpackhi_epi8( s, zero ), a, inv );
+        _mm256_storeu_si256( (__m256i *)(dst + x), _mm256_packus_epi16( lo, hi ));
+    }
+    return x + blend_constant_row_sse2( dst + x, src + x, len - x, alpha, src_or );
+}
+
+static int blend_argb_constant_alpha_row_avx2( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    return blend_constant_row_avx2( dst, src, len, alpha, 0 );
+}
+
+static int blend_argb_no_src_alpha_row_avx2( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    return blend_constant_row_avx2( dst, src, len, alpha, 0xff000000 );
+}
+
+static const struct simd_funcs simd_funcs_avx2 =
+{
+    rop_bytes_avx2,
+    blend_argb_row_avx2,
+    blend_argb_alpha_row_avx2,
+    blend_argb_constant_alpha_row_avx2,
+    blend_argb_no_src_alpha_row_avx2,
+};
+
+#elif defined(HAVE_SIMD_NEON)
+
+static inline uint16x8_t div255_neon( uint16x8_t x )
+{
+    /* (x + (x >> 8) + 1) >> 8, exact for x < 65535 */
+    return vshrq_n_u16( vaddq_u16( vsraq_n_u16( x, x, 8 ), vdupq_n_u16( 1 )), 8 );
+}
+
+static inline uint16x8_t fold_carry_neon( uint16x8_t sum )
+{
+    uint16x8_t carry = vreinterpretq_u16_u64( vshlq_n_u64( vreinterpretq_u64_u16( vshrq_n_u16( sum, 8 )), 16 ));
+    return vorrq_u16( vandq_u16( sum, vdupq_n_u16( 0xff )), carry );
+}
+
+/* replicate the alpha byte of each pixel into all four channels */
+static inline uint8x16_t broadcast_alpha_neon( uint8x16_t x )
+{
+    return vreinterpretq_u8_u32( vmulq_n_u32( vshrq_n_u32( vreinterpretq_u32_u8( x ), 24 ), 0x01010101 ));
+}
+
+static inline uint8x16_t blend_argb_neon( uint8x16_t d, uint16x8_t s_lo, uint16x8_t s_hi, uint8x16_t s_alpha )
+{
+    uint8x16_t inv = vmvnq_u8( s_alpha );
+    uint16x8_t round = vdupq_n_u16( 127 );
+    uint16x8_t lo = vmlal_u8( round, vget_low_u8( d ), vget_low_u8( inv ));
+    uint16x8_t hi = vmlal_u8( round, vget_high_u8( d ), vget_high_u8( inv ));
+
+    lo = fold_carry_neon( vaddq_u16( s_lo, div255_neon( lo )));
+    hi = fold_carry_neon( vaddq_u16( s_hi, div255_neon( hi )));
+    return vcombine_u8( vmovn_u16( lo ), vmovn_u16( hi ));
+}
+
+static int rop_bytes_neon( BYTE *ptr, int len, DWORD and, DWORD xor )
+{
+    uint8x16_t and_mask = vreinterpretq_u8_u32( vdupq_n_u32( and ));
+    uint8x16_t xor_mask = vreinterpretq_u8_u32( vdupq_n_u32( xor ));
+    int i;
+
+    for (i = 0; i + 16 <= len; i += 16)
+        vst1q_u8( ptr + i, veorq_u8( vandq_u8( vld1q_u8( ptr + i ), and_mask ), xor_mask ));
+    return i;
+}
+
+static int blend_argb_row_neon( DWORD *dst, const DWORD *src, int len )
+{
+    int x;
+
+    for (x = 0; x + 4 <= len; x += 4)
+    {
+        uint8x16_t s = vld1q_u8( (const BYTE *)(src + x) );
+        uint8x16_t d = vld1q_u8( (const BYTE *)(dst + x) );
+        uint8x16_t res = blend_argb_neon( d, vmovl_u8( vget_low_u8( s )), vmovl_u8( vget_high_u8( s )),
+                                          broadcast_alpha_neon( s ));
+        vst1q_u8( (BYTE *)(dst + x), res );
+    }
+    return x;
+}
+
+static int blend_argb_alpha_row_neon( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    uint8x8_t a = vdup_n_u8( alpha );
+    uint16x8_t round = vdupq_n_u16( 127 );
+    int x;
+
+    for (x = 0; x + 4 <= len; x += 4)
+    {
+        uint8x16_t s = vld1q_u8( (const BYTE *)(src + x) );
+        uint8x16_t d = vld1q_u8( (const BYTE *)(dst + x) );
+        uint16x8_t s_lo = div255_neon( vmlal_u8( round, vget_low_u8( s ), a ));
+        uint16x8_t s_hi = div255_neon( vmlal_u8( round, vget_high_u8( s ), a ));
+        uint8x16_t s8 = vcombine_u8( vmovn_u16( s_lo ), vmovn_u16( s_hi ));
+
+        vst1q_u8( (BYTE *)(dst + x), blend_argb_neon( d, s_lo, s_hi, broadcast_alpha_neon( s8 )));
+    }
+    return x;
+}
+
+static int blend_constant_row_neon( DWORD *dst, const DWORD *src, int len, DWORD alpha, DWORD src_or )
+{
+    uint8x16_t or_mask = vreinterpretq_u8_u32( vdupq_n_u32( src_or ));
+    uint8x8_t a = vdup_n_u8( alpha ), inv = vdup_n_u8( 255 - alpha );
+    uint16x8_t round = vdupq_n_u16( 127 );
+    int x;
+
+    for (x = 0; x + 4 <= len; x += 4)
+    {
+        uint8x16_t s = vorrq_u8( vld1q_u8( (const BYTE *)(src + x) ), or_mask );
+        uint8x16_t d = vld1q_u8( (const BYTE *)(dst + x) );
+        uint16x8_t lo = vmlal_u8( vmlal_u8( round, vget_low_u8( s ), a ), vget_low_u8( d ), inv );
+        uint16x8_t hi = vmlal_u8( vmlal_u8( round, vget_high_u8( s ), a ), vget_high_u8( d ), inv );
+
+        vst1q_u8( (BYTE *)(dst + x), vcombine_u8( vmovn_u16( div255_neon( lo )), vmovn_u16( div255_neon( hi ))));
+    }
+    return x;
+}
+
+static int blend_argb_constant_alpha_row_neon( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    return blend_constant_row_neon( dst, src, len, alpha, 0 );
+}
+
+static int blend_argb_no_src_alpha_row_neon( DWORD *dst, const DWORD *src, int len, DWORD alpha )
+{
+    return blend_constant_row_neon( dst, src, len, alpha, 0xff000000 );
+}
+
+static const struct simd_funcs simd_funcs_neon =
+{
+    rop_bytes_neon,
+    blend_argb_row_neon,
+    blend_argb_alpha_row_neon,
+    blend_argb_constant_alpha_row_neon,
+    blend_argb_no_src_alpha_row_neon,
+};
+
+#endif
+
+/***********************************************************************
+ *           init_dib_simd
+ *
+ * Select the vectorized row helpers supported by the host CPU.
+ */
+void init_dib_simd(void)
+{
+#ifdef HAVE_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports( "avx2" ))
+    {
+        TRACE( "using AVX2 primitives\n" );
+        simd_funcs = &simd_funcs_avx2;
+    }
+    else if (__builtin_cpu_supports( "sse2" ))
+    {
+        TRACE( "using SSE2 primitives\n" );
+        simd_funcs = &simd_funcs_sse2;
+    }
+#elif defined(HAVE_SIMD_NEON)
+    TRACE( "using NEON primitives\n" );
+    simd_funcs = &simd_funcs_neon;
+#endif
+}
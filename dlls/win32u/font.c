@@ -6820,7 +6820,11 @@ UINT font_init(void)
     name.Buffer = wine_font_mutexW;
     name.Length = name.MaximumLength = sizeof(wine_font_mutexW);
 
-    if (NtCreateMutant( &mutex, MUTEX_ALL_ACCESS, &attr, FALSE ) < 0) return dpi;
+    if (NtCreateMutant( &mutex, MUTEX_ALL_ACCESS, &attr, FALSE ) < 0)
+    {
+        font_funcs->load_fonts_done();
+        return dpi;
+    }
     NtWaitForSingleObject( mutex, FALSE, NULL );
 
     wine_fonts_cache_key = reg_create_key( wine_fonts_key, cacheW, sizeof(cacheW),
@@ -6840,6 +6844,9 @@ UINT font_init(void)
         load_font_list_from_cache();
     }
 
+    /* registry and external fonts go through the catalog too */
+    font_funcs->load_fonts_done();
+
     reorder_font_list();
     load_gdi_font_subst();
     load_gdi_font_replacements();
@@ -1300,22 +1300,433 @@ static void unix_face_destroy( struct unix_face *This )
     free( This );
 }
 
+/*************************************************************
+ * Persistent font catalog
+ *
+ * Parsing the names and properties of every system font is the most expensive part of
+ * starting a process.  The results are kept in a binary file in the prefix, validated
+ * against the size and modification time of each font file, so that the fonts loaded
+ * at startup can usually be added without opening them.  The catalog is only used while
+ * the initial font list is being built, and rewritten at the end if anything changed.
+ */
+
+#define FONT_CATALOG_MAGIC   0x54414346  /* "FCAT" */
+#define FONT_CATALOG_VERSION 1
+
+#define FONT_CATALOG_SCALABLE     0x01
+#define FONT_CATALOG_ALLOW_BITMAP 0x02  /* face was loaded with ADDFONT_ALLOW_BITMAP */
+#define FONT_CATALOG_INVALID      0x04  /* file doesn't contain a usable face */
+
+struct font_catalog_header
+{
+    UINT magic;
+    UINT version;
+    UINT lcid;
+    UINT count;
+    UINT size;
+    UINT reserved;
+};
+
+struct font_catalog_entry
+{
+    UINT hash;
+    UINT path;           /* offset of the unix file name */
+    UINT face_index;
+    UINT flags;
+    ULONGLONG mtime;
+    ULONGLONG file_size;
+    UINT num_faces;
+    DWORD ntm_flags;
+    UINT weight;
+    DWORD font_version;
+    FONTSIGNATURE fs;
+    struct bitmap_font_size size;
+    UINT names[4];       /* family, second, style and full name offsets, 0 if missing */
+};
+
+struct font_catalog_record
+{
+    struct font_catalog_entry entry;
+    const char *path;
+    const WCHAR *names[4];
+    BOOL owned;          /* strings are allocated rather than pointing into the mapped catalog */
+};
+
+static struct
+{
+    BOOL active;
+    const struct font_catalog_header *header;
+    const struct font_catalog_entry *entries;
+    SIZE_T map_size;
+    BYTE *used;          /* catalog entries that are still valid */
+    UINT used_count;
+    struct font_catalog_record *records;
+    UINT count;
+    UINT size;
+    BOOL dirty;
+} font_catalog;
+
+static char *get_font_catalog_name(void)
+{
+    static const char name[] = "/font-catalog";
+    const char *dir = ntdll_get_config_dir();
+    char *ret;
+
+    if (!dir || !(ret = malloc( strlen( dir ) + sizeof(name) ))) return NULL;
+    strcpy( ret, dir );
+    strcat( ret, name );
+    return ret;
+}
+
+static UINT hash_font_path( const char *path )
+{
+    UINT hash = 0x811c9dc5;
+
+    while (*path) hash = (hash ^ (unsigned char)*path++) * 0x01000193;
+    return hash;
+}
+
+static ULONGLONG get_font_file_mtime( const struct stat *st )
+{
+#ifdef HAVE_STRUCT_STAT_ST_MTIM
+    return (ULONGLONG)st->st_mtime * 1000000000 + st->st_mtim.tv_nsec;
+#elif defined(HAVE_STRUCT_STAT_ST_MTIMESPEC)
+    return (ULONGLONG)st->st_mtime * 1000000000 + st->st_mtimespec.tv_nsec;
+#else
+    return (ULONGLONG)st->st_mtime * 1000000000;
+#endif
+}
+
+static BOOL font_catalog_check_string( const struct font_catalog_header *header, UINT offset, UINT align )
+{
+    return offset % align == 0 && offset >= sizeof(*header) + header->count * sizeof(struct font_catalog_entry) &&
+           offset < header->size;
+}
+
+static BOOL font_catalog_check( const struct font_catalog_header *header, SIZE_T size )
+{
+    const struct font_catalog_entry *entries = (const struct font_catalog_entry *)(header + 1);
+    UINT i, j;
+
+    if (size < sizeof(*header) + sizeof(WCHAR)) return FALSE;
+    if (header->magic != FONT_CATALOG_MAGIC || header->version != FONT_CATALOG_VERSION) return FALSE;
+    if (header->size != size || header->lcid != system_lcid) return FALSE;
+    if (header->count > (size - sizeof(*header)) / sizeof(*entries)) return FALSE;
+    /* the file is terminated by a null WCHAR, so every string offset within it is terminated */
+    if (*(const WCHAR *)((const char *)header + size - sizeof(WCHAR))) return FALSE;
+
+    for (i = 0; i < header->count; i++)
+    {
+        if (i && entries[i].hash < entries[i - 1].hash) return FALSE;
+        if (!font_catalog_check_string( header, entries[i].path, 1 )) return FALSE;
+        for (j = 0; j < ARRAY_SIZE(entries[i].names); j++)
+            if (entries[i].names[j] && !font_catalog_check_string( header, entries[i].names[j], sizeof(WCHAR) ))
+                return FALSE;
+    }
+    return TRUE;
+}
+
+static void open_font_catalog(void)
+{
+    struct stat st;
+    char *name;
+    void *ptr;
+    int fd;
+
+    font_catalog.active = TRUE;
+    if (!(name = get_font_catalog_name())) return;
+    fd = open( name, O_RDONLY );
+    free( name );
+    if (fd == -1) return;
+
+    if (!fstat( fd, &st ) && st.st_size > sizeof(*font_catalog.header) &&
+        (ptr = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 )) != MAP_FAILED)
+    {
+        if (font_catalog_check( ptr, st.st_size ))
+        {
+            font_catalog.header = ptr;
+            font_catalog.entries = (const struct font_catalog_entry *)(font_catalog.header + 1);
+            font_catalog.map_size = st.st_size;
+            font_catalog.used = calloc( font_catalog.header->count, 1 );
+            TRACE( "loaded %u catalog entries\n", font_catalog.header->count );
+        }
+        else
+        {
+            WARN( "ignoring invalid font catalog\n" );
+            munmap( ptr, st.st_size );
+        }
+    }
+    close( fd );
+}
+
+static void free_font_catalog_record( struct font_catalog_record *record )
+{
+    UINT i;
+
+    if (!record->owned) return;
+    free( (char *)record->path );
+    for (i = 0; i < ARRAY_SIZE(record->names); i++) free( (WCHAR *)record->names[i] );
+}
+
+static struct font_catalog_record *add_font_catalog_record(void)
+{
+    struct font_catalog_record *record;
+
+    if (font_catalog.count == font_catalog.size)
+    {
+        UINT size = max( font_catalog.size * 2, 256 );
+        if (!(record = realloc( font_catalog.records, size * sizeof(*record) ))) return NULL;
+        font_catalog.records = record;
+        font_catalog.size = size;
+    }
+    record = &font_catalog.records[font_catalog.count];
+    memset( record, 0, sizeof(*record) );
+    font_catalog.count++;
+    return record;
+}
+
+static UINT get_font_catalog_flags( UINT flags )
+{
+    return flags & ADDFONT_ALLOW_BITMAP ? FONT_CATALOG_ALLOW_BITMAP : 0;
+}
+
+/* look up a face in the catalog; returns FALSE if it needs to be parsed */
+static BOOL lookup_font_catalog( const char *unix_name, const struct stat *st, UINT face_index,
+                                 UINT flags, struct unix_face *face, BOOL *valid )
+{
+    const struct font_catalog_entry *entry;
+    const char *base = (const char *)font_catalog.header;
+    struct font_catalog_record *record;
+    UINT i, hash, lo = 0, hi;
+
+    if (!font_catalog.header || !font_catalog.used) return FALSE;
+
+    hash = hash_font_path( unix_name );
+    hi = font_catalog.header->count;
+    while (lo < hi)
+    {
+        UINT mid = (lo + hi) / 2;
+        if (font_catalog.entries[mid].hash < hash) lo = mid + 1;
+        else hi = mid;
+    }
+
+    for (entry = font_catalog.entries + lo; entry < font_catalog.entries + font_catalog.header->count; entry++)
+    {
+        if (entry->hash != hash) return FALSE;
+        if (entry->face_index != face_index) continue;
+        if ((entry->flags & FONT_CATALOG_ALLOW_BITMAP) != get_font_catalog_flags( flags )) continue;
+        if (strcmp( base + entry->path, unix_name )) continue;
+        if (entry->file_size != st->st_size || entry->mtime != get_font_file_mtime( st )) return FALSE;
+        break;
+    }
+    if (entry == font_catalog.entries + font_catalog.header->count) return FALSE;
+
+    if (!font_catalog.used[entry - font_catalog.entries])
+    {
+        if (!(record = add_font_catalog_record())) return FALSE;
+        record->entry = *entry;
+        record->path = base + entry->path;
+        for (i = 0; i < ARRAY_SIZE(record->names); i++)
+            if (entry->names[i]) record->names[i] = (const WCHAR *)(base + entry->names[i]);
+        font_catalog.used[entry - font_catalog.entries] = 1;
+        font_catalog.used_count++;
+    }
+
+    *valid = !(entry->flags & FONT_CATALOG_INVALID);
+    memset( face, 0, sizeof(*face) );
+    face->scalable     = !!(entry->flags & FONT_CATALOG_SCALABLE);
+    face->num_faces    = entry->num_faces;
+    face->family_name  = entry->names[0] ? (WCHAR *)(base + entry->names[0]) : NULL;
+    face->second_name  = entry->names[1] ? (WCHAR *)(base + entry->names[1]) : NULL;
+    face->style_name   = entry->names[2] ? (WCHAR *)(base + entry->names[2]) : NULL;
+    face->full_name    = entry->names[3] ? (WCHAR *)(base + entry->names[3]) : NULL;
+    face->ntm_flags    = entry->ntm_flags;
+    face->weight       = entry->weight;
+    face->font_version = entry->font_version;
+    face->fs           = entry->fs;
+    face->size         = entry->size;
+    return TRUE;
+}
+
+static struct font_catalog_record *find_font_catalog_record( const char *unix_name, UINT hash,
+                                                             UINT face_index, UINT flags )
+{
+    struct font_catalog_record *record;
+
+    for (record = font_catalog.records; record < font_catalog.records + font_catalog.count; record++)
+    {
+        if (record->entry.hash != hash || record->entry.face_index != face_index) continue;
+        if ((record->entry.flags & FONT_CATALOG_ALLOW_BITMAP) != flags) continue;
+        if (record->path && !strcmp( record->path, unix_name )) return record;
+    }
+    return NULL;
+}
+
+static void add_font_catalog_entry( const char *unix_name, const struct stat *st, UINT face_index,
+                                    UINT flags, const struct unix_face *face )
+{
+    UINT hash = hash_font_path( unix_name ), catalog_flags = get_font_catalog_flags( flags );
+    struct font_catalog_record *record;
+
+    font_catalog.dirty = TRUE;
+    /* replace the record of a file that is scanned again instead of adding a duplicate */
+    if ((record = find_font_catalog_record( unix_name, hash, face_index, catalog_flags )))
+    {
+        free_font_catalog_record( record );
+        memset( record, 0, sizeof(*record) );
+    }
+    else if (!(record = add_font_catalog_record())) return;
+    record->owned = TRUE;
+    if (!(record->path = strdup( unix_name ))) return;
+    record->entry.hash       = hash;
+    record->entry.face_index = face_index;
+    record->entry.flags      = catalog_flags;
+    record->entry.mtime      = get_font_file_mtime( st );
+    record->entry.file_size  = st->st_size;
+    if (!face)
+    {
+        record->entry.flags |= FONT_CATALOG_INVALID;
+        return;
+    }
+    if (face->scalable) record->entry.flags |= FONT_CATALOG_SCALABLE;
+    record->entry.num_faces    = face->num_faces;
+    record->entry.ntm_flags    = face->ntm_flags;
+    record->entry.weight       = face->weight;
+    record->entry.font_version = face->font_version;
+    record->entry.fs           = face->fs;
+    record->entry.size         = face->size;
+    if (face->family_name) record->names[0] = wcsdup( face->family_name );
+    if (face->second_name) record->names[1] = wcsdup( face->second_name );
+    if (face->style_name) record->names[2] = wcsdup( face->style_name );
+    if (face->full_name) record->names[3] = wcsdup( face->full_name );
+}
+
+static int compare_font_catalog_records( const void *p1, const void *p2 )
+{
+    const struct font_catalog_record *r1 = p1, *r2 = p2;
+
+    if (r1->entry.hash != r2->entry.hash) return r1->entry.hash < r2->entry.hash ? -1 : 1;
+    return 0;
+}
+
+static BOOL is_font_catalog_record_valid( const struct font_catalog_record *record )
+{
+    return record->path && ((record->entry.flags & FONT_CATALOG_INVALID) || record->names[0]);
+}
+
+static void write_font_catalog(void)
+{
+    struct font_catalog_header *header;
+    struct font_catalog_entry *entries;
+    UINT i, j, count = 0, size, len;
+    char *name = NULL, *tmp_name = NULL, *data;
+    BOOL ret;
+    int fd;
+
+    qsort( font_catalog.records, font_catalog.count, sizeof(*font_catalog.records), compare_font_catalog_records );
+
+    size = sizeof(WCHAR);  /* terminating null */
+    for (i = 0; i < font_catalog.count; i++)
+    {
+        const struct font_catalog_record *record = &font_catalog.records[i];
+
+        if (!is_font_catalog_record_valid( record )) continue;
+        size += sizeof(*entries) + ((strlen( record->path ) + 2) & ~1);
+        for (j = 0; j < ARRAY_SIZE(record->names); j++)
+            if (record->names[j]) size += (lstrlenW( record->names[j] ) + 1) * sizeof(WCHAR);
+        count++;
+    }
+    size += sizeof(*header);
+
+    if (!(data = calloc( 1, size ))) return;
+    header = (struct font_catalog_header *)data;
+    header->magic   = FONT_CATALOG_MAGIC;
+    header->version = FONT_CATALOG_VERSION;
+    header->lcid    = system_lcid;
+    header->count   = count;
+    header->size    = size;
+
+    entries = (struct font_catalog_entry *)(header + 1);
+    size = sizeof(*header) + count * sizeof(*entries);
+    for (i = 0; i < font_catalog.count; i++)
+    {
+        const struct font_catalog_record *record = &font_catalog.records[i];
+
+        if (!is_font_catalog_record_valid( record )) continue;
+        *entries = record->entry;
+        entries->path = size;
+        len = strlen( record->path ) + 1;
+        memcpy( data + size, record->path, len );
+        size += (len + 1) & ~1;
+        for (j = 0; j < ARRAY_SIZE(record->names); j++)
+        {
+            if (!record->names[j]) continue;
+            entries->names[j] = size;
+            len = (lstrlenW( record->names[j] ) + 1) * sizeof(WCHAR);
+            memcpy( data + size, record->names[j], len );
+            size += len;
+        }
+        entries++;
+    }
+    size += sizeof(WCHAR);
+
+    /* write to a temporary file and rename it so that readers never see a partial catalog */
+    if (!(name = get_font_catalog_name())) goto done;
+    if (!(tmp_name = malloc( strlen( name ) + 16 ))) goto done;
+    sprintf( tmp_name, "%s.%x", name, (int)getpid() );
+    if ((fd = open( tmp_name, O_WRONLY | O_CREAT | O_TRUNC, 0666 )) == -1) goto done;
+    ret = write( fd, data, size ) == size;
+    if (close( fd )) ret = FALSE;
+    if (ret && !rename( tmp_name, name )) TRACE( "wrote %u entries to %s\n", count, debugstr_a(name) );
+    else unlink( tmp_name );
+
+done:
+    free( tmp_name );
+    free( name );
+    free( data );
+}
+
+static void close_font_catalog(void)
+{
+    UINT i;
+
+    if (font_catalog.dirty || !font_catalog.header || font_catalog.used_count != font_catalog.header->count)
+        write_font_catalog();
+
+    for (i = 0; i < font_catalog.count; i++) free_font_catalog_record( &font_catalog.records[i] );
+    free( font_catalog.records );
+    free( font_catalog.used );
+    if (font_catalog.header) munmap( (void *)font_catalog.header, font_catalog.map_size );
+    memset( &font_catalog, 0, sizeof(font_catalog) );
+}
+
 static int add_unix_face( const char *unix_name, const WCHAR *file, void *data_ptr, SIZE_T data_size,
                           DWORD face_index, DWORD flags, DWORD *num_faces )
 {
-    struct unix_face *unix_face;
-    int ret;
+    struct unix_face *unix_face, cached_face;
+    BOOL use_catalog, valid = TRUE;
+    struct stat st;
+    int ret = 0;
 
     if (num_faces) *num_faces = 0;
 
-    if (!(unix_face = unix_face_create( unix_name, data_ptr, data_size, face_index, flags )))
-        return 0;
+    use_catalog = font_catalog.active && unix_name && !stat( unix_name, &st );
+    if (use_catalog && lookup_font_catalog( unix_name, &st, face_index, flags, &cached_face, &valid ))
+    {
+        if (!valid) return 0;
+        unix_face = &cached_face;
+    }
+    else
+    {
+        unix_face = unix_face_create( unix_name, data_ptr, data_size, face_index, flags );
+        if (use_catalog) add_font_catalog_entry( unix_name, &st, face_index, flags, unix_face );
+        if (!unix_face) return 0;
+    }
 
     if (unix_face->family_name[0] == '.') /* Ignore fonts with names beginning with a dot */
     {
         TRACE("Ignoring %s since its family name begins with a dot\n", debugstr_a(unix_name));
-        unix_face_destroy( unix_face );
-        return 0;
+        goto done;
     }
 
     if (!HIWORD( flags )) flags |= ADDFONT_AA_FLAGS( default_aa_flags );
@@ -1330,7 +1741,9 @@ static int add_unix_face( const char *unix_name, const WCHAR *file, void *data_p
           (int)unix_face->fs.fsUsb[2], (int)unix_face->fs.fsUsb[3]);
 
     if (num_faces) *num_faces = unix_face->num_faces;
-    unix_face_destroy( unix_face );
+
+done:
+    if (unix_face != &cached_face) unix_face_destroy( unix_face );
     return ret;
 }
 
@@ -1900,6 +2313,14 @@ static void freetype_load_fonts(void)
 #endif
 }
 
+/*************************************************************
+ * freetype_load_fonts_done
+ */
+static void freetype_load_fonts_done(void)
+{
+    close_font_catalog();
+}
+
 /* Some fonts have large usWinDescent values, as a result of storing signed short
    in unsigned field. That's probably caused by sTypoDescent vs usWinDescent confusion in
    some font generation tools. */
@@ -4226,6 +4647,7 @@ static UINT freetype_get_kerning_pairs( struct gdi_font *font, KERNINGPAIR **pai
 static const struct font_backend_funcs font_funcs =
 {
     freetype_load_fonts,
+    freetype_load_fonts_done,
     fontconfig_enum_family_fallbacks,
     freetype_add_font,
     freetype_add_mem_font,
@@ -4250,6 +4672,7 @@ const struct font_backend_funcs *init_freetype_lib(void)
     init_fontconfig();
 #endif
     NtQueryDefaultLocale( FALSE, &system_lcid );
+    open_font_catalog();
     return &font_funcs;
 }
 
@@ -1041,6 +1041,7 @@ void gdi_init(void)
     pthread_mutexattr_destroy( &attr );
 
     NtQuerySystemInformation( SystemBasicInformation, &system_info, sizeof(system_info), NULL );
+    init_dib_simd();
     init_gdi_shared();
     if (!gdi_shared) return;
 
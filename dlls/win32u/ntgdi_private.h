@@ -220,6 +220,7 @@ extern UINT set_dib_dc_color_table( HDC hdc, UINT startpos, UINT entries,
                                     const RGBQUAD *colors );
 extern void dibdrv_set_window_surface( DC *dc, struct window_surface *surface );
 extern struct opengl_funcs *dibdrv_get_wgl_driver(void);
+extern void init_dib_simd(void);
 
 /* driver.c */
 extern const struct gdi_dc_funcs null_driver;
@@ -316,6 +317,7 @@ struct gdi_font
 struct font_backend_funcs
 {
     void  (*load_fonts)(void);
+    void  (*load_fonts_done)(void);
     BOOL  (*enum_family_fallbacks)( UINT pitch_and_family, int index, WCHAR buffer[LF_FACESIZE] );
     INT   (*add_font)( const WCHAR *file, UINT flags );
     INT   (*add_mem_font)( void *ptr, SIZE_T size, UINT flags );
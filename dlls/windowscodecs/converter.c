@@ -19,6 +19,11 @@
 
 #include <stdarg.h>
 #include <math.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #define COBJMACROS
 
@@ -76,6 +81,7 @@ typedef struct FormatConverter {
     LONG ref;
     IWICBitmapSource *source;
     const struct pixelformatinfo *dst_format, *src_format;
+    const struct conversion_plan *plan;
     WICBitmapDitherType dither;
     double alpha_threshold;
     IWICPalette *palette;
@@ -1555,6 +1561,294 @@ static HRESULT copypixels_to_16bppBGRA5551(struct FormatConverter *This, const W
     }
 }
 
+/* Conversions between the common formats with 8-bit channels are planned when the
+ * converter is initialized, as a short list of row operations.  Conversions that keep
+ * the pixel size are done in place in the destination buffer; the others read the
+ * source in strips, so no intermediate copy of the whole rectangle is needed. */
+
+#define STEP_EXPAND_24BPP  0x01  /* 24bpp source to 32bpp destination, alpha set to 255 */
+#define STEP_SHRINK_32BPP  0x02  /* 32bpp source to 24bpp destination, alpha dropped */
+#define STEP_SWAP_RB       0x04
+#define STEP_SET_ALPHA     0x08
+#define STEP_PREMULTIPLY   0x10
+#define STEP_UNPREMULTIPLY 0x20
+
+#define MAX_STRIP_BYTES    (256 * 1024)
+
+static const struct conversion_plan
+{
+    enum pixelformat src, dst;
+    UINT steps;
+} conversion_plans[] =
+{
+    {format_24bppBGR,   format_32bppBGRA,  STEP_EXPAND_24BPP},
+    {format_24bppBGR,   format_32bppBGR,   STEP_EXPAND_24BPP},
+    {format_24bppBGR,   format_32bppPBGRA, STEP_EXPAND_24BPP},
+    {format_24bppBGR,   format_32bppRGBA,  STEP_EXPAND_24BPP | STEP_SWAP_RB},
+    {format_24bppBGR,   format_32bppRGB,   STEP_EXPAND_24BPP | STEP_SWAP_RB},
+    {format_24bppBGR,   format_32bppPRGBA, STEP_EXPAND_24BPP | STEP_SWAP_RB},
+    {format_24bppRGB,   format_32bppBGRA,  STEP_EXPAND_24BPP | STEP_SWAP_RB},
+    {format_24bppRGB,   format_32bppBGR,   STEP_EXPAND_24BPP | STEP_SWAP_RB},
+    {format_24bppRGB,   format_32bppPBGRA, STEP_EXPAND_24BPP | STEP_SWAP_RB},
+    {format_24bppRGB,   format_32bppRGBA,  STEP_EXPAND_24BPP},
+    {format_24bppRGB,   format_32bppRGB,   STEP_EXPAND_24BPP},
+    {format_24bppRGB,   format_32bppPRGBA, STEP_EXPAND_24BPP},
+    {format_32bppBGR,   format_32bppBGRA,  STEP_SET_ALPHA},
+    {format_32bppBGR,   format_32bppPBGRA, STEP_SET_ALPHA},
+    {format_32bppBGR,   format_32bppRGBA,  STEP_SET_ALPHA | STEP_SWAP_RB},
+    {format_32bppBGR,   format_32bppPRGBA, STEP_SET_ALPHA | STEP_SWAP_RB},
+    {format_32bppBGRA,  format_32bppPBGRA, STEP_PREMULTIPLY},
+    {format_32bppBGRA,  format_32bppRGBA,  STEP_SWAP_RB},
+    {format_32bppBGRA,  format_32bppPRGBA, STEP_SWAP_RB | STEP_PREMULTIPLY},
+    {format_32bppPBGRA, format_32bppBGRA,  STEP_UNPREMULTIPLY},
+    {format_32bppPBGRA, format_32bppRGBA,  STEP_SWAP_RB | STEP_UNPREMULTIPLY},
+    {format_32bppRGB,   format_32bppRGBA,  STEP_SET_ALPHA},
+    {format_32bppRGB,   format_32bppPRGBA, STEP_SET_ALPHA},
+    {format_32bppRGB,   format_32bppBGRA,  STEP_SET_ALPHA | STEP_SWAP_RB},
+    {format_32bppRGB,   format_32bppPBGRA, STEP_SET_ALPHA | STEP_SWAP_RB},
+    {format_32bppRGBA,  format_32bppPRGBA, STEP_PREMULTIPLY},
+    {format_32bppRGBA,  format_32bppBGRA,  STEP_SWAP_RB},
+    {format_32bppRGBA,  format_32bppBGR,   STEP_SWAP_RB},
+    {format_32bppRGBA,  format_32bppPBGRA, STEP_SWAP_RB | STEP_PREMULTIPLY},
+    {format_32bppPRGBA, format_32bppRGBA,  STEP_UNPREMULTIPLY},
+    {format_32bppPRGBA, format_32bppBGRA,  STEP_SWAP_RB | STEP_UNPREMULTIPLY},
+    {format_32bppBGR,   format_24bppBGR,   STEP_SHRINK_32BPP},
+    {format_32bppBGRA,  format_24bppBGR,   STEP_SHRINK_32BPP},
+    {format_32bppPBGRA, format_24bppBGR,   STEP_SHRINK_32BPP},
+    {format_32bppRGB,   format_24bppBGR,   STEP_SHRINK_32BPP | STEP_SWAP_RB},
+    {format_32bppRGBA,  format_24bppBGR,   STEP_SHRINK_32BPP | STEP_SWAP_RB},
+    {format_32bppPRGBA, format_24bppBGR,   STEP_SHRINK_32BPP | STEP_SWAP_RB},
+    {format_32bppBGR,   format_24bppRGB,   STEP_SHRINK_32BPP | STEP_SWAP_RB},
+    {format_32bppBGRA,  format_24bppRGB,   STEP_SHRINK_32BPP | STEP_SWAP_RB},
+    {format_32bppPBGRA, format_24bppRGB,   STEP_SHRINK_32BPP | STEP_SWAP_RB},
+    {format_32bppRGB,   format_24bppRGB,   STEP_SHRINK_32BPP},
+    {format_32bppRGBA,  format_24bppRGB,   STEP_SHRINK_32BPP},
+    {format_32bppPRGBA, format_24bppRGB,   STEP_SHRINK_32BPP},
+};
+
+static const struct conversion_plan *find_conversion_plan(enum pixelformat src, enum pixelformat dst)
+{
+    UINT i;
+
+    for (i = 0; i < ARRAY_SIZE(conversion_plans); i++)
+        if (conversion_plans[i].src == src && conversion_plans[i].dst == dst) return &conversion_plans[i];
+    return NULL;
+}
+
+static void expand_24bpp_row(const BYTE *src, BYTE *dst, UINT width, BOOL swap)
+{
+    UINT x = 0;
+
+#ifdef __ARM_NEON
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x3_t in = vld3q_u8(src + 3 * x);
+        uint8x16x4_t out;
+
+        out.val[0] = swap ? in.val[2] : in.val[0];
+        out.val[1] = in.val[1];
+        out.val[2] = swap ? in.val[0] : in.val[2];
+        out.val[3] = vdupq_n_u8(0xff);
+        vst4q_u8(dst + 4 * x, out);
+    }
+#endif
+    for (; x < width; x++)
+    {
+        dst[4 * x]     = src[3 * x + (swap ? 2 : 0)];
+        dst[4 * x + 1] = src[3 * x + 1];
+        dst[4 * x + 2] = src[3 * x + (swap ? 0 : 2)];
+        dst[4 * x + 3] = 0xff;
+    }
+}
+
+static void shrink_32bpp_row(const BYTE *src, BYTE *dst, UINT width, BOOL swap)
+{
+    UINT x = 0;
+
+#ifdef __ARM_NEON
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t in = vld4q_u8(src + 4 * x);
+        uint8x16x3_t out;
+
+        out.val[0] = swap ? in.val[2] : in.val[0];
+        out.val[1] = in.val[1];
+        out.val[2] = swap ? in.val[0] : in.val[2];
+        vst3q_u8(dst + 3 * x, out);
+    }
+#endif
+    for (; x < width; x++)
+    {
+        dst[3 * x]     = src[4 * x + (swap ? 2 : 0)];
+        dst[3 * x + 1] = src[4 * x + 1];
+        dst[3 * x + 2] = src[4 * x + (swap ? 0 : 2)];
+    }
+}
+
+static void swap_rb_row(BYTE *row, UINT width)
+{
+    DWORD *pixel = (DWORD *)row;
+    UINT x = 0;
+
+#ifdef __SSE2__
+    const __m128i ag = _mm_set1_epi32(0xff00ff00), b = _mm_set1_epi32(0xff);
+
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i *)(pixel + x));
+        p = _mm_or_si128(_mm_and_si128(p, ag),
+                         _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p, 16), b),
+                                      _mm_slli_epi32(_mm_and_si128(p, b), 16)));
+        _mm_storeu_si128((__m128i *)(pixel + x), p);
+    }
+#elif defined(__ARM_NEON)
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t p = vld4q_u8(row + 4 * x);
+        uint8x16_t tmp = p.val[0];
+
+        p.val[0] = p.val[2];
+        p.val[2] = tmp;
+        vst4q_u8(row + 4 * x, p);
+    }
+#endif
+    for (; x < width; x++)
+        pixel[x] = (pixel[x] & 0xff00ff00) | ((pixel[x] >> 16) & 0xff) | ((pixel[x] & 0xff) << 16);
+}
+
+static void set_alpha_row(BYTE *row, UINT width)
+{
+    DWORD *pixel = (DWORD *)row;
+    UINT x = 0;
+
+#ifdef __SSE2__
+    const __m128i alpha = _mm_set1_epi32(0xff000000);
+
+    for (; x + 4 <= width; x += 4)
+        _mm_storeu_si128((__m128i *)(pixel + x),
+                         _mm_or_si128(_mm_loadu_si128((const __m128i *)(pixel + x)), alpha));
+#endif
+    for (; x < width; x++) pixel[x] |= 0xff000000;
+}
+
+/* (c * alpha + 127) / 255, computed without a division */
+static inline BYTE premultiply_channel(BYTE c, BYTE alpha)
+{
+    UINT t = c * alpha + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+static void premultiply_row(BYTE *row, UINT width)
+{
+    UINT x = 0;
+
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128(), round = _mm_set1_epi16(128);
+    const __m128i alpha_mask = _mm_set1_epi32(0xff000000);
+
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i *)(row + 4 * x)), lo, hi, a;
+
+        lo = _mm_unpacklo_epi8(p, zero);
+        hi = _mm_unpackhi_epi8(p, zero);
+        a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(3,3,3,3));
+        lo = _mm_add_epi16(_mm_mullo_epi16(lo, a), round);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(3,3,3,3));
+        hi = _mm_add_epi16(_mm_mullo_epi16(hi, a), round);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        /* keep the original alpha */
+        p = _mm_or_si128(_mm_andnot_si128(alpha_mask, _mm_packus_epi16(lo, hi)), _mm_and_si128(p, alpha_mask));
+        _mm_storeu_si128((__m128i *)(row + 4 * x), p);
+    }
+#endif
+    for (; x < width; x++)
+    {
+        BYTE *pixel = row + 4 * x, alpha = pixel[3];
+
+        if (alpha == 255) continue;
+        pixel[0] = premultiply_channel(pixel[0], alpha);
+        pixel[1] = premultiply_channel(pixel[1], alpha);
+        pixel[2] = premultiply_channel(pixel[2], alpha);
+    }
+}
+
+static void unpremultiply_row(BYTE *row, UINT width)
+{
+    UINT x, last_alpha = 0, r = 0;
+
+    for (x = 0; x < width; x++)
+    {
+        BYTE *pixel = row + 4 * x, alpha = pixel[3];
+
+        if (alpha == 0 || alpha == 255) continue;
+        /* c * 255 / alpha == (c * r) >> 16 for all 8-bit values */
+        if (alpha != last_alpha)
+        {
+            r = (255 * 65536 + alpha - 1) / alpha;
+            last_alpha = alpha;
+        }
+        pixel[0] = (pixel[0] * r) >> 16;
+        pixel[1] = (pixel[1] * r) >> 16;
+        pixel[2] = (pixel[2] * r) >> 16;
+    }
+}
+
+static void apply_inplace_steps(BYTE *row, UINT width, UINT steps)
+{
+    if (steps & STEP_SET_ALPHA) set_alpha_row(row, width);
+    if (steps & STEP_UNPREMULTIPLY) unpremultiply_row(row, width);
+    if (steps & STEP_SWAP_RB) swap_rb_row(row, width);
+    if (steps & STEP_PREMULTIPLY) premultiply_row(row, width);
+}
+
+static HRESULT copypixels_planned(struct FormatConverter *This, const WICRect *prc,
+    UINT cbStride, UINT cbBufferSize, BYTE *pbBuffer, UINT steps)
+{
+    UINT src_bpp, src_stride, strip_rows, y, i;
+    HRESULT hr = S_OK;
+    BYTE *strip;
+    WICRect rc;
+
+    if (!(steps & (STEP_EXPAND_24BPP | STEP_SHRINK_32BPP)))
+    {
+        hr = IWICBitmapSource_CopyPixels(This->source, prc, cbStride, cbBufferSize, pbBuffer);
+        if (FAILED(hr)) return hr;
+
+        for (y = 0; y < prc->Height; y++)
+            apply_inplace_steps(pbBuffer + cbStride * y, prc->Width, steps);
+        return S_OK;
+    }
+
+    src_bpp = steps & STEP_EXPAND_24BPP ? 3 : 4;
+    src_stride = src_bpp * prc->Width;
+    strip_rows = min(max(MAX_STRIP_BYTES / src_stride, 1), prc->Height);
+    if (!(strip = malloc(strip_rows * src_stride))) return E_OUTOFMEMORY;
+
+    rc = *prc;
+    for (y = 0; y < prc->Height; y += rc.Height)
+    {
+        rc.Y = prc->Y + y;
+        rc.Height = min(strip_rows, prc->Height - y);
+        hr = IWICBitmapSource_CopyPixels(This->source, &rc, src_stride, rc.Height * src_stride, strip);
+        if (FAILED(hr)) break;
+
+        for (i = 0; i < rc.Height; i++)
+        {
+            BYTE *dst = pbBuffer + cbStride * (y + i);
+
+            if (steps & STEP_EXPAND_24BPP)
+                expand_24bpp_row(strip + src_stride * i, dst, prc->Width, steps & STEP_SWAP_RB);
+            else
+                shrink_32bpp_row(strip + src_stride * i, dst, prc->Width, steps & STEP_SWAP_RB);
+        }
+    }
+
+    free(strip);
+    return hr;
+}
+
 static const struct pixelformatinfo supported_formats[] = {
     {format_1bppIndexed, &GUID_WICPixelFormat1bppIndexed, NULL, TRUE},
     {format_2bppIndexed, &GUID_WICPixelFormat2bppIndexed, NULL, TRUE},
@@ -1728,6 +2022,9 @@ static HRESULT WINAPI FormatConverter_CopyPixels(IWICFormatConverter *iface,
             prc = &rc;
         }
 
+        if (This->plan)
+            return copypixels_planned(This, prc, cbStride, cbBufferSize, pbBuffer, This->plan->steps);
+
         return This->dst_format->copy_function(This, prc, cbStride, cbBufferSize,
             pbBuffer, This->src_format->format);
     }
@@ -1820,6 +2117,7 @@ static HRESULT WINAPI FormatConverter_Initialize(IWICFormatConverter *iface,
         IWICBitmapSource_AddRef(source);
         This->src_format = srcinfo;
         This->dst_format = dstinfo;
+        This->plan = find_conversion_plan(srcinfo->format, dstinfo->format);
         This->dither = dither;
         This->alpha_threshold = alpha_threshold;
         This->palette = palette;
@@ -1905,6 +2203,7 @@ HRESULT FormatConverter_CreateInstance(REFIID iid, void** ppv)
     This->IWICFormatConverter_iface.lpVtbl = &FormatConverter_Vtbl;
     This->ref = 1;
     This->source = NULL;
+    This->plan = NULL;
     This->palette = NULL;
     InitializeCriticalSectionEx(&This->lock, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO);
     This->lock.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": FormatConverter.lock");
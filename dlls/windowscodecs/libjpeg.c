@@ -78,8 +78,10 @@ struct jpeg_decoder {
     struct jpeg_error_mgr jerr;
     struct jpeg_source_mgr source_mgr;
     BYTE source_buffer[1024];
+    ULONGLONG source_pos;
     UINT stride;
     BYTE *image_data;
+    BOOL decode_failed;
 };
 
 static inline struct jpeg_decoder *impl_from_decoder(struct decoder* iface)
@@ -111,7 +113,10 @@ static boolean source_mgr_fill_input_buffer(j_decompress_ptr cinfo)
     HRESULT hr;
     ULONG bytesread;
 
-    hr = stream_read(This->stream, This->source_buffer, 1024, &bytesread);
+    /* scanlines are decoded on demand, so the stream may have been moved in between */
+    hr = stream_seek(This->stream, This->source_pos, STREAM_SEEK_SET, NULL);
+    if (SUCCEEDED(hr))
+        hr = stream_read(This->stream, This->source_buffer, 1024, &bytesread);
 
     if (FAILED(hr) || bytesread == 0)
     {
@@ -119,6 +124,7 @@ static boolean source_mgr_fill_input_buffer(j_decompress_ptr cinfo)
     }
     else
     {
+        This->source_pos += bytesread;
         This->source_mgr.next_input_byte = This->source_buffer;
         This->source_mgr.bytes_in_buffer = bytesread;
         return TRUE;
@@ -131,7 +137,7 @@ static void source_mgr_skip_input_data(j_decompress_ptr cinfo, long num_bytes)
 
     if (num_bytes > This->source_mgr.bytes_in_buffer)
     {
-        stream_seek(This->stream, num_bytes - This->source_mgr.bytes_in_buffer, STREAM_SEEK_CUR, NULL);
+        This->source_pos += num_bytes - This->source_mgr.bytes_in_buffer;
         This->source_mgr.bytes_in_buffer = 0;
     }
     else if (num_bytes > 0)
@@ -150,7 +156,7 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
     struct jpeg_decoder *This = impl_from_decoder(iface);
     int ret;
     jmp_buf jmpbuf;
-    UINT data_size, i;
+    UINT data_size;
 
     if (This->cinfo_initialized)
         return WINCODEC_ERR_WRONGSTATE;
@@ -172,8 +178,7 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
     This->cinfo_initialized = TRUE;
 
     This->stream = stream;
-
-    stream_seek(This->stream, 0, STREAM_SEEK_SET, NULL);
+    This->source_pos = 0;
 
     This->source_mgr.bytes_in_buffer = 0;
     This->source_mgr.init_source = source_mgr_init_source;
@@ -256,13 +261,45 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
     if (!This->image_data)
         return E_OUTOFMEMORY;
 
-    while (This->cinfo.output_scanline < This->cinfo.output_height)
+    st->frame_count = 1;
+    st->flags = WICBitmapDecoderCapabilityCanDecodeAllImages |
+                WICBitmapDecoderCapabilityCanDecodeSomeImages |
+                WICBitmapDecoderCapabilityCanEnumerateMetadata |
+                DECODER_FLAGS_UNSUPPORTED_COLOR_CONTEXT;
+    return S_OK;
+}
+
+static HRESULT CDECL jpeg_decoder_get_frame_info(struct decoder* iface, UINT frame, struct decoder_frame *info)
+{
+    struct jpeg_decoder *This = impl_from_decoder(iface);
+    *info = This->frame;
+    return S_OK;
+}
+
+/* Decode scanlines until at least the first end rows of the image are available. */
+static HRESULT jpeg_decoder_decode_rows(struct jpeg_decoder *This, UINT end)
+{
+    jmp_buf jmpbuf;
+    UINT first_scanline, max_rows, i;
+    JSAMPROW out_rows[4];
+    JDIMENSION ret;
+
+    if (This->cinfo.output_scanline >= end)
+        return S_OK;
+    if (This->decode_failed)
+        return E_FAIL;
+
+    This->cinfo.client_data = jmpbuf;
+
+    if (setjmp(jmpbuf))
     {
-        UINT first_scanline = This->cinfo.output_scanline;
-        UINT max_rows;
-        JSAMPROW out_rows[4];
-        JDIMENSION ret;
+        This->decode_failed = TRUE;
+        return E_FAIL;
+    }
 
+    while (This->cinfo.output_scanline < end)
+    {
+        first_scanline = This->cinfo.output_scanline;
         max_rows = min(This->cinfo.output_height-first_scanline, 4);
         for (i=0; i<max_rows; i++)
             out_rows[i] = This->image_data + This->stride * (first_scanline+i);
@@ -271,37 +308,24 @@ static HRESULT CDECL jpeg_decoder_initialize(struct decoder* iface, IStream *str
         if (ret == 0)
         {
             ERR("read_scanlines failed\n");
+            This->decode_failed = TRUE;
             return E_FAIL;
         }
-    }
 
-    if (This->frame.bpp == 24)
-    {
-        /* libjpeg gives us RGB data and we want BGR, so byteswap the data */
-        reverse_bgr8(3, This->image_data,
-            This->cinfo.output_width, This->cinfo.output_height,
-            This->stride);
-    }
+        if (This->frame.bpp == 24)
+        {
+            /* libjpeg gives us RGB data and we want BGR, so byteswap the data */
+            reverse_bgr8(3, out_rows[0], This->cinfo.output_width, ret, This->stride);
+        }
 
-    if (This->cinfo.out_color_space == JCS_CMYK && This->cinfo.saw_Adobe_marker)
-    {
-        /* Adobe JPEG's have inverted CMYK data. */
-        for (i=0; i<data_size; i++)
-            This->image_data[i] ^= 0xff;
+        if (This->cinfo.out_color_space == JCS_CMYK && This->cinfo.saw_Adobe_marker)
+        {
+            /* Adobe JPEG's have inverted CMYK data. */
+            for (i=0; i<This->stride * ret; i++)
+                out_rows[0][i] ^= 0xff;
+        }
     }
 
-    st->frame_count = 1;
-    st->flags = WICBitmapDecoderCapabilityCanDecodeAllImages |
-                WICBitmapDecoderCapabilityCanDecodeSomeImages |
-                WICBitmapDecoderCapabilityCanEnumerateMetadata |
-                DECODER_FLAGS_UNSUPPORTED_COLOR_CONTEXT;
-    return S_OK;
-}
-
-static HRESULT CDECL jpeg_decoder_get_frame_info(struct decoder* iface, UINT frame, struct decoder_frame *info)
-{
-    struct jpeg_decoder *This = impl_from_decoder(iface);
-    *info = This->frame;
     return S_OK;
 }
 
@@ -309,6 +333,16 @@ static HRESULT CDECL jpeg_decoder_copy_pixels(struct decoder* iface, UINT frame,
     const WICRect *prc, UINT stride, UINT buffersize, BYTE *buffer)
 {
     struct jpeg_decoder *This = impl_from_decoder(iface);
+    UINT end = This->frame.height;
+    HRESULT hr;
+
+    /* only decode as far as the bottom of the requested rectangle */
+    if (prc && prc->Y >= 0 && prc->Height >= 0 && prc->Y <= end && prc->Height <= end - prc->Y)
+        end = prc->Y + prc->Height;
+
+    hr = jpeg_decoder_decode_rows(This, end);
+    if (FAILED(hr)) return hr;
+
     return copy_pixels(This->frame.bpp, This->image_data,
         This->frame.width, This->frame.height, This->stride,
         prc, stride, buffersize, buffer);
@@ -351,6 +385,7 @@ HRESULT CDECL jpeg_decoder_create(struct decoder_info *info, struct decoder **re
     This->cinfo_initialized = FALSE;
     This->stream = NULL;
     This->image_data = NULL;
+    This->decode_failed = FALSE;
     *result = &This->decoder;
 
     info->container_format = GUID_ContainerFormatJpeg;
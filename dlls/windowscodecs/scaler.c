@@ -18,6 +18,12 @@
  */
 
 #include <stdarg.h>
+#include <math.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 #define COBJMACROS
 
@@ -31,6 +37,13 @@
 
 WINE_DEFAULT_DEBUG_CHANNEL(wincodecs);
 
+struct scaler_weights
+{
+    UINT taps;       /* filter taps per destination pixel */
+    int *start;      /* first source pixel of each destination pixel */
+    SHORT *weights;  /* taps weights per destination pixel, summing to 1 << WEIGHT_BITS */
+};
+
 typedef struct BitmapScaler {
     IWICBitmapScaler IWICBitmapScaler_iface;
     LONG ref;
@@ -42,6 +55,7 @@ typedef struct BitmapScaler {
     UINT bpp;
     void (*fn_get_required_source_rect)(struct BitmapScaler*,UINT,UINT,WICRect*);
     void (*fn_copy_scanline)(struct BitmapScaler*,UINT,UINT,UINT,BYTE**,UINT,UINT,BYTE*);
+    struct scaler_weights weights_x, weights_y; /* only used for filtered modes */
     CRITICAL_SECTION lock; /* must be held when initialized */
 } BitmapScaler;
 
@@ -55,6 +69,14 @@ static inline BitmapScaler *impl_from_IMILBitmapScaler(IMILBitmapScaler *iface)
     return CONTAINING_RECORD(iface, BitmapScaler, IMILBitmapScaler_iface);
 }
 
+static void free_scaler_weights(struct scaler_weights *weights)
+{
+    free(weights->start);
+    free(weights->weights);
+    weights->start = NULL;
+    weights->weights = NULL;
+}
+
 static HRESULT WINAPI BitmapScaler_QueryInterface(IWICBitmapScaler *iface, REFIID iid,
     void **ppv)
 {
@@ -106,6 +128,8 @@ static ULONG WINAPI BitmapScaler_Release(IWICBitmapScaler *iface)
         This->lock.DebugInfo->Spare[0] = 0;
         DeleteCriticalSection(&This->lock);
         if (This->source) IWICBitmapSource_Release(This->source);
+        free_scaler_weights(&This->weights_x);
+        free_scaler_weights(&This->weights_y);
         free(This);
     }
 
@@ -203,6 +227,307 @@ static void NearestNeighbor_CopyScanline(BitmapScaler *This,
     }
 }
 
+/* Filtered scaling works on 8-bit channels in two separable passes.  Source rows are
+ * read in strips, filtered horizontally into a ring of intermediate rows holding the
+ * vertical filter taps, and combined vertically into each destination row, so memory
+ * use is bounded by the filter size rather than the image size. */
+
+#define WEIGHT_BITS       14
+#define INTERMEDIATE_BITS 6
+#define MAX_STRIP_BYTES   (4 * 1024 * 1024)
+
+static double cubic_filter(double x)
+{
+    static const double a = -0.5;
+
+    x = fabs(x);
+    if (x < 1.0) return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+    if (x < 2.0) return ((a * x - 5.0 * a) * x + 8.0 * a) * x - 4.0 * a;
+    return 0.0;
+}
+
+static double linear_filter(double x)
+{
+    x = fabs(x);
+    return x < 1.0 ? 1.0 - x : 0.0;
+}
+
+/* weight of source pixel j for a destination pixel centred on center */
+static double get_filter_weight(WICBitmapInterpolationMode mode, double center, double scale, int j)
+{
+    double lo, hi;
+
+    switch (mode)
+    {
+    case WICBitmapInterpolationModeLinear:
+        return linear_filter(j - center);
+    case WICBitmapInterpolationModeCubic:
+        return cubic_filter(j - center);
+    case WICBitmapInterpolationModeHighQualityCubic:
+        return cubic_filter((j - center) / scale);
+    case WICBitmapInterpolationModeFant:
+    default:
+        if (scale <= 1.0) return linear_filter(j - center);
+        /* area of the source pixel covered by the destination pixel */
+        lo = max(j - 0.5, center - scale / 2);
+        hi = min(j + 0.5, center + scale / 2);
+        return hi > lo ? hi - lo : 0.0;
+    }
+}
+
+static HRESULT init_scaler_weights(struct scaler_weights *weights, UINT src_size, UINT dst_size,
+    WICBitmapInterpolationMode mode)
+{
+    double scale = (double)src_size / dst_size, support, center, sum, *values;
+    int i, j, k, first, last, left, right, taps, total;
+
+    switch (mode)
+    {
+    case WICBitmapInterpolationModeLinear: support = 1.0; break;
+    case WICBitmapInterpolationModeCubic: support = 2.0; break;
+    case WICBitmapInterpolationModeHighQualityCubic: support = 2.0 * max(scale, 1.0); break;
+    default: support = scale > 1.0 ? scale / 2 + 0.5 : 1.0; break;
+    }
+
+    taps = min((int)ceil(2 * support) + 1, (int)src_size);
+    weights->taps = taps;
+    weights->start = malloc(dst_size * sizeof(*weights->start));
+    weights->weights = calloc(dst_size * taps, sizeof(*weights->weights));
+    values = malloc(taps * sizeof(*values));
+    if (!weights->start || !weights->weights || !values)
+    {
+        free(values);
+        return E_OUTOFMEMORY;
+    }
+
+    for (i = 0; i < dst_size; i++)
+    {
+        SHORT *w = weights->weights + i * taps;
+
+        /* only pixels strictly within the support have a non-zero weight */
+        center = (i + 0.5) * scale - 0.5;
+        left = (int)floor(center - support) + 1;
+        right = (int)ceil(center + support) - 1;
+
+        first = min(max(left, 0), (int)src_size - taps);
+        last = first + taps - 1;
+        memset(values, 0, taps * sizeof(*values));
+        sum = 0.0;
+        for (j = left; j <= right; j++)
+        {
+            double value = get_filter_weight(mode, center, scale, j);
+
+            /* pixels outside of the source repeat the edge */
+            k = min(max(j, first), last) - first;
+            values[k] += value;
+            sum += value;
+        }
+
+        weights->start[i] = first;
+        total = 0;
+        for (k = 0; k < taps; k++)
+        {
+            w[k] = floor(values[k] / sum * (1 << WEIGHT_BITS) + 0.5);
+            total += w[k];
+        }
+        /* make the weights sum to exactly one */
+        k = (int)min(max(center, first), last) - first;
+        w[k] += (1 << WEIGHT_BITS) - total;
+    }
+
+    free(values);
+    return S_OK;
+}
+
+/* filter one source row horizontally into an intermediate row */
+static void filter_row_horizontal(const BitmapScaler *This, const BYTE *src, UINT src_x,
+    UINT dst_x, UINT dst_width, SHORT *dst)
+{
+    const struct scaler_weights *weights = &This->weights_x;
+    UINT channels = This->bpp / 8, taps = weights->taps, i, c, k;
+    const int round = 1 << (WEIGHT_BITS - INTERMEDIATE_BITS - 1);
+
+#if defined(__SSE2__)
+    if (channels == 4)
+    {
+        const __m128i rnd = _mm_set1_epi32(round), zero = _mm_setzero_si128();
+
+        for (i = 0; i < dst_width; i++)
+        {
+            const SHORT *w = weights->weights + (dst_x + i) * taps;
+            const BYTE *p = src + (weights->start[dst_x + i] - src_x) * 4;
+            __m128i acc = rnd, px, wv;
+            DWORD p0, p1;
+
+            for (k = 0; k + 1 < taps; k += 2, p += 8)
+            {
+                memcpy(&p0, p, 4);
+                memcpy(&p1, p + 4, 4);
+                /* interleave the two pixels so that madd sums both taps for each channel */
+                px = _mm_unpacklo_epi8(_mm_unpacklo_epi8(_mm_cvtsi32_si128(p0), _mm_cvtsi32_si128(p1)), zero);
+                wv = _mm_set1_epi32((USHORT)w[k] | ((DWORD)(USHORT)w[k + 1] << 16));
+                acc = _mm_add_epi32(acc, _mm_madd_epi16(px, wv));
+            }
+            if (k < taps)
+            {
+                memcpy(&p0, p, 4);
+                px = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(p0), zero), zero);
+                acc = _mm_add_epi32(acc, _mm_madd_epi16(px, _mm_set1_epi32((USHORT)w[k])));
+            }
+            acc = _mm_srai_epi32(acc, WEIGHT_BITS - INTERMEDIATE_BITS);
+            _mm_storel_epi64((__m128i *)(dst + i * 4), _mm_packs_epi32(acc, acc));
+        }
+        return;
+    }
+#endif
+
+    for (i = 0; i < dst_width; i++)
+    {
+        const SHORT *w = weights->weights + (dst_x + i) * taps;
+        const BYTE *p = src + (weights->start[dst_x + i] - src_x) * channels;
+
+        for (c = 0; c < channels; c++)
+        {
+            int sum = round;
+
+            for (k = 0; k < taps; k++) sum += w[k] * p[k * channels + c];
+            dst[i * channels + c] = sum >> (WEIGHT_BITS - INTERMEDIATE_BITS);
+        }
+    }
+}
+
+static inline BYTE clamp_byte(int value)
+{
+    return value < 0 ? 0 : value > 255 ? 255 : value;
+}
+
+/* combine intermediate rows into a destination row */
+static void filter_rows_vertical(const SHORT **rows, const SHORT *w, UINT taps, UINT count, BYTE *dst)
+{
+    const int shift = WEIGHT_BITS + INTERMEDIATE_BITS, round = 1 << (shift - 1);
+    UINT i = 0, k;
+
+#if defined(__SSE2__)
+    const __m128i rnd = _mm_set1_epi32(round), zero = _mm_setzero_si128();
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i lo = rnd, hi = rnd, a, b, wv;
+
+        for (k = 0; k < taps; k += 2)
+        {
+            a = _mm_loadu_si128((const __m128i *)(rows[k] + i));
+            if (k + 1 < taps)
+            {
+                b = _mm_loadu_si128((const __m128i *)(rows[k + 1] + i));
+                wv = _mm_set1_epi32((USHORT)w[k] | ((DWORD)(USHORT)w[k + 1] << 16));
+            }
+            else
+            {
+                b = zero;
+                wv = _mm_set1_epi32((USHORT)w[k]);
+            }
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), wv));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), wv));
+        }
+        lo = _mm_srai_epi32(lo, shift);
+        hi = _mm_srai_epi32(hi, shift);
+        a = _mm_packs_epi32(lo, hi);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(a, a));
+    }
+#elif defined(__ARM_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        int32x4_t lo = vdupq_n_s32(round), hi = vdupq_n_s32(round);
+        int16x8_t a;
+
+        for (k = 0; k < taps; k++)
+        {
+            a = vld1q_s16(rows[k] + i);
+            lo = vmlal_n_s16(lo, vget_low_s16(a), w[k]);
+            hi = vmlal_n_s16(hi, vget_high_s16(a), w[k]);
+        }
+        a = vcombine_s16(vshrn_n_s32(lo, WEIGHT_BITS + INTERMEDIATE_BITS),
+                         vshrn_n_s32(hi, WEIGHT_BITS + INTERMEDIATE_BITS));
+        vst1_u8(dst + i, vqmovun_s16(a));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        int sum = round;
+
+        for (k = 0; k < taps; k++) sum += w[k] * rows[k][i];
+        dst[i] = clamp_byte(sum >> shift);
+    }
+}
+
+static HRESULT Filtered_CopyPixels(BitmapScaler *This, const WICRect *dest_rect, UINT stride, BYTE *buffer)
+{
+    const struct scaler_weights *wx = &This->weights_x, *wy = &This->weights_y;
+    UINT channels = This->bpp / 8, row_size = dest_rect->Width * channels;
+    UINT src_x, src_width, src_stride, strip_rows, y, k;
+    int row, next_row, strip_start = 0, strip_end = 0, last_row;
+    const SHORT **rows = NULL;
+    SHORT *ring = NULL;
+    BYTE *strip = NULL;
+    WICRect rc;
+    HRESULT hr = S_OK;
+
+    src_x = wx->start[dest_rect->X];
+    src_width = wx->start[dest_rect->X + dest_rect->Width - 1] + wx->taps - src_x;
+    src_stride = src_width * channels;
+    last_row = wy->start[dest_rect->Y + dest_rect->Height - 1] + wy->taps;
+    strip_rows = min(max(MAX_STRIP_BYTES / src_stride, 1), This->src_height);
+
+    ring = malloc(wy->taps * row_size * sizeof(*ring));
+    rows = malloc(wy->taps * sizeof(*rows));
+    strip = malloc(strip_rows * src_stride);
+    if (!ring || !rows || !strip)
+    {
+        hr = E_OUTOFMEMORY;
+        goto done;
+    }
+
+    next_row = wy->start[dest_rect->Y];
+    for (y = 0; y < dest_rect->Height; y++)
+    {
+        int first = wy->start[dest_rect->Y + y];
+
+        /* rows are filtered in order, and stay in the ring while they are needed */
+        if (next_row < first) next_row = first;
+        for (; next_row < first + (int)wy->taps; next_row++)
+        {
+            if (next_row >= strip_end || next_row < strip_start)
+            {
+                rc.X = src_x;
+                rc.Y = strip_start = next_row;
+                rc.Width = src_width;
+                rc.Height = min((int)strip_rows, last_row - next_row);
+                strip_end = strip_start + rc.Height;
+                hr = IWICBitmapSource_CopyPixels(This->source, &rc, src_stride, rc.Height * src_stride, strip);
+                if (FAILED(hr)) goto done;
+            }
+            filter_row_horizontal(This, strip + (next_row - strip_start) * src_stride, src_x,
+                dest_rect->X, dest_rect->Width, ring + (next_row % wy->taps) * row_size);
+        }
+
+        for (k = 0; k < wy->taps; k++)
+        {
+            row = first + k;
+            rows[k] = ring + (row % wy->taps) * row_size;
+        }
+        filter_rows_vertical(rows, wy->weights + (dest_rect->Y + y) * wy->taps, wy->taps, row_size,
+            buffer + stride * y);
+    }
+
+done:
+    free(strip);
+    free(rows);
+    free(ring);
+    return hr;
+}
+
 static HRESULT WINAPI BitmapScaler_CopyPixels(IWICBitmapScaler *iface,
     const WICRect *prc, UINT cbStride, UINT cbBufferSize, BYTE *pbBuffer)
 {
@@ -257,6 +582,12 @@ static HRESULT WINAPI BitmapScaler_CopyPixels(IWICBitmapScaler *iface,
         goto end;
     }
 
+    if (This->weights_x.weights)
+    {
+        hr = Filtered_CopyPixels(This, &dest_rect, cbStride, pbBuffer);
+        goto end;
+    }
+
     /* MSDN recommends calling CopyPixels once for each scanline from top to
      * bottom, and claims codecs optimize for this. Ideally, when called in this
      * way, we should avoid requesting a scanline from the source more than
@@ -312,6 +643,27 @@ end:
     return hr;
 }
 
+static BOOL is_8bit_channel_format(const WICPixelFormatGUID *format)
+{
+    static const WICPixelFormatGUID *formats[] =
+    {
+        &GUID_WICPixelFormat8bppGray,
+        &GUID_WICPixelFormat24bppBGR,
+        &GUID_WICPixelFormat24bppRGB,
+        &GUID_WICPixelFormat32bppBGR,
+        &GUID_WICPixelFormat32bppBGRA,
+        &GUID_WICPixelFormat32bppPBGRA,
+        &GUID_WICPixelFormat32bppRGB,
+        &GUID_WICPixelFormat32bppRGBA,
+        &GUID_WICPixelFormat32bppPRGBA,
+    };
+    UINT i;
+
+    for (i = 0; i < ARRAY_SIZE(formats); i++)
+        if (IsEqualGUID(format, formats[i])) return TRUE;
+    return FALSE;
+}
+
 static HRESULT WINAPI BitmapScaler_Initialize(IWICBitmapScaler *iface,
     IWICBitmapSource *pISource, UINT uiWidth, UINT uiHeight,
     WICBitmapInterpolationMode mode)
@@ -351,10 +703,38 @@ static HRESULT WINAPI BitmapScaler_Initialize(IWICBitmapScaler *iface,
     {
         switch (mode)
         {
+        case WICBitmapInterpolationModeLinear:
+        case WICBitmapInterpolationModeCubic:
+        case WICBitmapInterpolationModeFant:
+        case WICBitmapInterpolationModeHighQualityCubic:
+            if (is_8bit_channel_format(&src_pixelformat))
+            {
+                IWICBitmapSource_AddRef(pISource);
+                This->source = pISource;
+            }
+            else if (FAILED(WICConvertBitmapSource(&GUID_WICPixelFormat32bppBGRA, pISource, &This->source)))
+            {
+                WARN("can't convert %s for filtering, using nearest neighbor\n", debugstr_guid(&src_pixelformat));
+                goto nearest_neighbor;
+            }
+            else This->bpp = 32;
+
+            hr = init_scaler_weights(&This->weights_x, This->src_width, This->width, mode);
+            if (SUCCEEDED(hr))
+                hr = init_scaler_weights(&This->weights_y, This->src_height, This->height, mode);
+            if (FAILED(hr))
+            {
+                free_scaler_weights(&This->weights_x);
+                free_scaler_weights(&This->weights_y);
+                IWICBitmapSource_Release(This->source);
+                This->source = NULL;
+            }
+            break;
         default:
             FIXME("unsupported mode %i\n", mode);
             /* fall-through */
         case WICBitmapInterpolationModeNearestNeighbor:
+        nearest_neighbor:
             if ((This->bpp % 8) == 0)
             {
                 IWICBitmapSource_AddRef(pISource);
@@ -527,6 +907,8 @@ HRESULT BitmapScaler_Create(IWICBitmapScaler **scaler)
     This->src_height = 0;
     This->mode = 0;
     This->bpp = 0;
+    memset(&This->weights_x, 0, sizeof(This->weights_x));
+    memset(&This->weights_y, 0, sizeof(This->weights_y));
     InitializeCriticalSectionEx(&This->lock, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO);
     This->lock.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": BitmapScaler.lock");
 
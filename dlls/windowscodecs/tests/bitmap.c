@@ -1318,6 +1318,96 @@ static void test_bitmap_scaler(void)
     IWICBitmap_Release(bitmap);
 }
 
+static void test_bitmap_scaler_modes(void)
+{
+    static const WICBitmapInterpolationMode modes[] =
+    {
+        WICBitmapInterpolationModeNearestNeighbor,
+        WICBitmapInterpolationModeLinear,
+        WICBitmapInterpolationModeCubic,
+        WICBitmapInterpolationModeFant,
+        WICBitmapInterpolationModeHighQualityCubic,
+    };
+    /* 4x2 image made of two 2x2 blocks */
+    static const BYTE checker[] =
+    {
+        0x00,0x00,0x00,0xff, 0x00,0x00,0x00,0xff, 0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,
+        0x00,0x00,0x00,0xff, 0x00,0x00,0x00,0xff, 0xff,0xff,0xff,0xff, 0xff,0xff,0xff,0xff,
+    };
+    BYTE solid[16 * 16 * 4], buf[32 * 32 * 4];
+    IWICBitmapScaler *scaler;
+    IWICBitmap *bitmap;
+    HRESULT hr;
+    UINT i, j;
+
+    for (i = 0; i < sizeof(solid); i += 4)
+    {
+        solid[i] = 0x12;
+        solid[i + 1] = 0x34;
+        solid[i + 2] = 0x56;
+        solid[i + 3] = 0xff;
+    }
+
+    hr = IWICImagingFactory_CreateBitmapFromMemory(factory, 16, 16, &GUID_WICPixelFormat32bppBGRA,
+        16 * 4, sizeof(solid), solid, &bitmap);
+    ok(hr == S_OK, "Failed to create a bitmap, hr %#lx.\n", hr);
+
+    for (i = 0; i < ARRAY_SIZE(modes); i++)
+    {
+        static const UINT sizes[] = { 1, 5, 16, 32 };
+        UINT size = sizes[i % ARRAY_SIZE(sizes)];
+
+        hr = IWICImagingFactory_CreateBitmapScaler(factory, &scaler);
+        ok(hr == S_OK, "Failed to create bitmap scaler, hr %#lx.\n", hr);
+        hr = IWICBitmapScaler_Initialize(scaler, (IWICBitmapSource *)bitmap, size, size, modes[i]);
+        ok(hr == S_OK, "mode %u: Failed to initialize bitmap scaler, hr %#lx.\n", modes[i], hr);
+
+        memset(buf, 0xcc, sizeof(buf));
+        hr = IWICBitmapScaler_CopyPixels(scaler, NULL, size * 4, sizeof(buf), buf);
+        ok(hr == S_OK, "mode %u: Failed to copy pixels, hr %#lx.\n", modes[i], hr);
+
+        /* a solid image stays solid whatever the filter */
+        for (j = 0; j < size * size * 4; j += 4)
+        {
+            if (memcmp(buf + j, solid, 4)) break;
+        }
+        ok(j == size * size * 4, "mode %u, size %u: unexpected colour at pixel %u.\n", modes[i], size, j / 4);
+
+        IWICBitmapScaler_Release(scaler);
+    }
+    IWICBitmap_Release(bitmap);
+
+    hr = IWICImagingFactory_CreateBitmapFromMemory(factory, 4, 2, &GUID_WICPixelFormat32bppBGRA,
+        4 * 4, sizeof(checker), (BYTE *)checker, &bitmap);
+    ok(hr == S_OK, "Failed to create a bitmap, hr %#lx.\n", hr);
+
+    /* averaging each 2x2 block gives back the block colours */
+    hr = IWICImagingFactory_CreateBitmapScaler(factory, &scaler);
+    ok(hr == S_OK, "Failed to create bitmap scaler, hr %#lx.\n", hr);
+    hr = IWICBitmapScaler_Initialize(scaler, (IWICBitmapSource *)bitmap, 2, 1, WICBitmapInterpolationModeFant);
+    ok(hr == S_OK, "Failed to initialize bitmap scaler, hr %#lx.\n", hr);
+    hr = IWICBitmapScaler_CopyPixels(scaler, NULL, 8, sizeof(buf), buf);
+    ok(hr == S_OK, "Failed to copy pixels, hr %#lx.\n", hr);
+    ok(*(DWORD *)buf == 0xff000000, "got %08lx.\n", *(DWORD *)buf);
+    ok(*(DWORD *)(buf + 4) == 0xffffffff, "got %08lx.\n", *(DWORD *)(buf + 4));
+    IWICBitmapScaler_Release(scaler);
+
+    /* the edge between the blocks is interpolated when upscaling */
+    hr = IWICImagingFactory_CreateBitmapScaler(factory, &scaler);
+    ok(hr == S_OK, "Failed to create bitmap scaler, hr %#lx.\n", hr);
+    hr = IWICBitmapScaler_Initialize(scaler, (IWICBitmapSource *)bitmap, 8, 2, WICBitmapInterpolationModeLinear);
+    ok(hr == S_OK, "Failed to initialize bitmap scaler, hr %#lx.\n", hr);
+    hr = IWICBitmapScaler_CopyPixels(scaler, NULL, 32, sizeof(buf), buf);
+    ok(hr == S_OK, "Failed to copy pixels, hr %#lx.\n", hr);
+    ok(*(DWORD *)buf == 0xff000000, "got %08lx.\n", *(DWORD *)buf);
+    ok(buf[3 * 4] > 0x00 && buf[3 * 4] < buf[4 * 4] && buf[4 * 4] < 0xff, "got %02x, %02x.\n",
+        buf[3 * 4], buf[4 * 4]);
+    ok(*(DWORD *)(buf + 7 * 4) == 0xffffffff, "got %08lx.\n", *(DWORD *)(buf + 7 * 4));
+    IWICBitmapScaler_Release(scaler);
+
+    IWICBitmap_Release(bitmap);
+}
+
 static LONG obj_refcount(void *obj)
 {
     IUnknown_AddRef((IUnknown *)obj);
@@ -1494,6 +1584,7 @@ START_TEST(bitmap)
     test_CreateBitmapFromHBITMAP();
     test_clipper();
     test_bitmap_scaler();
+    test_bitmap_scaler_modes();
 
     IWICImagingFactory_Release(factory);
 
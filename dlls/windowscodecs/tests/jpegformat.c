@@ -55,6 +55,7 @@ static void test_decode_adobe_cmyk(void)
     IStream *jpegstream;
     GUID guidresult;
     UINT count=0, width=0, height=0;
+    WICRect rc;
     BYTE imagedata[5 * 4] = {1};
     UINT i;
 
@@ -121,6 +122,18 @@ static void test_decode_adobe_cmyk(void)
                     broken(IsEqualGUID(&guidresult, &GUID_WICPixelFormat24bppBGR)), /* xp/2003 */
                     "unexpected pixel format: %s\n", wine_dbgstr_guid(&guidresult));
 
+                /* Part of the image can be read before the rest is decoded */
+                rc.X = 0;
+                rc.Y = 1;
+                rc.Width = 1;
+                rc.Height = 2;
+                memset(imagedata, 0, sizeof(imagedata));
+                hr = IWICBitmapFrameDecode_CopyPixels(framedecode, &rc, 4, sizeof(imagedata), imagedata);
+                ok(SUCCEEDED(hr), "CopyPixels failed, hr=%lx\n", hr);
+                ok(!memcmp(imagedata, expected_imagedata + 4, 8) ||
+                        broken(!memcmp(imagedata, expected_imagedata_24bpp + 4, 8)), /* xp/2003 */
+                        "unexpected image data\n");
+
                 /* We want to be sure our state tracking will not impact output
                  * data on subsequent calls */
                 for(i=2; i>0; --i)
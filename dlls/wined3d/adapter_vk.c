@@ -389,6 +389,89 @@ static void get_physical_device_info(const struct wined3d_adapter_vk *adapter_vk
         VK_CALL(vkGetPhysicalDeviceFeatures(physical_device, &features2->features));
 }
 
+static bool wined3d_device_vk_get_pipeline_cache_name(const struct wined3d_adapter_vk *adapter_vk,
+        char *name, size_t size)
+{
+    const struct wined3d_vk_info *vk_info = &adapter_vk->vk_info;
+    VkPhysicalDeviceProperties properties;
+    char app_name[MAX_PATH];
+    unsigned int i;
+    int len;
+
+    if (!wined3d_get_app_name(app_name, ARRAY_SIZE(app_name)))
+        return false;
+
+    /* The driver validates the header of the data as well, but there's no
+     * point in loading data for a different device. */
+    VK_CALL(vkGetPhysicalDeviceProperties(adapter_vk->physical_device, &properties));
+    len = snprintf(name, size, "%s-%04x-%04x-", app_name, properties.vendorID, properties.deviceID);
+    if (len < 0 || len + 2 * VK_UUID_SIZE + sizeof(".vkpc") > size)
+        return false;
+    for (i = 0; i < VK_UUID_SIZE; ++i)
+        len += sprintf(name + len, "%02x", properties.pipelineCacheUUID[i]);
+    strcpy(name + len, ".vkpc");
+
+    return true;
+}
+
+static void wined3d_device_vk_create_pipeline_cache(struct wined3d_device_vk *device_vk,
+        const struct wined3d_adapter_vk *adapter_vk)
+{
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    VkPipelineCacheCreateInfo cache_info;
+    size_t data_size = 0;
+    void *data = NULL;
+    VkResult vr;
+
+    if (wined3d_device_vk_get_pipeline_cache_name(adapter_vk,
+            device_vk->pipeline_cache_name, ARRAY_SIZE(device_vk->pipeline_cache_name)))
+        wined3d_shader_cache_load_blob(device_vk->pipeline_cache_name, &data, &data_size);
+    else
+        device_vk->pipeline_cache_name[0] = 0;
+
+    cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    cache_info.pNext = NULL;
+    cache_info.flags = 0;
+    cache_info.initialDataSize = data_size;
+    cache_info.pInitialData = data;
+    if ((vr = VK_CALL(vkCreatePipelineCache(device_vk->vk_device,
+            &cache_info, NULL, &device_vk->vk_pipeline_cache))) < 0 && data)
+    {
+        WARN("Failed to create pipeline cache from %Iu bytes, vr %s.\n", data_size, wined3d_debug_vkresult(vr));
+        cache_info.initialDataSize = 0;
+        cache_info.pInitialData = NULL;
+        vr = VK_CALL(vkCreatePipelineCache(device_vk->vk_device, &cache_info, NULL, &device_vk->vk_pipeline_cache));
+    }
+    if (vr < 0)
+    {
+        WARN("Failed to create pipeline cache, vr %s.\n", wined3d_debug_vkresult(vr));
+        device_vk->vk_pipeline_cache = VK_NULL_HANDLE;
+    }
+    free(data);
+}
+
+static void wined3d_device_vk_destroy_pipeline_cache(struct wined3d_device_vk *device_vk)
+{
+    const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
+    size_t data_size;
+    void *data;
+
+    if (!device_vk->vk_pipeline_cache)
+        return;
+
+    if (device_vk->pipeline_cache_name[0]
+            && VK_CALL(vkGetPipelineCacheData(device_vk->vk_device, device_vk->vk_pipeline_cache,
+            &data_size, NULL)) == VK_SUCCESS && data_size && (data = malloc(data_size)))
+    {
+        if (VK_CALL(vkGetPipelineCacheData(device_vk->vk_device, device_vk->vk_pipeline_cache,
+                &data_size, data)) == VK_SUCCESS)
+            wined3d_shader_cache_save_blob(device_vk->pipeline_cache_name, data, data_size);
+        free(data);
+    }
+
+    VK_CALL(vkDestroyPipelineCache(device_vk->vk_device, device_vk->vk_pipeline_cache, NULL));
+}
+
 static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wined3d_adapter *adapter,
         enum wined3d_device_type device_type, HWND focus_window, unsigned int flags, BYTE surface_alignment,
         const enum wined3d_feature_level *levels, unsigned int level_count,
@@ -472,10 +555,13 @@ static HRESULT adapter_vk_create_device(struct wined3d *wined3d, const struct wi
         goto fail;
     }
 
+    wined3d_device_vk_create_pipeline_cache(device_vk, adapter_vk);
+
     if (FAILED(hr = wined3d_device_init(&device_vk->d, wined3d, adapter->ordinal, device_type, focus_window,
             flags, surface_alignment, levels, level_count, vk_info->supported, device_parent)))
     {
         WARN("Failed to initialize device, hr %#lx.\n", hr);
+        VK_CALL(vkDestroyPipelineCache(vk_device, device_vk->vk_pipeline_cache, NULL));
         wined3d_allocator_cleanup(&device_vk->allocator);
         goto fail;
     }
@@ -498,6 +584,7 @@ static void adapter_vk_destroy_device(struct wined3d_device *device)
     const struct wined3d_vk_info *vk_info = &device_vk->vk_info;
 
     wined3d_device_cleanup(&device_vk->d);
+    wined3d_device_vk_destroy_pipeline_cache(device_vk);
     wined3d_allocator_cleanup(&device_vk->allocator);
 
     wined3d_lock_cleanup(&device_vk->allocator_cs);
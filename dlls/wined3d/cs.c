@@ -734,6 +734,15 @@ static void wined3d_cs_exec_present(struct wined3d_cs *cs, const void *data)
         SetEvent(cs->present_event);
 }
 
+static void wined3d_cs_dump_stats(struct wined3d_cs *cs)
+{
+    TRACE_(d3d_perf)("Frame statistics: %ld stalls, %ld coalesced packets, queue fill %lu bytes, "
+            "%ld spins, %ld waits, spin limit %u.\n",
+            InterlockedExchange(&cs->stats.stalls, 0), InterlockedExchange(&cs->stats.coalesced, 0),
+            InterlockedExchange((LONG *)&cs->stats.max_fill, 0), InterlockedExchange(&cs->stats.spins, 0),
+            InterlockedExchange(&cs->stats.waits, 0), cs->spin_limit);
+}
+
 void wined3d_cs_emit_present(struct wined3d_cs *cs, struct wined3d_swapchain *swapchain,
         const RECT *src_rect, const RECT *dst_rect, HWND dst_window_override,
         unsigned int swap_interval, uint32_t flags)
@@ -763,6 +772,9 @@ void wined3d_cs_emit_present(struct wined3d_cs *cs, struct wined3d_swapchain *sw
 
     wined3d_device_context_submit(&cs->c, WINED3D_CS_QUEUE_DEFAULT);
 
+    if (cs->thread && TRACE_ON(d3d_perf))
+        wined3d_cs_dump_stats(cs);
+
     /* Limit input latency by limiting the number of presents that we can get
      * ahead of the worker thread. */
     while (pending >= swapchain->max_frame_latency)
@@ -3158,6 +3170,7 @@ static void wined3d_cs_queue_submit(struct wined3d_cs_queue *queue, struct wined
     packet = (struct wined3d_cs_packet *)&queue->data[queue->head & WINED3D_CS_QUEUE_MASK];
     TRACE("Queuing op %s at %p.\n", debug_cs_op(*(const enum wined3d_cs_op *)packet->data), packet);
     packet_size = FIELD_OFFSET(struct wined3d_cs_packet, data[packet->size]);
+    queue->prev_head = queue->head;
     InterlockedExchange((LONG *)&queue->head, queue->head + packet_size);
 
     if (InterlockedCompareExchange(&cs->waiting_for_event, FALSE, TRUE))
@@ -3169,14 +3182,71 @@ static void wined3d_cs_queue_submit(struct wined3d_cs_queue *queue, struct wined
     }
 }
 
+/* A state packet identical to the one submitted right before it has no
+ * effect, so it doesn't need to be executed. */
+static bool wined3d_cs_packet_is_redundant(const struct wined3d_cs_packet *packet,
+        const struct wined3d_cs_packet *prev)
+{
+    if (!packet->size || packet->size != prev->size)
+        return false;
+
+    switch (*(const enum wined3d_cs_op *)packet->data)
+    {
+        case WINED3D_CS_OP_SET_VIEWPORTS:
+        case WINED3D_CS_OP_SET_SCISSOR_RECTS:
+        case WINED3D_CS_OP_SET_VERTEX_DECLARATION:
+        case WINED3D_CS_OP_SET_SHADER:
+        case WINED3D_CS_OP_SET_BLEND_STATE:
+        case WINED3D_CS_OP_SET_DEPTH_STENCIL_STATE:
+        case WINED3D_CS_OP_SET_RASTERIZER_STATE:
+        case WINED3D_CS_OP_SET_DEPTH_BOUNDS:
+        case WINED3D_CS_OP_SET_RENDER_STATE:
+        case WINED3D_CS_OP_SET_TEXTURE_STATE:
+        case WINED3D_CS_OP_SET_TRANSFORM:
+        case WINED3D_CS_OP_SET_CLIP_PLANE:
+            break;
+
+        default:
+            return false;
+    }
+
+    return !memcmp(packet->data, prev->data, packet->size);
+}
+
+/* The previous packet is only read; it can't be overwritten before the
+ * current packet is submitted. */
+static bool wined3d_cs_queue_packet_is_redundant(const struct wined3d_cs_queue *queue)
+{
+    if (queue->prev_head == queue->head)
+        return false;
+
+    return wined3d_cs_packet_is_redundant(
+            (const struct wined3d_cs_packet *)&queue->data[queue->head & WINED3D_CS_QUEUE_MASK],
+            (const struct wined3d_cs_packet *)&queue->data[queue->prev_head & WINED3D_CS_QUEUE_MASK]);
+}
+
 static void wined3d_cs_mt_submit(struct wined3d_device_context *context, enum wined3d_cs_queue_id queue_id)
 {
     struct wined3d_cs *cs = wined3d_cs_from_context(context);
+    struct wined3d_cs_queue *queue;
+    ULONG fill;
 
     if (cs->thread_id == GetCurrentThreadId())
         return wined3d_cs_st_submit(context, queue_id);
 
-    wined3d_cs_queue_submit(&cs->queue[queue_id], cs);
+    queue = &cs->queue[queue_id];
+    if (wined3d_cs_queue_packet_is_redundant(queue))
+    {
+        TRACE("Dropping redundant packet at %p.\n", &queue->data[queue->head & WINED3D_CS_QUEUE_MASK]);
+        ++cs->stats.coalesced;
+        return;
+    }
+
+    wined3d_cs_queue_submit(queue, cs);
+
+    fill = queue->head - *(volatile ULONG *)&queue->tail;
+    if (fill > cs->stats.max_fill)
+        cs->stats.max_fill = fill;
 }
 
 static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size_t size, struct wined3d_cs *cs)
@@ -3185,6 +3255,7 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
     size_t header_size, packet_size, remaining;
     struct wined3d_cs_packet *packet;
     ULONG head = queue->head & WINED3D_CS_QUEUE_MASK;
+    bool stalled;
 
     header_size = FIELD_OFFSET(struct wined3d_cs_packet, data[0]);
     packet_size = FIELD_OFFSET(struct wined3d_cs_packet, data[size]);
@@ -3213,7 +3284,7 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
         assert(!head);
     }
 
-    for (;;)
+    for (stalled = false;; stalled = true)
     {
         ULONG tail = (*(volatile ULONG *)&queue->tail) & WINED3D_CS_QUEUE_MASK;
         ULONG new_pos;
@@ -3235,6 +3306,9 @@ static void *wined3d_cs_queue_require_space(struct wined3d_cs_queue *queue, size
                 head, tail, packet_size);
     }
 
+    if (stalled)
+        InterlockedIncrement(&cs->stats.stalls);
+
     packet = (struct wined3d_cs_packet *)&queue->data[head];
     packet->size = size;
     return packet->data;
@@ -3260,6 +3334,8 @@ static void wined3d_cs_mt_finish(struct wined3d_device_context *context, enum wi
         return wined3d_cs_st_finish(context, queue_id);
 
     TRACE_(d3d_perf)("Waiting for queue %u to be empty.\n", queue_id);
+    if (cs->queue[queue_id].head != *(volatile ULONG *)&cs->queue[queue_id].tail)
+        InterlockedIncrement(&cs->stats.stalls);
     while (cs->queue[queue_id].head != *(volatile ULONG *)&cs->queue[queue_id].tail)
         wined3d_pause(&spin_count);
     TRACE_(d3d_perf)("Queue is now empty.\n");
@@ -3393,8 +3469,37 @@ static void wined3d_cs_exec_execute_command_list(struct wined3d_cs *cs, const vo
     }
 }
 
+/* Adapt the number of spins before waiting for commands to the measured
+ * command latency. Waits that end shortly after they started only add
+ * wake-up latency, so spin longer; if commands arrive early in the spin, or
+ * only after a long wait, spin less. */
+static void wined3d_cs_update_spin_limit(struct wined3d_cs *cs, unsigned int spin_count,
+        const LARGE_INTEGER *wait_start, const LARGE_INTEGER *frequency)
+{
+    unsigned int limit = cs->spin_limit;
+    LARGE_INTEGER now;
+
+    if (wait_start->QuadPart)
+    {
+        QueryPerformanceCounter(&now);
+        if ((now.QuadPart - wait_start->QuadPart) * 1000000 < WINED3D_CS_SHORT_WAIT_TIMEOUT * frequency->QuadPart)
+            cs->spin_limit = min(limit * 2, WINED3D_CS_MAX_SPIN_COUNT);
+        else
+            cs->spin_limit = max(limit - limit / 4, WINED3D_CS_MIN_SPIN_COUNT);
+        InterlockedIncrement(&cs->stats.waits);
+        spin_count = limit;
+    }
+    else if (spin_count * 4 < limit)
+    {
+        cs->spin_limit = max(limit - limit / 16, WINED3D_CS_MIN_SPIN_COUNT);
+    }
+
+    InterlockedExchangeAdd(&cs->stats.spins, spin_count);
+}
+
 static DWORD WINAPI wined3d_cs_run(void *ctx)
 {
+    LARGE_INTEGER frequency, wait_start = {{0}};
     struct wined3d_cs_queue *queue;
     unsigned int spin_count = 0;
     struct wined3d_cs *cs = ctx;
@@ -3411,6 +3516,7 @@ static DWORD WINAPI wined3d_cs_run(void *ctx)
 
     list_init(&cs->query_poll_list);
     cs->thread_id = GetCurrentThreadId();
+    QueryPerformanceFrequency(&frequency);
     while (run)
     {
         if (++poll == WINED3D_CS_QUERY_POLL_INTERVAL)
@@ -3428,17 +3534,28 @@ static DWORD WINAPI wined3d_cs_run(void *ctx)
             if (wined3d_cs_queue_is_empty(cs, queue))
             {
                 YieldProcessor();
-                if (++spin_count >= WINED3D_CS_SPIN_COUNT)
+                if (++spin_count >= cs->spin_limit)
                 {
                     if (poll)
+                    {
                         poll = WINED3D_CS_QUERY_POLL_INTERVAL - 1;
+                    }
                     else
+                    {
+                        if (!wait_start.QuadPart)
+                            QueryPerformanceCounter(&wait_start);
                         wined3d_cs_wait_event(cs);
+                    }
                 }
                 continue;
             }
         }
-        spin_count = 0;
+        if (spin_count)
+        {
+            wined3d_cs_update_spin_limit(cs, spin_count, &wait_start, &frequency);
+            wait_start.QuadPart = 0;
+            spin_count = 0;
+        }
 
         run = wined3d_cs_execute_next(cs, queue);
     }
@@ -3494,6 +3611,7 @@ struct wined3d_cs *wined3d_cs_create(struct wined3d_device *device,
 
     cs->c.ops = &wined3d_cs_st_ops;
     cs->c.device = device;
+    cs->spin_limit = WINED3D_CS_SPIN_COUNT;
     cs->serialize_commands = TRACE_ON(d3d_sync) || wined3d_settings.cs_multithreaded & WINED3D_CSMT_SERIALIZE;
 
     if (cs->serialize_commands)
@@ -4079,9 +4197,14 @@ struct wined3d_deferred_context
 
     SIZE_T data_size, data_capacity;
     void *data;
+    /* Offsets of the last submitted packet and of its end. */
+    SIZE_T last_packet, last_packet_end;
 
     SIZE_T resource_count, resources_capacity;
     struct wined3d_resource **resources;
+    /* Recently referenced resources, to avoid recording the same resource
+     * for every draw. Every entry is also in "resources". */
+    struct wined3d_resource *resource_cache[64];
 
     SIZE_T upload_count, uploads_capacity;
     struct wined3d_deferred_upload *uploads;
@@ -4133,7 +4256,18 @@ static void wined3d_deferred_context_submit(struct wined3d_device_context *conte
     struct wined3d_cs_packet *packet;
 
     assert(queue_id == WINED3D_CS_QUEUE_DEFAULT);
+    packet = (struct wined3d_cs_packet *)((BYTE *)deferred->data + deferred->data_size);
+    if (deferred->data_size && deferred->last_packet_end == deferred->data_size
+            && wined3d_cs_packet_is_redundant(packet,
+            (const struct wined3d_cs_packet *)((BYTE *)deferred->data + deferred->last_packet)))
+    {
+        TRACE("Dropping redundant packet at offset %Iu.\n", (size_t)deferred->data_size);
+        return;
+    }
+
+    deferred->last_packet = deferred->data_size;
     packet = wined3d_next_cs_packet(deferred->data, &deferred->data_size, ~(SIZE_T)0);
+    deferred->last_packet_end = deferred->data_size;
     wined3d_cs_packet_incref_objects(packet);
 }
 
@@ -4312,12 +4446,19 @@ static void wined3d_deferred_context_reference_resource(struct wined3d_device_co
         struct wined3d_resource *resource)
 {
     struct wined3d_deferred_context *deferred = wined3d_deferred_context_from_context(context);
+    ULONG_PTR idx = ((ULONG_PTR)resource >> 4) % ARRAY_SIZE(deferred->resource_cache);
+
+    /* Referencing the same resources again for every draw would only grow the
+     * list, and the reference count updates contend with other threads. */
+    if (deferred->resource_cache[idx] == resource)
+        return;
 
     if (!wined3d_array_reserve((void **)&deferred->resources, &deferred->resources_capacity,
             deferred->resource_count + 1, sizeof(*deferred->resources)))
         return;
 
     deferred->resources[deferred->resource_count++] = resource;
+    deferred->resource_cache[idx] = resource;
     wined3d_resource_incref(resource);
 }
 
@@ -4484,6 +4625,7 @@ HRESULT CDECL wined3d_deferred_context_record_command_list(struct wined3d_device
 
     deferred->data_size = 0;
     deferred->resource_count = 0;
+    memset(deferred->resource_cache, 0, sizeof(deferred->resource_cache));
     deferred->upload_count = 0;
     deferred->command_list_count = 0;
     deferred->query_count = 0;
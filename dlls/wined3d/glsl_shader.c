@@ -631,6 +631,135 @@ void shader_glsl_validate_link(const struct wined3d_gl_info *gl_info, GLuint pro
     print_glsl_info_log(gl_info, program, TRUE);
 }
 
+/* Context activation is done by the caller. The key covers the driver and
+ * the source of every attached shader, in attachment order. */
+static bool shader_glsl_init_program_cache_key(const struct wined3d_gl_info *gl_info,
+        GLuint program, bool dual_source, struct wined3d_shader_cache_key *key)
+{
+    static const GLenum driver_strings[] = {GL_VENDOR, GL_RENDERER, GL_VERSION};
+    GLint i, shader_count, source_size, max_source_size = 0;
+    GLuint shaders[8];
+    const char *str;
+    char *source;
+
+    GL_EXTCALL(glGetAttachedShaders(program, ARRAY_SIZE(shaders), &shader_count, shaders));
+    if (shader_count <= 0 || shader_count == ARRAY_SIZE(shaders))
+        return false;
+    for (i = 0; i < shader_count; ++i)
+    {
+        GL_EXTCALL(glGetShaderiv(shaders[i], GL_SHADER_SOURCE_LENGTH, &source_size));
+        max_source_size = max(max_source_size, source_size);
+    }
+    if (max_source_size <= 0 || !(source = malloc(max_source_size)))
+        return false;
+
+    wined3d_shader_cache_key_init(key, "glsl-program");
+    for (i = 0; i < ARRAY_SIZE(driver_strings); ++i)
+    {
+        if (!(str = (const char *)gl_info->gl_ops.gl.p_glGetString(driver_strings[i])))
+            str = "";
+        wined3d_shader_cache_key_add(key, str, strlen(str) + 1);
+    }
+    wined3d_shader_cache_key_add(key, &dual_source, sizeof(dual_source));
+    for (i = 0; i < shader_count; ++i)
+    {
+        GL_EXTCALL(glGetShaderSource(shaders[i], max_source_size, &source_size, source));
+        wined3d_shader_cache_key_add(key, source, source_size + 1);
+    }
+    free(source);
+    checkGLcall("shader_glsl_init_program_cache_key");
+
+    return key->valid;
+}
+
+/* Context activation is done by the caller. */
+static bool shader_glsl_load_program_binary(const struct wined3d_gl_info *gl_info,
+        GLuint program, const struct wined3d_shader_cache_key *key)
+{
+    GLint link_status;
+    size_t size;
+    GLenum format;
+    BYTE *data;
+
+    if (!wined3d_shader_cache_lookup(key, (void **)&data, &size))
+        return false;
+
+    if (size > sizeof(format))
+    {
+        memcpy(&format, data, sizeof(format));
+        GL_EXTCALL(glProgramBinary(program, format, data + sizeof(format), size - sizeof(format)));
+        GL_EXTCALL(glGetProgramiv(program, GL_LINK_STATUS, &link_status));
+        checkGLcall("glProgramBinary");
+    }
+    else
+    {
+        link_status = GL_FALSE;
+    }
+    free(data);
+
+    /* Drivers may reject binaries after an update, even with the same
+     * version string. The program is linked from source in that case. */
+    if (!link_status)
+        TRACE("Program binary for program %u was rejected.\n", program);
+    return link_status;
+}
+
+/* Context activation is done by the caller. */
+static void shader_glsl_store_program_binary(const struct wined3d_gl_info *gl_info,
+        GLuint program, const struct wined3d_shader_cache_key *key)
+{
+    GLint link_status, length = 0;
+    GLenum format;
+    BYTE *data;
+
+    GL_EXTCALL(glGetProgramiv(program, GL_LINK_STATUS, &link_status));
+    if (link_status)
+        GL_EXTCALL(glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length));
+    if (length <= 0 || !(data = malloc(sizeof(format) + length)))
+        return;
+
+    GL_EXTCALL(glGetProgramBinary(program, length, &length, &format, data + sizeof(format)));
+    checkGLcall("glGetProgramBinary");
+    if (length > 0)
+    {
+        memcpy(data, &format, sizeof(format));
+        wined3d_shader_cache_store(key, data, sizeof(format) + length);
+    }
+    free(data);
+}
+
+/* Context activation is done by the caller. Programs are reloaded from the
+ * shader cache when possible; programs using transform feedback are always
+ * linked, since the varyings are not part of the shader source. */
+static void shader_glsl_link_program(const struct wined3d_gl_info *gl_info,
+        GLuint program, bool cacheable, bool dual_source)
+{
+    struct wined3d_shader_cache_key key;
+
+    if (!gl_info->supported[ARB_GET_PROGRAM_BINARY] || !cacheable
+            || !shader_glsl_init_program_cache_key(gl_info, program, dual_source, &key))
+    {
+        TRACE("Linking GLSL shader program %u.\n", program);
+        GL_EXTCALL(glLinkProgram(program));
+        shader_glsl_validate_link(gl_info, program);
+        return;
+    }
+
+    if (shader_glsl_load_program_binary(gl_info, program, &key))
+    {
+        TRACE("Loaded GLSL shader program %u from the shader cache.\n", program);
+        wined3d_shader_cache_key_cleanup(&key);
+        return;
+    }
+
+    TRACE("Linking GLSL shader program %u.\n", program);
+    GL_EXTCALL(glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+    GL_EXTCALL(glLinkProgram(program));
+    shader_glsl_validate_link(gl_info, program);
+    shader_glsl_store_program_binary(gl_info, program, &key);
+    wined3d_shader_cache_key_cleanup(&key);
+}
+
 static struct vkd3d_shader_resource_binding *create_resource_bindings(const struct wined3d_gl_info *gl_info,
         enum wined3d_shader_type shader_type, unsigned int *count)
 {
@@ -10292,9 +10421,7 @@ static HRESULT shader_glsl_compile_compute_shader(struct shader_glsl_priv *priv,
 
     list_add_head(&shader->linked_programs, &entry->cs.shader_entry);
 
-    TRACE("Linking GLSL shader program %u.\n", program_id);
-    GL_EXTCALL(glLinkProgram(program_id));
-    shader_glsl_validate_link(gl_info, program_id);
+    shader_glsl_link_program(gl_info, program_id, true, false);
 
     GL_EXTCALL(glUseProgram(program_id));
     checkGLcall("glUseProgram");
@@ -10620,9 +10747,8 @@ static void set_glsl_shader_program(const struct wined3d_context_gl *context_gl,
     }
 
     /* Link the program */
-    TRACE("Linking GLSL shader program %u.\n", program_id);
-    GL_EXTCALL(glLinkProgram(program_id));
-    shader_glsl_validate_link(gl_info, program_id);
+    shader_glsl_link_program(gl_info, program_id, !gshader || !gshader->u.gs.so_desc,
+            state->blend_state && state->blend_state->dual_source);
 
     shader_glsl_init_vs_uniform_locations(gl_info, priv, program_id, &entry->vs,
             vshader ? vshader->limits->constant_float : 0);
@@ -0,0 +1,537 @@
+/*
+ * Persistent shader translation cache
+ *
+ * Copyright 2026 The Wine Project
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include "wined3d_private.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(d3d_shader);
+
+/* Translated shaders are stored as one file per entry, named after a 64-bit
+ * hash of the key. The complete key is stored in the file as well, so hash
+ * collisions only cost a recompilation. Files are written to a temporary name
+ * and renamed into place from a thread pool callback, so concurrent processes
+ * never see partial entries. When the directory grows beyond the configured
+ * size, the least recently used entries are removed. */
+
+#define WINED3D_SHADER_CACHE_MAGIC      0x43533357 /* "W3SC" */
+#define WINED3D_SHADER_CACHE_VERSION    1
+#define WINED3D_SHADER_CACHE_MAX_ENTRY  (16u * 1024 * 1024)
+
+struct wined3d_shader_cache_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t hash;
+    uint32_t key_size;
+    uint32_t data_size;
+    uint64_t checksum;
+};
+
+struct wined3d_shader_cache_write
+{
+    WCHAR filename[MAX_PATH];
+    size_t size;
+    BYTE data[];
+};
+
+static CRITICAL_SECTION wined3d_shader_cache_cs;
+static CRITICAL_SECTION_DEBUG wined3d_shader_cache_cs_debug =
+{
+    0, 0, &wined3d_shader_cache_cs,
+    {&wined3d_shader_cache_cs_debug.ProcessLocksList,
+    &wined3d_shader_cache_cs_debug.ProcessLocksList},
+    0, 0, {(DWORD_PTR)(__FILE__ ": wined3d_shader_cache_cs")}
+};
+static CRITICAL_SECTION wined3d_shader_cache_cs = {&wined3d_shader_cache_cs_debug, -1, 0, 0, 0, 0};
+
+static INIT_ONCE shader_cache_init_once = INIT_ONCE_STATIC_INIT;
+static WCHAR shader_cache_path[MAX_PATH];
+static BOOL shader_cache_enabled;
+static TP_CALLBACK_ENVIRON shader_cache_environment;
+
+/* Protected by wined3d_shader_cache_cs. */
+static ULONGLONG shader_cache_max_size;
+static ULONGLONG shader_cache_total_size;
+static BOOL shader_cache_size_known;
+
+static LONG shader_cache_hits, shader_cache_misses, shader_cache_writes;
+
+static uint64_t shader_cache_hash(uint64_t hash, const void *data, size_t size)
+{
+    const BYTE *p = data;
+    size_t i;
+
+    for (i = 0; i < size; ++i)
+    {
+        hash ^= p[i];
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+static BOOL shader_cache_create_directory(WCHAR *path)
+{
+    WCHAR *p;
+
+    /* Skip the drive or UNC prefix. */
+    if (!(p = wcschr(path, '\\')))
+        return FALSE;
+    while ((p = wcschr(p + 1, '\\')))
+    {
+        *p = 0;
+        CreateDirectoryW(path, NULL);
+        *p = '\\';
+    }
+
+    return CreateDirectoryW(path, NULL) || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
+static BOOL WINAPI shader_cache_init(INIT_ONCE *once, void *param, void **context)
+{
+    HMODULE module;
+    DWORD len;
+
+    if (!wined3d_settings.shader_cache_size)
+    {
+        TRACE("Shader cache disabled.\n");
+        return TRUE;
+    }
+
+    if (wined3d_settings.shader_cache_path)
+    {
+        if (!MultiByteToWideChar(CP_ACP, 0, wined3d_settings.shader_cache_path, -1,
+                shader_cache_path, ARRAY_SIZE(shader_cache_path)))
+            return TRUE;
+    }
+    else
+    {
+        static const WCHAR subdirW[] = L"\\wine\\wined3d_shader_cache";
+
+        len = GetEnvironmentVariableW(L"LOCALAPPDATA", shader_cache_path, ARRAY_SIZE(shader_cache_path));
+        if (!len || len + ARRAY_SIZE(subdirW) > ARRAY_SIZE(shader_cache_path))
+        {
+            WARN("Failed to get the local application data directory.\n");
+            return TRUE;
+        }
+        wcscat(shader_cache_path, subdirW);
+    }
+
+    if (!shader_cache_create_directory(shader_cache_path))
+    {
+        WARN("Failed to create shader cache directory %s, error %lu.\n",
+                debugstr_w(shader_cache_path), GetLastError());
+        return TRUE;
+    }
+
+    /* Keep the module loaded while writes are pending. */
+    GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+            (const WCHAR *)shader_cache_init, &module);
+    memset(&shader_cache_environment, 0, sizeof(shader_cache_environment));
+    shader_cache_environment.Version = 1;
+    shader_cache_environment.RaceDll = module;
+
+    shader_cache_max_size = (ULONGLONG)wined3d_settings.shader_cache_size * 1024 * 1024;
+    shader_cache_enabled = TRUE;
+    TRACE("Using shader cache %s, maximum size %u MiB.\n",
+            debugstr_w(shader_cache_path), wined3d_settings.shader_cache_size);
+
+    return TRUE;
+}
+
+static BOOL shader_cache_get_filename(uint64_t hash, WCHAR *filename, size_t count)
+{
+    int ret;
+
+    ret = _snwprintf(filename, count, L"%s\\%08x%08x.bin", shader_cache_path,
+            (unsigned int)(hash >> 32), (unsigned int)hash);
+    return ret > 0 && ret < count;
+}
+
+void wined3d_shader_cache_key_init(struct wined3d_shader_cache_key *key, const char *backend)
+{
+    memset(key, 0, sizeof(*key));
+    key->valid = true;
+    wined3d_shader_cache_key_add(key, backend, strlen(backend) + 1);
+}
+
+void wined3d_shader_cache_key_add(struct wined3d_shader_cache_key *key, const void *data, size_t size)
+{
+    if (!key->valid || !size)
+        return;
+
+    if (!wined3d_array_reserve((void **)&key->data, &key->size, key->count + size, 1))
+    {
+        key->valid = false;
+        return;
+    }
+    memcpy(key->data + key->count, data, size);
+    key->count += size;
+}
+
+void wined3d_shader_cache_key_cleanup(struct wined3d_shader_cache_key *key)
+{
+    free(key->data);
+}
+
+static uint64_t shader_cache_key_hash(const struct wined3d_shader_cache_key *key)
+{
+    return shader_cache_hash(0xcbf29ce484222325ull, key->data, key->count);
+}
+
+static int __cdecl shader_cache_file_compare(const void *a, const void *b)
+{
+    const WIN32_FIND_DATAW *f1 = a, *f2 = b;
+
+    return CompareFileTime(&f1->ftLastWriteTime, &f2->ftLastWriteTime);
+}
+
+/* Called with wined3d_shader_cache_cs held. When evicting, removes the least
+ * recently used entries until the cache is below three quarters of its maximum
+ * size. */
+static void shader_cache_scan(BOOL evict)
+{
+    WIN32_FIND_DATAW *files = NULL, data;
+    SIZE_T files_size = 0, count = 0, i;
+    WCHAR pattern[MAX_PATH];
+    ULONGLONG total = 0, file_size;
+    HANDLE find;
+
+    if (_snwprintf(pattern, ARRAY_SIZE(pattern), L"%s\\*.bin", shader_cache_path) < 0)
+        return;
+    if ((find = FindFirstFileW(pattern, &data)) == INVALID_HANDLE_VALUE)
+        return;
+    do
+    {
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            continue;
+        total += ((ULONGLONG)data.nFileSizeHigh << 32) | data.nFileSizeLow;
+        if (evict && wined3d_array_reserve((void **)&files, &files_size, count + 1, sizeof(*files)))
+            files[count++] = data;
+    } while (FindNextFileW(find, &data));
+    FindClose(find);
+
+    if (evict && total > shader_cache_max_size)
+    {
+        qsort(files, count, sizeof(*files), shader_cache_file_compare);
+        for (i = 0; i < count && total > shader_cache_max_size / 4 * 3; ++i)
+        {
+            if (_snwprintf(pattern, ARRAY_SIZE(pattern), L"%s\\%s", shader_cache_path, files[i].cFileName) < 0)
+                continue;
+            file_size = ((ULONGLONG)files[i].nFileSizeHigh << 32) | files[i].nFileSizeLow;
+            if (DeleteFileW(pattern))
+                total -= file_size;
+        }
+        TRACE("Evicted %Iu entries, cache size is now %s bytes.\n", i, wine_dbgstr_longlong(total));
+    }
+    free(files);
+
+    shader_cache_total_size = total;
+    shader_cache_size_known = TRUE;
+}
+
+static BOOL shader_cache_write_file(const WCHAR *filename, const void *data, size_t size)
+{
+    WCHAR tmp_filename[MAX_PATH];
+    HANDLE file;
+    DWORD written;
+    BOOL ret;
+
+    if (!GetTempFileNameW(shader_cache_path, L"w3d", 0, tmp_filename))
+    {
+        WARN("Failed to create temporary file, error %lu.\n", GetLastError());
+        return FALSE;
+    }
+
+    if ((file = CreateFileW(tmp_filename, GENERIC_WRITE, 0, NULL,
+            CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE)
+    {
+        DeleteFileW(tmp_filename);
+        return FALSE;
+    }
+    ret = WriteFile(file, data, size, &written, NULL) && written == size;
+    CloseHandle(file);
+
+    if (!ret || !MoveFileExW(tmp_filename, filename, MOVEFILE_REPLACE_EXISTING))
+    {
+        WARN("Failed to write %s, error %lu.\n", debugstr_w(filename), GetLastError());
+        DeleteFileW(tmp_filename);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static void CALLBACK shader_cache_write_cb(TP_CALLBACK_INSTANCE *instance, void *ctx)
+{
+    struct wined3d_shader_cache_write *write = ctx;
+
+    if (!shader_cache_write_file(write->filename, write->data, write->size))
+    {
+        free(write);
+        return;
+    }
+    InterlockedIncrement(&shader_cache_writes);
+
+    EnterCriticalSection(&wined3d_shader_cache_cs);
+    if (!shader_cache_size_known)
+        shader_cache_scan(FALSE);
+    else
+        shader_cache_total_size += write->size;
+    if (shader_cache_total_size > shader_cache_max_size)
+        shader_cache_scan(TRUE);
+    LeaveCriticalSection(&wined3d_shader_cache_cs);
+
+    free(write);
+}
+
+bool wined3d_shader_cache_lookup(const struct wined3d_shader_cache_key *key, void **data, size_t *size)
+{
+    struct wined3d_shader_cache_header header;
+    WCHAR filename[MAX_PATH];
+    LARGE_INTEGER file_size;
+    BYTE *buffer = NULL;
+    FILETIME now;
+    uint64_t hash;
+    HANDLE file;
+    DWORD read;
+    bool ret = false;
+
+    InitOnceExecuteOnce(&shader_cache_init_once, shader_cache_init, NULL, NULL);
+    if (!shader_cache_enabled || !key->valid)
+        return false;
+
+    hash = shader_cache_key_hash(key);
+    if (!shader_cache_get_filename(hash, filename, ARRAY_SIZE(filename)))
+        return false;
+
+    if ((file = CreateFileW(filename, GENERIC_READ | FILE_WRITE_ATTRIBUTES,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE)
+    {
+        TRACE("Cache miss for %s.\n", wine_dbgstr_longlong(hash));
+        InterlockedIncrement(&shader_cache_misses);
+        return false;
+    }
+
+    if (!GetFileSizeEx(file, &file_size)
+            || !ReadFile(file, &header, sizeof(header), &read, NULL) || read != sizeof(header)
+            || header.magic != WINED3D_SHADER_CACHE_MAGIC || header.version != WINED3D_SHADER_CACHE_VERSION
+            || header.hash != hash || header.key_size != key->count
+            || header.data_size > WINED3D_SHADER_CACHE_MAX_ENTRY
+            || file_size.QuadPart != sizeof(header) + header.key_size + (ULONGLONG)header.data_size)
+    {
+        WARN("Invalid cache entry %s.\n", debugstr_w(filename));
+        goto done;
+    }
+
+    if (!(buffer = malloc(header.key_size + header.data_size)))
+        goto done;
+    if (!ReadFile(file, buffer, header.key_size + header.data_size, &read, NULL)
+            || read != header.key_size + header.data_size
+            || shader_cache_hash(hash, buffer, read) != header.checksum)
+    {
+        WARN("Corrupted cache entry %s.\n", debugstr_w(filename));
+        goto done;
+    }
+
+    if (memcmp(buffer, key->data, key->count))
+    {
+        TRACE("Hash collision for %s.\n", wine_dbgstr_longlong(hash));
+        goto done;
+    }
+
+    if (!(*data = malloc(header.data_size)))
+        goto done;
+    memcpy(*data, buffer + header.key_size, header.data_size);
+    *size = header.data_size;
+    ret = true;
+
+    /* The modification time doubles as the last use time for eviction. */
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file, NULL, NULL, &now);
+
+done:
+    free(buffer);
+    CloseHandle(file);
+    if (ret)
+    {
+        TRACE("Cache hit for %s, %Iu bytes.\n", wine_dbgstr_longlong(hash), *size);
+        InterlockedIncrement(&shader_cache_hits);
+    }
+    else
+    {
+        InterlockedIncrement(&shader_cache_misses);
+    }
+    return ret;
+}
+
+void wined3d_shader_cache_store(const struct wined3d_shader_cache_key *key, const void *data, size_t size)
+{
+    struct wined3d_shader_cache_header *header;
+    struct wined3d_shader_cache_write *write;
+    uint64_t hash;
+    BYTE *p;
+
+    InitOnceExecuteOnce(&shader_cache_init_once, shader_cache_init, NULL, NULL);
+    if (!shader_cache_enabled || !key->valid || size > WINED3D_SHADER_CACHE_MAX_ENTRY)
+        return;
+
+    if (!(write = malloc(offsetof(struct wined3d_shader_cache_write, data[sizeof(*header) + key->count + size]))))
+        return;
+
+    hash = shader_cache_key_hash(key);
+    if (!shader_cache_get_filename(hash, write->filename, ARRAY_SIZE(write->filename)))
+    {
+        free(write);
+        return;
+    }
+
+    header = (struct wined3d_shader_cache_header *)write->data;
+    p = (BYTE *)(header + 1);
+    memcpy(p, key->data, key->count);
+    memcpy(p + key->count, data, size);
+
+    header->magic = WINED3D_SHADER_CACHE_MAGIC;
+    header->version = WINED3D_SHADER_CACHE_VERSION;
+    header->hash = hash;
+    header->key_size = key->count;
+    header->data_size = size;
+    header->checksum = shader_cache_hash(hash, p, key->count + size);
+    write->size = sizeof(*header) + key->count + size;
+
+    if (!TrySubmitThreadpoolCallback(shader_cache_write_cb, write, &shader_cache_environment))
+        shader_cache_write_cb(NULL, write);
+}
+
+/* Named blobs, such as Vulkan pipeline caches, are stored next to the shader
+ * entries. They are validated by their users and not subject to eviction. */
+static BOOL shader_cache_get_blob_filename(const char *name, WCHAR *filename, size_t count)
+{
+    size_t len = wcslen(shader_cache_path);
+
+    if (len + 1 >= count)
+        return FALSE;
+    memcpy(filename, shader_cache_path, len * sizeof(WCHAR));
+    filename[len++] = '\\';
+    return !!MultiByteToWideChar(CP_ACP, 0, name, -1, filename + len, count - len);
+}
+
+bool wined3d_shader_cache_load_blob(const char *name, void **data, size_t *size)
+{
+    WCHAR filename[MAX_PATH];
+    LARGE_INTEGER file_size;
+    HANDLE file;
+    DWORD read;
+
+    InitOnceExecuteOnce(&shader_cache_init_once, shader_cache_init, NULL, NULL);
+    if (!shader_cache_enabled || !shader_cache_get_blob_filename(name, filename, ARRAY_SIZE(filename)))
+        return false;
+
+    if ((file = CreateFileW(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE)
+        return false;
+
+    if (!GetFileSizeEx(file, &file_size) || !file_size.QuadPart
+            || file_size.QuadPart > WINED3D_SHADER_CACHE_MAX_ENTRY
+            || !(*data = malloc(file_size.QuadPart)))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    if (!ReadFile(file, *data, file_size.QuadPart, &read, NULL) || read != file_size.QuadPart)
+    {
+        CloseHandle(file);
+        free(*data);
+        return false;
+    }
+    CloseHandle(file);
+
+    *size = read;
+    TRACE("Loaded %Iu bytes from %s.\n", *size, debugstr_w(filename));
+    return true;
+}
+
+void wined3d_shader_cache_save_blob(const char *name, const void *data, size_t size)
+{
+    WCHAR filename[MAX_PATH];
+
+    InitOnceExecuteOnce(&shader_cache_init_once, shader_cache_init, NULL, NULL);
+    if (!shader_cache_enabled || size > WINED3D_SHADER_CACHE_MAX_ENTRY
+            || !shader_cache_get_blob_filename(name, filename, ARRAY_SIZE(filename)))
+        return;
+
+    if (shader_cache_write_file(filename, data, size))
+        TRACE("Saved %Iu bytes to %s.\n", size, debugstr_w(filename));
+}
+
+/* Entries for other modules, such as d3dcompiler, share the cache and its
+ * settings. Their keys are prefixed with the module's name. */
+BOOL CDECL wined3d_shader_cache_enabled(void)
+{
+    InitOnceExecuteOnce(&shader_cache_init_once, shader_cache_init, NULL, NULL);
+    return shader_cache_enabled;
+}
+
+BOOL CDECL wined3d_shader_cache_get(const char *name, const void *key_data, SIZE_T key_size,
+        void **data, SIZE_T *size)
+{
+    struct wined3d_shader_cache_key key;
+    size_t data_size;
+    bool ret;
+
+    TRACE("name %s, key_data %p, key_size %Iu, data %p, size %p.\n",
+            debugstr_a(name), key_data, key_size, data, size);
+
+    wined3d_shader_cache_key_init(&key, name);
+    wined3d_shader_cache_key_add(&key, key_data, key_size);
+    if ((ret = wined3d_shader_cache_lookup(&key, data, &data_size)))
+        *size = data_size;
+    wined3d_shader_cache_key_cleanup(&key);
+
+    return ret;
+}
+
+void CDECL wined3d_shader_cache_put(const char *name, const void *key_data, SIZE_T key_size,
+        const void *data, SIZE_T size)
+{
+    struct wined3d_shader_cache_key key;
+
+    TRACE("name %s, key_data %p, key_size %Iu, data %p, size %Iu.\n",
+            debugstr_a(name), key_data, key_size, data, size);
+
+    wined3d_shader_cache_key_init(&key, name);
+    wined3d_shader_cache_key_add(&key, key_data, key_size);
+    wined3d_shader_cache_store(&key, data, size);
+    wined3d_shader_cache_key_cleanup(&key);
+}
+
+void CDECL wined3d_shader_cache_free(void *data)
+{
+    free(data);
+}
+
+void wined3d_shader_cache_cleanup(void)
+{
+    if (!shader_cache_enabled)
+        return;
+
+    TRACE("Shader cache statistics: %ld hits, %ld misses, %ld writes.\n",
+            shader_cache_hits, shader_cache_misses, shader_cache_writes);
+}
@@ -252,6 +252,36 @@ static void shader_spirv_init_shader_interface_vk(struct wined3d_shader_spirv_sh
     iface->vkd3d_interface.uav_counter_count = b->uav_counter_count;
 }
 
+static void shader_spirv_init_cache_key(struct wined3d_shader_cache_key *key,
+        const struct wined3d_vk_info *vk_info, const struct wined3d_shader_desc *shader_desc,
+        enum vkd3d_shader_source_type source_type, enum wined3d_shader_type shader_type,
+        const struct shader_spirv_compile_arguments *args, const struct shader_spirv_resource_bindings *bindings)
+{
+    struct shader_spirv_compile_arguments default_args;
+    const char *version = vkd3d_shader_get_version(NULL, NULL);
+    BOOL stencil_export = vk_info->supported[WINED3D_VK_EXT_SHADER_STENCIL_EXPORT];
+
+    if (!args)
+    {
+        memset(&default_args, 0, sizeof(default_args));
+        args = &default_args;
+    }
+
+    wined3d_shader_cache_key_init(key, "spirv");
+    wined3d_shader_cache_key_add(key, version, strlen(version) + 1);
+    wined3d_shader_cache_key_add(key, spirv_compile_options, sizeof(spirv_compile_options));
+    wined3d_shader_cache_key_add(key, &source_type, sizeof(source_type));
+    wined3d_shader_cache_key_add(key, &shader_type, sizeof(shader_type));
+    wined3d_shader_cache_key_add(key, &stencil_export, sizeof(stencil_export));
+    wined3d_shader_cache_key_add(key, args, sizeof(*args));
+    wined3d_shader_cache_key_add(key, &bindings->binding_count, sizeof(bindings->binding_count));
+    wined3d_shader_cache_key_add(key, bindings->bindings, bindings->binding_count * sizeof(*bindings->bindings));
+    wined3d_shader_cache_key_add(key, &bindings->uav_counter_count, sizeof(bindings->uav_counter_count));
+    wined3d_shader_cache_key_add(key, bindings->uav_counters,
+            bindings->uav_counter_count * sizeof(*bindings->uav_counters));
+    wined3d_shader_cache_key_add(key, shader_desc->byte_code, shader_desc->byte_code_size);
+}
+
 static VkShaderModule shader_spirv_compile_shader(struct wined3d_context_vk *context_vk,
         const struct wined3d_shader_desc *shader_desc, enum vkd3d_shader_source_type source_type,
         enum wined3d_shader_type shader_type, const struct shader_spirv_compile_arguments *args,
@@ -262,13 +292,28 @@ static VkShaderModule shader_spirv_compile_shader(struct wined3d_context_vk *con
     struct wined3d_shader_spirv_compile_args compile_args;
     struct wined3d_shader_spirv_shader_interface iface;
     VkShaderModuleCreateInfo shader_create_info;
+    struct wined3d_shader_cache_key cache_key;
     struct vkd3d_shader_compile_info info;
     struct vkd3d_shader_code spirv;
+    bool cached = false, use_cache;
     VkShaderModule module;
     char *messages;
     VkResult vr;
     int ret;
 
+    /* Stream output descriptions reference semantic names by pointer, so
+     * those variants are always compiled. */
+    if ((use_cache = !so_desc))
+    {
+        shader_spirv_init_cache_key(&cache_key, vk_info, shader_desc,
+                source_type, shader_type, args, bindings);
+        if ((cached = wined3d_shader_cache_lookup(&cache_key, (void **)&spirv.code, &spirv.size)))
+        {
+            wined3d_shader_cache_key_cleanup(&cache_key);
+            goto create_module;
+        }
+    }
+
     shader_spirv_init_shader_interface_vk(&iface, bindings, so_desc);
     shader_spirv_init_compile_args(vk_info, &compile_args, &iface.vkd3d_interface,
             VKD3D_SHADER_SPIRV_ENVIRONMENT_VULKAN_1_0, shader_type, source_type, args);
@@ -303,23 +348,34 @@ static VkShaderModule shader_spirv_compile_shader(struct wined3d_context_vk *con
     if (ret < 0)
     {
         ERR("Failed to compile shader, ret %d.\n", ret);
+        if (use_cache)
+            wined3d_shader_cache_key_cleanup(&cache_key);
         return VK_NULL_HANDLE;
     }
 
+    if (use_cache)
+    {
+        wined3d_shader_cache_store(&cache_key, spirv.code, spirv.size);
+        wined3d_shader_cache_key_cleanup(&cache_key);
+    }
+
+create_module:
     shader_create_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
     shader_create_info.pNext = NULL;
     shader_create_info.flags = 0;
     shader_create_info.codeSize = spirv.size;
     shader_create_info.pCode = spirv.code;
-    if ((vr = VK_CALL(vkCreateShaderModule(device_vk->vk_device, &shader_create_info, NULL, &module))) < 0)
-    {
+    vr = VK_CALL(vkCreateShaderModule(device_vk->vk_device, &shader_create_info, NULL, &module));
+    if (cached)
+        free((void *)spirv.code);
+    else
         vkd3d_shader_free_shader_code(&spirv);
+    if (vr < 0)
+    {
         WARN("Failed to create Vulkan shader module, vr %s.\n", wined3d_debug_vkresult(vr));
         return VK_NULL_HANDLE;
     }
 
-    vkd3d_shader_free_shader_code(&spirv);
-
     return module;
 }
 
@@ -428,7 +484,7 @@ static struct shader_spirv_compute_program_vk *shader_spirv_find_compute_program
     pipeline_info.basePipelineHandle = VK_NULL_HANDLE;
     pipeline_info.basePipelineIndex = -1;
     if ((vr = VK_CALL(vkCreateComputePipelines(device_vk->vk_device,
-            VK_NULL_HANDLE, 1, &pipeline_info, NULL, &program->vk_pipeline))) < 0)
+            device_vk->vk_pipeline_cache, 1, &pipeline_info, NULL, &program->vk_pipeline))) < 0)
     {
         ERR("Failed to create Vulkan compute pipeline, vr %s.\n", wined3d_debug_vkresult(vr));
         VK_CALL(vkDestroyShaderModule(device_vk->vk_device, program->vk_module, NULL));
@@ -206,6 +206,10 @@
 @ cdecl wined3d_sampler_get_parent(ptr)
 @ cdecl wined3d_sampler_incref(ptr)
 
+@ cdecl wined3d_shader_cache_enabled()
+@ cdecl wined3d_shader_cache_free(ptr)
+@ cdecl wined3d_shader_cache_get(str ptr long ptr ptr)
+@ cdecl wined3d_shader_cache_put(str ptr long ptr long)
 @ cdecl wined3d_shader_create_cs(ptr ptr ptr ptr ptr)
 @ cdecl wined3d_shader_create_ds(ptr ptr ptr ptr ptr)
 @ cdecl wined3d_shader_create_gs(ptr ptr ptr ptr ptr ptr)
@@ -129,6 +129,7 @@ struct wined3d_settings wined3d_settings =
     .max_sm_cs = UINT_MAX,
     .renderer = WINED3D_RENDERER_AUTO,
     .shader_backend = WINED3D_SHADER_BACKEND_AUTO,
+    .shader_cache_size = 256,
 };
 
 enum wined3d_renderer CDECL wined3d_get_renderer(void)
@@ -463,6 +464,17 @@ static BOOL wined3d_dll_init(HINSTANCE hInstDLL)
             TRACE("Forcing all constant buffers to be write-mappable.\n");
             wined3d_settings.cb_access_map_w = TRUE;
         }
+        if (!get_config_key_dword(hkey, appkey, env, "shader_cache_size", &wined3d_settings.shader_cache_size))
+            TRACE("Limiting the shader cache to %u MiB.\n", wined3d_settings.shader_cache_size);
+        if (!get_config_key(hkey, appkey, env, "shader_cache_path", buffer, size))
+        {
+            size_t len = strlen(buffer) + 1;
+
+            if (!(wined3d_settings.shader_cache_path = malloc(len)))
+                ERR("Failed to allocate shader cache path memory.\n");
+            else
+                memcpy(wined3d_settings.shader_cache_path, buffer, len);
+        }
     }
 
     if (appkey) RegCloseKey( appkey );
@@ -521,6 +533,8 @@ static BOOL wined3d_dll_destroy(HINSTANCE hInstDLL)
     }
     free(swapchain_state_table.hooks);
 
+    wined3d_shader_cache_cleanup();
+    free(wined3d_settings.shader_cache_path);
     free(wined3d_settings.logo);
     UnregisterClassA(WINED3D_OPENGL_WINDOW_CLASS_NAME, hInstDLL);
 
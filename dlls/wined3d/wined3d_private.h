@@ -486,6 +486,8 @@ struct wined3d_settings
     enum wined3d_renderer renderer;
     enum wined3d_shader_backend shader_backend;
     BOOL cb_access_map_w;
+    unsigned int shader_cache_size;
+    char *shader_cache_path;
 };
 
 extern struct wined3d_settings wined3d_settings;
@@ -1553,6 +1555,22 @@ extern const struct wined3d_shader_backend_ops none_shader_backend;
 
 const struct wined3d_shader_backend_ops *wined3d_spirv_shader_backend_init_vk(void);
 
+struct wined3d_shader_cache_key
+{
+    BYTE *data;
+    SIZE_T size, count;
+    bool valid;
+};
+
+void wined3d_shader_cache_key_init(struct wined3d_shader_cache_key *key, const char *backend);
+void wined3d_shader_cache_key_add(struct wined3d_shader_cache_key *key, const void *data, size_t size);
+void wined3d_shader_cache_key_cleanup(struct wined3d_shader_cache_key *key);
+bool wined3d_shader_cache_lookup(const struct wined3d_shader_cache_key *key, void **data, size_t *size);
+void wined3d_shader_cache_store(const struct wined3d_shader_cache_key *key, const void *data, size_t size);
+bool wined3d_shader_cache_load_blob(const char *name, void **data, size_t *size);
+void wined3d_shader_cache_save_blob(const char *name, const void *data, size_t size);
+void wined3d_shader_cache_cleanup(void);
+
 #define D3DCOLOR_B_R(dw) (((dw) >> 16) & 0xff)
 #define D3DCOLOR_B_G(dw) (((dw) >>  8) & 0xff)
 #define D3DCOLOR_B_B(dw) (((dw) >>  0) & 0xff)
@@ -3566,6 +3584,11 @@ enum wined3d_cs_queue_id
 #define WINED3D_CS_QUEUE_SIZE           0x400000u
 #endif
 #define WINED3D_CS_SPIN_COUNT           2000u
+#define WINED3D_CS_MIN_SPIN_COUNT       64u
+#define WINED3D_CS_MAX_SPIN_COUNT       64000u
+/* Waits for commands shorter than this, in µs, are considered to cost more in
+ * wake-up latency than spinning would have. */
+#define WINED3D_CS_SHORT_WAIT_TIMEOUT   200
 /* How long to wait for commands when there are active queries, in µs. */
 #define WINED3D_CS_COMMAND_WAIT_WITH_QUERIES_TIMEOUT 100
 /* How long to wait for the CS from the client thread, in µs. */
@@ -3577,6 +3600,7 @@ C_ASSERT(!(WINED3D_CS_QUEUE_SIZE & (WINED3D_CS_QUEUE_SIZE - 1)));
 struct wined3d_cs_queue
 {
     ULONG head, tail;
+    ULONG prev_head;
     BYTE data[WINED3D_CS_QUEUE_SIZE];
 };
 
@@ -3623,6 +3647,16 @@ struct wined3d_cs
     LONG waiting_for_event;
     LONG waiting_for_present;
     LONG pending_presents;
+    unsigned int spin_limit;
+
+    struct
+    {
+        LONG stalls;
+        LONG coalesced;
+        LONG spins;
+        LONG waits;
+        ULONG max_fill;
+    } stats;
 };
 
 static inline void wined3d_device_context_lock(struct wined3d_device_context *context)
@@ -115,26 +115,104 @@ static uint32_t wine_vk_count_struct_(void *s, VkStructureType t)
 
 static const struct vulkan_funcs *vk_funcs;
 
-static int wrapper_entry_compare(const void *key, const struct rb_entry *entry)
+#define WRAPPER_TABLE_MIN_SIZE 64
+#define WRAPPER_REMOVED (~(uint64_t)0)
+
+static uint32_t wrapper_hash(uint64_t host_handle)
 {
-    struct wrapper_entry *wrapper = RB_ENTRY_VALUE(entry, struct wrapper_entry, entry);
-    const uint64_t *host_handle = key;
-    if (*host_handle < wrapper->host_handle) return -1;
-    if (*host_handle > wrapper->host_handle) return 1;
-    return 0;
+    return (host_handle * 0x9e3779b97f4a7c15ull) >> 32;
+}
+
+static int wrapper_table_find(const struct wrapper_table *table, uint64_t host_handle)
+{
+    uint32_t i = wrapper_hash(host_handle) & table->mask;
+    uint64_t key;
+
+    while ((key = __atomic_load_n(&table->slots[i].host_handle, __ATOMIC_ACQUIRE)))
+    {
+        if (key == host_handle)
+            return i;
+        i = (i + 1) & table->mask;
+    }
+    return -1;
+}
+
+/* Called with the instance wrapper_lock held. */
+static void wrapper_table_insert(struct wrapper_table *table, uint64_t host_handle, uint64_t client_handle)
+{
+    uint32_t i = wrapper_hash(host_handle) & table->mask;
+
+    while (table->slots[i].host_handle)
+        i = (i + 1) & table->mask;
+    table->slots[i].client_handle = client_handle;
+    __atomic_store_n(&table->slots[i].host_handle, host_handle, __ATOMIC_RELEASE);
+    table->used++;
+}
+
+/* Called with the instance wrapper_lock held. */
+static BOOL wrapper_table_rehash(struct wine_instance *instance)
+{
+    struct wrapper_table *old = instance->wrappers, *table;
+    uint32_t size = WRAPPER_TABLE_MIN_SIZE, i;
+    uint64_t host_handle;
+
+    while (size < instance->wrapper_count * 4)
+        size *= 2;
+    if (!(table = calloc(1, offsetof(struct wrapper_table, slots[size]))))
+        return FALSE;
+    table->mask = size - 1;
+
+    for (i = 0; old && i <= old->mask; i++)
+    {
+        host_handle = old->slots[i].host_handle;
+        if (host_handle && host_handle != WRAPPER_REMOVED)
+            wrapper_table_insert(table, host_handle, old->slots[i].client_handle);
+    }
+
+    table->prev = old;
+    __atomic_store_n(&instance->wrappers, table, __ATOMIC_SEQ_CST);
+    return TRUE;
+}
+
+/* Called with the instance wrapper_lock held. Replaced tables may only be freed
+ * once no lookup is in progress, as a reader may have loaded the table pointer
+ * before it was replaced. */
+static void free_retired_wrapper_tables(struct wine_instance *instance)
+{
+    struct wrapper_table *table, *prev;
+
+    if (!instance->wrappers || !instance->wrappers->prev) return;
+    if (__atomic_load_n(&instance->wrapper_readers, __ATOMIC_SEQ_CST)) return;
+
+    for (table = instance->wrappers->prev; table; table = prev)
+    {
+        prev = table->prev;
+        free(table);
+    }
+    instance->wrappers->prev = NULL;
 }
 
 static void add_handle_mapping(struct wine_instance *instance, uint64_t client_handle,
                                uint64_t host_handle, struct wrapper_entry *entry)
 {
+    struct wrapper_table *table;
+
     if (instance->enable_wrapper_list)
     {
         entry->host_handle = host_handle;
         entry->client_handle = client_handle;
 
-        pthread_rwlock_wrlock(&instance->wrapper_lock);
-        rb_put(&instance->wrappers, &host_handle, &entry->entry);
-        pthread_rwlock_unlock(&instance->wrapper_lock);
+        pthread_mutex_lock(&instance->wrapper_lock);
+        table = instance->wrappers;
+        if ((!table || (table->used + 1) * 4 > (table->mask + 1) * 3) && !wrapper_table_rehash(instance))
+            ERR("Failed to grow the wrapper table.\n");
+        else if (wrapper_table_find(instance->wrappers, host_handle) == -1)
+        {
+            wrapper_table_insert(instance->wrappers, host_handle, client_handle);
+            instance->wrapper_count++;
+        }
+        free_retired_wrapper_tables(instance);
+        pthread_mutex_unlock(&instance->wrapper_lock);
     }
 }
 
@@ -146,27 +224,121 @@ static void add_handle_mapping_ptr(struct wine_instance *instance, void *client_
 
 static void remove_handle_mapping(struct wine_instance *instance, struct wrapper_entry *entry)
 {
+    struct wrapper_table *table;
+    int i;
+
     if (instance->enable_wrapper_list)
     {
-        pthread_rwlock_wrlock(&instance->wrapper_lock);
-        rb_remove(&instance->wrappers, &entry->entry);
-        pthread_rwlock_unlock(&instance->wrapper_lock);
+        pthread_mutex_lock(&instance->wrapper_lock);
+        if ((table = instance->wrappers) && (i = wrapper_table_find(table, entry->host_handle)) != -1
+                && table->slots[i].client_handle == entry->client_handle)
+        {
+            __atomic_store_n(&table->slots[i].host_handle, WRAPPER_REMOVED, __ATOMIC_RELEASE);
+            instance->wrapper_count--;
+        }
+        free_retired_wrapper_tables(instance);
+        pthread_mutex_unlock(&instance->wrapper_lock);
     }
 }
 
 static uint64_t client_handle_from_host(struct wine_instance *instance, uint64_t host_handle)
 {
-    struct rb_entry *entry;
-    uint64_t result = 0;
+    uint64_t client_handle = 0;
+    struct wrapper_table *table;
+    int i;
+
+    if (!host_handle) return 0;
+
+    __atomic_add_fetch(&instance->wrapper_readers, 1, __ATOMIC_SEQ_CST);
+    if ((table = __atomic_load_n(&instance->wrappers, __ATOMIC_SEQ_CST))
+            && (i = wrapper_table_find(table, host_handle)) != -1)
+        client_handle = table->slots[i].client_handle;
+    __atomic_sub_fetch(&instance->wrapper_readers, 1, __ATOMIC_RELEASE);
+
+    return client_handle;
+}
+
+static void free_wrapper_tables(struct wine_instance *instance)
+{
+    struct wrapper_table *table, *prev;
 
-    pthread_rwlock_rdlock(&instance->wrapper_lock);
-    if ((entry = rb_get(&instance->wrappers, &host_handle)))
+    for (table = instance->wrappers; table; table = prev)
     {
-        struct wrapper_entry *wrapper = RB_ENTRY_VALUE(entry, struct wrapper_entry, entry);
-        result = wrapper->client_handle;
+        prev = table->prev;
+        free(table);
+    }
+    instance->wrappers = NULL;
+}
+
+/* Conversions which don't fit in the on-stack buffer of a conversion context
+ * are allocated from larger blocks. Each thread keeps one spare block around,
+ * so that large conversions, such as big submits or descriptor updates from
+ * 32-bit applications, don't allocate on every call. */
+#define CONVERSION_BLOCK_SIZE (64 * 1024)
+
+struct conversion_block
+{
+    struct list entry;
+    size_t size;
+    size_t used;
+    char data[];
+};
+
+static pthread_key_t conversion_block_key;
+static pthread_once_t conversion_block_once = PTHREAD_ONCE_INIT;
+
+static void init_conversion_block_key(void)
+{
+    pthread_key_create(&conversion_block_key, free);
+}
+
+void *conversion_context_alloc_block(struct conversion_context *pool, size_t size)
+{
+    struct conversion_block *block;
+    size_t block_size;
+
+    size = (size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1);
+
+    if (!list_empty(&pool->alloc_entries))
+    {
+        block = LIST_ENTRY(list_tail(&pool->alloc_entries), struct conversion_block, entry);
+        if (block->size - block->used >= size)
+        {
+            block->used += size;
+            return block->data + block->used - size;
+        }
+    }
+
+    pthread_once(&conversion_block_once, init_conversion_block_key);
+    if ((block = pthread_getspecific(conversion_block_key)) && block->size >= size)
+    {
+        pthread_setspecific(conversion_block_key, NULL);
+    }
+    else
+    {
+        block_size = max(size, CONVERSION_BLOCK_SIZE);
+        if (!(block = malloc(offsetof(struct conversion_block, data[block_size]))))
+            return NULL;
+        block->size = block_size;
+    }
+
+    block->used = size;
+    list_add_tail(&pool->alloc_entries, &block->entry);
+    return block->data;
+}
+
+void conversion_context_free_blocks(struct conversion_context *pool)
+{
+    struct conversion_block *block, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE(block, next, &pool->alloc_entries, struct conversion_block, entry)
+    {
+        list_remove(&block->entry);
+        if (block->size == CONVERSION_BLOCK_SIZE && !pthread_getspecific(conversion_block_key))
+            pthread_setspecific(conversion_block_key, block);
+        else
+            free(block);
     }
-    pthread_rwlock_unlock(&instance->wrapper_lock);
-    return result;
 }
 
 struct vk_callback_funcs callback_funcs;
@@ -1032,8 +1204,7 @@ VkResult wine_vkCreateInstance(const VkInstanceCreateInfo *create_info,
 
     TRACE("Created instance %p, host_instance %p.\n", object, object->host_instance);
 
-    rb_init(&object->wrappers, wrapper_entry_compare);
-    pthread_rwlock_init(&object->wrapper_lock, NULL);
+    pthread_mutex_init(&object->wrapper_lock, NULL);
 
     for (i = 0; i < object->phys_dev_count; i++)
     {
@@ -1082,7 +1253,8 @@ void wine_vkDestroyInstance(VkInstance handle, const VkAllocationCallbacks *allo
     }
     remove_handle_mapping(instance, &instance->wrapper_entry);
 
-    pthread_rwlock_destroy(&instance->wrapper_lock);
+    free_wrapper_tables(instance);
+    pthread_mutex_destroy(&instance->wrapper_lock);
     free(instance->utils_messengers);
     free(instance);
 }
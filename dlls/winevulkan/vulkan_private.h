@@ -36,11 +36,27 @@
  */
 struct wrapper_entry
 {
-    struct rb_entry entry;
     uint64_t host_handle;
     uint64_t client_handle;
 };
 
+/* Open addressing hash table of host to client handle mappings. Lookups don't
+ * take any lock; updates are serialized by the instance wrapper_lock. Removed
+ * slots are never reused, so readers never see a slot change its mapping; the
+ * table is instead rebuilt, sized for the live mappings, once it fills up.
+ * Replaced tables are kept until no lookup is in flight (wrapper_readers). */
+struct wrapper_table
+{
+    struct wrapper_table *prev;
+    uint32_t mask;
+    uint32_t used;
+    struct
+    {
+        uint64_t host_handle;
+        uint64_t client_handle;
+    } slots[];
+};
+
 struct wine_cmd_buffer
 {
     struct wine_device *device; /* parent */
@@ -142,8 +158,10 @@ struct wine_instance
 
     VkBool32 enable_win32_surface;
     VkBool32 enable_wrapper_list;
-    struct rb_tree wrappers;
-    pthread_rwlock_t wrapper_lock;
+    struct wrapper_table *wrappers;
+    uint32_t wrapper_count;
+    uint32_t wrapper_readers;
+    pthread_mutex_t wrapper_lock;
 
     struct wine_debug_utils_messenger *utils_messengers;
     uint32_t utils_messenger_count;
@@ -288,6 +306,9 @@ struct conversion_context
     struct list alloc_entries;
 };
 
+void *conversion_context_alloc_block(struct conversion_context *pool, size_t size);
+void conversion_context_free_blocks(struct conversion_context *pool);
+
 static inline void init_conversion_context(struct conversion_context *pool)
 {
     pool->used = 0;
@@ -296,9 +317,8 @@ static inline void init_conversion_context(struct conversion_context *pool)
 
 static inline void free_conversion_context(struct conversion_context *pool)
 {
-    struct list *entry, *next;
-    LIST_FOR_EACH_SAFE(entry, next, &pool->alloc_entries)
-        free(entry);
+    if (!list_empty(&pool->alloc_entries))
+        conversion_context_free_blocks(pool);
 }
 
 static inline void *conversion_context_alloc(struct conversion_context *pool, size_t size)
@@ -309,14 +329,7 @@ static inline void *conversion_context_alloc(struct conversion_context *pool, si
         pool->used += (size + sizeof(UINT64) - 1) & ~(sizeof(UINT64) - 1);
         return ret;
     }
-    else
-    {
-        struct list *entry;
-        if (!(entry = malloc(sizeof(*entry) + size)))
-            return NULL;
-        list_add_tail(&pool->alloc_entries, entry);
-        return entry + 1;
-    }
+    return conversion_context_alloc_block(pool, size);
 }
 
 struct wine_deferred_operation
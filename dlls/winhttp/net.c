@@ -179,11 +179,6 @@ static DWORD netconn_verify_cert( PCCERT_CONTEXT cert, WCHAR *server, DWORD secu
 
 static BOOL winsock_loaded;
 
-void netconn_unload( void )
-{
-    if (winsock_loaded) WSACleanup();
-}
-
 static BOOL WINAPI winsock_startup( INIT_ONCE *once, void *param, void **ctx )
 {
     int ret;
@@ -300,7 +295,7 @@ void netconn_release( struct netconn *conn )
     }
     if (conn->socket != -1)
         closesocket( conn->socket );
-    release_host( conn->host );
+    release_host_connection( conn->host );
     if (conn->port)
         CloseHandle( conn->port );
     free(conn);
@@ -723,7 +718,7 @@ BOOL netconn_is_alive( struct netconn *netconn )
     return len == 1 || (len == -1 && err == WSAEWOULDBLOCK);
 }
 
-static DWORD resolve_hostname( const WCHAR *name, INTERNET_PORT port, struct sockaddr_storage *sa )
+static DWORD resolve_hostname( const WCHAR *name, struct sockaddr_storage *sa )
 {
     ADDRINFOW *res, hints;
     int ret;
@@ -747,7 +742,14 @@ static DWORD resolve_hostname( const WCHAR *name, INTERNET_PORT port, struct soc
         }
     }
     memcpy( sa, res->ai_addr, res->ai_addrlen );
-    switch (res->ai_family)
+
+    FreeAddrInfoW( res );
+    return ERROR_SUCCESS;
+}
+
+static void set_address_port( struct sockaddr_storage *sa, INTERNET_PORT port )
+{
+    switch (sa->ss_family)
     {
     case AF_INET:
         ((struct sockaddr_in *)sa)->sin_port = htons( port );
@@ -756,22 +758,46 @@ static DWORD resolve_hostname( const WCHAR *name, INTERNET_PORT port, struct soc
         ((struct sockaddr_in6 *)sa)->sin6_port = htons( port );
         break;
     }
-
-    FreeAddrInfoW( res );
-    return ERROR_SUCCESS;
 }
 
 struct async_resolve
 {
     LONG                     ref;
     WCHAR                   *hostname;
-    INTERNET_PORT            port;
     struct sockaddr_storage  addr;
     DWORD                    result;
     HANDLE                   done;
 };
 
-static struct async_resolve *create_async_resolve( const WCHAR *hostname, INTERNET_PORT port )
+/* Resolved names are cached for all sessions in the process. GetAddrInfoW
+ * doesn't tell us the record TTLs, so fixed lifetimes are used instead. */
+#define RESOLVE_CACHE_MAX_ENTRIES  256
+#define RESOLVE_CACHE_TTL          60000 /* milliseconds */
+#define RESOLVE_CACHE_NEGATIVE_TTL 5000
+
+struct resolve_cache_entry
+{
+    struct list              entry;
+    WCHAR                   *hostname;
+    struct sockaddr_storage  addr;
+    DWORD                    result;
+    ULONGLONG                expires;
+    struct async_resolve    *pending; /* lookup in progress, shared by all requests for this name */
+};
+
+static CRITICAL_SECTION resolve_cache_cs;
+static CRITICAL_SECTION_DEBUG resolve_cache_debug =
+{
+    0, 0, &resolve_cache_cs,
+    { &resolve_cache_debug.ProcessLocksList, &resolve_cache_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": resolve_cache_cs") }
+};
+static CRITICAL_SECTION resolve_cache_cs = { &resolve_cache_debug, -1, 0, 0, 0, 0 };
+
+static struct list resolve_cache = LIST_INIT( resolve_cache );
+static unsigned int resolve_cache_count;
+
+static struct async_resolve *create_async_resolve( const WCHAR *hostname )
 {
     struct async_resolve *ret;
 
@@ -782,8 +808,7 @@ static struct async_resolve *create_async_resolve( const WCHAR *hostname, INTERN
     }
     ret->ref = 1;
     ret->hostname = wcsdup( hostname );
-    ret->port     = port;
-    if (!(ret->done = CreateEventW( NULL, FALSE, FALSE, NULL )))
+    if (!(ret->done = CreateEventW( NULL, TRUE, FALSE, NULL )))
     {
         free( ret->hostname );
         free( ret );
@@ -801,46 +826,166 @@ static void async_resolve_release( struct async_resolve *async )
     free( async );
 }
 
+static void free_resolve_cache_entry( struct resolve_cache_entry *entry )
+{
+    list_remove( &entry->entry );
+    resolve_cache_count--;
+    free( entry->hostname );
+    free( entry );
+}
+
+/* caller must hold resolve_cache_cs */
+static struct resolve_cache_entry *find_resolve_cache_entry( const WCHAR *hostname, ULONGLONG now )
+{
+    struct resolve_cache_entry *entry, *next;
+
+    LIST_FOR_EACH_ENTRY_SAFE( entry, next, &resolve_cache, struct resolve_cache_entry, entry )
+    {
+        if (wcsicmp( entry->hostname, hostname )) continue;
+        if (!entry->pending && entry->expires <= now)
+        {
+            free_resolve_cache_entry( entry );
+            return NULL;
+        }
+        list_remove( &entry->entry );
+        list_add_head( &resolve_cache, &entry->entry );
+        return entry;
+    }
+    return NULL;
+}
+
+/* caller must hold resolve_cache_cs */
+static void add_resolve_cache_entry( const WCHAR *hostname, struct async_resolve *pending )
+{
+    struct resolve_cache_entry *entry;
+
+    if (!(entry = calloc( 1, sizeof(*entry) ))) return;
+    if (!(entry->hostname = wcsdup( hostname )))
+    {
+        free( entry );
+        return;
+    }
+    /* mark the new entry pending before trimming so that it can't be evicted */
+    entry->pending = pending;
+    InterlockedIncrement( &pending->ref );
+    list_add_head( &resolve_cache, &entry->entry );
+
+    if (++resolve_cache_count > RESOLVE_CACHE_MAX_ENTRIES)
+    {
+        struct resolve_cache_entry *cursor, *prev;
+
+        LIST_FOR_EACH_ENTRY_SAFE_REV( cursor, prev, &resolve_cache, struct resolve_cache_entry, entry )
+        {
+            if (cursor->pending) continue;
+            free_resolve_cache_entry( cursor );
+            break;
+        }
+    }
+}
+
 static void CALLBACK resolve_proc( TP_CALLBACK_INSTANCE *instance, void *ctx )
 {
     struct async_resolve *async = ctx;
+    struct resolve_cache_entry *entry;
+
+    async->result = resolve_hostname( async->hostname, &async->addr );
+
+    EnterCriticalSection( &resolve_cache_cs );
+    LIST_FOR_EACH_ENTRY( entry, &resolve_cache, struct resolve_cache_entry, entry )
+    {
+        if (entry->pending != async) continue;
+        entry->addr    = async->addr;
+        entry->result  = async->result;
+        entry->expires = GetTickCount64() + (async->result ? RESOLVE_CACHE_NEGATIVE_TTL : RESOLVE_CACHE_TTL);
+        entry->pending = NULL;
+        async_resolve_release( async );
+        break;
+    }
+    LeaveCriticalSection( &resolve_cache_cs );
 
-    async->result = resolve_hostname( async->hostname, async->port, &async->addr );
     SetEvent( async->done );
     async_resolve_release( async );
 }
 
 DWORD netconn_resolve( WCHAR *hostname, INTERNET_PORT port, struct sockaddr_storage *addr, int timeout )
 {
+    struct resolve_cache_entry *entry;
+    struct async_resolve *async;
     DWORD ret;
 
-    if (!timeout) ret = resolve_hostname( hostname, port, addr );
-    else
+    EnterCriticalSection( &resolve_cache_cs );
+
+    if ((entry = find_resolve_cache_entry( hostname, GetTickCount64() )) && !entry->pending)
     {
-        struct async_resolve *async;
+        TRACE( "using cached result for %s\n", debugstr_w(hostname) );
+        *addr = entry->addr;
+        ret = entry->result;
+        LeaveCriticalSection( &resolve_cache_cs );
+        if (!ret) set_address_port( addr, port );
+        return ret;
+    }
 
-        if (!(async = create_async_resolve( hostname, port )))
+    if (entry)
+    {
+        TRACE( "waiting for pending lookup of %s\n", debugstr_w(hostname) );
+        async = entry->pending;
+        InterlockedIncrement( &async->ref );
+    }
+    else
+    {
+        if (!(async = create_async_resolve( hostname )))
+        {
+            LeaveCriticalSection( &resolve_cache_cs );
             return ERROR_OUTOFMEMORY;
+        }
 
+        /* one reference for the thread pool callback and one for the cache entry */
         InterlockedIncrement( &async->ref );
         if (!TrySubmitThreadpoolCallback( resolve_proc, async, NULL ))
         {
+            ret = GetLastError();
+            LeaveCriticalSection( &resolve_cache_cs );
             InterlockedDecrement( &async->ref );
             async_resolve_release( async );
-            return GetLastError();
-        }
-        if (WaitForSingleObject( async->done, timeout ) != WAIT_OBJECT_0) ret = ERROR_WINHTTP_TIMEOUT;
-        else
-        {
-            *addr = async->addr;
-            ret = async->result;
+            return ret;
         }
-        async_resolve_release( async );
+        add_resolve_cache_entry( hostname, async );
     }
 
+    LeaveCriticalSection( &resolve_cache_cs );
+
+    if (WaitForSingleObject( async->done, timeout ? timeout : INFINITE ) != WAIT_OBJECT_0) ret = ERROR_WINHTTP_TIMEOUT;
+    else
+    {
+        *addr = async->addr;
+        ret = async->result;
+        if (!ret) set_address_port( addr, port );
+    }
+    async_resolve_release( async );
+
     return ret;
 }
 
+static void free_resolve_cache(void)
+{
+    struct resolve_cache_entry *entry, *next;
+
+    EnterCriticalSection( &resolve_cache_cs );
+    LIST_FOR_EACH_ENTRY_SAFE( entry, next, &resolve_cache, struct resolve_cache_entry, entry )
+    {
+        /* still referenced by a pending thread pool callback */
+        if (entry->pending) continue;
+        free_resolve_cache_entry( entry );
+    }
+    LeaveCriticalSection( &resolve_cache_cs );
+}
+
+void netconn_unload( void )
+{
+    free_resolve_cache();
+    if (winsock_loaded) WSACleanup();
+}
+
 const void *netconn_get_certificate( struct netconn *conn )
 {
     const CERT_CONTEXT *ret;
@@ -22,6 +22,7 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <wchar.h>
+#include <zlib.h>
 
 #define COBJMACROS
 #include "windef.h"
@@ -1440,7 +1441,20 @@ static CRITICAL_SECTION_DEBUG connection_pool_debug =
 };
 static CRITICAL_SECTION connection_pool_cs = { &connection_pool_debug, -1, 0, 0, 0, 0 };
 
-static struct list connection_pool = LIST_INIT( connection_pool );
+/* hosts are hashed on name, port, security and session */
+#define HOST_HASH_SIZE 64
+static struct list connection_pool[HOST_HASH_SIZE];
+
+static struct list *get_host_bucket( const WCHAR *hostname, INTERNET_PORT port, BOOL secure, LONG session_id )
+{
+    unsigned int hash = (port ^ (secure ? 0x10000 : 0)) + session_id * 0x9e3779b1;
+    struct list *bucket;
+
+    while (*hostname) hash = hash * 31 + *hostname++;
+    bucket = &connection_pool[hash % HOST_HASH_SIZE];
+    if (!bucket->next) list_init( bucket );
+    return bucket;
+}
 
 void release_host( struct hostdata *host )
 {
@@ -1456,6 +1470,25 @@ void release_host( struct hostdata *host )
     free( host );
 }
 
+/* release a connection slot reserved in open_connection() along with its host reference */
+void release_host_connection( struct hostdata *host )
+{
+    EnterCriticalSection( &connection_pool_cs );
+    host->open_connections--;
+    WakeConditionVariable( &host->cv );
+    LeaveCriticalSection( &connection_pool_cs );
+    release_host( host );
+}
+
+/* wake up open_connection() if it is waiting on behalf of a request whose handle is being closed */
+void cancel_connection_wait( struct request *request )
+{
+    EnterCriticalSection( &connection_pool_cs );
+    request->closing = TRUE;
+    if (request->wait_host) WakeAllConditionVariable( &request->wait_host->cv );
+    LeaveCriticalSection( &connection_pool_cs );
+}
+
 static BOOL connection_collector_running;
 
 static void CALLBACK connection_collector( TP_CALLBACK_INSTANCE *instance, void *ctx )
@@ -1464,6 +1497,7 @@ static void CALLBACK connection_collector( TP_CALLBACK_INSTANCE *instance, void
     struct netconn *netconn, *next_netconn;
     struct hostdata *host, *next_host;
     ULONGLONG now;
+    unsigned int i;
 
     do
     {
@@ -1474,17 +1508,21 @@ static void CALLBACK connection_collector( TP_CALLBACK_INSTANCE *instance, void
 
         EnterCriticalSection(&connection_pool_cs);
 
-        LIST_FOR_EACH_ENTRY_SAFE(host, next_host, &connection_pool, struct hostdata, entry)
+        for (i = 0; i < HOST_HASH_SIZE; i++)
         {
-            LIST_FOR_EACH_ENTRY_SAFE(netconn, next_netconn, &host->connections, struct netconn, entry)
+            if (!connection_pool[i].next) continue;
+            LIST_FOR_EACH_ENTRY_SAFE(host, next_host, &connection_pool[i], struct hostdata, entry)
             {
-                if (netconn->keep_until < now)
+                LIST_FOR_EACH_ENTRY_SAFE(netconn, next_netconn, &host->connections, struct netconn, entry)
                 {
-                    TRACE("freeing %p\n", netconn);
-                    list_remove(&netconn->entry);
-                    netconn_release(netconn);
+                    if (netconn->keep_until < now)
+                    {
+                        TRACE("freeing %p\n", netconn);
+                        list_remove(&netconn->entry);
+                        netconn_release(netconn);
+                    }
+                    else remaining_connections++;
                 }
-                else remaining_connections++;
             }
         }
 
@@ -1515,6 +1553,7 @@ static void cache_connection( struct netconn *netconn )
         else FreeLibrary( winhttp_instance );
     }
 
+    WakeConditionVariable( &netconn->host->cv );
     LeaveCriticalSection( &connection_pool_cs );
 }
 
@@ -1566,20 +1605,27 @@ static DWORD open_connection( struct request *request )
     struct hostdata *host = NULL, *iter;
     struct netconn *netconn = NULL;
     struct connect *connect;
+    struct list *bucket;
     WCHAR *addressW = NULL;
     INTERNET_PORT port;
-    DWORD ret, len;
+    DWORD ret = ERROR_SUCCESS, len, max_conns, timeout;
+    ULONGLONG start, elapsed;
+    LONG session_id;
 
     if (request->netconn) goto done;
 
     connect = request->connect;
     port = connect->serverport ? connect->serverport : (request->hdr.flags & WINHTTP_FLAG_SECURE ? 443 : 80);
+    max_conns = connect->session->max_conns_per_server;
+    session_id = connect->session->pool_id;
 
     EnterCriticalSection( &connection_pool_cs );
 
-    LIST_FOR_EACH_ENTRY( iter, &connection_pool, struct hostdata, entry )
+    bucket = get_host_bucket( connect->servername, port, is_secure, session_id );
+    LIST_FOR_EACH_ENTRY( iter, bucket, struct hostdata, entry )
     {
-        if (iter->port == port && !wcscmp( connect->servername, iter->hostname ) && !is_secure == !iter->secure)
+        if (iter->port == port && iter->session_id == session_id && !wcscmp( connect->servername, iter->hostname ) &&
+            !is_secure == !iter->secure)
         {
             host = iter;
             host->ref++;
@@ -1594,10 +1640,13 @@ static DWORD open_connection( struct request *request )
             host->ref = 1;
             host->secure = is_secure;
             host->port = port;
+            host->session_id = session_id;
+            host->open_connections = 0;
+            InitializeConditionVariable( &host->cv );
             list_init( &host->connections );
             if ((host->hostname = wcsdup( connect->servername )))
             {
-                list_add_head( &connection_pool, &host->entry );
+                list_add_head( bucket, &host->entry );
             }
             else
             {
@@ -1611,14 +1660,40 @@ static DWORD open_connection( struct request *request )
 
     if (!host) return ERROR_OUTOFMEMORY;
 
+    /* waiting for a connection counts against the connect timeout */
+    timeout = request->connect_timeout > 0 ? request->connect_timeout : INFINITE;
+    start = GetTickCount64();
+
     for (;;)
     {
         EnterCriticalSection( &connection_pool_cs );
+        while (list_empty( &host->connections ) && host->open_connections >= max_conns)
+        {
+            elapsed = GetTickCount64() - start;
+            if (request->closing) ret = ERROR_WINHTTP_OPERATION_CANCELLED;
+            else if (timeout != INFINITE && elapsed >= timeout) ret = ERROR_WINHTTP_TIMEOUT;
+            if (ret) break;
+
+            TRACE( "waiting for a free connection to %s:%u\n", debugstr_w(host->hostname), port );
+            request->wait_host = host;
+            SleepConditionVariableCS( &host->cv, &connection_pool_cs,
+                                      timeout == INFINITE ? INFINITE : timeout - elapsed );
+            request->wait_host = NULL;
+        }
+        if (ret)
+        {
+            /* pass on a wakeup this request may have consumed */
+            WakeConditionVariable( &host->cv );
+            LeaveCriticalSection( &connection_pool_cs );
+            release_host( host );
+            return ret;
+        }
         if (!list_empty( &host->connections ))
         {
             netconn = LIST_ENTRY( list_head( &host->connections ), struct netconn, entry );
             list_remove( &netconn->entry );
         }
+        else host->open_connections++; /* reserve a slot for a new connection */
         LeaveCriticalSection( &connection_pool_cs );
         if (!netconn) break;
 
@@ -1641,14 +1716,14 @@ static DWORD open_connection( struct request *request )
 
         if ((ret = netconn_resolve( host->hostname, port, &connect->sockaddr, request->resolve_timeout )))
         {
-            release_host( host );
+            release_host_connection( host );
             return ret;
         }
         connect->resolved = TRUE;
 
         if (!(addressW = addr_to_str( &connect->sockaddr )))
         {
-            release_host( host );
+            release_host_connection( host );
             return ERROR_OUTOFMEMORY;
         }
         len = lstrlenW( addressW ) + 1;
@@ -1659,7 +1734,7 @@ static DWORD open_connection( struct request *request )
     {
         if (!addressW && !(addressW = addr_to_str( &connect->sockaddr )))
         {
-            release_host( host );
+            release_host_connection( host );
             return ERROR_OUTOFMEMORY;
         }
 
@@ -1671,7 +1746,7 @@ static DWORD open_connection( struct request *request )
         if ((ret = netconn_create( host, &connect->sockaddr, request->connect_timeout, &netconn )))
         {
             free( addressW );
-            release_host( host );
+            release_host_connection( host );
             return ret;
         }
         netconn_set_timeout( netconn, TRUE, request->send_timeout );
@@ -1711,6 +1786,8 @@ static DWORD open_connection( struct request *request )
     else
     {
         TRACE("using connection %p\n", netconn);
+        /* the pooled connection holds its own host reference */
+        release_host( host );
 
         netconn_set_timeout( netconn, TRUE, request->send_timeout );
         netconn_set_timeout( netconn, FALSE, request_receive_response_timeout( request ));
@@ -1982,6 +2059,168 @@ static BOOL end_of_read_data( struct request *request )
     return (request->content_length == request->content_read);
 }
 
+/* mark raw content bytes as consumed */
+static void consume_data( struct request *request, DWORD count )
+{
+    remove_data( request, count );
+    if (request->read_chunked) request->read_chunked_size -= count;
+    request->content_read += count;
+}
+
+struct content_decoder
+{
+    z_stream zstream;
+    BOOL     is_gzip;
+    BOOL     started;      /* inflate has produced output or consumed input */
+    BOOL     pending;      /* inflate ran out of output space, it may hold more data */
+    BOOL     end_of_data;  /* end of the decoded stream */
+};
+
+static voidpf winhttp_zalloc( voidpf opaque, uInt items, uInt size )
+{
+    return malloc( items * size );
+}
+
+static void winhttp_zfree( voidpf opaque, voidpf address )
+{
+    free( address );
+}
+
+void free_content_decoder( struct request *request )
+{
+    if (!request->decoder) return;
+    inflateEnd( &request->decoder->zstream );
+    free( request->decoder );
+    request->decoder = NULL;
+}
+
+/* set up a decoder if the response is compressed with an encoding the application asked us to handle */
+static void init_content_decoder( struct request *request )
+{
+    struct content_decoder *decoder;
+    WCHAR encoding[20];
+    DWORD size = sizeof(encoding);
+    BOOL is_gzip;
+    int zret;
+
+    free_content_decoder( request );
+    if (!request->hdr.decompression || !request->content_length) return;
+    if (query_headers( request, WINHTTP_QUERY_CONTENT_ENCODING, NULL, encoding, &size, NULL )) return;
+
+    if ((request->hdr.decompression & WINHTTP_DECOMPRESSION_FLAG_GZIP) && !wcsicmp( encoding, L"gzip" ))
+        is_gzip = TRUE;
+    else if ((request->hdr.decompression & WINHTTP_DECOMPRESSION_FLAG_DEFLATE) && !wcsicmp( encoding, L"deflate" ))
+        is_gzip = FALSE;
+    else
+    {
+        TRACE( "not decoding content encoding %s\n", debugstr_w(encoding) );
+        return;
+    }
+
+    if (!(decoder = calloc( 1, sizeof(*decoder) ))) return;
+    decoder->zstream.zalloc = winhttp_zalloc;
+    decoder->zstream.zfree = winhttp_zfree;
+    decoder->is_gzip = is_gzip;
+
+    /* "deflate" is supposed to be zlib wrapped, but some servers send raw deflate data */
+    if ((zret = inflateInit2( &decoder->zstream, is_gzip ? 0x1f : 15 )) != Z_OK)
+    {
+        ERR( "inflateInit2 failed: %d\n", zret );
+        free( decoder );
+        return;
+    }
+    TRACE( "decoding %s content\n", debugstr_w(encoding) );
+    request->decoder = decoder;
+}
+
+/* check if we have returned all of the (decoded) content */
+static BOOL end_of_content( struct request *request )
+{
+    if (request->decoder) return request->decoder->end_of_data;
+    return end_of_read_data( request );
+}
+
+/* skip raw data left after the end of the compressed stream, so that the connection can be reused */
+static void discard_data( struct request *request, BOOL notify )
+{
+    DWORD count;
+
+    while (!end_of_read_data( request ))
+    {
+        if (!(count = get_available_data( request )))
+        {
+            if (refill_buffer( request, notify )) break;
+            if (!(count = get_available_data( request ))) break;
+        }
+        consume_data( request, count );
+    }
+}
+
+/* inflate straight from read_buf into the caller's buffer */
+static DWORD read_decoded_data( struct request *request, char *buffer, DWORD size, int *bytes_read, BOOL async )
+{
+    struct content_decoder *decoder = request->decoder;
+    z_stream *zstream = &decoder->zstream;
+    DWORD count, consumed, produced;
+    DWORD ret = ERROR_SUCCESS;
+    int zret;
+
+    while (size && !decoder->end_of_data)
+    {
+        if (!(count = get_available_data( request )) && !end_of_read_data( request ) && !decoder->pending)
+        {
+            /* don't wait for more input if we already have something to return */
+            if (*bytes_read) break;
+            if ((ret = refill_buffer( request, async ))) return ret;
+            count = get_available_data( request );
+        }
+
+        zstream->next_in   = (Bytef *)request->read_buf + request->read_pos;
+        zstream->avail_in  = count;
+        zstream->next_out  = (Bytef *)buffer + *bytes_read;
+        zstream->avail_out = size;
+        zret = inflate( zstream, Z_SYNC_FLUSH );
+
+        if (zret == Z_DATA_ERROR && !decoder->is_gzip && !decoder->started)
+        {
+            TRACE( "no zlib header, falling back to raw deflate\n" );
+            if (inflateReset2( zstream, -15 ) != Z_OK) return ERROR_WINHTTP_INVALID_SERVER_RESPONSE;
+            decoder->started = TRUE;
+            continue;
+        }
+
+        consumed = count - zstream->avail_in;
+        produced = size - zstream->avail_out;
+        consume_data( request, consumed );
+        size -= produced;
+        *bytes_read += produced;
+        if (consumed || produced) decoder->started = TRUE;
+        decoder->pending = !zstream->avail_out;
+
+        if (zret == Z_STREAM_END)
+        {
+            decoder->end_of_data = TRUE;
+            discard_data( request, async );
+        }
+        else if (zret != Z_OK && zret != Z_BUF_ERROR)
+        {
+            WARN( "inflate failed: %d (%s)\n", zret, debugstr_a(zstream->msg) );
+            return ERROR_WINHTTP_INVALID_SERVER_RESPONSE;
+        }
+        else if (!consumed && !produced)
+        {
+            if (end_of_read_data( request ))
+            {
+                /* truncated stream, return whatever we have decoded */
+                decoder->end_of_data = TRUE;
+                break;
+            }
+            if (count) break;
+        }
+    }
+    return ret;
+}
+
 static DWORD read_data( struct request *request, void *buffer, DWORD size, DWORD *read, BOOL async )
 {
     int count, bytes_read = 0;
@@ -1990,7 +2229,13 @@ static DWORD read_data( struct request *request, void *buffer, DWORD size, DWORD
     if (request->read_chunked && request->read_chunked_size == ~0u
         && (ret = start_next_chunk( request, async ))) goto done;
 
-    if (end_of_read_data( request )) goto done;
+    if (end_of_content( request )) goto done;
+
+    if (request->decoder)
+    {
+        ret = read_decoded_data( request, buffer, size, &bytes_read, async );
+        goto done;
+    }
 
     while (size)
     {
@@ -2001,18 +2246,16 @@ static DWORD read_data( struct request *request, void *buffer, DWORD size, DWORD
         }
         count = min( count, size );
         memcpy( (char *)buffer + bytes_read, request->read_buf + request->read_pos, count );
-        remove_data( request, count );
-        if (request->read_chunked) request->read_chunked_size -= count;
+        consume_data( request, count );
         size -= count;
         bytes_read += count;
-        request->content_read += count;
         if (end_of_read_data( request )) goto done;
     }
     if (request->read_chunked && !request->read_chunked_size) ret = refill_buffer( request, async );
 
 done:
     TRACE( "retrieved %u bytes (%lu/%lu)\n", bytes_read, request->content_read, request->content_length );
-    if (end_of_read_data( request )) finished_reading( request );
+    if (end_of_content( request ) && end_of_read_data( request )) finished_reading( request );
     if (async)
     {
         if (!ret) send_callback( &request->hdr, WINHTTP_CALLBACK_STATUS_READ_COMPLETE, buffer, bytes_read );
@@ -2035,6 +2278,7 @@ static void drain_content( struct request *request )
     DWORD size, bytes_read, bytes_total = 0, bytes_left = request->content_length - request->content_read;
     char buffer[2048];
 
+    free_content_decoder( request );
     refill_buffer( request, FALSE );
     for (;;)
     {
@@ -2294,6 +2538,18 @@ static DWORD send_request( struct request *request, const WCHAR *headers, DWORD
     {
         process_header( request, L"Connection", L"Keep-Alive", WINHTTP_ADDREQ_FLAG_ADD_IF_NEW, TRUE );
     }
+    if (request->hdr.decompression)
+    {
+        const WCHAR *encoding;
+
+        if ((request->hdr.decompression & WINHTTP_DECOMPRESSION_FLAG_ALL) == WINHTTP_DECOMPRESSION_FLAG_ALL)
+            encoding = L"gzip, deflate";
+        else if (request->hdr.decompression & WINHTTP_DECOMPRESSION_FLAG_GZIP)
+            encoding = L"gzip";
+        else
+            encoding = L"deflate";
+        process_header( request, L"Accept-Encoding", encoding, WINHTTP_ADDREQ_FLAG_ADD_IF_NEW, TRUE );
+    }
     if (request->hdr.flags & WINHTTP_FLAG_REFRESH)
     {
         process_header( request, L"Pragma", L"no-cache", WINHTTP_ADDREQ_FLAG_ADD_IF_NEW, TRUE );
@@ -2994,6 +3250,7 @@ static DWORD receive_response( struct request *request )
     if ((ret = query_headers( request, query, NULL, &status, &size, NULL ))) goto done;
 
     set_content_length( request, status );
+    init_content_decoder( request );
 
     if (!(request->hdr.disable_flags & WINHTTP_DISABLE_COOKIES)) record_cookies( request );
 
@@ -3093,15 +3350,19 @@ static DWORD query_data_ready( struct request *request )
 
     count = get_available_data( request );
     if (!request->read_chunked && request->netconn) count += netconn_query_data_available( request->netconn );
+    /* the decoder may still hold output, or have to detect the end of the stream */
+    if (!count && request->decoder && (request->decoder->pending || end_of_read_data( request ))) count = 1;
 
     return count;
 }
 
 static BOOL skip_async_queue( struct request *request, BOOL *wont_block, DWORD to_read )
 {
-    if (!request->read_chunked)
+    /* decoded reads return early instead of waiting for more compressed input */
+    if (request->decoder) to_read = 1;
+    else if (!request->read_chunked)
         to_read = min( to_read, request->content_length - request->content_read );
-    *wont_block = end_of_read_data( request ) || query_data_ready( request ) >= to_read;
+    *wont_block = end_of_content( request ) || query_data_ready( request ) >= to_read;
     return request->hdr.recursion_count < 3 && *wont_block;
 }
 
@@ -3109,7 +3370,7 @@ static DWORD query_data_available( struct request *request, DWORD *available, BO
 {
     DWORD ret = ERROR_SUCCESS, count = 0;
 
-    if (end_of_read_data( request )) goto done;
+    if (end_of_content( request )) goto done;
 
     if (!(count = query_data_ready( request )))
     {
@@ -123,6 +123,13 @@ static BOOL session_query_option( struct object_header *hdr, DWORD option, void
         *buflen = sizeof(DWORD);
         return TRUE;
 
+    case WINHTTP_OPTION_MAX_CONNS_PER_SERVER:
+        if (!validate_buffer( buffer, buflen, sizeof(DWORD) )) return FALSE;
+
+        *(DWORD *)buffer = session->max_conns_per_server;
+        *buflen = sizeof(DWORD);
+        return TRUE;
+
     case WINHTTP_OPTION_SEND_TIMEOUT:
         if (!validate_buffer( buffer, buflen, sizeof(DWORD) )) return FALSE;
 
@@ -193,6 +200,26 @@ static BOOL session_set_option( struct object_header *hdr, DWORD option, void *b
         hdr->redirect_policy = policy;
         return TRUE;
     }
+    case WINHTTP_OPTION_DECOMPRESSION:
+    {
+        DWORD flags;
+
+        if (buflen != sizeof(DWORD))
+        {
+            SetLastError( ERROR_INSUFFICIENT_BUFFER );
+            return FALSE;
+        }
+
+        flags = *(DWORD *)buffer;
+        TRACE( "%#lx\n", flags );
+        if (flags & ~WINHTTP_DECOMPRESSION_FLAG_ALL)
+        {
+            SetLastError( ERROR_INVALID_PARAMETER );
+            return FALSE;
+        }
+        hdr->decompression = flags;
+        return TRUE;
+    }
     case WINHTTP_OPTION_SECURE_PROTOCOLS:
     {
         if (buflen != sizeof(session->secure_protocols))
@@ -240,7 +267,18 @@ static BOOL session_set_option( struct object_header *hdr, DWORD option, void *b
         return TRUE;
 
     case WINHTTP_OPTION_MAX_CONNS_PER_SERVER:
-        FIXME( "WINHTTP_OPTION_MAX_CONNS_PER_SERVER: %lu\n", *(DWORD *)buffer );
+        if (buflen != sizeof(DWORD))
+        {
+            SetLastError( ERROR_INSUFFICIENT_BUFFER );
+            return FALSE;
+        }
+        if (!*(DWORD *)buffer)
+        {
+            SetLastError( ERROR_INVALID_PARAMETER );
+            return FALSE;
+        }
+        TRACE( "WINHTTP_OPTION_MAX_CONNS_PER_SERVER: %lu\n", *(DWORD *)buffer );
+        session->max_conns_per_server = *(DWORD *)buffer;
         return TRUE;
 
     case WINHTTP_OPTION_MAX_CONNS_PER_1_0_SERVER:
@@ -294,6 +332,8 @@ static const struct object_vtbl session_vtbl =
     session_set_option
 };
 
+static LONG session_pool_id;
+
 /***********************************************************************
  *          WinHttpOpen (winhttp.@)
  */
@@ -318,6 +358,8 @@ HINTERNET WINAPI WinHttpOpen( LPCWSTR agent, DWORD access, LPCWSTR proxy, LPCWST
     session->receive_response_timeout = DEFAULT_RECEIVE_RESPONSE_TIMEOUT;
     session->websocket_receive_buffer_size = 32768;
     session->websocket_send_buffer_size = 32768;
+    session->max_conns_per_server = ~0u;
+    session->pool_id = InterlockedIncrement( &session_pool_id );
     list_init( &session->cookie_cache );
     InitializeCriticalSectionEx( &session->cs, 0, RTL_CRITICAL_SECTION_FLAG_FORCE_DEBUG_INFO );
     session->cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": session.cs");
@@ -620,6 +662,7 @@ HINTERNET WINAPI WinHttpConnect( HINTERNET hsession, const WCHAR *server, INTERN
     connect->hdr.notify_mask = session->hdr.notify_mask;
     connect->hdr.context = session->hdr.context;
     connect->hdr.redirect_policy = session->hdr.redirect_policy;
+    connect->hdr.decompression = session->hdr.decompression;
 
     addref_object( &session->hdr );
     connect->session = session;
@@ -657,6 +700,7 @@ static void request_destroy( struct object_header *hdr )
 
     destroy_authinfo( request->authinfo );
     destroy_authinfo( request->proxy_authinfo );
+    free_content_decoder( request );
 
     free( request->verb );
     free( request->path );
@@ -1032,6 +1076,26 @@ static BOOL request_set_option( struct object_header *hdr, DWORD option, void *b
         hdr->redirect_policy = policy;
         return TRUE;
     }
+    case WINHTTP_OPTION_DECOMPRESSION:
+    {
+        DWORD flags;
+
+        if (buflen != sizeof(DWORD))
+        {
+            SetLastError( ERROR_INSUFFICIENT_BUFFER );
+            return FALSE;
+        }
+
+        flags = *(DWORD *)buffer;
+        TRACE( "%#lx\n", flags );
+        if (flags & ~WINHTTP_DECOMPRESSION_FLAG_ALL)
+        {
+            SetLastError( ERROR_INVALID_PARAMETER );
+            return FALSE;
+        }
+        hdr->decompression = flags;
+        return TRUE;
+    }
     case WINHTTP_OPTION_SECURITY_FLAGS:
     {
         DWORD flags;
@@ -1229,9 +1293,14 @@ static BOOL request_set_option( struct object_header *hdr, DWORD option, void *b
     }
 }
 
+static void request_handle_closing( struct object_header *hdr )
+{
+    cancel_connection_wait( (struct request *)hdr );
+}
+
 static const struct object_vtbl request_vtbl =
 {
-    NULL,
+    request_handle_closing,
     request_destroy,
     request_query_option,
     request_set_option
@@ -1307,6 +1376,7 @@ HINTERNET WINAPI WinHttpOpenRequest( HINTERNET hconnect, const WCHAR *verb, cons
     request->hdr.notify_mask = connect->hdr.notify_mask;
     request->hdr.context = connect->hdr.context;
     request->hdr.redirect_policy = connect->hdr.redirect_policy;
+    request->hdr.decompression = connect->hdr.decompression;
     init_queue( &request->queue );
 
     addref_object( &connect->hdr );
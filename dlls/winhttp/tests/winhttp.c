@@ -103,6 +103,37 @@ static void test_WinHttpQueryOption(void)
     ok(size == sizeof(feature), "WinHttpQueryOption should set the size: %lu\n", size);
     ok(feature == 0, "got unexpected WINHTTP_OPTION_WORKER_THREAD_COUNT %#lx\n", feature);
 
+    feature = 0xdeadbeef;
+    size = sizeof(feature);
+    SetLastError(0xdeadbeef);
+    ret = WinHttpQueryOption(session, WINHTTP_OPTION_MAX_CONNS_PER_SERVER, &feature, &size);
+    ok(ret, "failed to query option %lu\n", GetLastError());
+    ok(size == sizeof(feature), "WinHttpQueryOption should set the size: %lu\n", size);
+    ok(feature == ~0u, "got unexpected WINHTTP_OPTION_MAX_CONNS_PER_SERVER %#lx\n", feature);
+
+    feature = 2;
+    SetLastError(0xdeadbeef);
+    ret = WinHttpSetOption(session, WINHTTP_OPTION_MAX_CONNS_PER_SERVER, &feature, sizeof(feature) - 1);
+    ok(!ret, "should fail to set option\n");
+    ok(GetLastError() == ERROR_INSUFFICIENT_BUFFER, "expected ERROR_INSUFFICIENT_BUFFER, got %lu\n", GetLastError());
+
+    feature = 0;
+    SetLastError(0xdeadbeef);
+    ret = WinHttpSetOption(session, WINHTTP_OPTION_MAX_CONNS_PER_SERVER, &feature, sizeof(feature));
+    ok(!ret, "should fail to set option\n");
+    ok(GetLastError() == ERROR_INVALID_PARAMETER, "expected ERROR_INVALID_PARAMETER, got %lu\n", GetLastError());
+
+    feature = 2;
+    SetLastError(0xdeadbeef);
+    ret = WinHttpSetOption(session, WINHTTP_OPTION_MAX_CONNS_PER_SERVER, &feature, sizeof(feature));
+    ok(ret, "failed to set option %lu\n", GetLastError());
+
+    feature = 0xdeadbeef;
+    size = sizeof(feature);
+    ret = WinHttpQueryOption(session, WINHTTP_OPTION_MAX_CONNS_PER_SERVER, &feature, &size);
+    ok(ret, "failed to query option %lu\n", GetLastError());
+    ok(feature == 2, "got unexpected WINHTTP_OPTION_MAX_CONNS_PER_SERVER %#lx\n", feature);
+
     feature = 0xdeadbeef;
     size = sizeof(feature) + 1;
     SetLastError(0xdeadbeef);
@@ -2304,6 +2335,25 @@ static const char proxy_pac[] =
 "    return 'PROXY ' + url + '_' + host + ':8080';\r\n"
 "}\r\n\r\n";
 
+static const char gzipmsg[] =
+"HTTP/1.1 200 OK\r\n"
+"Server: winetest\r\n"
+"Content-Encoding: gzip\r\n"
+"Content-Length: 31\r\n"
+"\r\n"
+"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03\xf3\x48\xcd\xc9\xc9\x57\x08\xcf\x2f\xca\x49\x01\x00"
+"\x56\xb1\x17\x4a\x0b\x00\x00\x00";
+
+static const char deflatemsg[] =
+"HTTP/1.1 200 OK\r\n"
+"Server: winetest\r\n"
+"Content-Encoding: deflate\r\n"
+"Transfer-Encoding: chunked\r\n"
+"\r\n"
+"7\r\n\x78\x9c\xf3\x48\xcd\xc9\xc9\r\n"
+"c\r\n\x57\x08\xcf\x2f\xca\x49\x01\x00\x18\x0b\x04\x1d\r\n"
+"0\r\n\r\n";
+
 static const char unauthorized[] = "Unauthorized";
 static const char hello_world[] = "Hello World";
 static const char auth_unseen[] = "Auth Unseen";
@@ -2432,6 +2482,17 @@ static DWORD CALLBACK server_thread(LPVOID param)
         {
             send(c, page1, sizeof page1 - 1, 0);
         }
+        if (strstr(buffer, "GET /gzip"))
+        {
+            ok(!!strstr(buffer, "Accept-Encoding: gzip"), "header missing from request %s\n", debugstr_a(buffer));
+            send(c, gzipmsg, sizeof gzipmsg - 1, 0);
+            continue;
+        }
+        if (strstr(buffer, "GET /deflate"))
+        {
+            send(c, deflatemsg, sizeof deflatemsg - 1, 0);
+            continue;
+        }
         if (strstr(buffer, "GET /no_content"))
         {
             send(c, nocontentmsg, sizeof nocontentmsg - 1, 0);
@@ -2755,6 +2816,83 @@ static void test_chunked_request(int port)
     WinHttpCloseHandle(ses);
 }
 
+static void test_decompression(int port)
+{
+    static const struct
+    {
+        const WCHAR *path;
+        DWORD flags;
+    }
+    tests[] =
+    {
+        { L"/gzip", WINHTTP_DECOMPRESSION_FLAG_GZIP },
+        { L"/gzip", WINHTTP_DECOMPRESSION_FLAG_ALL },
+        { L"/deflate", WINHTTP_DECOMPRESSION_FLAG_DEFLATE },
+    };
+    HINTERNET ses, con, req;
+    char buffer[0x100];
+    DWORD count, total, flags;
+    unsigned int i;
+    BOOL ret;
+
+    ses = WinHttpOpen(L"winetest", WINHTTP_ACCESS_TYPE_NO_PROXY, NULL, NULL, 0);
+    ok(ses != NULL, "failed to open session %lu\n", GetLastError());
+
+    flags = WINHTTP_DECOMPRESSION_FLAG_ALL;
+    ret = WinHttpSetOption(ses, WINHTTP_OPTION_DECOMPRESSION, &flags, sizeof(flags));
+    if (!ret)
+    {
+        win_skip("WINHTTP_OPTION_DECOMPRESSION not supported\n");
+        WinHttpCloseHandle(ses);
+        return;
+    }
+
+    con = WinHttpConnect(ses, L"localhost", port, 0);
+    ok(con != NULL, "failed to open a connection %lu\n", GetLastError());
+
+    for (i = 0; i < ARRAY_SIZE(tests); ++i)
+    {
+        req = WinHttpOpenRequest(con, NULL, tests[i].path, NULL, NULL, NULL, 0);
+        ok(req != NULL, "failed to open a request %lu\n", GetLastError());
+
+        flags = tests[i].flags;
+        ret = WinHttpSetOption(req, WINHTTP_OPTION_DECOMPRESSION, &flags, sizeof(flags));
+        ok(ret, "failed to set option %lu\n", GetLastError());
+
+        ret = WinHttpSendRequest(req, NULL, 0, NULL, 0, 0, 0);
+        ok(ret, "failed to send request %lu\n", GetLastError());
+        ret = WinHttpReceiveResponse(req, NULL);
+        ok(ret, "failed to receive response %lu\n", GetLastError());
+
+        /* read in small pieces to exercise partial output */
+        total = 0;
+        memset(buffer, 0, sizeof(buffer));
+        do
+        {
+            count = 0;
+            ret = WinHttpReadData(req, buffer + total, 4, &count);
+            ok(ret, "failed to read data %lu\n", GetLastError());
+            total += count;
+        } while (ret && count && total < sizeof(buffer) - 4);
+        ok(total == 11, "%u: got %lu bytes\n", i, total);
+        ok(!strcmp(buffer, "Hello World"), "%u: got %s\n", i, debugstr_a(buffer));
+        WinHttpCloseHandle(req);
+    }
+
+    req = WinHttpOpenRequest(con, NULL, L"/gzip", NULL, NULL, NULL, 0);
+    ok(req != NULL, "failed to open a request %lu\n", GetLastError());
+
+    flags = 0x80;
+    SetLastError(0xdeadbeef);
+    ret = WinHttpSetOption(req, WINHTTP_OPTION_DECOMPRESSION, &flags, sizeof(flags));
+    ok(!ret, "expected failure\n");
+    ok(GetLastError() == ERROR_INVALID_PARAMETER, "got %lu\n", GetLastError());
+    WinHttpCloseHandle(req);
+
+    WinHttpCloseHandle(con);
+    WinHttpCloseHandle(ses);
+}
+
 static void test_basic_authentication(int port)
 {
     HINTERNET ses, con, req;
@@ -6220,6 +6358,7 @@ START_TEST (winhttp)
     test_basic_request(si.port, NULL, L"/basic");
     test_basic_request(si.port, L"PUT", L"/test");
     test_chunked_request(si.port);
+    test_decompression(si.port);
     test_no_headers(si.port);
     test_no_content(si.port);
     test_head_request(si.port);
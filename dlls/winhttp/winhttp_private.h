@@ -45,6 +45,7 @@ struct object_header
     DWORD disable_flags;
     DWORD logon_policy;
     DWORD redirect_policy;
+    DWORD decompression;
     DWORD error;
     DWORD_PTR context;
     LONG refs;
@@ -63,7 +64,10 @@ struct hostdata
     WCHAR *hostname;
     INTERNET_PORT port;
     BOOL secure;
+    LONG session_id;               /* connections are pooled per session */
     struct list connections;
+    unsigned int open_connections;
+    CONDITION_VARIABLE cv;         /* signaled when a connection or a slot becomes available */
 };
 
 struct session
@@ -87,6 +91,8 @@ struct session
     DWORD passport_flags;
     unsigned int websocket_receive_buffer_size;
     unsigned int websocket_send_buffer_size;
+    DWORD max_conns_per_server;
+    LONG pool_id;
 };
 
 struct connect
@@ -199,6 +205,8 @@ struct request
     void *optional;
     DWORD optional_len;
     struct netconn *netconn;
+    struct hostdata *wait_host; /* host whose connections open_connection() is waiting for */
+    BOOL closing;
     DWORD security_flags;
     BOOL check_revocation;
     const CERT_CONTEXT *server_cert;
@@ -221,6 +229,7 @@ struct request
     DWORD read_pos;       /* current read position in read_buf */
     DWORD read_size;      /* valid data size in read_buf */
     char  read_buf[8192]; /* buffer for already read but not returned data */
+    struct content_decoder *decoder; /* decoder for compressed content */
     struct header *headers;
     DWORD num_headers;
     struct authinfo *authinfo;
@@ -399,6 +408,7 @@ BOOL free_handle( HINTERNET );
 
 void send_callback( struct object_header *, DWORD, LPVOID, DWORD );
 void close_connection( struct request * );
+void free_content_decoder( struct request * );
 void init_queue( struct queue *queue );
 void stop_queue( struct queue * );
 
@@ -426,6 +436,8 @@ BOOL set_server_for_hostname( struct connect *, const WCHAR *, INTERNET_PORT );
 void destroy_authinfo( struct authinfo * );
 
 void release_host( struct hostdata * );
+void release_host_connection( struct hostdata * );
+void cancel_connection_wait( struct request * );
 DWORD process_header( struct request *, const WCHAR *, const WCHAR *, DWORD, BOOL );
 
 extern HRESULT WinHttpRequest_create( void ** );
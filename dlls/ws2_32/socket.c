@@ -897,6 +897,87 @@ static BOOL WINAPI WS2_TransmitFile( SOCKET s, HANDLE file, DWORD file_len, DWOR
 }
 
 
+/***********************************************************************
+ *     TransmitPackets
+ */
+static BOOL WINAPI WS2_TransmitPackets( SOCKET s, TRANSMIT_PACKETS_ELEMENT *elements, DWORD count,
+                                        DWORD send_size, OVERLAPPED *overlapped, DWORD flags )
+{
+    struct afd_transmit_packets_params params = {0};
+    struct afd_transmit_packets_element *afd_elements;
+    IO_STATUS_BLOCK iosb, *piosb = &iosb;
+    HANDLE event = NULL;
+    void *cvalue = NULL;
+    NTSTATUS status;
+    DWORD i;
+
+    TRACE( "socket %#Ix, elements %p, count %lu, send_size %lu, overlapped %p, flags %#lx\n",
+           s, elements, count, send_size, overlapped, flags );
+
+    if (count && !elements)
+    {
+        SetLastError( WSAEINVAL );
+        return FALSE;
+    }
+
+    if (!(afd_elements = calloc( count, sizeof(*afd_elements) )))
+    {
+        SetLastError( WSAENOBUFS );
+        return FALSE;
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        afd_elements[i].flags = elements[i].dwElFlags;
+        afd_elements[i].len = elements[i].cLength;
+        if (elements[i].dwElFlags & TP_ELEMENT_FILE)
+        {
+            afd_elements[i].file = HandleToULong( elements[i].hFile );
+            afd_elements[i].offset = elements[i].nFileOffset;
+            /* an offset of -1 means the current file position */
+            if (afd_elements[i].offset.QuadPart == -1)
+                afd_elements[i].offset.QuadPart = FILE_USE_FILE_POINTER_POSITION;
+        }
+        else
+        {
+            afd_elements[i].buffer_ptr = u64_from_user_ptr(elements[i].pBuffer);
+        }
+    }
+
+    if (overlapped)
+    {
+        piosb = (IO_STATUS_BLOCK *)overlapped;
+        if (!((ULONG_PTR)overlapped->hEvent & 1)) cvalue = overlapped;
+        event = overlapped->hEvent;
+        overlapped->Internal = STATUS_PENDING;
+        overlapped->InternalHigh = 0;
+    }
+    else if (!(event = get_sync_event()))
+    {
+        free( afd_elements );
+        return FALSE;
+    }
+
+    params.elements_ptr = u64_from_user_ptr(afd_elements);
+    params.count = count;
+    params.send_size = send_size;
+    params.flags = flags;
+
+    status = NtDeviceIoControlFile( (HANDLE)s, event, NULL, cvalue, piosb,
+                                    IOCTL_AFD_WINE_TRANSMIT_PACKETS, &params, sizeof(params), NULL, 0 );
+    free( afd_elements );
+    if (status == STATUS_PENDING && !overlapped)
+    {
+        if (WaitForSingleObject( event, INFINITE ) == WAIT_FAILED)
+            return FALSE;
+        status = piosb->Status;
+    }
+    SetLastError( NtStatusToWSAError( status ) );
+    TRACE( "status %#lx.\n", status );
+    return !status;
+}
+
+
 /***********************************************************************
  *     GetAcceptExSockaddrs
  */
@@ -2514,7 +2595,7 @@ INT WINAPI WSAIoctl(SOCKET s, DWORD code, LPVOID in_buff, DWORD in_size, LPVOID
             EXTENSION_FUNCTION(WSAID_ACCEPTEX, WS2_AcceptEx)
             EXTENSION_FUNCTION(WSAID_GETACCEPTEXSOCKADDRS, WS2_GetAcceptExSockaddrs)
             EXTENSION_FUNCTION(WSAID_TRANSMITFILE, WS2_TransmitFile)
-            /* EXTENSION_FUNCTION(WSAID_TRANSMITPACKETS, WS2_TransmitPackets) */
+            EXTENSION_FUNCTION(WSAID_TRANSMITPACKETS, WS2_TransmitPackets)
             EXTENSION_FUNCTION(WSAID_WSARECVMSG, WS2_WSARecvMsg)
             EXTENSION_FUNCTION(WSAID_WSASENDMSG, WSASendMsg)
         };
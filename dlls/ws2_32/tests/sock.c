@@ -10050,6 +10050,80 @@ static void test_TransmitFile(void)
     closesocket(server);
 }
 
+static void test_TransmitPackets(void)
+{
+    GUID transmitPacketsGuid = WSAID_TRANSMITPACKETS;
+    LPFN_TRANSMITPACKETS pTransmitPackets = NULL;
+    TRANSMIT_PACKETS_ELEMENT elements[3];
+    char header_msg[] = "hello world";
+    char footer_msg[] = "goodbye!!!";
+    char system_ini_path[MAX_PATH];
+    DWORD num_bytes, file_size;
+    SOCKET client, server;
+    WSAOVERLAPPED ov;
+    char buf[256];
+    HANDLE file;
+    int iret;
+    BOOL bret;
+
+    tcp_socketpair(&client, &server);
+    iret = WSAIoctl(client, SIO_GET_EXTENSION_FUNCTION_POINTER, &transmitPacketsGuid, sizeof(transmitPacketsGuid),
+                    &pTransmitPackets, sizeof(pTransmitPackets), &num_bytes, NULL, NULL);
+    ok(!iret, "failed to get TransmitPackets, error %u\n", WSAGetLastError());
+    iret = set_blocking(server, FALSE);
+    ok(!iret, "failed to set nonblocking, error %u\n", WSAGetLastError());
+
+    GetSystemWindowsDirectoryA(system_ini_path, MAX_PATH);
+    strcat(system_ini_path, "\\system.ini");
+    file = CreateFileA(system_ini_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_ALWAYS, 0, NULL);
+    ok(file != INVALID_HANDLE_VALUE, "failed to open file, error %lu\n", GetLastError());
+    file_size = GetFileSize(file, NULL);
+
+    bret = pTransmitPackets(client, NULL, 0, 0, NULL, 0);
+    ok(bret, "TransmitPackets failed, error %u\n", WSAGetLastError());
+    iret = recv(server, buf, sizeof(buf), 0);
+    ok(iret == -1, "got %d\n", iret);
+
+    memset(elements, 0, sizeof(elements));
+    elements[0].dwElFlags = TP_ELEMENT_MEMORY;
+    elements[0].cLength = sizeof(header_msg);
+    elements[0].pBuffer = header_msg;
+    elements[1].dwElFlags = TP_ELEMENT_FILE;
+    elements[1].hFile = file;
+    elements[2].dwElFlags = TP_ELEMENT_MEMORY | TP_ELEMENT_EOP;
+    elements[2].cLength = sizeof(footer_msg);
+    elements[2].pBuffer = footer_msg;
+    bret = pTransmitPackets(client, elements, 3, 0, NULL, 0);
+    ok(bret, "TransmitPackets failed, error %u\n", WSAGetLastError());
+    iret = recv(server, buf, sizeof(header_msg), 0);
+    ok(iret == sizeof(header_msg), "got %d\n", iret);
+    ok(!memcmp(buf, header_msg, sizeof(header_msg)), "header did not match\n");
+    compare_file(file, server, 0);
+    iret = recv(server, buf, sizeof(footer_msg), 0);
+    ok(iret == sizeof(footer_msg), "got %d\n", iret);
+    ok(!memcmp(buf, footer_msg, sizeof(footer_msg)), "footer did not match\n");
+
+    /* file element with an offset and a length */
+    memset(&ov, 0, sizeof(ov));
+    ov.hEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+    elements[1].nFileOffset.QuadPart = 10;
+    elements[1].cLength = file_size - 10;
+    bret = pTransmitPackets(client, &elements[1], 1, 0, &ov, 0);
+    ok(!bret, "TransmitPackets succeeded\n");
+    ok(WSAGetLastError() == ERROR_IO_PENDING, "got error %u\n", WSAGetLastError());
+    iret = WaitForSingleObject(ov.hEvent, 2000);
+    ok(!iret, "wait timed out\n");
+    bret = WSAGetOverlappedResult(client, &ov, &num_bytes, FALSE, NULL);
+    ok(bret, "got error %u\n", WSAGetLastError());
+    ok(num_bytes == file_size - 10, "expected %lu bytes, got %lu\n", file_size - 10, num_bytes);
+    compare_file(file, server, 10);
+
+    CloseHandle(ov.hEvent);
+    CloseHandle(file);
+    closesocket(client);
+    closesocket(server);
+}
+
 static void test_getpeername(void)
 {
     SOCKET sock;
@@ -14305,6 +14379,7 @@ START_TEST( sock )
 
     test_ipv6only();
     test_TransmitFile();
+    test_TransmitPackets();
     test_AcceptEx();
     test_connect();
     test_shutdown();
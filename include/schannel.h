@@ -343,4 +343,13 @@ typedef struct _SecPkgContext_CipherInfo
     DWORD dwKeyType;
 } SecPkgContext_CipherInfo, *PSecPkgContext_CipherInfo;
 
+#define SSL_SESSION_RECONNECT 1
+
+typedef struct _SecPkgContext_SessionInfo
+{
+    DWORD dwFlags;
+    DWORD cbSessionId;
+    BYTE rgbSessionId[32];
+} SecPkgContext_SessionInfo, *PSecPkgContext_SessionInfo;
+
 #endif /* __WINE_SCHANNEL_H__ */
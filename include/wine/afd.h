@@ -291,6 +291,7 @@ C_ASSERT( sizeof(struct afd_get_events_params) == 56 );
 #define IOCTL_AFD_WINE_SET_TCP_KEEPCNT                  WINE_AFD_IOC(302)
 #define IOCTL_AFD_WINE_GET_TCP_KEEPINTVL                WINE_AFD_IOC(303)
 #define IOCTL_AFD_WINE_SET_TCP_KEEPINTVL                WINE_AFD_IOC(304)
+#define IOCTL_AFD_WINE_TRANSMIT_PACKETS                 WINE_AFD_IOC(305)
 
 struct afd_iovec
 {
@@ -358,6 +359,27 @@ struct afd_transmit_params
 };
 C_ASSERT( sizeof(struct afd_transmit_params) == 48 );
 
+struct afd_transmit_packets_element
+{
+    LARGE_INTEGER offset;
+    ULONGLONG buffer_ptr;
+    ULONG file;
+    DWORD len;
+    DWORD flags;
+    DWORD padding;
+};
+C_ASSERT( sizeof(struct afd_transmit_packets_element) == 32 );
+
+struct afd_transmit_packets_params
+{
+    ULONGLONG elements_ptr; /* const struct afd_transmit_packets_element[] */
+    DWORD count;
+    DWORD send_size;
+    DWORD flags;
+    DWORD padding;
+};
+C_ASSERT( sizeof(struct afd_transmit_packets_params) == 24 );
+
 struct afd_message_select_params
 {
     ULONG handle;
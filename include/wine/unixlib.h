@@ -35,6 +35,7 @@ extern DECLSPEC_EXPORT const unixlib_entry_t __wine_unix_call_wow64_funcs[];
 /* some useful helpers from ntdll */
 NTSYSAPI const char *ntdll_get_build_dir(void);
 NTSYSAPI const char *ntdll_get_data_dir(void);
+NTSYSAPI const char *ntdll_get_config_dir(void);
 NTSYSAPI DWORD ntdll_umbstowcs( const char *src, DWORD srclen, WCHAR *dst, DWORD dstlen );
 NTSYSAPI int ntdll_wcstoumbs( const WCHAR *src, DWORD srclen, char *dst, DWORD dstlen, BOOL strict );
 NTSYSAPI int ntdll_wcsicmp( const WCHAR *str1, const WCHAR *str2 );
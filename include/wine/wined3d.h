@@ -2719,6 +2719,11 @@ ULONG __cdecl wined3d_sampler_decref(struct wined3d_sampler *sampler);
 void * __cdecl wined3d_sampler_get_parent(const struct wined3d_sampler *sampler);
 ULONG __cdecl wined3d_sampler_incref(struct wined3d_sampler *sampler);
 
+BOOL __cdecl wined3d_shader_cache_enabled(void);
+void __cdecl wined3d_shader_cache_free(void *data);
+BOOL __cdecl wined3d_shader_cache_get(const char *name, const void *key, SIZE_T key_size, void **data, SIZE_T *size);
+void __cdecl wined3d_shader_cache_put(const char *name, const void *key, SIZE_T key_size,
+        const void *data, SIZE_T size);
 HRESULT __cdecl wined3d_shader_create_cs(struct wined3d_device *device, const struct wined3d_shader_desc *desc,
         void *parent, const struct wined3d_parent_ops *parent_ops, struct wined3d_shader **shader);
 HRESULT __cdecl wined3d_shader_create_ds(struct wined3d_device *device, const struct wined3d_shader_desc *desc,
@@ -1325,13 +1325,13 @@ struct hlsl_ir_node *hlsl_new_store_index(struct hlsl_ctx *ctx, const struct hls
     assert(lhs);
     assert(!hlsl_deref_is_lowered(lhs));
 
-    if (!(store = hlsl_alloc(ctx, sizeof(*store))))
+    if (!(store = hlsl_alloc_node(ctx, sizeof(*store))))
         return NULL;
     init_node(&store->node, HLSL_IR_STORE, NULL, loc);
 
     if (!init_deref(ctx, &store->lhs, lhs->var, lhs->path_len + !!idx))
     {
-        vkd3d_free(store);
+        hlsl_free_node(store);
         return NULL;
     }
     for (i = 0; i < lhs->path_len; ++i)
@@ -1356,13 +1356,13 @@ bool hlsl_new_store_component(struct hlsl_ctx *ctx, struct hlsl_block *block,
 
     hlsl_block_init(block);
 
-    if (!(store = hlsl_alloc(ctx, sizeof(*store))))
+    if (!(store = hlsl_alloc_node(ctx, sizeof(*store))))
         return false;
     init_node(&store->node, HLSL_IR_STORE, NULL, &rhs->loc);
 
     if (!init_deref_from_component_index(ctx, &comp_path_block, &store->lhs, lhs, comp, &rhs->loc))
     {
-        vkd3d_free(store);
+        hlsl_free_node(store);
         return false;
     }
     hlsl_block_add_block(block, &comp_path_block);
@@ -1381,7 +1381,7 @@ struct hlsl_ir_node *hlsl_new_call(struct hlsl_ctx *ctx, struct hlsl_ir_function
 {
     struct hlsl_ir_call *call;
 
-    if (!(call = hlsl_alloc(ctx, sizeof(*call))))
+    if (!(call = hlsl_alloc_node(ctx, sizeof(*call))))
         return NULL;
 
     init_node(&call->node, HLSL_IR_CALL, NULL, loc);
@@ -1396,7 +1396,7 @@ struct hlsl_ir_node *hlsl_new_constant(struct hlsl_ctx *ctx, struct hlsl_type *t
 
     assert(type->class <= HLSL_CLASS_VECTOR);
 
-    if (!(c = hlsl_alloc(ctx, sizeof(*c))))
+    if (!(c = hlsl_alloc_node(ctx, sizeof(*c))))
         return NULL;
 
     init_node(&c->node, HLSL_IR_CONSTANT, type, loc);
@@ -1446,7 +1446,7 @@ struct hlsl_ir_node *hlsl_new_expr(struct hlsl_ctx *ctx, enum hlsl_ir_expr_op op
     struct hlsl_ir_expr *expr;
     unsigned int i;
 
-    if (!(expr = hlsl_alloc(ctx, sizeof(*expr))))
+    if (!(expr = hlsl_alloc_node(ctx, sizeof(*expr))))
         return NULL;
     init_node(&expr->node, HLSL_IR_EXPR, data_type, loc);
     expr->op = op;
@@ -1487,7 +1487,7 @@ struct hlsl_ir_node *hlsl_new_if(struct hlsl_ctx *ctx, struct hlsl_ir_node *cond
 {
     struct hlsl_ir_if *iff;
 
-    if (!(iff = hlsl_alloc(ctx, sizeof(*iff))))
+    if (!(iff = hlsl_alloc_node(ctx, sizeof(*iff))))
         return NULL;
     init_node(&iff->node, HLSL_IR_IF, NULL, loc);
     hlsl_src_from_node(&iff->condition, condition);
@@ -1522,7 +1522,7 @@ struct hlsl_ir_node *hlsl_new_switch(struct hlsl_ctx *ctx, struct hlsl_ir_node *
 {
     struct hlsl_ir_switch *s;
 
-    if (!(s = hlsl_alloc(ctx, sizeof(*s))))
+    if (!(s = hlsl_alloc_node(ctx, sizeof(*s))))
         return NULL;
     init_node(&s->node, HLSL_IR_SWITCH, NULL, loc);
     hlsl_src_from_node(&s->selector, selector);
@@ -1546,13 +1546,13 @@ struct hlsl_ir_load *hlsl_new_load_index(struct hlsl_ctx *ctx, const struct hlsl
     if (idx)
         type = hlsl_get_element_type_from_path_index(ctx, type, idx);
 
-    if (!(load = hlsl_alloc(ctx, sizeof(*load))))
+    if (!(load = hlsl_alloc_node(ctx, sizeof(*load))))
         return NULL;
     init_node(&load->node, HLSL_IR_LOAD, type, loc);
 
     if (!init_deref(ctx, &load->src, deref->var, deref->path_len + !!idx))
     {
-        vkd3d_free(load);
+        hlsl_free_node(load);
         return NULL;
     }
     for (i = 0; i < deref->path_len; ++i)
@@ -1594,7 +1594,7 @@ struct hlsl_ir_node *hlsl_new_load_component(struct hlsl_ctx *ctx, struct hlsl_b
 
     hlsl_block_init(block);
 
-    if (!(load = hlsl_alloc(ctx, sizeof(*load))))
+    if (!(load = hlsl_alloc_node(ctx, sizeof(*load))))
         return NULL;
 
     type = hlsl_deref_get_type(ctx, deref);
@@ -1603,7 +1603,7 @@ struct hlsl_ir_node *hlsl_new_load_component(struct hlsl_ctx *ctx, struct hlsl_b
 
     if (!init_deref_from_component_index(ctx, &comp_path_block, &load->src, deref, comp, loc))
     {
-        vkd3d_free(load);
+        hlsl_free_node(load);
         return NULL;
     }
     hlsl_block_add_block(block, &comp_path_block);
@@ -1618,14 +1618,14 @@ struct hlsl_ir_node *hlsl_new_resource_load(struct hlsl_ctx *ctx,
 {
     struct hlsl_ir_resource_load *load;
 
-    if (!(load = hlsl_alloc(ctx, sizeof(*load))))
+    if (!(load = hlsl_alloc_node(ctx, sizeof(*load))))
         return NULL;
     init_node(&load->node, HLSL_IR_RESOURCE_LOAD, params->format, loc);
     load->load_type = params->type;
 
     if (!hlsl_init_deref_from_index_chain(ctx, &load->resource, params->resource))
     {
-        vkd3d_free(load);
+        hlsl_free_node(load);
         return NULL;
     }
 
@@ -1634,7 +1634,7 @@ struct hlsl_ir_node *hlsl_new_resource_load(struct hlsl_ctx *ctx,
         if (!hlsl_init_deref_from_index_chain(ctx, &load->sampler, params->sampler))
         {
             hlsl_cleanup_deref(&load->resource);
-            vkd3d_free(load);
+            hlsl_free_node(load);
             return NULL;
         }
     }
@@ -1657,7 +1657,7 @@ struct hlsl_ir_node *hlsl_new_resource_store(struct hlsl_ctx *ctx, const struct
 {
     struct hlsl_ir_resource_store *store;
 
-    if (!(store = hlsl_alloc(ctx, sizeof(*store))))
+    if (!(store = hlsl_alloc_node(ctx, sizeof(*store))))
         return NULL;
     init_node(&store->node, HLSL_IR_RESOURCE_STORE, NULL, loc);
     hlsl_copy_deref(ctx, &store->resource, resource);
@@ -1672,7 +1672,7 @@ struct hlsl_ir_node *hlsl_new_swizzle(struct hlsl_ctx *ctx, uint32_t s, unsigned
     struct hlsl_ir_swizzle *swizzle;
     struct hlsl_type *type;
 
-    if (!(swizzle = hlsl_alloc(ctx, sizeof(*swizzle))))
+    if (!(swizzle = hlsl_alloc_node(ctx, sizeof(*swizzle))))
         return NULL;
     assert(hlsl_is_numeric_type(val->data_type));
     if (components == 1)
@@ -1691,14 +1691,14 @@ struct hlsl_ir_node *hlsl_new_stateblock_constant(struct hlsl_ctx *ctx, const ch
     struct hlsl_ir_stateblock_constant *constant;
     struct hlsl_type *type = hlsl_get_scalar_type(ctx, HLSL_TYPE_INT);
 
-    if (!(constant = hlsl_alloc(ctx, sizeof(*constant))))
+    if (!(constant = hlsl_alloc_node(ctx, sizeof(*constant))))
         return NULL;
 
     init_node(&constant->node, HLSL_IR_STATEBLOCK_CONSTANT, type, loc);
 
     if (!(constant->name = hlsl_alloc(ctx, strlen(name) + 1)))
     {
-        vkd3d_free(constant);
+        hlsl_free_node(constant);
         return NULL;
     }
     strcpy(constant->name, name);
@@ -1735,7 +1735,7 @@ struct hlsl_ir_node *hlsl_new_index(struct hlsl_ctx *ctx, struct hlsl_ir_node *v
     struct hlsl_type *type = val->data_type;
     struct hlsl_ir_index *index;
 
-    if (!(index = hlsl_alloc(ctx, sizeof(*index))))
+    if (!(index = hlsl_alloc_node(ctx, sizeof(*index))))
         return NULL;
 
     if (type->class == HLSL_CLASS_TEXTURE || type->class == HLSL_CLASS_UAV)
@@ -1756,7 +1756,7 @@ struct hlsl_ir_node *hlsl_new_jump(struct hlsl_ctx *ctx, enum hlsl_ir_jump_type
 {
     struct hlsl_ir_jump *jump;
 
-    if (!(jump = hlsl_alloc(ctx, sizeof(*jump))))
+    if (!(jump = hlsl_alloc_node(ctx, sizeof(*jump))))
         return NULL;
     init_node(&jump->node, HLSL_IR_JUMP, NULL, loc);
     jump->type = type;
@@ -1769,7 +1769,7 @@ struct hlsl_ir_node *hlsl_new_loop(struct hlsl_ctx *ctx,
 {
     struct hlsl_ir_loop *loop;
 
-    if (!(loop = hlsl_alloc(ctx, sizeof(*loop))))
+    if (!(loop = hlsl_alloc_node(ctx, sizeof(*loop))))
         return NULL;
     init_node(&loop->node, HLSL_IR_LOOP, NULL, loc);
     hlsl_block_init(&loop->body);
@@ -1915,13 +1915,13 @@ static struct hlsl_ir_node *clone_load(struct hlsl_ctx *ctx, struct clone_instr_
 {
     struct hlsl_ir_load *dst;
 
-    if (!(dst = hlsl_alloc(ctx, sizeof(*dst))))
+    if (!(dst = hlsl_alloc_node(ctx, sizeof(*dst))))
         return NULL;
     init_node(&dst->node, HLSL_IR_LOAD, src->node.data_type, &src->node.loc);
 
     if (!clone_deref(ctx, map, &dst->src, &src->src))
     {
-        vkd3d_free(dst);
+        hlsl_free_node(dst);
         return NULL;
     }
     return &dst->node;
@@ -1948,19 +1948,19 @@ static struct hlsl_ir_node *clone_resource_load(struct hlsl_ctx *ctx,
 {
     struct hlsl_ir_resource_load *dst;
 
-    if (!(dst = hlsl_alloc(ctx, sizeof(*dst))))
+    if (!(dst = hlsl_alloc_node(ctx, sizeof(*dst))))
         return NULL;
     init_node(&dst->node, HLSL_IR_RESOURCE_LOAD, src->node.data_type, &src->node.loc);
     dst->load_type = src->load_type;
     if (!clone_deref(ctx, map, &dst->resource, &src->resource))
     {
-        vkd3d_free(dst);
+        hlsl_free_node(dst);
         return NULL;
     }
     if (!clone_deref(ctx, map, &dst->sampler, &src->sampler))
     {
         hlsl_cleanup_deref(&dst->resource);
-        vkd3d_free(dst);
+        hlsl_free_node(dst);
         return NULL;
     }
     clone_src(map, &dst->coords, &src->coords);
@@ -1979,12 +1979,12 @@ static struct hlsl_ir_node *clone_resource_store(struct hlsl_ctx *ctx,
 {
     struct hlsl_ir_resource_store *dst;
 
-    if (!(dst = hlsl_alloc(ctx, sizeof(*dst))))
+    if (!(dst = hlsl_alloc_node(ctx, sizeof(*dst))))
         return NULL;
     init_node(&dst->node, HLSL_IR_RESOURCE_STORE, NULL, &src->node.loc);
     if (!clone_deref(ctx, map, &dst->resource, &src->resource))
     {
-        vkd3d_free(dst);
+        hlsl_free_node(dst);
         return NULL;
     }
     clone_src(map, &dst->coords, &src->coords);
@@ -1996,13 +1996,13 @@ static struct hlsl_ir_node *clone_store(struct hlsl_ctx *ctx, struct clone_instr
 {
     struct hlsl_ir_store *dst;
 
-    if (!(dst = hlsl_alloc(ctx, sizeof(*dst))))
+    if (!(dst = hlsl_alloc_node(ctx, sizeof(*dst))))
         return NULL;
     init_node(&dst->node, HLSL_IR_STORE, NULL, &src->node.loc);
 
     if (!clone_deref(ctx, map, &dst->lhs, &src->lhs))
     {
-        vkd3d_free(dst);
+        hlsl_free_node(dst);
         return NULL;
     }
     clone_src(map, &dst->rhs, &src->rhs);
@@ -3123,6 +3123,106 @@ void hlsl_free_type(struct hlsl_type *type)
     vkd3d_free(type);
 }
 
+#define HLSL_NODE_CHUNK_SIZE (64 * 1024)
+#define HLSL_NODE_ALIGNMENT 16
+
+struct hlsl_node_chunk
+{
+    struct hlsl_node_chunk *next;
+};
+
+struct hlsl_node_header
+{
+    struct hlsl_node_arena *arena;
+    union
+    {
+        size_t size_class;
+        struct hlsl_node_header *next_free;
+    } u;
+};
+
+#define HLSL_NODE_CHUNK_HEADER_SIZE align(sizeof(struct hlsl_node_chunk), HLSL_NODE_ALIGNMENT)
+#define HLSL_NODE_HEADER_SIZE align(sizeof(struct hlsl_node_header), HLSL_NODE_ALIGNMENT)
+
+void *hlsl_alloc_node(struct hlsl_ctx *ctx, size_t size)
+{
+    size_t size_class = (size + HLSL_NODE_ALIGNMENT - 1) / HLSL_NODE_ALIGNMENT, alloc_size;
+    struct hlsl_node_arena *arena = &ctx->node_arena;
+    struct hlsl_node_header *header;
+    struct hlsl_node_chunk *chunk;
+
+    /* Unusually large nodes get their own allocation. */
+    if (size_class >= HLSL_NODE_SIZE_CLASS_COUNT)
+    {
+        if (!(header = hlsl_alloc(ctx, HLSL_NODE_HEADER_SIZE + size)))
+            return NULL;
+        header->arena = NULL;
+        return (char *)header + HLSL_NODE_HEADER_SIZE;
+    }
+
+    if ((header = arena->free_lists[size_class]))
+    {
+        arena->free_lists[size_class] = header->u.next_free;
+    }
+    else
+    {
+        alloc_size = HLSL_NODE_HEADER_SIZE + size_class * HLSL_NODE_ALIGNMENT;
+        if (alloc_size > arena->remaining)
+        {
+            if (!(chunk = vkd3d_malloc(HLSL_NODE_CHUNK_SIZE)))
+            {
+                ctx->result = VKD3D_ERROR_OUT_OF_MEMORY;
+                return NULL;
+            }
+            chunk->next = arena->chunks;
+            arena->chunks = chunk;
+            arena->ptr = (char *)chunk + HLSL_NODE_CHUNK_HEADER_SIZE;
+            arena->remaining = HLSL_NODE_CHUNK_SIZE - HLSL_NODE_CHUNK_HEADER_SIZE;
+        }
+        header = (struct hlsl_node_header *)arena->ptr;
+        arena->ptr += alloc_size;
+        arena->remaining -= alloc_size;
+    }
+
+    header->arena = arena;
+    header->u.size_class = size_class;
+    memset((char *)header + HLSL_NODE_HEADER_SIZE, 0, size_class * HLSL_NODE_ALIGNMENT);
+    return (char *)header + HLSL_NODE_HEADER_SIZE;
+}
+
+void hlsl_free_node(void *node)
+{
+    struct hlsl_node_header *header;
+    struct hlsl_node_arena *arena;
+    size_t size_class;
+
+    if (!node)
+        return;
+
+    header = (struct hlsl_node_header *)((char *)node - HLSL_NODE_HEADER_SIZE);
+    if (!(arena = header->arena))
+    {
+        vkd3d_free(header);
+        return;
+    }
+
+    size_class = header->u.size_class;
+    header->u.next_free = arena->free_lists[size_class];
+    arena->free_lists[size_class] = header;
+}
+
+static void hlsl_node_arena_cleanup(struct hlsl_node_arena *arena)
+{
+    struct hlsl_node_chunk *chunk, *next;
+
+    for (chunk = arena->chunks; chunk; chunk = next)
+    {
+        next = chunk->next;
+        vkd3d_free(chunk);
+    }
+    memset(arena, 0, sizeof(*arena));
+}
+
 void hlsl_free_instr_list(struct list *list)
 {
     struct hlsl_ir_node *node, *next_node;
@@ -3142,12 +3242,12 @@ void hlsl_block_cleanup(struct hlsl_block *block)
 
 static void free_ir_call(struct hlsl_ir_call *call)
 {
-    vkd3d_free(call);
+    hlsl_free_node(call);
 }
 
 static void free_ir_constant(struct hlsl_ir_constant *constant)
 {
-    vkd3d_free(constant);
+    hlsl_free_node(constant);
 }
 
 static void free_ir_expr(struct hlsl_ir_expr *expr)
@@ -3156,7 +3256,7 @@ static void free_ir_expr(struct hlsl_ir_expr *expr)
 
     for (i = 0; i < ARRAY_SIZE(expr->operands); ++i)
         hlsl_src_remove(&expr->operands[i]);
-    vkd3d_free(expr);
+    hlsl_free_node(expr);
 }
 
 static void free_ir_if(struct hlsl_ir_if *if_node)
@@ -3164,25 +3264,25 @@ static void free_ir_if(struct hlsl_ir_if *if_node)
     hlsl_block_cleanup(&if_node->then_block);
     hlsl_block_cleanup(&if_node->else_block);
     hlsl_src_remove(&if_node->condition);
-    vkd3d_free(if_node);
+    hlsl_free_node(if_node);
 }
 
 static void free_ir_jump(struct hlsl_ir_jump *jump)
 {
     hlsl_src_remove(&jump->condition);
-    vkd3d_free(jump);
+    hlsl_free_node(jump);
 }
 
 static void free_ir_load(struct hlsl_ir_load *load)
 {
     hlsl_cleanup_deref(&load->src);
-    vkd3d_free(load);
+    hlsl_free_node(load);
 }
 
 static void free_ir_loop(struct hlsl_ir_loop *loop)
 {
     hlsl_block_cleanup(&loop->body);
-    vkd3d_free(loop);
+    hlsl_free_node(loop);
 }
 
 static void free_ir_resource_load(struct hlsl_ir_resource_load *load)
@@ -3196,7 +3296,7 @@ static void free_ir_resource_load(struct hlsl_ir_resource_load *load)
     hlsl_src_remove(&load->cmp);
     hlsl_src_remove(&load->texel_offset);
     hlsl_src_remove(&load->sample_index);
-    vkd3d_free(load);
+    hlsl_free_node(load);
 }
 
 static void free_ir_resource_store(struct hlsl_ir_resource_store *store)
@@ -3204,20 +3304,20 @@ static void free_ir_resource_store(struct hlsl_ir_resource_store *store)
     hlsl_cleanup_deref(&store->resource);
     hlsl_src_remove(&store->coords);
     hlsl_src_remove(&store->value);
-    vkd3d_free(store);
+    hlsl_free_node(store);
 }
 
 static void free_ir_store(struct hlsl_ir_store *store)
 {
     hlsl_src_remove(&store->rhs);
     hlsl_cleanup_deref(&store->lhs);
-    vkd3d_free(store);
+    hlsl_free_node(store);
 }
 
 static void free_ir_swizzle(struct hlsl_ir_swizzle *swizzle)
 {
     hlsl_src_remove(&swizzle->val);
-    vkd3d_free(swizzle);
+    hlsl_free_node(swizzle);
 }
 
 static void free_ir_switch(struct hlsl_ir_switch *s)
@@ -3225,20 +3325,20 @@ static void free_ir_switch(struct hlsl_ir_switch *s)
     hlsl_src_remove(&s->selector);
     hlsl_cleanup_ir_switch_cases(&s->cases);
 
-    vkd3d_free(s);
+    hlsl_free_node(s);
 }
 
 static void free_ir_index(struct hlsl_ir_index *index)
 {
     hlsl_src_remove(&index->val);
     hlsl_src_remove(&index->idx);
-    vkd3d_free(index);
+    hlsl_free_node(index);
 }
 
 static void free_ir_stateblock_constant(struct hlsl_ir_stateblock_constant *constant)
 {
     vkd3d_free(constant->name);
-    vkd3d_free(constant);
+    hlsl_free_node(constant);
 }
 
 void hlsl_free_instr(struct hlsl_ir_node *node)
@@ -3878,6 +3978,8 @@ static void hlsl_ctx_cleanup(struct hlsl_ctx *ctx)
     }
 
     vkd3d_free(ctx->constant_defs.regs);
+
+    hlsl_node_arena_cleanup(&ctx->node_arena);
 }
 
 int hlsl_compile_shader(const struct vkd3d_shader_code *hlsl, const struct vkd3d_shader_compile_info *compile_info,
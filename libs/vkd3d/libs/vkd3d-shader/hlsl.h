@@ -863,6 +863,19 @@ struct hlsl_buffer
     bool automatically_packed_elements;
 };
 
+#define HLSL_NODE_SIZE_CLASS_COUNT 64
+
+/* IR nodes are allocated from large chunks owned by the compilation context.
+ * Freed nodes are kept on per-size free lists and reused; the chunks are only
+ * released when the context is destroyed. */
+struct hlsl_node_arena
+{
+    struct hlsl_node_chunk *chunks;
+    char *ptr;
+    size_t remaining;
+    struct hlsl_node_header *free_lists[HLSL_NODE_SIZE_CLASS_COUNT];
+};
+
 struct hlsl_ctx
 {
     const struct hlsl_profile_info *profile;
@@ -971,6 +984,8 @@ struct hlsl_ctx
     bool child_effect;
     bool include_empty_buffers;
     bool warn_implicit_truncation;
+
+    struct hlsl_node_arena node_arena;
 };
 
 static inline bool hlsl_version_ge(const struct hlsl_ctx *ctx, unsigned int major, unsigned int minor)
@@ -1266,9 +1281,11 @@ void hlsl_free_ir_switch_case(struct hlsl_ir_switch_case *c);
 
 void hlsl_replace_node(struct hlsl_ir_node *old, struct hlsl_ir_node *new);
 
+void *hlsl_alloc_node(struct hlsl_ctx *ctx, size_t size);
 void hlsl_free_attribute(struct hlsl_attribute *attr);
 void hlsl_free_instr(struct hlsl_ir_node *node);
 void hlsl_free_instr_list(struct list *list);
+void hlsl_free_node(void *node);
 void hlsl_free_state_block(struct hlsl_state_block *state_block);
 void hlsl_free_type(struct hlsl_type *type);
 void hlsl_free_var(struct hlsl_ir_var *decl);
@@ -5408,6 +5408,19 @@ static void remove_unreachable_code(struct hlsl_ctx *ctx, struct hlsl_block *bod
     }
 }
 
+/* The local folding passes are fused into a single walk over the program.
+ * Each of them may replace and free the instruction, so stop at the first one
+ * which makes progress; the caller repeats the walk until nothing changes. */
+static bool fold_local_constants(struct hlsl_ctx *ctx, struct hlsl_ir_node *instr, void *context)
+{
+    return hlsl_fold_constant_exprs(ctx, instr, context)
+            || hlsl_fold_constant_identities(ctx, instr, context)
+            || hlsl_fold_constant_swizzles(ctx, instr, context)
+            || fold_swizzle_chains(ctx, instr, context)
+            || remove_trivial_swizzles(ctx, instr, context)
+            || remove_trivial_conditional_branches(ctx, instr, context);
+}
+
 void hlsl_run_const_passes(struct hlsl_ctx *ctx, struct hlsl_block *body)
 {
     bool progress;
@@ -5436,13 +5449,8 @@ void hlsl_run_const_passes(struct hlsl_ctx *ctx, struct hlsl_block *body)
 
     do
     {
-        progress = hlsl_transform_ir(ctx, hlsl_fold_constant_exprs, body, NULL);
-        progress |= hlsl_transform_ir(ctx, hlsl_fold_constant_identities, body, NULL);
-        progress |= hlsl_transform_ir(ctx, hlsl_fold_constant_swizzles, body, NULL);
+        progress = hlsl_transform_ir(ctx, fold_local_constants, body, NULL);
         progress |= hlsl_copy_propagation_execute(ctx, body);
-        progress |= hlsl_transform_ir(ctx, fold_swizzle_chains, body, NULL);
-        progress |= hlsl_transform_ir(ctx, remove_trivial_swizzles, body, NULL);
-        progress |= hlsl_transform_ir(ctx, remove_trivial_conditional_branches, body, NULL);
     } while (progress);
 }
 